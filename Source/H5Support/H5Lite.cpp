@@ -219,6 +219,72 @@ herr_t H5Lite::findAttribute(hid_t loc_id, const std::string& attrName)
   return ret;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+hid_t H5Lite::createChunkCacheAccessPlist(hid_t loc_id, const std::string& dsetName, size_t cacheBytes)
+{
+  H5SUPPORT_MUTEX_LOCK()
+
+  if(cacheBytes == 0)
+  {
+    return H5P_DEFAULT;
+  }
+  hid_t did = H5Dopen(loc_id, dsetName.c_str(), H5P_DEFAULT);
+  if(did < 0)
+  {
+    return H5P_DEFAULT;
+  }
+
+  size_t chunkBytes = 0;
+  hid_t dcpl = H5Dget_create_plist(did);
+  if(dcpl >= 0 && H5Pget_layout(dcpl) == H5D_CHUNKED)
+  {
+    int rank = H5Pget_chunk(dcpl, 0, nullptr);
+    if(rank > 0)
+    {
+      std::vector<hsize_t> chunkDims(rank, 0);
+      H5Pget_chunk(dcpl, rank, chunkDims.data());
+      hid_t tid = H5Dget_type(did);
+      chunkBytes = H5Tget_size(tid);
+      H5Tclose(tid);
+      for(int i = 0; i < rank; i++)
+      {
+        chunkBytes *= static_cast<size_t>(chunkDims[i]);
+      }
+    }
+  }
+  if(dcpl >= 0)
+  {
+    H5Pclose(dcpl);
+  }
+  H5Dclose(did);
+  if(chunkBytes == 0)
+  {
+    return H5P_DEFAULT;
+  }
+
+  size_t chunksInCache = cacheBytes / chunkBytes;
+  if(chunksInCache < 1)
+  {
+    chunksInCache = 1;
+  }
+  // An odd slot count spreads the chunk indices better over the hash table
+  size_t numSlots = chunksInCache * 100 + 1;
+
+  hid_t dapl = H5Pcreate(H5P_DATASET_ACCESS);
+  if(dapl < 0)
+  {
+    return H5P_DEFAULT;
+  }
+  if(H5Pset_chunk_cache(dapl, numSlots, cacheBytes, H5D_CHUNK_CACHE_W0_DEFAULT) < 0)
+  {
+    H5Pclose(dapl);
+    return H5P_DEFAULT;
+  }
+  return dapl;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -1151,6 +1151,127 @@ namespace H5Support_NAMESPACE
         return retErr;
       }
 
+      /**
+       * @brief Creates a dataset access property list whose raw data chunk cache holds
+       * cacheBytes bytes. The number of hash slots is sized for about 100 times the
+       * number of chunks of the dataset that fit into the cache, as the HDF5 documentation
+       * recommends. Contiguous datasets and a cacheBytes of 0 get H5P_DEFAULT.
+       * @param loc_id The parent location that contains the dataset
+       * @param dsetName The name of the dataset
+       * @param cacheBytes The size of the chunk cache in bytes
+       * @return The property list, which the caller closes unless it is H5P_DEFAULT
+       */
+      static H5Support_EXPORT hid_t createChunkCacheAccessPlist(hid_t loc_id, const std::string& dsetName, size_t cacheBytes);
+
+      /**
+       * @brief Reads a hyperslab of a dataset into a preallocated array. The selected
+       * elements are stored contiguously in the order HDF5 iterates them, last dimension
+       * fastest. Empty offset and count vectors select the whole dataset; an empty stride
+       * means a stride of 1 in every dimension.
+       * @param loc_id The parent location that contains the dataset to read
+       * @param dsetName The name of the dataset to read
+       * @param offset The first element to read in each dimension
+       * @param count The number of elements to read in each dimension
+       * @param stride The step between elements in each dimension
+       * @param chunkCacheBytes The chunk cache size used for chunked datasets, 0 for the HDF5 default
+       * @param data A Pointer to the PreAllocated Array of Data, large enough for the selection
+       * @return Standard HDF error condition
+       */
+      template <typename T>
+      static herr_t readPointerDatasetHyperslab(hid_t loc_id,
+                                                const std::string& dsetName,
+                                                const std::vector<hsize_t>& offset,
+                                                const std::vector<hsize_t>& count,
+                                                const std::vector<hsize_t>& stride,
+                                                size_t chunkCacheBytes,
+                                                T* data)
+      {
+        hid_t dapl = H5Lite::createChunkCacheAccessPlist(loc_id, dsetName, chunkCacheBytes);
+
+        H5SUPPORT_MUTEX_LOCK()
+
+        herr_t err = 0;
+        herr_t retErr = 0;
+        T test = 0x00;
+        hid_t dataType = H5Lite::HDFTypeForPrimitive(test);
+        if (dataType == -1)
+        {
+          std::cout  << "dataType was not supported." << std::endl;
+          retErr = -10;
+        }
+        else if (nullptr == data)
+        {
+          std::cout  << "The Pointer to hold the data is nullptr. This is NOT allowed." << std::endl;
+          retErr = -3;
+        }
+        hid_t did = -1;
+        if (retErr >= 0)
+        {
+          did = H5Dopen(loc_id, dsetName.c_str(), dapl);
+        }
+        if (dapl != H5P_DEFAULT)
+        {
+          H5Pclose(dapl);
+        }
+        if (retErr < 0)
+        {
+          return retErr;
+        }
+        if ( did < 0 )
+        {
+          std::cout  << " Error opening Dataset: " << did << std::endl;
+          return -1;
+        }
+
+        hid_t fileSpace = H5S_ALL;
+        hid_t memSpace = H5S_ALL;
+        if (!offset.empty())
+        {
+          fileSpace = H5Dget_space(did);
+          int rank = H5Sget_simple_extent_ndims(fileSpace);
+          if (rank < 0 || offset.size() != static_cast<size_t>(rank) || count.size() != offset.size() || (!stride.empty() && stride.size() != offset.size()))
+          {
+            std::cout  << "The hyperslab does not match the rank of dataset " << dsetName << std::endl;
+            retErr = -4;
+          }
+          else
+          {
+            hsize_t numElements = 1;
+            for (size_t i = 0; i < count.size(); ++i)
+            {
+              numElements *= count[i];
+            }
+            err = H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, offset.data(), stride.empty() ? nullptr : stride.data(), count.data(), nullptr);
+            if (err < 0)
+            {
+              std::cout  << "Error selecting the hyperslab of dataset " << dsetName << std::endl;
+              retErr = err;
+            }
+            memSpace = H5Screate_simple(1, &numElements, nullptr);
+          }
+        }
+
+        if (retErr >= 0)
+        {
+          err = H5Dread(did, dataType, memSpace, fileSpace, H5P_DEFAULT, data);
+          if (err < 0)
+          {
+            std::cout  << "Error Reading Data." << std::endl;
+            retErr = err;
+          }
+        }
+        if (memSpace != H5S_ALL && memSpace >= 0)
+        {
+          CloseH5S(memSpace, err, retErr);
+        }
+        if (fileSpace != H5S_ALL && fileSpace >= 0)
+        {
+          CloseH5S(fileSpace, err, retErr);
+        }
+        CloseH5D(did, err, retErr);
+        return retErr;
+      }
+
       /**
        * @brief Reads data from the HDF5 File into an std::vector<T> object. If the dataset
        * is very large this can be an expensive method to use. It is here for convenience
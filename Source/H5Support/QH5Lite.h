@@ -461,6 +461,30 @@ namespace H5Support_NAMESPACE
         return H5Lite::readPointerDataset(loc_id, dsetName.toStdString(), data);
       }
 
+      /**
+       * @brief Reads a hyperslab of a dataset into a preallocated array, see
+       * H5Lite::readPointerDatasetHyperslab()
+       * @param loc_id The parent location that contains the dataset to read
+       * @param dsetName The name of the dataset to read
+       * @param offset The first element to read in each dimension, empty for the whole dataset
+       * @param count The number of elements to read in each dimension
+       * @param stride The step between elements in each dimension, empty for 1
+       * @param chunkCacheBytes The chunk cache size used for chunked datasets, 0 for the HDF5 default
+       * @param data A Pointer to the PreAllocated Array of Data
+       * @return Standard HDF error condition
+       */
+      template <typename T>
+      static herr_t readPointerDatasetHyperslab(hid_t loc_id,
+                                                const QString& dsetName,
+                                                const QVector<hsize_t>& offset,
+                                                const QVector<hsize_t>& count,
+                                                const QVector<hsize_t>& stride,
+                                                size_t chunkCacheBytes,
+                                                T* data)
+      {
+        return H5Lite::readPointerDatasetHyperslab(loc_id, dsetName.toStdString(), offset.toStdVector(), count.toStdVector(), stride.toStdVector(), chunkCacheBytes, data);
+      }
+
 
       /**
        * @brief Reads data from the HDF5 File into an QVector<T> object. If the dataset
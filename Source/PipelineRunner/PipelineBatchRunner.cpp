@@ -0,0 +1,505 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineBatchRunner.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QEventLoop>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QRegularExpression>
+
+#include "SIMPLib/Common/Constants.h"
+
+namespace
+{
+const QString k_Jobs("Jobs");
+const QString k_Name("Name");
+const QString k_Overrides("Overrides");
+}
+
+const QString PipelineBatchRunner::ProtocolPrefix("@batch ");
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineBatchRunner::PipelineBatchRunner()
+: m_JobCount(1)
+, m_ThreadBudget(1)
+, m_MemoryBudget(0)
+, m_EventLoop(nullptr)
+, m_ThreadsPerWorker(1)
+, m_NextJob(0)
+, m_CompletedJobs(0)
+, m_RunningWorkers(0)
+, m_BytesInFlight(0)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineBatchRunner::~PipelineBatchRunner() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineBatchRunner::ReadManifest(const QString& filePath, QVector<Job>& jobs, QString& error)
+{
+  QFile file(filePath);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    error = QObject::tr("The manifest file '%1' could not be opened").arg(filePath);
+    return false;
+  }
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+  if(parseError.error != QJsonParseError::NoError || !doc.isObject())
+  {
+    error = QObject::tr("The manifest file '%1' is not a valid JSON object: %2").arg(filePath).arg(parseError.errorString());
+    return false;
+  }
+  QJsonValue jobsValue = doc.object().value(k_Jobs);
+  if(!jobsValue.isArray())
+  {
+    error = QObject::tr("The manifest file '%1' does not have a '%2' array").arg(filePath).arg(k_Jobs);
+    return false;
+  }
+
+  QJsonArray jobArray = jobsValue.toArray();
+  jobs.clear();
+  jobs.reserve(jobArray.size());
+  for(int i = 0; i < jobArray.size(); i++)
+  {
+    if(!jobArray[i].isObject())
+    {
+      error = QObject::tr("Job %1 of the manifest file '%2' is not a JSON object").arg(i).arg(filePath);
+      return false;
+    }
+    QJsonObject jobObj = jobArray[i].toObject();
+    Job job;
+    job.name = jobObj.value(k_Name).toString();
+    if(job.name.isEmpty())
+    {
+      job.name = QString("Job_%1").arg(i);
+    }
+    job.overrides = jobObj.value(k_Overrides).toObject();
+    jobs.push_back(job);
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineBatchRunner::ReadPipelineFile(const QString& filePath, QJsonObject& pipelineRoot, QString& error)
+{
+  QFile file(filePath);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    error = QObject::tr("The pipeline file '%1' could not be opened").arg(filePath);
+    return false;
+  }
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+  if(parseError.error != QJsonParseError::NoError || !doc.isObject() || !doc.object().contains(SIMPL::Settings::PipelineBuilderGroup))
+  {
+    error = QObject::tr("The pipeline file '%1' is not a JSON pipeline").arg(filePath);
+    return false;
+  }
+  pipelineRoot = doc.object();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineBatchRunner::ApplyOverrides(QJsonObject& pipelineRoot, const QJsonObject& overrides, QString& error)
+{
+  for(QJsonObject::const_iterator filterIter = overrides.constBegin(); filterIter != overrides.constEnd(); ++filterIter)
+  {
+    bool isIndex = false;
+    filterIter.key().toInt(&isIndex);
+    if(!isIndex || !pipelineRoot.value(filterIter.key()).isObject())
+    {
+      error = QObject::tr("The pipeline does not have a filter with index '%1'").arg(filterIter.key());
+      return false;
+    }
+    if(!filterIter.value().isObject())
+    {
+      error = QObject::tr("The overrides of filter %1 are not a JSON object").arg(filterIter.key());
+      return false;
+    }
+
+    QJsonObject filterObj = pipelineRoot.value(filterIter.key()).toObject();
+    QJsonObject parameters = filterIter.value().toObject();
+    for(QJsonObject::const_iterator paramIter = parameters.constBegin(); paramIter != parameters.constEnd(); ++paramIter)
+    {
+      if(!filterObj.contains(paramIter.key()))
+      {
+        QString humanLabel = filterObj.value(SIMPL::Settings::HumanLabel).toString();
+        error = QObject::tr("Filter %1 (%2) does not have a parameter '%3'").arg(filterIter.key()).arg(humanLabel).arg(paramIter.key());
+        return false;
+      }
+      filterObj[paramIter.key()] = paramIter.value();
+    }
+    pipelineRoot[filterIter.key()] = filterObj;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineBatchRunner::LogFilePath(const QString& logDirectory, int jobIndex, const QString& jobName)
+{
+  QString fileName = jobName;
+  fileName.replace(QRegularExpression("[^A-Za-z0-9_.-]"), "_");
+  return logDirectory + QDir::separator() + QString("%1_%2.log").arg(jobIndex, 6, 10, QChar('0')).arg(fileName);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineBatchRunner::CanAdmit(quint64 memoryBudget, quint64 bytesInFlight, quint64 estimatedBytes)
+{
+  if(memoryBudget == 0 || bytesInFlight == 0)
+  {
+    return true;
+  }
+  return (bytesInFlight <= memoryBudget && estimatedBytes <= memoryBudget - bytesInFlight);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineBatchRunner::run()
+{
+  QString error;
+  QJsonObject pipelineRoot;
+  if(!ReadManifest(m_ManifestFile, m_Jobs, error) || !ReadPipelineFile(m_PipelineFile, pipelineRoot, error))
+  {
+    std::cout << error.toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+  if(!QDir().mkpath(m_LogDirectory))
+  {
+    std::cout << "The log directory '" << m_LogDirectory.toStdString() << "' could not be created" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  m_Results = QVector<JobResult>(m_Jobs.size());
+  m_NextJob = 0;
+  m_CompletedJobs = 0;
+  m_RunningWorkers = 0;
+  m_BytesInFlight = 0;
+  m_PendingAdmission.clear();
+
+  int workerCount = std::min(std::max(m_JobCount, 1), m_Jobs.size());
+  m_ThreadsPerWorker = std::max(1, m_ThreadBudget / std::max(workerCount, 1));
+  std::cout << "Running " << m_Jobs.size() << " jobs in " << workerCount << " worker processes with " << m_ThreadsPerWorker << " threads each" << std::endl;
+
+  m_BatchTimer.start();
+  QEventLoop eventLoop;
+  m_EventLoop = &eventLoop;
+  m_Workers = QVector<WorkerSlot>(workerCount);
+  for(int i = 0; i < workerCount; i++)
+  {
+    startWorker(i);
+  }
+  if(m_RunningWorkers > 0)
+  {
+    eventLoop.exec();
+  }
+  m_EventLoop = nullptr;
+
+  int succeeded = 0;
+  for(const JobResult& result : m_Results)
+  {
+    if(result.status == "Succeeded")
+    {
+      succeeded++;
+    }
+  }
+  std::cout << succeeded << " of " << m_Jobs.size() << " jobs succeeded in " << m_BatchTimer.elapsed() << " ms" << std::endl;
+
+  if(!writeSummary())
+  {
+    std::cout << "The summary file '" << m_SummaryFile.toStdString() << "' could not be written" << std::endl;
+    return EXIT_FAILURE;
+  }
+  return (succeeded == m_Jobs.size()) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineBatchRunner::startWorker(int slotIndex)
+{
+  WorkerSlot& slot = m_Workers[slotIndex];
+  slot.job = -1;
+  slot.admitted = false;
+  slot.process = new QProcess();
+  // The worker's error output is passed through. Its standard output carries nothing but the protocol:
+  // the worker points its own stdout at stderr before any plugin is loaded.
+  slot.process->setProcessChannelMode(QProcess::ForwardedErrorChannel);
+  QObject::connect(slot.process, &QProcess::readyReadStandardOutput, [this, slotIndex] { readWorkerOutput(slotIndex); });
+  QObject::connect(slot.process, static_cast<void (QProcess::*)(int, QProcess::ExitStatus)>(&QProcess::finished),
+                   [this, slotIndex](int exitCode, QProcess::ExitStatus exitStatus) { workerFinished(slotIndex, exitCode, exitStatus); });
+
+  QStringList arguments;
+  arguments << "--batch-worker"
+            << "--pipeline" << m_PipelineFile << "--batch" << m_ManifestFile << "--threads" << QString::number(m_ThreadsPerWorker) << "--log-dir" << m_LogDirectory;
+  slot.process->start(QCoreApplication::applicationFilePath(), arguments);
+  if(!slot.process->waitForStarted())
+  {
+    std::cout << "A worker process could not be started: " << slot.process->errorString().toStdString() << std::endl;
+    delete slot.process;
+    slot.process = nullptr;
+    return false;
+  }
+
+  m_RunningWorkers++;
+  dispatchNextJob(slotIndex);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineBatchRunner::dispatchNextJob(int slotIndex)
+{
+  WorkerSlot& slot = m_Workers[slotIndex];
+  if(m_NextJob < m_Jobs.size())
+  {
+    slot.job = m_NextJob++;
+    slot.process->write(QString("JOB %1\n").arg(slot.job).toLatin1());
+  }
+  else
+  {
+    slot.job = -1;
+    slot.process->write("QUIT\n");
+    slot.process->closeWriteChannel();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineBatchRunner::readWorkerOutput(int slotIndex)
+{
+  QProcess* process = m_Workers[slotIndex].process;
+  while(nullptr != process && process->canReadLine())
+  {
+    QString line = QString::fromUtf8(process->readLine()).trimmed();
+    if(line.startsWith(ProtocolPrefix))
+    {
+      handleWorkerMessage(slotIndex, line.mid(ProtocolPrefix.size()));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineBatchRunner::handleWorkerMessage(int slotIndex, const QString& message)
+{
+  WorkerSlot& slot = m_Workers[slotIndex];
+  QStringList fields = message.split(' ');
+  if(fields.size() < 2 || fields[1].toInt() != slot.job || slot.job < 0)
+  {
+    return;
+  }
+  JobResult& result = m_Results[slot.job];
+
+  // PLAN <job> <estimated peak bytes>
+  if(fields[0] == "PLAN" && fields.size() >= 3)
+  {
+    result.estimatedBytes = fields[2].toULongLong();
+    result.admissionRequested = m_BatchTimer.elapsed();
+    m_PendingAdmission.enqueue(slotIndex);
+    admitPendingJobs();
+  }
+  // DONE <job> <status> <error code> <preflight ms> <run ms> <message>
+  else if(fields[0] == "DONE" && fields.size() >= 6)
+  {
+    int jobIndex = slot.job;
+    result.status = fields[2];
+    result.errorCode = fields[3].toInt();
+    result.preflightTime = fields[4].toLongLong();
+    result.runTime = fields[5].toLongLong();
+    result.message = QStringList(fields.mid(6)).join(' ');
+    releaseJob(slotIndex);
+    reportJob(jobIndex);
+    dispatchNextJob(slotIndex);
+    admitPendingJobs();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineBatchRunner::workerFinished(int slotIndex, int exitCode, QProcess::ExitStatus exitStatus)
+{
+  // Pick up anything the worker wrote right before it exited
+  readWorkerOutput(slotIndex);
+
+  WorkerSlot& slot = m_Workers[slotIndex];
+  if(slot.job >= 0)
+  {
+    int jobIndex = slot.job;
+    JobResult& result = m_Results[jobIndex];
+    result.status = "Crashed";
+    result.errorCode = exitCode;
+    result.message = (exitStatus == QProcess::CrashExit) ? QObject::tr("The worker process crashed while running the job") : QObject::tr("The worker process exited while running the job");
+    releaseJob(slotIndex);
+    reportJob(jobIndex);
+  }
+  slot.process->deleteLater();
+  slot.process = nullptr;
+  m_RunningWorkers--;
+
+  // Replace the worker as long as there are jobs left for it
+  if(m_NextJob < m_Jobs.size())
+  {
+    startWorker(slotIndex);
+  }
+  admitPendingJobs();
+
+  if(m_RunningWorkers == 0 && nullptr != m_EventLoop)
+  {
+    m_EventLoop->quit();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineBatchRunner::admitPendingJobs()
+{
+  // Jobs are admitted in the order they asked so a large job is not starved by smaller ones behind it
+  while(!m_PendingAdmission.isEmpty())
+  {
+    WorkerSlot& slot = m_Workers[m_PendingAdmission.head()];
+    JobResult& result = m_Results[slot.job];
+    if(!CanAdmit(m_MemoryBudget, m_BytesInFlight, result.estimatedBytes))
+    {
+      break;
+    }
+    m_PendingAdmission.dequeue();
+    slot.admitted = true;
+    m_BytesInFlight += result.estimatedBytes;
+    result.waitTime = m_BatchTimer.elapsed() - result.admissionRequested;
+    slot.process->write(QString("RUN %1\n").arg(slot.job).toLatin1());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineBatchRunner::releaseJob(int slotIndex)
+{
+  WorkerSlot& slot = m_Workers[slotIndex];
+  if(slot.admitted)
+  {
+    m_BytesInFlight -= m_Results[slot.job].estimatedBytes;
+    slot.admitted = false;
+  }
+  m_PendingAdmission.removeAll(slotIndex);
+  slot.job = -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineBatchRunner::reportJob(int jobIndex)
+{
+  const JobResult& result = m_Results[jobIndex];
+  m_CompletedJobs++;
+  std::cout << "[" << m_CompletedJobs << "/" << m_Jobs.size() << "] " << m_Jobs[jobIndex].name.toStdString() << ": " << result.status.toStdString();
+  if(result.status != "Succeeded")
+  {
+    std::cout << " (" << result.errorCode << ") " << result.message.toStdString();
+  }
+  std::cout << " in " << (result.preflightTime + result.runTime) << " ms" << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineBatchRunner::writeSummary()
+{
+  QJsonArray jobArray;
+  for(int i = 0; i < m_Jobs.size(); i++)
+  {
+    const JobResult& result = m_Results[i];
+    QJsonObject jobObj;
+    jobObj[k_Name] = m_Jobs[i].name;
+    jobObj["Status"] = result.status;
+    jobObj["Error Code"] = result.errorCode;
+    jobObj["Message"] = result.message;
+    jobObj["Estimated Peak Bytes"] = static_cast<double>(result.estimatedBytes);
+    jobObj["Preflight Time (ms)"] = static_cast<double>(result.preflightTime);
+    jobObj["Wait Time (ms)"] = static_cast<double>(result.waitTime);
+    jobObj["Run Time (ms)"] = static_cast<double>(result.runTime);
+    jobObj["Log File"] = LogFilePath(m_LogDirectory, i, m_Jobs[i].name);
+    jobArray.push_back(jobObj);
+  }
+
+  QJsonObject root;
+  root["Pipeline"] = m_PipelineFile;
+  root["Manifest"] = m_ManifestFile;
+  root["Worker Processes"] = m_Workers.size();
+  root["Threads Per Worker"] = m_ThreadsPerWorker;
+  root["Memory Budget"] = static_cast<double>(m_MemoryBudget);
+  root["Total Time (ms)"] = static_cast<double>(m_BatchTimer.elapsed());
+  root[k_Jobs] = jobArray;
+
+  QFileInfo fi(m_SummaryFile);
+  QDir().mkpath(fi.absolutePath());
+  QFile file(m_SummaryFile);
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+  {
+    return false;
+  }
+  file.write(QJsonDocument(root).toJson());
+  return true;
+}
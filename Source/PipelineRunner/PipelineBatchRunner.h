@@ -0,0 +1,190 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _pipelinebatchrunner_h_
+#define _pipelinebatchrunner_h_
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QJsonObject>
+#include <QtCore/QProcess>
+#include <QtCore/QQueue>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+
+class QEventLoop;
+
+/**
+ * @brief The PipelineBatchRunner class runs one pipeline once for every job of a batch manifest.
+ *
+ * The jobs are executed by a fixed number of worker processes (PipelineRunner --batch-worker). Each worker
+ * loads the plugins once and then runs one job after the other, so the start up cost is paid per worker and
+ * not per job. Separate processes keep HDF5, which is usually not built thread safe, and any static state of
+ * the filters isolated between concurrently running pipelines.
+ *
+ * The thread budget is split evenly between the workers. Before a job executes, its worker preflights the
+ * pipeline and reports the peak memory predicted by the PipelineMemoryPlanner. A job is only allowed to run
+ * while the predictions of all running jobs fit into the memory budget; a job is always admitted when no
+ * other job is running so that a job larger than the budget still runs, alone.
+ *
+ * The manifest is a JSON file of the form
+ * @code
+ * { "Jobs": [ { "Name": "Scan_0001", "Overrides": { "0": { "InputFile": "/Data/Scan_0001.ang" } } } ] }
+ * @endcode
+ * where the keys of "Overrides" are filter indices of the pipeline file and their values replace the
+ * parameters of the same name of that filter.
+ */
+class PipelineBatchRunner
+{
+  public:
+    PipelineBatchRunner();
+    virtual ~PipelineBatchRunner();
+
+    SIMPL_INSTANCE_STRING_PROPERTY(PipelineFile)
+    SIMPL_INSTANCE_STRING_PROPERTY(ManifestFile)
+    SIMPL_INSTANCE_STRING_PROPERTY(SummaryFile)
+    SIMPL_INSTANCE_STRING_PROPERTY(LogDirectory)
+    SIMPL_INSTANCE_PROPERTY(int, JobCount)
+    SIMPL_INSTANCE_PROPERTY(int, ThreadBudget)
+    SIMPL_INSTANCE_PROPERTY(quint64, MemoryBudget)
+
+    /**
+     * @brief The Job struct is one entry of the manifest
+     */
+    struct Job
+    {
+      QString name;
+      QJsonObject overrides;
+    };
+
+    /**
+     * @brief Prefix of the lines a worker writes to the coordinator. The worker's standard output is
+     * reserved for these lines (see PipelineBatchWorker), so the prefix only guards against a line that
+     * was not written by the protocol.
+     */
+    static const QString ProtocolPrefix;
+
+    /**
+     * @brief run Runs every job of the manifest and writes the summary file
+     * @return EXIT_SUCCESS if every job succeeded
+     */
+    int run();
+
+    /**
+     * @brief ReadManifest Reads the jobs of a manifest file
+     * @return False with a description in error if the file could not be read
+     */
+    static bool ReadManifest(const QString& filePath, QVector<Job>& jobs, QString& error);
+
+    /**
+     * @brief ReadPipelineFile Reads a JSON pipeline file
+     * @return False with a description in error if the file could not be read
+     */
+    static bool ReadPipelineFile(const QString& filePath, QJsonObject& pipelineRoot, QString& error);
+
+    /**
+     * @brief ApplyOverrides Replaces filter parameters of a JSON pipeline with the overrides of a job. Every
+     * overridden parameter must already exist in the pipeline so that typing errors are not silently ignored.
+     * @return False with a description in error if an override does not match the pipeline
+     */
+    static bool ApplyOverrides(QJsonObject& pipelineRoot, const QJsonObject& overrides, QString& error);
+
+    /**
+     * @brief LogFilePath Returns the path of the file the messages of a job are written to
+     */
+    static QString LogFilePath(const QString& logDirectory, int jobIndex, const QString& jobName);
+
+    /**
+     * @brief CanAdmit Returns true if a job predicted to need estimatedBytes may start while the running
+     * jobs are predicted to need bytesInFlight. A budget of zero admits everything, and a job is always
+     * admitted when nothing else is running.
+     */
+    static bool CanAdmit(quint64 memoryBudget, quint64 bytesInFlight, quint64 estimatedBytes);
+
+  protected:
+    /**
+     * @brief The JobResult struct collects what the summary reports about a job
+     */
+    struct JobResult
+    {
+      QString status = "NotRun";
+      int errorCode = 0;
+      quint64 estimatedBytes = 0;
+      qint64 preflightTime = 0;
+      qint64 waitTime = 0;
+      qint64 runTime = 0;
+      qint64 admissionRequested = 0;
+      QString message;
+    };
+
+    /**
+     * @brief The WorkerSlot struct tracks one worker process and the job it is running
+     */
+    struct WorkerSlot
+    {
+      QProcess* process = nullptr;
+      int job = -1;
+      bool admitted = false;
+    };
+
+    bool startWorker(int slotIndex);
+    void dispatchNextJob(int slotIndex);
+    void readWorkerOutput(int slotIndex);
+    void handleWorkerMessage(int slotIndex, const QString& message);
+    void workerFinished(int slotIndex, int exitCode, QProcess::ExitStatus exitStatus);
+    void admitPendingJobs();
+    void releaseJob(int slotIndex);
+    void reportJob(int jobIndex);
+    bool writeSummary();
+
+  private:
+    QVector<Job> m_Jobs;
+    QVector<JobResult> m_Results;
+    QVector<WorkerSlot> m_Workers;
+    QQueue<int> m_PendingAdmission;
+    QElapsedTimer m_BatchTimer;
+    QEventLoop* m_EventLoop;
+    int m_ThreadsPerWorker;
+    int m_NextJob;
+    int m_CompletedJobs;
+    int m_RunningWorkers;
+    quint64 m_BytesInFlight;
+
+    PipelineBatchRunner(const PipelineBatchRunner&) = delete; // Copy Constructor Not Implemented
+    void operator=(const PipelineBatchRunner&) = delete;      // Move assignment Not Implemented
+};
+
+#endif /* _pipelinebatchrunner_h_ */
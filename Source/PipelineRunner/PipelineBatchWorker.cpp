@@ -0,0 +1,354 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineBatchWorker.h"
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QStringList>
+#include <QtCore/QTextStream>
+#include <QtCore/QThreadPool>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PipelineMemoryPlanner.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_scheduler_init.h>
+#endif
+
+namespace
+{
+// The original standard output of the process, see PipelineBatchWorker::OpenProtocolChannel()
+FILE* s_ProtocolStream = nullptr;
+
+/**
+ * @brief The JobLogObserver class writes the messages of one job to its log file and remembers the first
+ * error so that it can be reported in the summary. Progress values are not logged.
+ */
+class JobLogObserver : public Observer
+{
+  public:
+    JobLogObserver(const QString& filePath)
+    : m_File(filePath)
+    {
+      if(m_File.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+      {
+        m_Stream.setDevice(&m_File);
+      }
+    }
+
+    ~JobLogObserver() override
+    {
+      m_Stream.flush();
+    }
+
+    void processPipelineMessage(const PipelineMessage& pm) override
+    {
+      QString text;
+      switch(pm.getType())
+      {
+        case PipelineMessage::MessageType::Error:
+          text = pm.generateErrorString();
+          if(m_FirstError.isEmpty())
+          {
+            m_FirstError = text;
+          }
+          break;
+        case PipelineMessage::MessageType::Warning:
+          text = pm.generateWarningString();
+          break;
+        case PipelineMessage::MessageType::StatusMessage:
+        case PipelineMessage::MessageType::StatusMessageAndProgressValue:
+          text = pm.generateStatusString();
+          break;
+        case PipelineMessage::MessageType::StandardOutputMessage:
+          text = pm.generateStandardOutputString();
+          break;
+        default:
+          return;
+      }
+      if(nullptr != m_Stream.device())
+      {
+        m_Stream << pm.getFilterHumanLabel() << ": " << text << "\n";
+      }
+    }
+
+    void log(const QString& text)
+    {
+      if(nullptr != m_Stream.device())
+      {
+        m_Stream << text << "\n";
+      }
+    }
+
+    QString getFirstError() const
+    {
+      return m_FirstError;
+    }
+
+  private:
+    QFile m_File;
+    QTextStream m_Stream;
+    QString m_FirstError;
+};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineBatchWorker::PipelineBatchWorker()
+: m_ThreadCount(1)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineBatchWorker::~PipelineBatchWorker() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineBatchWorker::OpenProtocolChannel()
+{
+  if(nullptr != s_ProtocolStream)
+  {
+    return true;
+  }
+  std::cout.flush();
+  fflush(stdout);
+#ifdef _WIN32
+  int protocolFd = _dup(_fileno(stdout));
+  if(protocolFd < 0)
+  {
+    return false;
+  }
+  if(_dup2(_fileno(stderr), _fileno(stdout)) < 0)
+  {
+    _close(protocolFd);
+    return false;
+  }
+  s_ProtocolStream = _fdopen(protocolFd, "w");
+#else
+  int protocolFd = dup(STDOUT_FILENO);
+  if(protocolFd < 0)
+  {
+    return false;
+  }
+  if(dup2(STDERR_FILENO, STDOUT_FILENO) < 0)
+  {
+    close(protocolFd);
+    return false;
+  }
+  s_ProtocolStream = fdopen(protocolFd, "w");
+#endif
+  return (nullptr != s_ProtocolStream);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineBatchWorker::run()
+{
+  if(!OpenProtocolChannel())
+  {
+    std::cerr << "The protocol channel to the batch coordinator could not be opened" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  QString error;
+  QVector<PipelineBatchRunner::Job> jobs;
+  if(!PipelineBatchRunner::ReadManifest(m_ManifestFile, jobs, error) || !PipelineBatchRunner::ReadPipelineFile(m_PipelineFile, m_PipelineRoot, error))
+  {
+    std::cerr << error.toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Every parallel algorithm of every job in this process shares the same threads. Filters create their own
+  // task_scheduler_init, which only adds a reference to the one that is already active on this thread.
+  QThreadPool::globalInstance()->setMaxThreadCount(m_ThreadCount);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init(m_ThreadCount);
+#endif
+
+  std::string line;
+  while(std::getline(std::cin, line))
+  {
+    QStringList fields = QString::fromStdString(line).trimmed().split(' ');
+    if(fields[0] == "QUIT")
+    {
+      break;
+    }
+    if(fields[0] != "JOB" || fields.size() < 2)
+    {
+      continue;
+    }
+    bool ok = false;
+    int jobIndex = fields[1].toInt(&ok);
+    if(!ok || jobIndex < 0 || jobIndex >= jobs.size())
+    {
+      sendDone(jobIndex, "Invalid", -1, 0, 0, QObject::tr("The manifest does not have a job %1").arg(fields[1]));
+      continue;
+    }
+    if(!runJob(jobIndex, jobs[jobIndex]))
+    {
+      break;
+    }
+  }
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineBatchWorker::runJob(int jobIndex, const PipelineBatchRunner::Job& job)
+{
+  QElapsedTimer timer;
+  timer.start();
+  JobLogObserver obs(PipelineBatchRunner::LogFilePath(m_LogDirectory, jobIndex, job.name));
+
+  QString error;
+  QJsonObject pipelineRoot = m_PipelineRoot;
+  if(!PipelineBatchRunner::ApplyOverrides(pipelineRoot, job.overrides, error))
+  {
+    obs.log(error);
+    sendDone(jobIndex, "Invalid", -1, timer.elapsed(), 0, error);
+    return true;
+  }
+
+  JsonFilterParametersReader::Pointer jsonReader = JsonFilterParametersReader::New();
+  FilterPipeline::Pointer pipeline = jsonReader->readPipelineFromString(QString::fromUtf8(QJsonDocument(pipelineRoot).toJson()), &obs);
+  if(nullptr == pipeline.get())
+  {
+    error = QObject::tr("The pipeline could not be created from the pipeline file and the overrides of the job");
+    obs.log(error);
+    sendDone(jobIndex, "Invalid", -1, timer.elapsed(), 0, error);
+    return true;
+  }
+  pipeline->addMessageReceiver(&obs);
+
+  int err = pipeline->preflightPipeline();
+  if(err < 0)
+  {
+    sendDone(jobIndex, "PreflightFailed", err, timer.elapsed(), 0, obs.getFirstError());
+    return true;
+  }
+
+  // The preflighted filters still hold the structure they produced, which is all the planner needs
+  quint64 estimatedBytes = 0;
+  PipelineMemoryPlanner::Pointer planner = PipelineMemoryPlanner::New();
+  if(planner->plan(pipeline->getFilterContainer()) >= 0)
+  {
+    estimatedBytes = pipeline->getReleaseDeadArrays() ? planner->getPlannedPeakBytes() : planner->getPeakBytes();
+    obs.log(planner->getSummary());
+  }
+  qint64 preflightTime = timer.elapsed();
+  sendPlan(jobIndex, estimatedBytes);
+
+  // Wait until the coordinator admits the job
+  std::string line;
+  while(true)
+  {
+    if(!std::getline(std::cin, line))
+    {
+      return false;
+    }
+    QStringList fields = QString::fromStdString(line).trimmed().split(' ');
+    if(fields[0] == "QUIT")
+    {
+      return false;
+    }
+    if(fields[0] == "RUN" && fields.size() >= 2 && fields[1].toInt() == jobIndex)
+    {
+      break;
+    }
+  }
+
+  timer.restart();
+  pipeline->execute();
+  qint64 runTime = timer.elapsed();
+  err = pipeline->getErrorCondition();
+  if(err < 0)
+  {
+    sendDone(jobIndex, "Failed", err, preflightTime, runTime, obs.getFirstError());
+  }
+  else
+  {
+    sendDone(jobIndex, "Succeeded", 0, preflightTime, runTime, QString());
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineBatchWorker::sendMessage(const QString& message)
+{
+  QByteArray line = (PipelineBatchRunner::ProtocolPrefix + message + "\n").toUtf8();
+  fwrite(line.constData(), 1, static_cast<size_t>(line.size()), s_ProtocolStream);
+  fflush(s_ProtocolStream);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineBatchWorker::sendPlan(int jobIndex, quint64 estimatedBytes)
+{
+  sendMessage(QString("PLAN %1 %2").arg(jobIndex).arg(estimatedBytes));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineBatchWorker::sendDone(int jobIndex, const QString& status, int errorCode, qint64 preflightTime, qint64 runTime, const QString& message)
+{
+  // The message is the last field and must stay on one line
+  QString singleLine = message.simplified();
+  sendMessage(QString("DONE %1 %2 %3 %4 %5 %6").arg(jobIndex).arg(status).arg(errorCode).arg(preflightTime).arg(runTime).arg(singleLine));
+}
@@ -0,0 +1,99 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _pipelinebatchworker_h_
+#define _pipelinebatchworker_h_
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QString>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+
+#include "PipelineBatchRunner.h"
+
+/**
+ * @brief The PipelineBatchWorker class is the worker process side of PipelineBatchRunner. It reads job
+ * indices from its standard input, applies the overrides of each job to the pipeline, preflights it, reports
+ * the predicted peak memory and executes the pipeline once the coordinator admits the job.
+ *
+ * The replies go to the coordinator on the process's original standard output, which OpenProtocolChannel()
+ * takes over; anything else the process prints to stdout ends up on its error output instead.
+ *
+ * The plugins must have been loaded before run() is called. All jobs of the worker share ThreadCount threads.
+ */
+class PipelineBatchWorker
+{
+  public:
+    PipelineBatchWorker();
+    virtual ~PipelineBatchWorker();
+
+    SIMPL_INSTANCE_STRING_PROPERTY(PipelineFile)
+    SIMPL_INSTANCE_STRING_PROPERTY(ManifestFile)
+    SIMPL_INSTANCE_STRING_PROPERTY(LogDirectory)
+    SIMPL_INSTANCE_PROPERTY(int, ThreadCount)
+
+    /**
+     * @brief OpenProtocolChannel Keeps a private copy of the standard output for the protocol and points
+     * stdout at the error output, so that filters and plugins that print can not corrupt the protocol. Call
+     * it before the plugins are loaded; calling it again does nothing.
+     * @return False if the descriptors could not be duplicated
+     */
+    static bool OpenProtocolChannel();
+
+    /**
+     * @brief run Processes jobs until the coordinator sends QUIT or closes the standard input
+     * @return EXIT_SUCCESS unless the pipeline or manifest could not be read
+     */
+    int run();
+
+  protected:
+    /**
+     * @brief runJob Runs one job and reports the result to the coordinator
+     * @return False if the coordinator went away while the job waited for admission
+     */
+    bool runJob(int jobIndex, const PipelineBatchRunner::Job& job);
+
+    void sendMessage(const QString& message);
+    void sendPlan(int jobIndex, quint64 estimatedBytes);
+    void sendDone(int jobIndex, const QString& status, int errorCode, qint64 preflightTime, qint64 runTime, const QString& message);
+
+  private:
+    QJsonObject m_PipelineRoot;
+
+    PipelineBatchWorker(const PipelineBatchWorker&) = delete; // Copy Constructor Not Implemented
+    void operator=(const PipelineBatchWorker&) = delete;      // Move assignment Not Implemented
+};
+
+#endif /* _pipelinebatchworker_h_ */
@@ -38,6 +38,7 @@
 #include <stdlib.h>
 
 // C++ Includes
+#include <algorithm>
 #include <iostream>
 
 // Qt Includes
@@ -46,9 +47,11 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QFile>
 #include <QtCore/QSettings>
 #include <QtCore/QString>
+#include <QtCore/QThread>
 #include <QtCore/QtDebug>
 
 // DREAM3DLib includes
@@ -64,6 +67,9 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
+#include "PipelineBatchRunner.h"
+#include "PipelineBatchWorker.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -92,20 +98,100 @@ int main(int argc, char* argv[])
                                      "Pipeline File as a JSON file.", "file");
   parser.addOption(pipelineFileArg);
 
+  QCommandLineOption loadAllPluginsArg(QStringList() << "load-all-plugins",
+                                       "Load every plugin library at start up instead of only those the pipeline uses.");
+  parser.addOption(loadAllPluginsArg);
+
+  QCommandLineOption batchArg(QStringList() << "batch",
+                              "Run the pipeline once for every job of a JSON manifest. Each job lists the filter parameters it overrides.", "manifest");
+  parser.addOption(batchArg);
+
+  QCommandLineOption jobsArg(QStringList() << "jobs",
+                             "Number of batch jobs that run at the same time. Defaults to a quarter of the thread budget.", "count");
+  parser.addOption(jobsArg);
+
+  QCommandLineOption threadsArg(QStringList() << "threads",
+                                "Number of threads shared by all batch jobs. Defaults to the number of cores.", "count");
+  parser.addOption(threadsArg);
+
+  QCommandLineOption memoryBudgetArg(QStringList() << "memory-budget",
+                                     "Batch jobs only start while the predicted peak memory of all running jobs stays below this many MB. 0 disables the limit.", "MB");
+  parser.addOption(memoryBudgetArg);
+
+  QCommandLineOption summaryArg(QStringList() << "summary",
+                                "JSON file the batch summary is written to. Defaults to <manifest>_Summary.json.", "file");
+  parser.addOption(summaryArg);
+
+  QCommandLineOption logDirArg(QStringList() << "log-dir",
+                               "Directory for the log file of each batch job. Defaults to <manifest>_Logs.", "directory");
+  parser.addOption(logDirArg);
+
+  // Used by the batch mode to start its worker processes
+  QCommandLineOption batchWorkerArg(QStringList() << "batch-worker", "Internal: run batch jobs sent on the standard input.");
+  batchWorkerArg.setHidden(true);
+  parser.addOption(batchWorkerArg);
+
   // Process the actual command line arguments given by the user
   parser.process(*app);
 
   QString pipelineFile = parser.value(pipelineFileArg);
 
-  std::cout << "PipelineRunner Starting. " << std::endl;
-  std::cout << "   " << SIMPLib::Version::PackageComplete().toStdString() << std::endl;
+  int threadBudget = QThread::idealThreadCount();
+  if(parser.isSet(threadsArg))
+  {
+    threadBudget = std::max(1, parser.value(threadsArg).toInt());
+  }
 
-  // Register all the filters including trying to load those from Plugins
-  FilterManager* fm = FilterManager::Instance();
-  SIMPLibPluginLoader::LoadPluginFilters(fm);
+  // The batch coordinator only starts the worker processes and never loads any plugins itself
+  if(parser.isSet(batchArg) && !parser.isSet(batchWorkerArg))
+  {
+    QFileInfo manifestFi(parser.value(batchArg));
+    QString manifestBase = manifestFi.absolutePath() + "/" + manifestFi.completeBaseName();
+
+    PipelineBatchRunner batchRunner;
+    batchRunner.setPipelineFile(QFileInfo(pipelineFile).absoluteFilePath());
+    batchRunner.setManifestFile(manifestFi.absoluteFilePath());
+    batchRunner.setSummaryFile(parser.isSet(summaryArg) ? parser.value(summaryArg) : manifestBase + "_Summary.json");
+    batchRunner.setLogDirectory(QFileInfo(parser.isSet(logDirArg) ? parser.value(logDirArg) : manifestBase + "_Logs").absoluteFilePath());
+    batchRunner.setThreadBudget(threadBudget);
+    batchRunner.setJobCount(parser.isSet(jobsArg) ? parser.value(jobsArg).toInt() : std::max(1, threadBudget / 4));
+    batchRunner.setMemoryBudget(parser.value(memoryBudgetArg).toULongLong() * 1024ULL * 1024ULL);
+    return batchRunner.run();
+  }
+
+  if(!parser.isSet(batchWorkerArg))
+  {
+    std::cout << "PipelineRunner Starting. " << std::endl;
+    std::cout << "   " << SIMPLib::Version::PackageComplete().toStdString() << std::endl;
+  }
+
+  // A batch worker claims its standard output for the coordinator before a plugin can print to it
+  if(parser.isSet(batchWorkerArg) && !PipelineBatchWorker::OpenProtocolChannel())
+  {
+    std::cerr << "The protocol channel to the batch coordinator could not be opened" << std::endl;
+    return EXIT_FAILURE;
+  }
 
+  // Register all the filters including trying to load those from Plugins. Plugins found in the
+  // manifest cache are only loaded once the pipeline creates one of their filters.
+  QElapsedTimer startupTimer;
+  startupTimer.start();
+  FilterManager* fm = FilterManager::Instance();
+  bool deferLoading = !parser.isSet(loadAllPluginsArg);
+  SIMPLibPluginLoader::LoadPluginFilters(fm, false, deferLoading);
   QMetaObjectUtilities::RegisterMetaTypes();
 
+  if(parser.isSet(batchWorkerArg))
+  {
+    PipelineBatchWorker batchWorker;
+    batchWorker.setPipelineFile(pipelineFile);
+    batchWorker.setManifestFile(parser.value(batchArg));
+    batchWorker.setLogDirectory(parser.value(logDirArg));
+    batchWorker.setThreadCount(threadBudget);
+    return batchWorker.run();
+  }
+  std::cout << "Filters registered in " << startupTimer.elapsed() << " ms" << std::endl;
+
   int err = 0;
 
   // Sanity Check the filepath to make sure it exists, Report an error and bail if it does not
@@ -143,6 +229,7 @@ int main(int argc, char* argv[])
   }
 
   std::cout << "Pipeline Count: " << pipeline->size() << std::endl;
+  std::cout << "Pipeline ready in " << startupTimer.elapsed() << " ms" << std::endl;
   Observer obs; // Create an Observer to report errors/progress from the executing pipeline
   pipeline->addMessageReceiver(&obs);
   // Preflight the pipeline
@@ -0,0 +1,257 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <iostream>
+#include <limits>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+#include "PipelineBatchRunner.h"
+
+/**
+ * @brief The PipelineBatchRunnerTest class covers the parts of the batch mode that do not need worker processes
+ */
+class PipelineBatchRunnerTest
+{
+public:
+  PipelineBatchRunnerTest()
+  {
+  }
+  virtual ~PipelineBatchRunnerTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString ManifestFile()
+  {
+    return QDir::tempPath() + "/PipelineBatchRunnerTest_Manifest.json";
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void WriteFile(const QString& filePath, const QByteArray& contents)
+  {
+    QFile file(filePath);
+    DREAM3D_REQUIRE(file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    file.write(contents);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QJsonObject CreatePipeline()
+  {
+    QJsonObject reader;
+    reader[SIMPL::Settings::HumanLabel] = QString("Read File");
+    reader["InputFile"] = QString("/Data/Default.ang");
+    reader["ZStartIndex"] = 0;
+
+    QJsonObject builder;
+    builder["Number_Filters"] = 1;
+
+    QJsonObject root;
+    root[SIMPL::Settings::PipelineBuilderGroup] = builder;
+    root["0"] = reader;
+    return root;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+    QFile::remove(ManifestFile());
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReadManifest()
+  {
+    QJsonObject overrides;
+    overrides["0"] = QJsonObject{{"InputFile", QString("/Data/Scan_0001.ang")}};
+    QJsonArray jobArray;
+    jobArray.push_back(QJsonObject{{"Name", QString("Scan_0001")}, {"Overrides", overrides}});
+    jobArray.push_back(QJsonObject());
+    WriteFile(ManifestFile(), QJsonDocument(QJsonObject{{"Jobs", jobArray}}).toJson());
+
+    QVector<PipelineBatchRunner::Job> jobs;
+    QString error;
+    DREAM3D_REQUIRE(PipelineBatchRunner::ReadManifest(ManifestFile(), jobs, error))
+    DREAM3D_REQUIRE_EQUAL(jobs.size(), 2)
+    DREAM3D_REQUIRE(jobs[0].name == "Scan_0001")
+    DREAM3D_REQUIRE(jobs[0].overrides == overrides)
+    // Jobs without a name are named after their position
+    DREAM3D_REQUIRE(jobs[1].name == "Job_1")
+    DREAM3D_REQUIRE(jobs[1].overrides.isEmpty())
+
+    // Every malformed manifest is rejected with a description
+    QList<QByteArray> badManifests;
+    badManifests << QByteArray("not json") << QByteArray("[1, 2]") << QByteArray("{\"Tasks\": []}") << QByteArray("{\"Jobs\": [1]}");
+    foreach(QByteArray contents, badManifests)
+    {
+      WriteFile(ManifestFile(), contents);
+      error.clear();
+      DREAM3D_REQUIRE_EQUAL(PipelineBatchRunner::ReadManifest(ManifestFile(), jobs, error), false)
+      DREAM3D_REQUIRE_EQUAL(error.isEmpty(), false)
+    }
+
+    error.clear();
+    DREAM3D_REQUIRE_EQUAL(PipelineBatchRunner::ReadManifest(QDir::tempPath() + "/PipelineBatchRunnerTest_Missing.json", jobs, error), false)
+    DREAM3D_REQUIRE_EQUAL(error.isEmpty(), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestApplyOverrides()
+  {
+    QString error;
+    QJsonObject pipeline = CreatePipeline();
+    QJsonObject overrides;
+    overrides["0"] = QJsonObject{{"InputFile", QString("/Data/Scan_0002.ang")}, {"ZStartIndex", 4}};
+    DREAM3D_REQUIRE(PipelineBatchRunner::ApplyOverrides(pipeline, overrides, error))
+    QJsonObject reader = pipeline.value("0").toObject();
+    DREAM3D_REQUIRE(reader.value("InputFile").toString() == "/Data/Scan_0002.ang")
+    DREAM3D_REQUIRE_EQUAL(reader.value("ZStartIndex").toInt(), 4)
+    DREAM3D_REQUIRE(reader.value(SIMPL::Settings::HumanLabel).toString() == "Read File")
+
+    // An empty set of overrides leaves the pipeline alone
+    QJsonObject unchanged = pipeline;
+    DREAM3D_REQUIRE(PipelineBatchRunner::ApplyOverrides(pipeline, QJsonObject(), error))
+    DREAM3D_REQUIRE(pipeline == unchanged)
+
+    // A filter index that is not in the pipeline, or not an index at all
+    pipeline = CreatePipeline();
+    overrides = QJsonObject{{"3", QJsonObject{{"InputFile", QString("a")}}}};
+    DREAM3D_REQUIRE_EQUAL(PipelineBatchRunner::ApplyOverrides(pipeline, overrides, error), false)
+    DREAM3D_REQUIRE(error.contains("'3'"))
+    overrides = QJsonObject{{SIMPL::Settings::PipelineBuilderGroup, QJsonObject{{"Number_Filters", 2}}}};
+    DREAM3D_REQUIRE_EQUAL(PipelineBatchRunner::ApplyOverrides(pipeline, overrides, error), false)
+
+    // Overrides that are not an object
+    overrides = QJsonObject{{"0", QString("/Data/Scan_0002.ang")}};
+    DREAM3D_REQUIRE_EQUAL(PipelineBatchRunner::ApplyOverrides(pipeline, overrides, error), false)
+
+    // A misspelled parameter is an error rather than a new parameter
+    overrides = QJsonObject{{"0", QJsonObject{{"InputFiel", QString("/Data/Scan_0002.ang")}}}};
+    DREAM3D_REQUIRE_EQUAL(PipelineBatchRunner::ApplyOverrides(pipeline, overrides, error), false)
+    DREAM3D_REQUIRE(error.contains("InputFiel"))
+    DREAM3D_REQUIRE(error.contains("Read File"))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAdmission()
+  {
+    const quint64 budget = 1000;
+
+    // Without a budget everything runs
+    DREAM3D_REQUIRE(PipelineBatchRunner::CanAdmit(0, 5000, 5000))
+
+    // A job larger than the budget still runs when nothing else does
+    DREAM3D_REQUIRE(PipelineBatchRunner::CanAdmit(budget, 0, 5000))
+
+    // Jobs share the budget up to and including its last byte
+    DREAM3D_REQUIRE(PipelineBatchRunner::CanAdmit(budget, 600, 400))
+    DREAM3D_REQUIRE_EQUAL(PipelineBatchRunner::CanAdmit(budget, 600, 401), false)
+
+    // Once a lone oversized job runs nothing else is admitted, whatever its size
+    DREAM3D_REQUIRE_EQUAL(PipelineBatchRunner::CanAdmit(budget, 5000, 0), false)
+
+    // Sizes near the top of the range must not wrap around
+    DREAM3D_REQUIRE_EQUAL(PipelineBatchRunner::CanAdmit(budget, 600, std::numeric_limits<quint64>::max()), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLogFilePath()
+  {
+    QString path = PipelineBatchRunner::LogFilePath("/Logs", 12, "Scan 01/02:a.b");
+    DREAM3D_REQUIRE(path == QString("/Logs") + QDir::separator() + "000012_Scan_01_02_a.b.log")
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### PipelineBatchRunnerTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestReadManifest())
+    DREAM3D_REGISTER_TEST(TestApplyOverrides())
+    DREAM3D_REGISTER_TEST(TestAdmission())
+    DREAM3D_REGISTER_TEST(TestLogFilePath())
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+private:
+  PipelineBatchRunnerTest(const PipelineBatchRunnerTest&); // Copy Constructor Not Implemented
+  void operator=(const PipelineBatchRunnerTest&);          // Move assignment Not Implemented
+};
+
+// -----------------------------------------------------------------------------
+//  Use test framework
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  int err = EXIT_SUCCESS;
+
+  QCoreApplication app(argc, argv);
+
+  PipelineBatchRunnerTest()();
+
+  PRINT_TEST_SUMMARY();
+
+  return err;
+}
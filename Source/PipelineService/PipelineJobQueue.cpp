@@ -0,0 +1,504 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineJobQueue.h"
+
+#include <algorithm>
+
+#include <QtCore/QMutexLocker>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/Observer.h"
+#include "SIMPLib/DataArrays/DataArrayAllocator.h"
+#include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_scheduler_init.h>
+#endif
+
+namespace
+{
+// Number of recent jobs the latency statistics are computed from
+const int k_LatencySampleCount = 1024;
+
+/**
+ * @brief The JobObserver class forwards the messages of a running pipeline to its job
+ */
+class JobObserver : public Observer
+{
+  public:
+    JobObserver(const PipelineJob::Pointer& job)
+    : m_Job(job)
+    {
+    }
+
+    ~JobObserver() override = default;
+
+    void processPipelineMessage(const PipelineMessage& pm) override
+    {
+      if(pm.getType() == PipelineMessage::MessageType::Error && m_FirstError.isEmpty())
+      {
+        m_FirstError = pm.generateErrorString();
+      }
+      m_Job->postEvent(PipelineJobQueue::MessageToJson(pm));
+      // The pipeline sends messages from the worker thread before every filter it executes
+      m_Job->reapplyCancel();
+    }
+
+    QString getFirstError() const
+    {
+      return m_FirstError;
+    }
+
+  private:
+    PipelineJob::Pointer m_Job;
+    QString m_FirstError;
+};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::PipelineJob()
+: m_Operation(Operation::Preflight)
+{
+  m_Timer.start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::~PipelineJob() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJob::postEvent(const QJsonObject& event, bool last)
+{
+  QMutexLocker lock(&m_Mutex);
+  m_Events.push_back(event);
+  m_Finished = m_Finished || last;
+  m_EventPosted.wakeAll();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineJob::takeEvents(QVector<QJsonObject>& events, unsigned long timeout)
+{
+  QMutexLocker lock(&m_Mutex);
+  if(m_Events.isEmpty() && !m_Finished)
+  {
+    m_EventPosted.wait(&m_Mutex, timeout);
+  }
+  events += m_Events;
+  m_Events.clear();
+  return m_Finished;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJob::cancel()
+{
+  QMutexLocker lock(&m_Mutex);
+  m_Cancelled = true;
+  if(nullptr != m_RunningPipeline.get())
+  {
+    m_RunningPipeline->cancelPipeline();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineJob::isCancelled()
+{
+  QMutexLocker lock(&m_Mutex);
+  return m_Cancelled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineJob::startPipeline(FilterPipeline::Pointer pipeline)
+{
+  QMutexLocker lock(&m_Mutex);
+  if(m_Cancelled)
+  {
+    return false;
+  }
+  m_RunningPipeline = pipeline;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJob::stopPipeline()
+{
+  QMutexLocker lock(&m_Mutex);
+  m_RunningPipeline = FilterPipeline::NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJob::reapplyCancel()
+{
+  QMutexLocker lock(&m_Mutex);
+  if(m_Cancelled && nullptr != m_RunningPipeline.get() && !m_RunningPipeline->getCancel())
+  {
+    m_RunningPipeline->cancelPipeline();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 PipelineJob::getElapsedTime() const
+{
+  return m_Timer.elapsed();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJobQueue::Worker::Worker(PipelineJobQueue* queue, int threadCount)
+: m_Queue(queue)
+, m_ThreadCount(threadCount)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJobQueue::Worker::~Worker() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJobQueue::Worker::run()
+{
+// Filters create their own task_scheduler_init, which only adds a reference to the one that is already
+// active on this thread, so every job of this worker shares the same number of threads.
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init(m_ThreadCount);
+#endif
+
+  PipelineJob::Pointer job = m_Queue->takeJob(false);
+  while(nullptr != job.get())
+  {
+    m_Queue->runJob(job);
+    job = m_Queue->takeJob(true);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJobQueue::PipelineJobQueue(int workerCount, int threadsPerWorker, int maxQueueDepth)
+: m_MaxQueueDepth(maxQueueDepth)
+, m_ThreadsPerWorker(threadsPerWorker)
+{
+  for(int i = 0; i < workerCount; i++)
+  {
+    Worker* worker = new Worker(this, threadsPerWorker);
+    m_Workers.push_back(worker);
+    worker->start();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJobQueue::~PipelineJobQueue()
+{
+  shutdown();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineJobQueue::submit(PipelineJob::Pointer job)
+{
+  QMutexLocker lock(&m_Mutex);
+  if(m_ShuttingDown || m_Queue.size() >= m_MaxQueueDepth)
+  {
+    m_Rejected++;
+    return false;
+  }
+  m_Submitted++;
+  m_Queue.enqueue(job);
+  m_JobQueued.wakeOne();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJobQueue::shutdown()
+{
+  QQueue<PipelineJob::Pointer> queued;
+  {
+    QMutexLocker lock(&m_Mutex);
+    m_ShuttingDown = true;
+    queued.swap(m_Queue);
+    m_JobQueued.wakeAll();
+  }
+  for(const PipelineJob::Pointer& job : queued)
+  {
+    job->cancel();
+    finishJob(job, "Cancelled", 0, QObject::tr("The service is shutting down"), job->getElapsedTime(), 0);
+  }
+  for(Worker* worker : m_Workers)
+  {
+    worker->wait();
+    delete worker;
+  }
+  m_Workers.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineJob::Pointer PipelineJobQueue::takeJob(bool finishedJob)
+{
+  QMutexLocker lock(&m_Mutex);
+  if(finishedJob)
+  {
+    m_BusyWorkers--;
+  }
+  while(m_Queue.isEmpty() && !m_ShuttingDown)
+  {
+    m_JobQueued.wait(&m_Mutex);
+  }
+  if(m_ShuttingDown)
+  {
+    return PipelineJob::NullPointer();
+  }
+  m_BusyWorkers++;
+  return m_Queue.dequeue();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJobQueue::runJob(const PipelineJob::Pointer& job)
+{
+  qint64 queueTime = job->getElapsedTime();
+  if(job->isCancelled())
+  {
+    finishJob(job, "Cancelled", 0, QString(), queueTime, 0);
+    return;
+  }
+
+  QJsonObject started;
+  started["event"] = "started";
+  started["queueMs"] = queueTime;
+  job->postEvent(started);
+
+  QElapsedTimer timer;
+  timer.start();
+  JobObserver obs(job);
+  FilterPipeline::Pointer pipeline;
+  {
+    QMutexLocker lock(&m_ReadMutex);
+    JsonFilterParametersReader::Pointer jsonReader = JsonFilterParametersReader::New();
+    pipeline = jsonReader->readPipelineFromString(job->getPipelineJson(), &obs);
+  }
+  if(nullptr == pipeline.get())
+  {
+    finishJob(job, "Invalid", -1, QObject::tr("The request does not contain a valid pipeline"), queueTime, timer.elapsed());
+    return;
+  }
+  pipeline->addMessageReceiver(&obs);
+  if(!job->startPipeline(pipeline))
+  {
+    finishJob(job, "Cancelled", 0, QString(), queueTime, timer.elapsed());
+    return;
+  }
+
+  QString status = "Completed";
+  int err = pipeline->preflightPipeline();
+  if(err < 0)
+  {
+    status = "PreflightFailed";
+  }
+  else if(job->getOperation() == PipelineJob::Operation::Execute && !job->isCancelled())
+  {
+    pipeline->execute();
+    err = pipeline->getErrorCondition();
+    status = err < 0 ? "Failed" : "Completed";
+  }
+  if(job->isCancelled())
+  {
+    status = "Cancelled";
+  }
+  job->stopPipeline();
+  finishJob(job, status, err, obs.getFirstError(), queueTime, timer.elapsed());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineJobQueue::finishJob(const PipelineJob::Pointer& job, const QString& status, int errorCode, const QString& message, qint64 queueTime, qint64 runTime)
+{
+  {
+    QMutexLocker lock(&m_Mutex);
+    if(status == "Completed")
+    {
+      m_Completed++;
+    }
+    else if(status == "Cancelled")
+    {
+      m_Cancelled++;
+    }
+    else
+    {
+      m_Failed++;
+    }
+
+    if(m_QueueTimes.size() < k_LatencySampleCount)
+    {
+      m_QueueTimes.push_back(queueTime);
+      m_RunTimes.push_back(runTime);
+    }
+    else
+    {
+      m_QueueTimes[m_NextSample] = queueTime;
+      m_RunTimes[m_NextSample] = runTime;
+    }
+    m_NextSample = (m_NextSample + 1) % k_LatencySampleCount;
+  }
+
+  QJsonObject done;
+  done["event"] = "done";
+  done["status"] = status;
+  done["errorCode"] = errorCode;
+  done["message"] = message;
+  done["queueMs"] = queueTime;
+  done["runMs"] = runTime;
+  job->postEvent(done, true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineJobQueue::getMetrics()
+{
+  QMutexLocker lock(&m_Mutex);
+  QJsonObject metrics;
+  metrics["workers"] = static_cast<int>(m_Workers.size());
+  metrics["threadsPerWorker"] = m_ThreadsPerWorker;
+  metrics["busyWorkers"] = m_BusyWorkers;
+  metrics["queueDepth"] = m_Queue.size();
+  metrics["maxQueueDepth"] = m_MaxQueueDepth;
+  metrics["submitted"] = static_cast<double>(m_Submitted);
+  metrics["rejected"] = static_cast<double>(m_Rejected);
+  metrics["completed"] = static_cast<double>(m_Completed);
+  metrics["failed"] = static_cast<double>(m_Failed);
+  metrics["cancelled"] = static_cast<double>(m_Cancelled);
+  metrics["queueMs"] = LatencyToJson(m_QueueTimes);
+  metrics["runMs"] = LatencyToJson(m_RunTimes);
+  metrics["allocator"] = DataArrayAllocator::StatisticsToJson(DataArrayAllocator::Instance()->getStatistics());
+  return metrics;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineJobQueue::LatencyToJson(QVector<qint64> samples)
+{
+  QJsonObject latency;
+  latency["samples"] = samples.size();
+  if(samples.isEmpty())
+  {
+    return latency;
+  }
+
+  std::sort(samples.begin(), samples.end());
+  double sum = 0.0;
+  for(qint64 sample : samples)
+  {
+    sum += sample;
+  }
+  int last = samples.size() - 1;
+  latency["mean"] = sum / samples.size();
+  latency["p50"] = static_cast<double>(samples[last * 50 / 100]);
+  latency["p95"] = static_cast<double>(samples[last * 95 / 100]);
+  latency["max"] = static_cast<double>(samples[last]);
+  return latency;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineJobQueue::MessageToJson(const PipelineMessage& msg)
+{
+  QJsonObject event;
+  event["event"] = "message";
+  switch(msg.getType())
+  {
+    case PipelineMessage::MessageType::Error:
+      event["type"] = "Error";
+      break;
+    case PipelineMessage::MessageType::Warning:
+      event["type"] = "Warning";
+      break;
+    case PipelineMessage::MessageType::StatusMessage:
+      event["type"] = "Status";
+      break;
+    case PipelineMessage::MessageType::StandardOutputMessage:
+      event["type"] = "StandardOutput";
+      break;
+    case PipelineMessage::MessageType::ProgressValue:
+      event["type"] = "Progress";
+      break;
+    case PipelineMessage::MessageType::StatusMessageAndProgressValue:
+      event["type"] = "StatusAndProgress";
+      break;
+    default:
+      event["type"] = "Unknown";
+      break;
+  }
+  event["filterClassName"] = msg.getFilterClassName();
+  event["filterHumanLabel"] = msg.getFilterHumanLabel();
+  event["pipelineIndex"] = msg.getPipelineIndex();
+  event["code"] = msg.getCode();
+  event["progress"] = msg.getProgressValue();
+  event["text"] = msg.getText();
+  return event;
+}
@@ -0,0 +1,260 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _pipelinejobqueue_h_
+#define _pipelinejobqueue_h_
+
+#include <vector>
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+#include <QtCore/QQueue>
+#include <QtCore/QString>
+#include <QtCore/QThread>
+#include <QtCore/QVector>
+#include <QtCore/QWaitCondition>
+
+#include "SIMPLib/Common/PipelineMessage.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+
+/**
+ * @brief The PipelineJob class is one request of the pipeline service. The request handler thread that
+ * received it creates the job and reads its events while a worker thread of the PipelineJobQueue runs the
+ * pipeline and posts the events. The operation and the pipeline are set before the job is submitted and are
+ * not changed afterwards; everything else is guarded by the mutex of the job.
+ */
+class PipelineJob
+{
+  public:
+    SIMPL_SHARED_POINTERS(PipelineJob)
+    SIMPL_STATIC_NEW_MACRO(PipelineJob)
+
+    virtual ~PipelineJob();
+
+    enum class Operation : unsigned int
+    {
+      Preflight = 0,
+      Execute = 1
+    };
+
+    SIMPL_INSTANCE_PROPERTY(Operation, Operation)
+    SIMPL_INSTANCE_STRING_PROPERTY(PipelineJson)
+
+    /**
+     * @brief postEvent Appends an event for the request handler. The final event of a job must have last set
+     * and no events may be posted after it.
+     */
+    void postEvent(const QJsonObject& event, bool last = false);
+
+    /**
+     * @brief takeEvents Moves the pending events into events, waiting up to timeout milliseconds if there are
+     * none yet
+     * @return True once the final event of the job has been taken
+     */
+    bool takeEvents(QVector<QJsonObject>& events, unsigned long timeout);
+
+    /**
+     * @brief cancel Cancels the job. A queued job is skipped and a running pipeline is asked to stop after the
+     * filter that is currently running.
+     */
+    void cancel();
+
+    /**
+     * @brief isCancelled Returns whether cancel() was called
+     */
+    bool isCancelled();
+
+    /**
+     * @brief startPipeline Sets the pipeline cancel() stops. The cancelled flag is checked under the same lock
+     * cancel() takes, so a job is either cancelled before its pipeline starts or its pipeline is stopped.
+     * @return False if the job was already cancelled, in which case the pipeline must not be run
+     */
+    bool startPipeline(FilterPipeline::Pointer pipeline);
+
+    /**
+     * @brief stopPipeline Clears the pipeline cancel() stops once the worker is done with it
+     */
+    void stopPipeline();
+
+    /**
+     * @brief reapplyCancel Asks the running pipeline to stop again if the job was cancelled.
+     * FilterPipeline::execute() clears the cancel state of the pipeline when it starts, which would lose a
+     * cancel() that came in between preflight and execute, so the worker calls this for every message the
+     * pipeline sends.
+     */
+    void reapplyCancel();
+
+    /**
+     * @brief getElapsedTime Returns the milliseconds since the job was created
+     */
+    qint64 getElapsedTime() const;
+
+  protected:
+    PipelineJob();
+
+  private:
+    QMutex m_Mutex;
+    QWaitCondition m_EventPosted;
+    QVector<QJsonObject> m_Events;
+    bool m_Finished = false;
+    bool m_Cancelled = false;
+    FilterPipeline::Pointer m_RunningPipeline;
+    QElapsedTimer m_Timer;
+
+    PipelineJob(const PipelineJob&) = delete; // Copy Constructor Not Implemented
+    void operator=(const PipelineJob&) = delete; // Move assignment Not Implemented
+};
+
+/**
+ * @brief The PipelineJobQueue class preflights or executes PipelineJobs on a fixed number of worker threads.
+ *
+ * The workers live as long as the queue, so every job runs with the plugins that were loaded when the
+ * service started and without the cost of starting a thread or a process. Each worker caps the number of
+ * threads its parallel algorithms use so that the workers together do not oversubscribe the machine.
+ *
+ * Reading a pipeline registers filter factories with the global FilterManager, which is not thread safe,
+ * so the workers read their pipelines one at a time. HDF5 is usually not built thread safe either; more
+ * than one worker should only be used with a thread safe HDF5 or with pipelines that do not read or write
+ * HDF5 files.
+ *
+ * The queue also keeps the metrics of the service: counters of the finished jobs and the queue wait and run
+ * times of the most recent jobs.
+ */
+class PipelineJobQueue
+{
+  public:
+    /**
+     * @brief PipelineJobQueue Starts the worker threads
+     * @param workerCount Number of pipelines that run at the same time
+     * @param threadsPerWorker Number of threads each pipeline may use for its parallel algorithms
+     * @param maxQueueDepth Number of jobs that may wait for a worker before new jobs are rejected
+     */
+    PipelineJobQueue(int workerCount, int threadsPerWorker, int maxQueueDepth);
+
+    /**
+     * @brief ~PipelineJobQueue Cancels the queued jobs and waits for the running ones to finish
+     */
+    virtual ~PipelineJobQueue();
+
+    /**
+     * @brief submit Appends a job to the queue
+     * @return False if the queue is full or shutting down, in which case the job is not run
+     */
+    bool submit(PipelineJob::Pointer job);
+
+    /**
+     * @brief shutdown Stops accepting jobs, cancels the queued jobs and waits for the workers to finish
+     */
+    void shutdown();
+
+    /**
+     * @brief getMetrics Returns the queue depth, the job counters and the latency statistics as JSON
+     */
+    QJsonObject getMetrics();
+
+    /**
+     * @brief MessageToJson Converts a message of a running pipeline into a job event
+     */
+    static QJsonObject MessageToJson(const PipelineMessage& msg);
+
+  protected:
+    /**
+     * @brief The Worker class is one of the threads that run the jobs
+     */
+    class Worker : public QThread
+    {
+      public:
+        Worker(PipelineJobQueue* queue, int threadCount);
+        ~Worker() override;
+
+      protected:
+        void run() override;
+
+      private:
+        PipelineJobQueue* m_Queue;
+        int m_ThreadCount;
+    };
+
+    /**
+     * @brief takeJob Blocks until a job is queued
+     * @param finishedJob Whether the calling worker just finished a job and is idle again
+     * @return The job or a null pointer once the queue shuts down
+     */
+    PipelineJob::Pointer takeJob(bool finishedJob);
+
+    /**
+     * @brief runJob Reads, preflights and, if requested, executes the pipeline of a job and posts its events
+     */
+    void runJob(const PipelineJob::Pointer& job);
+
+    /**
+     * @brief finishJob Posts the final event of a job and updates the metrics
+     */
+    void finishJob(const PipelineJob::Pointer& job, const QString& status, int errorCode, const QString& message, qint64 queueTime, qint64 runTime);
+
+    /**
+     * @brief LatencyToJson Returns the mean, the 50th and 95th percentile and the maximum of a set of latencies
+     */
+    static QJsonObject LatencyToJson(QVector<qint64> samples);
+
+  private:
+    int m_MaxQueueDepth;
+    std::vector<Worker*> m_Workers;
+
+    QMutex m_Mutex;
+    QWaitCondition m_JobQueued;
+    QQueue<PipelineJob::Pointer> m_Queue;
+    bool m_ShuttingDown = false;
+    int m_BusyWorkers = 0;
+    int m_ThreadsPerWorker;
+
+    quint64 m_Submitted = 0;
+    quint64 m_Rejected = 0;
+    quint64 m_Completed = 0;
+    quint64 m_Failed = 0;
+    quint64 m_Cancelled = 0;
+    QVector<qint64> m_QueueTimes;
+    QVector<qint64> m_RunTimes;
+    int m_NextSample = 0;
+
+    QMutex m_ReadMutex;
+
+    PipelineJobQueue(const PipelineJobQueue&) = delete; // Copy Constructor Not Implemented
+    void operator=(const PipelineJobQueue&) = delete;   // Move assignment Not Implemented
+};
+
+#endif /* _pipelinejobqueue_h_ */
@@ -0,0 +1,175 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineRequestHandler.h"
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonParseError>
+
+namespace
+{
+// Milliseconds without an event after which a keep-alive is written
+const unsigned long k_KeepAliveInterval = 5000;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineRequestHandler::PipelineRequestHandler(PipelineJobQueue* queue, QObject* parent)
+: HttpRequestHandler(parent)
+, m_Queue(queue)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineRequestHandler::~PipelineRequestHandler() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineRequestHandler::service(HttpRequest& request, HttpResponse& response)
+{
+  QByteArray path = request.getPath();
+  QByteArray method = request.getMethod();
+
+  if(path == "/health" && method == "GET")
+  {
+    QJsonObject health;
+    health["status"] = "ok";
+    writeJson(response, 200, "OK", health);
+  }
+  else if(path == "/metrics" && method == "GET")
+  {
+    writeJson(response, 200, "OK", m_Queue->getMetrics());
+  }
+  else if(path == "/preflight" && method == "POST")
+  {
+    runJob(request, response, PipelineJob::Operation::Preflight);
+  }
+  else if(path == "/execute" && method == "POST")
+  {
+    runJob(request, response, PipelineJob::Operation::Execute);
+  }
+  else
+  {
+    QJsonObject error;
+    error["error"] = QString("No resource %1 %2").arg(QString(method)).arg(QString(path));
+    writeJson(response, 404, "Not Found", error);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineRequestHandler::writeJson(HttpResponse& response, int statusCode, const QByteArray& description, const QJsonObject& json)
+{
+  response.setStatus(statusCode, description);
+  response.setHeader("Content-Type", "application/json");
+  response.write(QJsonDocument(json).toJson(QJsonDocument::Compact), true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineRequestHandler::runJob(HttpRequest& request, HttpResponse& response, PipelineJob::Operation operation)
+{
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(request.getBody(), &parseError);
+  if(parseError.error != QJsonParseError::NoError || !doc.isObject())
+  {
+    QJsonObject error;
+    error["error"] = QString("The request body is not a JSON pipeline: %1").arg(parseError.errorString());
+    writeJson(response, 400, "Bad Request", error);
+    return;
+  }
+
+  PipelineJob::Pointer job = PipelineJob::New();
+  job->setOperation(operation);
+  job->setPipelineJson(QString::fromUtf8(request.getBody()));
+
+  // Posted before the job is submitted so that it is always the first event
+  QJsonObject accepted;
+  accepted["event"] = "accepted";
+  job->postEvent(accepted);
+  if(!m_Queue->submit(job))
+  {
+    QJsonObject error;
+    error["error"] = QString("The job queue is full");
+    writeJson(response, 503, "Service Unavailable", error);
+    return;
+  }
+
+  bool sse = request.getParameter("format") == "sse" || request.getHeader("Accept").contains("text/event-stream");
+  response.setStatus(200, "OK");
+  response.setHeader("Content-Type", sse ? "text/event-stream" : "application/x-ndjson");
+  response.setHeader("Cache-Control", "no-cache");
+
+  bool finished = false;
+  while(!finished)
+  {
+    QVector<QJsonObject> events;
+    finished = job->takeEvents(events, k_KeepAliveInterval);
+
+    QByteArray chunk;
+    if(events.isEmpty())
+    {
+      chunk = sse ? QByteArray(": keep-alive\n\n") : QByteArray("{\"event\":\"keep-alive\"}\n");
+    }
+    for(const QJsonObject& event : events)
+    {
+      QByteArray data = QJsonDocument(event).toJson(QJsonDocument::Compact);
+      if(sse)
+      {
+        chunk += "event: " + event["event"].toString().toUtf8() + "\ndata: " + data + "\n\n";
+      }
+      else
+      {
+        chunk += data + "\n";
+      }
+    }
+
+    // The socket only notices a closed connection when it tries to send, so flush every chunk
+    response.write(chunk);
+    response.flush();
+    if(!response.isConnected())
+    {
+      job->cancel();
+      return;
+    }
+  }
+  response.write(QByteArray(), true);
+}
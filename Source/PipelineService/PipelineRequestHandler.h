@@ -0,0 +1,92 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _pipelinerequesthandler_h_
+#define _pipelinerequesthandler_h_
+
+#include <QtCore/QJsonObject>
+
+#include "QtWebApp/httpserver/httprequesthandler.h"
+
+#include "PipelineJobQueue.h"
+
+/**
+ * @brief The PipelineRequestHandler class implements the HTTP interface of the pipeline service:
+ *
+ * @li GET /health answers {"status": "ok"} while the service runs.
+ * @li GET /metrics returns the queue depth, the job counters, the queue wait and run times of the most
+ * recent jobs and the DataArrayAllocator statistics, see PipelineJobQueue::getMetrics().
+ * @li POST /preflight and POST /execute take a JSON pipeline, in the format of a .json pipeline file, as the
+ * request body and preflight or execute it.
+ *
+ * The pipeline requests stream their events while the pipeline runs: an "accepted" event, a "started" event
+ * once a worker picks up the job, a "message" event for every PipelineMessage and a final "done" event with
+ * the status and error code of the job. By default every event is written as one line of JSON
+ * (application/x-ndjson). Clients that send "Accept: text/event-stream" or the parameter format=sse receive
+ * server-sent events instead, where the name of each event is its "event" value. A keep-alive is written
+ * while a job produces no events so that a client which has gone away is noticed and its job cancelled.
+ *
+ * A request is answered with 400 if its body is not a JSON object and with 503 if the queue is full.
+ */
+class PipelineRequestHandler : public HttpRequestHandler
+{
+  public:
+    PipelineRequestHandler(PipelineJobQueue* queue, QObject* parent = nullptr);
+    ~PipelineRequestHandler() override;
+
+    /**
+     * @brief service Answers one request. Called on the thread of the connection.
+     */
+    void service(HttpRequest& request, HttpResponse& response) override;
+
+  protected:
+    /**
+     * @brief writeJson Writes a complete JSON response
+     */
+    void writeJson(HttpResponse& response, int statusCode, const QByteArray& description, const QJsonObject& json);
+
+    /**
+     * @brief runJob Submits a pipeline request to the queue and streams its events
+     */
+    void runJob(HttpRequest& request, HttpResponse& response, PipelineJob::Operation operation);
+
+  private:
+    PipelineJobQueue* m_Queue;
+
+    PipelineRequestHandler(const PipelineRequestHandler&) = delete; // Copy Constructor Not Implemented
+    void operator=(const PipelineRequestHandler&) = delete;         // Move assignment Not Implemented
+};
+
+#endif /* _pipelinerequesthandler_h_ */
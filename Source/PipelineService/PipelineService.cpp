@@ -0,0 +1,158 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+// C++ Includes
+#include <algorithm>
+#include <iostream>
+
+// Qt Includes
+#include <QtCore/QCommandLineOption>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QSettings>
+#include <QtCore/QString>
+#include <QtCore/QTextStream>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
+
+#include <hdf5.h>
+
+#include "QtWebApp/httpserver/httplistener.h"
+
+// SIMPLib includes
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/SIMPLibVersion.h"
+
+#include "PipelineJobQueue.h"
+#include "PipelineRequestHandler.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  QCoreApplication* app = new QCoreApplication(argc, argv);
+  app->setOrganizationName("BlueQuartz Software");
+  app->setOrganizationDomain("bluequartz.net");
+  app->setApplicationName("PipelineService");
+  app->setApplicationVersion(SIMPLib::Version::Major() + "." + SIMPLib::Version::Minor() + "." + SIMPLib::Version::Patch());
+
+  QCommandLineParser parser;
+  QString str;
+  QTextStream ss(&str);
+  ss << "Pipeline Service (" << SIMPLib::Version::Major() << "." << SIMPLib::Version::Minor() << "." << SIMPLib::Version::Patch()
+     << "): This application preflights and executes JSON pipelines that are sent to it over HTTP.";
+  parser.setApplicationDescription(str);
+  parser.addHelpOption();
+  parser.addVersionOption();
+
+  QCommandLineOption hostArg(QStringList() << "host", "Address the service listens on. Defaults to 127.0.0.1.", "address", "127.0.0.1");
+  parser.addOption(hostArg);
+
+  QCommandLineOption portArg(QStringList() << "port", "Port the service listens on. Defaults to 8090; 0 picks a free port, which is printed once the service listens.", "port", "8090");
+  parser.addOption(portArg);
+
+#ifdef H5_HAVE_THREADSAFE
+  int defaultWorkers = std::max(1, QThread::idealThreadCount() / 4);
+#else
+  int defaultWorkers = 1;
+#endif
+  QCommandLineOption workersArg(QStringList() << "workers",
+                                QString("Number of pipelines that run at the same time. Defaults to %1.").arg(defaultWorkers), "count", QString::number(defaultWorkers));
+  parser.addOption(workersArg);
+
+  QCommandLineOption threadsArg(QStringList() << "threads",
+                                "Number of threads each running pipeline may use. Defaults to the number of cores divided by the number of workers.", "count");
+  parser.addOption(threadsArg);
+
+  QCommandLineOption maxQueueArg(QStringList() << "max-queue", "Number of jobs that may wait for a worker before new jobs are rejected. Defaults to 64.", "count", "64");
+  parser.addOption(maxQueueArg);
+
+  parser.process(*app);
+
+  int workerCount = std::max(1, parser.value(workersArg).toInt());
+  int threadsPerWorker = std::max(1, QThread::idealThreadCount() / workerCount);
+  if(parser.isSet(threadsArg))
+  {
+    threadsPerWorker = std::max(1, parser.value(threadsArg).toInt());
+  }
+  int maxQueueDepth = std::max(1, parser.value(maxQueueArg).toInt());
+
+  std::cout << "PipelineService Starting. " << std::endl;
+  std::cout << "   " << SIMPLib::Version::PackageComplete().toStdString() << std::endl;
+#ifndef H5_HAVE_THREADSAFE
+  if(workerCount > 1)
+  {
+    std::cout << "WARNING: HDF5 is not built thread safe. Pipelines that run at the same time must not read or write HDF5 files." << std::endl;
+  }
+#endif
+
+  // Every plugin is loaded now so that the workers never load one while another worker reads a pipeline
+  FilterManager* fm = FilterManager::Instance();
+  SIMPLibPluginLoader::LoadPluginFilters(fm, false, false);
+  QMetaObjectUtilities::RegisterMetaTypes();
+  QThreadPool::globalInstance()->setMaxThreadCount(workerCount * threadsPerWorker);
+
+  PipelineJobQueue jobQueue(workerCount, threadsPerWorker, maxQueueDepth);
+
+  QSettings* listenerSettings = new QSettings(app);
+  listenerSettings->beginGroup("listener");
+  listenerSettings->setValue("host", parser.value(hostArg));
+  listenerSettings->setValue("port", parser.value(portArg));
+  listenerSettings->setValue("minThreads", "4");
+  listenerSettings->setValue("maxThreads", QString::number(workerCount + maxQueueDepth + 4));
+  listenerSettings->setValue("readTimeout", "60000");
+  listenerSettings->setValue("maxRequestSize", "64000000");
+  listenerSettings->setValue("maxMultiPartSize", "64000000");
+
+  PipelineRequestHandler* requestHandler = new PipelineRequestHandler(&jobQueue, app);
+  HttpListener* listener = new HttpListener(listenerSettings, requestHandler, app);
+  if(!listener->isListening())
+  {
+    std::cout << "The service could not listen on " << parser.value(hostArg).toStdString() << ":" << parser.value(portArg).toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+  // serverPort() is the bound port, which differs from the requested one when port 0 asked for a free port
+  std::cout << "Listening on http://" << parser.value(hostArg).toStdString() << ":" << listener->serverPort() << " with " << workerCount << " worker(s) of "
+            << threadsPerWorker << " thread(s)" << std::endl;
+
+  int result = app->exec();
+  listener->close();
+  jobQueue.shutdown();
+  return result;
+}
@@ -0,0 +1,359 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <iostream>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QList>
+#include <QtCore/QSemaphore>
+#include <QtCore/QSettings>
+#include <QtCore/QThread>
+#include <QtNetwork/QHostAddress>
+#include <QtNetwork/QTcpSocket>
+
+#include "QtWebApp/httpserver/httplistener.h"
+
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+#include "PipelineJobQueue.h"
+#include "PipelineRequestHandler.h"
+
+namespace
+{
+// Milliseconds the test waits for the service before it gives up
+const int k_Timeout = 30000;
+}
+
+/**
+ * @brief The ServiceThread class runs the HTTP listener of the pipeline service on an ephemeral port. The
+ * listener needs an event loop, so it runs on a thread of its own and the test talks to it with blocking
+ * sockets from the main thread.
+ */
+class ServiceThread : public QThread
+{
+public:
+  ServiceThread(PipelineJobQueue* queue)
+  : m_Queue(queue)
+  {
+  }
+  ~ServiceThread() override = default;
+
+  /**
+   * @brief waitUntilListening Blocks until the listener is set up
+   * @return The port the listener is bound to or 0 if it could not listen
+   */
+  quint16 waitUntilListening()
+  {
+    m_Listening.acquire();
+    return m_Port;
+  }
+
+protected:
+  void run() override
+  {
+    QSettings settings(SettingsFile(), QSettings::IniFormat);
+    settings.beginGroup("listener");
+    settings.setValue("host", "127.0.0.1");
+    settings.setValue("port", "0");
+    settings.setValue("minThreads", "2");
+    settings.setValue("maxThreads", "8");
+    settings.setValue("readTimeout", "60000");
+    settings.setValue("maxRequestSize", "64000000");
+    settings.setValue("maxMultiPartSize", "64000000");
+
+    PipelineRequestHandler requestHandler(m_Queue);
+    HttpListener listener(&settings, &requestHandler);
+    m_Port = listener.isListening() ? listener.serverPort() : 0;
+    m_Listening.release();
+    if(m_Port != 0)
+    {
+      exec();
+    }
+    listener.close();
+  }
+
+public:
+  static QString SettingsFile()
+  {
+    return QDir::tempPath() + "/PipelineServiceTest.ini";
+  }
+
+private:
+  PipelineJobQueue* m_Queue;
+  quint16 m_Port = 0;
+  QSemaphore m_Listening;
+};
+
+/**
+ * @brief The PipelineServiceTest class sends requests to the HTTP interface of the pipeline service
+ */
+class PipelineServiceTest
+{
+public:
+  PipelineServiceTest()
+  {
+  }
+  virtual ~PipelineServiceTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+    QFile::remove(ServiceThread::SettingsFile());
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QByteArray PipelineJson()
+  {
+    return QByteArray("{"
+                      "\"0\": {\"Filter_Name\": \"CreateDataContainer\", \"Filter_Enabled\": true, \"DataContainerName\": \"DataContainer\"},"
+                      "\"PipelineBuilder\": {\"Name\": \"PipelineServiceTest\", \"Number_Filters\": 1, \"Version\": 6}"
+                      "}");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void SendRequest(QTcpSocket& socket, quint16 port, const QByteArray& method, const QByteArray& path, const QByteArray& body)
+  {
+    socket.connectToHost(QHostAddress(QHostAddress::LocalHost), port);
+    DREAM3D_REQUIRE(socket.waitForConnected(k_Timeout))
+
+    // Connection: close keeps the service from sending chunks, so the body can be read as it is
+    QByteArray request = method + " " + path + " HTTP/1.1\r\n";
+    request += "Host: 127.0.0.1\r\n";
+    request += "Connection: close\r\n";
+    if(!body.isEmpty())
+    {
+      request += "Content-Type: application/json\r\n";
+      request += "Content-Length: " + QByteArray::number(body.size()) + "\r\n";
+    }
+    request += "\r\n" + body;
+    socket.write(request);
+    DREAM3D_REQUIRE(socket.waitForBytesWritten(k_Timeout))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QByteArray ReadUntilClosed(QTcpSocket& socket)
+  {
+    QByteArray data = socket.readAll();
+    while(socket.state() == QAbstractSocket::ConnectedState && socket.waitForReadyRead(k_Timeout))
+    {
+      data += socket.readAll();
+    }
+    data += socket.readAll();
+    return data;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QByteArray ReadUntil(QTcpSocket& socket, const QByteArray& token)
+  {
+    QByteArray data = socket.readAll();
+    while(!data.contains(token) && socket.waitForReadyRead(k_Timeout))
+    {
+      data += socket.readAll();
+    }
+    return data;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int StatusCode(const QByteArray& response)
+  {
+    // "HTTP/1.1 200 OK"
+    QList<QByteArray> statusLine = response.left(response.indexOf("\r\n")).split(' ');
+    return statusLine.size() < 2 ? -1 : statusLine[1].toInt();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QByteArray Body(const QByteArray& response)
+  {
+    int end = response.indexOf("\r\n\r\n");
+    return end < 0 ? QByteArray() : response.mid(end + 4);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QList<QJsonObject> Events(const QByteArray& response)
+  {
+    QList<QJsonObject> events;
+    for(const QByteArray& line : Body(response).split('\n'))
+    {
+      if(line.trimmed().isEmpty())
+      {
+        continue;
+      }
+      QJsonParseError parseError;
+      QJsonDocument doc = QJsonDocument::fromJson(line, &parseError);
+      DREAM3D_REQUIRE(parseError.error == QJsonParseError::NoError)
+      DREAM3D_REQUIRE(doc.isObject())
+      events.push_back(doc.object());
+    }
+    return events;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPreflightStreamsEvents()
+  {
+    PipelineJobQueue queue(1, 1, 4);
+    ServiceThread service(&queue);
+    service.start();
+    quint16 port = service.waitUntilListening();
+    DREAM3D_REQUIRE(port != 0)
+
+    QTcpSocket socket;
+    SendRequest(socket, port, "POST", "/preflight", PipelineJson());
+    QByteArray response = ReadUntilClosed(socket);
+
+    service.quit();
+    service.wait();
+    queue.shutdown();
+
+    DREAM3D_REQUIRE_EQUAL(StatusCode(response), 200)
+    DREAM3D_REQUIRE(response.contains("application/x-ndjson"))
+
+    QList<QJsonObject> events = Events(response);
+    DREAM3D_REQUIRE(events.size() >= 3)
+    DREAM3D_REQUIRE(events.front()["event"].toString() == "accepted")
+    DREAM3D_REQUIRE(events[1]["event"].toString() == "started")
+    DREAM3D_REQUIRE(events.back()["event"].toString() == "done")
+    DREAM3D_REQUIRE(events.back()["status"].toString() == "Completed")
+    DREAM3D_REQUIRE_EQUAL(events.back()["errorCode"].toInt(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFullQueueIsRejected()
+  {
+    // Without a worker the first job stays queued, which fills a queue of depth 1
+    PipelineJobQueue queue(0, 1, 1);
+    ServiceThread service(&queue);
+    service.start();
+    quint16 port = service.waitUntilListening();
+    DREAM3D_REQUIRE(port != 0)
+
+    QTcpSocket queued;
+    SendRequest(queued, port, "POST", "/execute", PipelineJson());
+    QByteArray queuedResponse = ReadUntil(queued, "\"accepted\"");
+    DREAM3D_REQUIRE_EQUAL(StatusCode(queuedResponse), 200)
+
+    QTcpSocket rejected;
+    SendRequest(rejected, port, "POST", "/execute", PipelineJson());
+    QByteArray rejectedResponse = ReadUntilClosed(rejected);
+    DREAM3D_REQUIRE_EQUAL(StatusCode(rejectedResponse), 503)
+
+    QTcpSocket metrics;
+    SendRequest(metrics, port, "GET", "/metrics", QByteArray());
+    QByteArray metricsResponse = ReadUntilClosed(metrics);
+    DREAM3D_REQUIRE_EQUAL(StatusCode(metricsResponse), 200)
+    QJsonObject metricsJson = QJsonDocument::fromJson(Body(metricsResponse)).object();
+    DREAM3D_REQUIRE_EQUAL(metricsJson["queueDepth"].toInt(), 1)
+    DREAM3D_REQUIRE_EQUAL(metricsJson["maxQueueDepth"].toInt(), 1)
+    DREAM3D_REQUIRE_EQUAL(metricsJson["busyWorkers"].toInt(), 0)
+    DREAM3D_REQUIRE_EQUAL(metricsJson["submitted"].toInt(), 1)
+    DREAM3D_REQUIRE_EQUAL(metricsJson["rejected"].toInt(), 1)
+
+    // Shutting the queue down cancels the queued job, which ends its stream
+    queue.shutdown();
+    queuedResponse += ReadUntilClosed(queued);
+
+    service.quit();
+    service.wait();
+
+    QList<QJsonObject> events = Events(queuedResponse);
+    DREAM3D_REQUIRE(events.size() >= 2)
+    DREAM3D_REQUIRE(events.front()["event"].toString() == "accepted")
+    DREAM3D_REQUIRE(events.back()["event"].toString() == "done")
+    DREAM3D_REQUIRE(events.back()["status"].toString() == "Cancelled")
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### PipelineServiceTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestPreflightStreamsEvents())
+    DREAM3D_REGISTER_TEST(TestFullQueueIsRejected())
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+private:
+  PipelineServiceTest(const PipelineServiceTest&); // Copy Constructor Not Implemented
+  void operator=(const PipelineServiceTest&);      // Move assignment Not Implemented
+};
+
+// -----------------------------------------------------------------------------
+//  Use test framework
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  int err = EXIT_SUCCESS;
+
+  QCoreApplication app(argc, argv);
+
+  PipelineServiceTest()();
+
+  PRINT_TEST_SUMMARY();
+
+  return err;
+}
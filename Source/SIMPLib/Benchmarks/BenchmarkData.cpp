@@ -0,0 +1,269 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "BenchmarkData.h"
+
+#include <cmath>
+#include <random>
+
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+namespace
+{
+const unsigned int k_Seed = 5489u;
+
+// Edge length of the blocks the FeatureIds of CreateImageVolume() are made of
+const size_t k_BlockSize = 8;
+}
+
+const QString BenchmarkData::DataContainerName("BenchmarkDataContainer");
+const QString BenchmarkData::CellAttributeMatrixName("CellData");
+const QString BenchmarkData::FeatureAttributeMatrixName("FeatureData");
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BenchmarkData::BenchmarkData() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BenchmarkData::~BenchmarkData() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BenchmarkSize BenchmarkData::Size(const QString& name)
+{
+  BenchmarkSize size;
+  if(name == "small")
+  {
+    size.name = name;
+    size.volumeDimension = 32;
+    size.meshDimension = 64;
+    size.featureCount = 10000;
+    size.arrayTuples = 1000000;
+    size.asciiLines = 10000;
+  }
+  else if(name == "medium")
+  {
+    size.name = name;
+    size.volumeDimension = 128;
+    size.meshDimension = 512;
+    size.featureCount = 100000;
+    size.arrayTuples = 16000000;
+    size.asciiLines = 200000;
+  }
+  else if(name == "large")
+  {
+    size.name = name;
+    size.volumeDimension = 256;
+    size.meshDimension = 1024;
+    size.featureCount = 1000000;
+    size.arrayTuples = 64000000;
+    size.asciiLines = 1000000;
+  }
+  return size;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer BenchmarkData::CreateImageVolume(size_t dimension)
+{
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New(DataContainerName);
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+  image->setDimensions(dimension, dimension, dimension);
+  dc->setGeometry(image);
+
+  size_t blocksPerDim = (dimension + k_BlockSize - 1) / k_BlockSize;
+  size_t numFeatures = blocksPerDim * blocksPerDim * blocksPerDim + 1;
+
+  QVector<size_t> tDims = {dimension, dimension, dimension};
+  AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tDims, CellAttributeMatrixName, AttributeMatrix::Type::Cell);
+  FloatArrayType::Pointer floatField = FloatArrayType::CreateArray(tDims, QVector<size_t>(1, 1), "Float");
+  DoubleArrayType::Pointer doubleField = DoubleArrayType::CreateArray(tDims, QVector<size_t>(1, 1), "Double");
+  Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(tDims, QVector<size_t>(1, 1), "FeatureIds");
+  FloatArrayType::Pointer eulers = FloatArrayType::CreateArray(tDims, QVector<size_t>(1, 3), "Eulers");
+
+  float* floatPtr = floatField->getPointer(0);
+  double* doublePtr = doubleField->getPointer(0);
+  int32_t* featureIdsPtr = featureIds->getPointer(0);
+  float* eulersPtr = eulers->getPointer(0);
+  std::mt19937 generator(k_Seed);
+  std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+  size_t index = 0;
+  for(size_t z = 0; z < dimension; z++)
+  {
+    for(size_t y = 0; y < dimension; y++)
+    {
+      for(size_t x = 0; x < dimension; x++)
+      {
+        floatPtr[index] = std::sin(0.1f * x) * std::cos(0.07f * y) + 0.01f * z;
+        doublePtr[index] = std::cos(0.05 * x) + std::sin(0.09 * y) * std::cos(0.03 * z);
+        size_t block = ((z / k_BlockSize) * blocksPerDim + y / k_BlockSize) * blocksPerDim + x / k_BlockSize;
+        featureIdsPtr[index] = static_cast<int32_t>(block + 1);
+        eulersPtr[3 * index] = angle(generator);
+        eulersPtr[3 * index + 1] = 0.5f * angle(generator);
+        eulersPtr[3 * index + 2] = angle(generator);
+        index++;
+      }
+    }
+  }
+  cellAm->addAttributeArray(floatField->getName(), floatField);
+  cellAm->addAttributeArray(doubleField->getName(), doubleField);
+  cellAm->addAttributeArray(featureIds->getName(), featureIds);
+  cellAm->addAttributeArray(eulers->getName(), eulers);
+  dc->addAttributeMatrix(cellAm->getName(), cellAm);
+  dc->addAttributeMatrix(FeatureAttributeMatrixName, CreateFeatureMatrix(numFeatures));
+
+  dca->addDataContainer(dc);
+  return dca;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TriangleGeom::Pointer BenchmarkData::CreateTriangleMesh(size_t dimension)
+{
+  size_t vertsPerRow = dimension + 1;
+  SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(static_cast<int64_t>(vertsPerRow * vertsPerRow));
+  float* vertPtr = vertices->getPointer(0);
+  for(size_t y = 0; y < vertsPerRow; y++)
+  {
+    for(size_t x = 0; x < vertsPerRow; x++)
+    {
+      size_t v = y * vertsPerRow + x;
+      vertPtr[3 * v] = static_cast<float>(x);
+      vertPtr[3 * v + 1] = static_cast<float>(y);
+      vertPtr[3 * v + 2] = 2.0f * std::sin(0.2f * x) * std::cos(0.15f * y);
+    }
+  }
+
+  TriangleGeom::Pointer triangles = TriangleGeom::CreateGeometry(static_cast<int64_t>(2 * dimension * dimension), vertices, SIMPL::Geometry::TriangleGeometry);
+  int64_t* triPtr = triangles->getTriangles()->getPointer(0);
+  size_t t = 0;
+  for(size_t y = 0; y < dimension; y++)
+  {
+    for(size_t x = 0; x < dimension; x++)
+    {
+      int64_t v0 = static_cast<int64_t>(y * vertsPerRow + x);
+      int64_t v1 = v0 + 1;
+      int64_t v2 = v0 + static_cast<int64_t>(vertsPerRow);
+      int64_t v3 = v2 + 1;
+      triPtr[3 * t] = v0;
+      triPtr[3 * t + 1] = v1;
+      triPtr[3 * t + 2] = v3;
+      t++;
+      triPtr[3 * t] = v0;
+      triPtr[3 * t + 1] = v3;
+      triPtr[3 * t + 2] = v2;
+      t++;
+    }
+  }
+  return triangles;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AttributeMatrix::Pointer BenchmarkData::CreateFeatureMatrix(size_t featureCount)
+{
+  QVector<size_t> tDims(1, featureCount);
+  AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, FeatureAttributeMatrixName, AttributeMatrix::Type::CellFeature);
+
+  BoolArrayType::Pointer active = BoolArrayType::CreateArray(tDims, QVector<size_t>(1, 1), "Active");
+  Int32ArrayType::Pointer phases = Int32ArrayType::CreateArray(tDims, QVector<size_t>(1, 1), "Phases");
+  Int32ArrayType::Pointer numCells = Int32ArrayType::CreateArray(tDims, QVector<size_t>(1, 1), "NumCells");
+  FloatArrayType::Pointer volumes = FloatArrayType::CreateArray(tDims, QVector<size_t>(1, 1), "Volumes");
+  FloatArrayType::Pointer diameters = FloatArrayType::CreateArray(tDims, QVector<size_t>(1, 1), "EquivalentDiameters");
+  FloatArrayType::Pointer centroids = FloatArrayType::CreateArray(tDims, QVector<size_t>(1, 3), "Centroids");
+  FloatArrayType::Pointer axisEulers = FloatArrayType::CreateArray(tDims, QVector<size_t>(1, 3), "AxisEulerAngles");
+
+  std::mt19937 generator(k_Seed);
+  std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+  std::uniform_int_distribution<int32_t> cells(1, 2000);
+  for(size_t i = 0; i < featureCount; i++)
+  {
+    int32_t count = cells(generator);
+    active->setValue(i, i > 0);
+    phases->setValue(i, i > 0 ? 1 + static_cast<int32_t>(i % 3) : 0);
+    numCells->setValue(i, count);
+    volumes->setValue(i, static_cast<float>(count));
+    diameters->setValue(i, std::cbrt(6.0f * count / 3.1415927f));
+    for(int c = 0; c < 3; c++)
+    {
+      centroids->setComponent(i, c, 100.0f * unit(generator));
+      axisEulers->setComponent(i, c, 6.2831853f * unit(generator));
+    }
+  }
+
+  am->addAttributeArray(active->getName(), active);
+  am->addAttributeArray(phases->getName(), phases);
+  am->addAttributeArray(numCells->getName(), numCells);
+  am->addAttributeArray(volumes->getName(), volumes);
+  am->addAttributeArray(diameters->getName(), diameters);
+  am->addAttributeArray(centroids->getName(), centroids);
+  am->addAttributeArray(axisEulers->getName(), axisEulers);
+  return am;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BenchmarkData::WriteAsciiFile(const QString& filePath, size_t lineCount)
+{
+  QFile file(filePath);
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+  {
+    return false;
+  }
+
+  std::mt19937 generator(k_Seed);
+  std::uniform_real_distribution<float> values(-1000.0f, 1000.0f);
+  std::uniform_int_distribution<int32_t> ids(0, 100000);
+  QTextStream out(&file);
+  for(size_t i = 0; i < lineCount; i++)
+  {
+    out << values(generator) << "," << ids(generator) << "\n";
+  }
+  return out.status() == QTextStream::Ok;
+}
@@ -0,0 +1,112 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _benchmarkdata_h_
+#define _benchmarkdata_h_
+
+#include <QtCore/QString>
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+/**
+ * @brief The BenchmarkSize struct holds the problem sizes of one benchmark preset
+ */
+struct BenchmarkSize
+{
+  QString name;
+  size_t volumeDimension = 0; // Edge length of the ImageGeom volumes in voxels
+  size_t meshDimension = 0;   // Edge length of the triangulated grid surface in quads
+  size_t featureCount = 0;    // Number of tuples of the feature attribute matrices
+  size_t arrayTuples = 0;     // Number of tuples of the plain DataArrays
+  size_t asciiLines = 0;      // Number of lines of the generated ASCII files
+};
+
+/**
+ * @brief The BenchmarkData class generates the synthetic inputs of the benchmarks. All generators use a fixed
+ * seed so that every run of every build processes exactly the same data.
+ */
+class BenchmarkData
+{
+  public:
+    virtual ~BenchmarkData();
+
+    static const QString DataContainerName;
+    static const QString CellAttributeMatrixName;
+    static const QString FeatureAttributeMatrixName;
+
+    /**
+     * @brief Size Returns one of the presets "small", "medium" or "large". Unknown names return an empty
+     * preset.
+     */
+    static BenchmarkSize Size(const QString& name);
+
+    /**
+     * @brief CreateImageVolume Creates a DataContainerArray holding one ImageGeom of dimension^3 voxels. Its cell
+     * attribute matrix holds a smooth "Float" field, a "Double" field, "FeatureIds" that split the volume into
+     * blocks of 8^3 voxels and a 3 component "Eulers" array. The feature attribute matrix holds one tuple per
+     * block.
+     */
+    static DataContainerArray::Pointer CreateImageVolume(size_t dimension);
+
+    /**
+     * @brief CreateTriangleMesh Triangulates a wavy grid surface of dimension x dimension quads, which gives
+     * (dimension + 1)^2 vertices and 2 * dimension^2 triangles
+     */
+    static TriangleGeom::Pointer CreateTriangleMesh(size_t dimension);
+
+    /**
+     * @brief CreateFeatureMatrix Creates a feature attribute matrix with the typical statistics arrays of a
+     * segmented volume: "Active", "Phases", "NumCells", "Volumes", "EquivalentDiameters", "Centroids" and
+     * "AxisEulerAngles"
+     */
+    static AttributeMatrix::Pointer CreateFeatureMatrix(size_t featureCount);
+
+    /**
+     * @brief WriteAsciiFile Writes a comma separated file with one float and one integer column per line
+     * @return False if the file could not be written
+     */
+    static bool WriteAsciiFile(const QString& filePath, size_t lineCount);
+
+  protected:
+    BenchmarkData();
+
+  private:
+    BenchmarkData(const BenchmarkData&) = delete; // Copy Constructor Not Implemented
+    void operator=(const BenchmarkData&) = delete; // Move assignment Not Implemented
+};
+
+#endif /* _benchmarkdata_h_ */
@@ -0,0 +1,301 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "BenchmarkRunner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QMap>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BenchmarkState::BenchmarkState(const QString& tempDir)
+: m_TempDir(tempDir)
+, m_ItemsProcessed(0)
+, m_BytesProcessed(0)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BenchmarkState::~BenchmarkState() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BenchmarkState::startTimer()
+{
+  m_Timed = true;
+  m_Timer.start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BenchmarkState::stopTimer()
+{
+  m_Elapsed += m_Timer.nsecsElapsed();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BenchmarkState::isTimed() const
+{
+  return m_Timed;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 BenchmarkState::getElapsedNanoseconds() const
+{
+  return m_Elapsed;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BenchmarkState::fail(const QString& message)
+{
+  if(m_Failure.isEmpty())
+  {
+    m_Failure = message;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString BenchmarkState::getFailure() const
+{
+  return m_Failure;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BenchmarkRunner::BenchmarkRunner()
+: m_Repetitions(5)
+, m_WarmupRepetitions(1)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BenchmarkRunner::~BenchmarkRunner() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BenchmarkRunner::addBenchmark(const QString& group, const QString& name, BenchmarkFunction function)
+{
+  Benchmark benchmark;
+  benchmark.group = group;
+  benchmark.name = name;
+  benchmark.function = function;
+  m_Benchmarks.push_back(benchmark);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList BenchmarkRunner::getBenchmarkNames() const
+{
+  QStringList names;
+  for(const Benchmark& benchmark : m_Benchmarks)
+  {
+    names << benchmark.group + "/" + benchmark.name;
+  }
+  return names;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject BenchmarkRunner::run(const QRegularExpression& filter, const QJsonObject& metadata)
+{
+  QJsonArray results;
+  for(const Benchmark& benchmark : m_Benchmarks)
+  {
+    QString fullName = benchmark.group + "/" + benchmark.name;
+    if(!filter.match(fullName).hasMatch())
+    {
+      continue;
+    }
+
+    QJsonObject result = runBenchmark(benchmark);
+    results.append(result);
+
+    if(result["Status"].toString() != "Ok")
+    {
+      std::printf("%-55s FAILED: %s\n", fullName.toStdString().c_str(), result["Message"].toString().toStdString().c_str());
+    }
+    else
+    {
+      std::printf("%-55s median %12.3f ms   min %12.3f ms   %10.3f M items/s\n", fullName.toStdString().c_str(), result["Median"].toDouble() / 1.0E6,
+                  result["Min"].toDouble() / 1.0E6, result["Items Per Second"].toDouble() / 1.0E6);
+    }
+    std::fflush(stdout);
+  }
+
+  QJsonObject root;
+  root["Metadata"] = metadata;
+  root["Benchmarks"] = results;
+  return root;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject BenchmarkRunner::runBenchmark(const Benchmark& benchmark)
+{
+  QJsonObject result;
+  result["Name"] = benchmark.group + "/" + benchmark.name;
+  result["Group"] = benchmark.group;
+
+  QVector<qint64> times;
+  quint64 items = 0;
+  quint64 bytes = 0;
+  int repetitions = std::max(1, m_Repetitions);
+  for(int i = 0; i < m_WarmupRepetitions + repetitions; i++)
+  {
+    BenchmarkState state(m_TempDir);
+    QElapsedTimer timer;
+    timer.start();
+    benchmark.function(state);
+    qint64 elapsed = state.isTimed() ? state.getElapsedNanoseconds() : timer.nsecsElapsed();
+
+    if(!state.getFailure().isEmpty())
+    {
+      result["Status"] = "Failed";
+      result["Message"] = state.getFailure();
+      return result;
+    }
+    if(i >= m_WarmupRepetitions)
+    {
+      times.push_back(elapsed);
+    }
+    items = state.getItemsProcessed();
+    bytes = state.getBytesProcessed();
+  }
+
+  std::sort(times.begin(), times.end());
+  double mean = 0.0;
+  for(qint64 t : times)
+  {
+    mean += static_cast<double>(t);
+  }
+  mean /= times.size();
+  double variance = 0.0;
+  for(qint64 t : times)
+  {
+    variance += (t - mean) * (t - mean);
+  }
+  variance = times.size() > 1 ? variance / (times.size() - 1) : 0.0;
+
+  size_t mid = times.size() / 2;
+  double median = times.size() % 2 == 1 ? static_cast<double>(times[mid]) : 0.5 * static_cast<double>(times[mid - 1] + times[mid]);
+
+  result["Status"] = "Ok";
+  result["Repetitions"] = times.size();
+  result["Min"] = static_cast<double>(times.front());
+  result["Median"] = median;
+  result["Mean"] = mean;
+  result["Max"] = static_cast<double>(times.back());
+  result["Standard Deviation"] = std::sqrt(variance);
+  result["Items Processed"] = static_cast<double>(items);
+  result["Bytes Processed"] = static_cast<double>(bytes);
+  result["Items Per Second"] = median > 0.0 ? static_cast<double>(items) * 1.0E9 / median : 0.0;
+  result["Bytes Per Second"] = median > 0.0 ? static_cast<double>(bytes) * 1.0E9 / median : 0.0;
+
+  QJsonArray samples;
+  for(qint64 t : times)
+  {
+    samples.append(static_cast<double>(t));
+  }
+  result["Samples"] = samples;
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int BenchmarkRunner::Compare(const QJsonObject& baseline, const QJsonObject& current, double threshold)
+{
+  QMap<QString, QJsonObject> baselineResults;
+  for(const QJsonValue& value : baseline["Benchmarks"].toArray())
+  {
+    QJsonObject result = value.toObject();
+    baselineResults.insert(result["Name"].toString(), result);
+  }
+
+  int regressions = 0;
+  std::printf("\n%-55s %14s %14s %9s\n", "Benchmark", "Baseline (ms)", "Current (ms)", "Change");
+  for(const QJsonValue& value : current["Benchmarks"].toArray())
+  {
+    QJsonObject result = value.toObject();
+    QString name = result["Name"].toString();
+    if(!baselineResults.contains(name))
+    {
+      std::printf("%-55s %14s\n", name.toStdString().c_str(), "new");
+      continue;
+    }
+    QJsonObject base = baselineResults[name];
+    if(result["Status"].toString() != "Ok" || base["Status"].toString() != "Ok")
+    {
+      std::printf("%-55s %14s\n", name.toStdString().c_str(), "failed");
+      continue;
+    }
+
+    double baseMedian = base["Median"].toDouble();
+    double currentMedian = result["Median"].toDouble();
+    double change = baseMedian > 0.0 ? (currentMedian - baseMedian) / baseMedian : 0.0;
+    bool regressed = change > threshold;
+    if(regressed)
+    {
+      regressions++;
+    }
+    std::printf("%-55s %14.3f %14.3f %+8.1f%%%s\n", name.toStdString().c_str(), baseMedian / 1.0E6, currentMedian / 1.0E6, change * 100.0, regressed ? "  REGRESSION" : "");
+  }
+  std::printf("\n%d regression(s) above %.1f%%\n", regressions, threshold * 100.0);
+  return regressions;
+}
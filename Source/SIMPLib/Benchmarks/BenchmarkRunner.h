@@ -0,0 +1,165 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _benchmarkrunner_h_
+#define _benchmarkrunner_h_
+
+#include <functional>
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QJsonObject>
+#include <QtCore/QRegularExpression>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+
+/**
+ * @brief The BenchmarkState class is handed to a benchmark for every repetition. Only the time between
+ * startTimer() and stopTimer() is measured so that a benchmark can build its input data outside of the
+ * measurement. A benchmark that never calls startTimer() is measured as a whole.
+ */
+class BenchmarkState
+{
+  public:
+    BenchmarkState(const QString& tempDir);
+    virtual ~BenchmarkState();
+
+    SIMPL_INSTANCE_STRING_PROPERTY(TempDir)
+
+    /**
+     * @brief Number of items (voxels, triangles, tuples, lines, ...) one repetition processes. Used to report
+     * the throughput.
+     */
+    SIMPL_INSTANCE_PROPERTY(quint64, ItemsProcessed)
+
+    /**
+     * @brief Number of bytes one repetition processes. Used to report the bandwidth.
+     */
+    SIMPL_INSTANCE_PROPERTY(quint64, BytesProcessed)
+
+    void startTimer();
+    void stopTimer();
+
+    /**
+     * @brief isTimed Returns whether startTimer() was called during the repetition
+     */
+    bool isTimed() const;
+
+    /**
+     * @brief getElapsedNanoseconds Returns the time measured between startTimer() and stopTimer()
+     */
+    qint64 getElapsedNanoseconds() const;
+
+    /**
+     * @brief fail Marks the repetition as failed. Its time is not used and the benchmark is reported as failed.
+     */
+    void fail(const QString& message);
+
+    QString getFailure() const;
+
+  private:
+    QElapsedTimer m_Timer;
+    bool m_Timed = false;
+    qint64 m_Elapsed = 0;
+    QString m_Failure;
+};
+
+/**
+ * @brief The BenchmarkRunner class runs registered benchmarks several times and reports the statistics of
+ * the measured times as JSON.
+ *
+ * The JSON document has a "Metadata" object that describes the build and the machine and a "Benchmarks"
+ * array with one object per benchmark. Compare() matches the benchmarks of two such documents by name so
+ * that the results of two builds can be checked for regressions.
+ */
+class BenchmarkRunner
+{
+  public:
+    BenchmarkRunner();
+    virtual ~BenchmarkRunner();
+
+    using BenchmarkFunction = std::function<void(BenchmarkState&)>;
+
+    SIMPL_INSTANCE_STRING_PROPERTY(TempDir)
+    SIMPL_INSTANCE_PROPERTY(int, Repetitions)
+    SIMPL_INSTANCE_PROPERTY(int, WarmupRepetitions)
+
+    /**
+     * @brief addBenchmark Registers a benchmark. Its full name is "group/name".
+     */
+    void addBenchmark(const QString& group, const QString& name, BenchmarkFunction function);
+
+    /**
+     * @brief getBenchmarkNames Returns the full names of all registered benchmarks
+     */
+    QStringList getBenchmarkNames() const;
+
+    /**
+     * @brief run Runs every benchmark whose full name matches the filter and prints one line per benchmark
+     * @return The results as a JSON document object
+     */
+    QJsonObject run(const QRegularExpression& filter, const QJsonObject& metadata);
+
+    /**
+     * @brief Compare Prints the change of the median time of every benchmark that is found in both result
+     * documents
+     * @param threshold Relative slow down, e.g. 0.1 for 10%, above which a benchmark counts as a regression
+     * @return The number of regressions
+     */
+    static int Compare(const QJsonObject& baseline, const QJsonObject& current, double threshold);
+
+  protected:
+    struct Benchmark
+    {
+      QString group;
+      QString name;
+      BenchmarkFunction function;
+    };
+
+    /**
+     * @brief runBenchmark Runs the warm up and measured repetitions of one benchmark
+     */
+    QJsonObject runBenchmark(const Benchmark& benchmark);
+
+  private:
+    QVector<Benchmark> m_Benchmarks;
+
+    BenchmarkRunner(const BenchmarkRunner&) = delete; // Copy Constructor Not Implemented
+    void operator=(const BenchmarkRunner&) = delete;  // Move assignment Not Implemented
+};
+
+#endif /* _benchmarkrunner_h_ */
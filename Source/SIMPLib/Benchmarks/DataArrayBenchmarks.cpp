@@ -0,0 +1,220 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DataArrayBenchmarks.h"
+
+#include <random>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FloatArrayType::Pointer CreateFilledArray(size_t numTuples, size_t numComps)
+{
+  FloatArrayType::Pointer array = FloatArrayType::CreateArray(numTuples, QVector<size_t>(1, numComps), "Source");
+  float* ptr = array->getPointer(0);
+  size_t count = numTuples * numComps;
+  for(size_t i = 0; i < count; i++)
+  {
+    ptr[i] = static_cast<float>(i % 1000);
+  }
+  return array;
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayBenchmarks::DataArrayBenchmarks() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayBenchmarks::~DataArrayBenchmarks() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayBenchmarks::Register(BenchmarkRunner& runner, const BenchmarkSize& size)
+{
+  size_t numTuples = size.arrayTuples;
+  size_t featureCount = size.featureCount;
+
+  runner.addBenchmark("DataArray", "Allocate", [numTuples](BenchmarkState& state) {
+    state.startTimer();
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(numTuples, QVector<size_t>(1, 1), "Array");
+    state.stopTimer();
+    if(nullptr == array->getConstVoidPointer(0))
+    {
+      state.fail("The array could not be allocated");
+    }
+    state.setItemsProcessed(numTuples);
+    state.setBytesProcessed(numTuples * sizeof(float));
+  });
+
+  runner.addBenchmark("DataArray", "AllocateAndInitialize", [numTuples](BenchmarkState& state) {
+    state.startTimer();
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(numTuples, QVector<size_t>(1, 1), "Array");
+    array->initializeWithZeros();
+    state.stopTimer();
+    state.setItemsProcessed(numTuples);
+    state.setBytesProcessed(numTuples * sizeof(float));
+  });
+
+  runner.addBenchmark("DataArray", "DeepCopy", [numTuples](BenchmarkState& state) {
+    FloatArrayType::Pointer source = CreateFilledArray(numTuples, 1);
+    state.startTimer();
+    IDataArray::Pointer copy = source->deepCopy();
+    state.stopTimer();
+    state.setItemsProcessed(numTuples);
+    state.setBytesProcessed(numTuples * sizeof(float));
+  });
+
+  // shallowCopy() shares the buffer until the copy is written to, so the shared copy only measures the
+  // bookkeeping while the detached copy measures the deferred duplication of the data
+  runner.addBenchmark("DataArray", "ShallowCopyShared", [numTuples](BenchmarkState& state) {
+    FloatArrayType::Pointer source = CreateFilledArray(numTuples, 1);
+    state.startTimer();
+    FloatArrayType::Pointer copy = source->shallowCopy();
+    state.stopTimer();
+    state.setItemsProcessed(numTuples);
+  });
+
+  runner.addBenchmark("DataArray", "ShallowCopyDetached", [numTuples](BenchmarkState& state) {
+    FloatArrayType::Pointer source = CreateFilledArray(numTuples, 1);
+    state.startTimer();
+    FloatArrayType::Pointer copy = source->shallowCopy();
+    copy->getPointer(0);
+    state.stopTimer();
+    state.setItemsProcessed(numTuples);
+    state.setBytesProcessed(numTuples * sizeof(float));
+  });
+
+  runner.addBenchmark("DataArray", "CopyFromArray", [numTuples](BenchmarkState& state) {
+    FloatArrayType::Pointer source = CreateFilledArray(numTuples, 1);
+    FloatArrayType::Pointer destination = FloatArrayType::CreateArray(numTuples, QVector<size_t>(1, 1), "Destination");
+    destination->initializeWithZeros();
+    state.startTimer();
+    bool ok = destination->copyFromArray(0, source, 0, numTuples);
+    state.stopTimer();
+    if(!ok)
+    {
+      state.fail("copyFromArray failed");
+    }
+    state.setItemsProcessed(numTuples);
+    state.setBytesProcessed(numTuples * sizeof(float));
+  });
+
+  runner.addBenchmark("DataArray", "ResizeGrow", [numTuples](BenchmarkState& state) {
+    FloatArrayType::Pointer array = CreateFilledArray(numTuples, 1);
+    state.startTimer();
+    array->resize(numTuples * 2);
+    state.stopTimer();
+    state.setItemsProcessed(numTuples);
+    state.setBytesProcessed(numTuples * sizeof(float));
+  });
+
+  // Every tenth tuple of a 3 component array, the pattern of removing rejected features
+  runner.addBenchmark("DataArray", "EraseTuplesSparse", [numTuples](BenchmarkState& state) {
+    FloatArrayType::Pointer array = CreateFilledArray(numTuples, 3);
+    QVector<size_t> idxs;
+    idxs.reserve(static_cast<int>(numTuples / 10 + 1));
+    for(size_t i = 0; i < numTuples; i += 10)
+    {
+      idxs.push_back(i);
+    }
+    state.startTimer();
+    int err = array->eraseTuples(idxs);
+    state.stopTimer();
+    if(err < 0)
+    {
+      state.fail("eraseTuples failed");
+    }
+    state.setItemsProcessed(numTuples);
+    state.setBytesProcessed(numTuples * 3 * sizeof(float));
+  });
+
+  // The first tenth of the tuples as one contiguous range
+  runner.addBenchmark("DataArray", "EraseTuplesBlock", [numTuples](BenchmarkState& state) {
+    FloatArrayType::Pointer array = CreateFilledArray(numTuples, 3);
+    QVector<size_t> idxs;
+    idxs.reserve(static_cast<int>(numTuples / 10));
+    for(size_t i = 0; i < numTuples / 10; i++)
+    {
+      idxs.push_back(i);
+    }
+    state.startTimer();
+    int err = array->eraseTuples(idxs);
+    state.stopTimer();
+    if(err < 0)
+    {
+      state.fail("eraseTuples failed");
+    }
+    state.setItemsProcessed(numTuples);
+    state.setBytesProcessed(numTuples * 3 * sizeof(float));
+  });
+
+  // Removes a random tenth of the features from every array of a feature attribute matrix and renumbers the
+  // feature ids of the cells
+  runner.addBenchmark("AttributeMatrix", "RemoveInactiveObjects", [numTuples, featureCount](BenchmarkState& state) {
+    AttributeMatrix::Pointer am = BenchmarkData::CreateFeatureMatrix(featureCount);
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(numTuples, QVector<size_t>(1, 1), "FeatureIds");
+    std::mt19937 generator(5489u);
+    std::uniform_int_distribution<int32_t> ids(0, static_cast<int32_t>(featureCount - 1));
+    int32_t* featureIdsPtr = featureIds->getPointer(0);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      featureIdsPtr[i] = ids(generator);
+    }
+    std::uniform_int_distribution<int> keep(0, 9);
+    QVector<bool> activeObjects(static_cast<int>(featureCount), true);
+    for(size_t i = 1; i < featureCount; i++)
+    {
+      activeObjects[static_cast<int>(i)] = keep(generator) != 0;
+    }
+
+    state.startTimer();
+    bool ok = am->removeInactiveObjects(activeObjects, featureIds.get());
+    state.stopTimer();
+    if(!ok)
+    {
+      state.fail("removeInactiveObjects failed");
+    }
+    state.setItemsProcessed(featureCount);
+  });
+}
@@ -0,0 +1,146 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "FilterBenchmarks.h"
+
+#include "SIMPLib/CoreFilters/ArrayCalculator.h"
+#include "SIMPLib/CoreFilters/MultiThresholdObjects2.h"
+#include "SIMPLib/Filtering/ComparisonInputsAdvanced.h"
+#include "SIMPLib/Filtering/ComparisonSet.h"
+#include "SIMPLib/Filtering/ComparisonValue.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void RunFilter(BenchmarkState& state, AbstractFilter::Pointer filter, size_t numCells)
+{
+  state.startTimer();
+  filter->execute();
+  state.stopTimer();
+  if(filter->getErrorCondition() < 0)
+  {
+    state.fail(QString("%1 failed with error %2").arg(filter->getNameOfClass()).arg(filter->getErrorCondition()));
+  }
+  state.setItemsProcessed(numCells);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AddArrayCalculatorBenchmark(BenchmarkRunner& runner, const QString& name, size_t volumeDimension, const QString& equation)
+{
+  runner.addBenchmark("ArrayCalculator", name, [volumeDimension, equation](BenchmarkState& state) {
+    ArrayCalculator::Pointer filter = ArrayCalculator::New();
+    filter->setDataContainerArray(BenchmarkData::CreateImageVolume(volumeDimension));
+    filter->setSelectedAttributeMatrix(DataArrayPath(BenchmarkData::DataContainerName, BenchmarkData::CellAttributeMatrixName, ""));
+    filter->setCalculatedArray(DataArrayPath(BenchmarkData::DataContainerName, BenchmarkData::CellAttributeMatrixName, "Calculated"));
+    filter->setInfixEquation(equation);
+    filter->setScalarType(SIMPL::ScalarTypes::Type::Double);
+    filter->setUnits(ArrayCalculator::Radians);
+    RunFilter(state, filter, volumeDimension * volumeDimension * volumeDimension);
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ComparisonValue::Pointer CreateComparison(const QString& arrayName, int compOperator, double value, int unionOperator)
+{
+  ComparisonValue::Pointer comparison = ComparisonValue::New();
+  comparison->setAttributeArrayName(arrayName);
+  comparison->setCompOperator(compOperator);
+  comparison->setCompValue(value);
+  comparison->setUnionOperator(unionOperator);
+  return comparison;
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterBenchmarks::FilterBenchmarks() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterBenchmarks::~FilterBenchmarks() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterBenchmarks::Register(BenchmarkRunner& runner, const BenchmarkSize& size)
+{
+  size_t volumeDimension = size.volumeDimension;
+
+  AddArrayCalculatorBenchmark(runner, "Arithmetic", volumeDimension, "Float * 2 + Double - 1");
+  AddArrayCalculatorBenchmark(runner, "Trigonometric", volumeDimension, "sqrt(Float^2 + Double^2) * sin(Float) + cos(Double)");
+  AddArrayCalculatorBenchmark(runner, "ComponentAccess", volumeDimension, "Eulers[0] + Eulers[1] * Eulers[2]");
+
+  runner.addBenchmark("MultiThresholdObjects2", "SingleComparison", [volumeDimension](BenchmarkState& state) {
+    ComparisonInputsAdvanced thresholds;
+    thresholds.setDataContainerName(BenchmarkData::DataContainerName);
+    thresholds.setAttributeMatrixName(BenchmarkData::CellAttributeMatrixName);
+    thresholds.addInput(CreateComparison("Float", SIMPL::Comparison::Operator_GreaterThan, 0.25, SIMPL::Union::Operator_And));
+
+    MultiThresholdObjects2::Pointer filter = MultiThresholdObjects2::New();
+    filter->setDataContainerArray(BenchmarkData::CreateImageVolume(volumeDimension));
+    filter->setSelectedThresholds(thresholds);
+    filter->setDestinationArrayName("Mask");
+    RunFilter(state, filter, volumeDimension * volumeDimension * volumeDimension);
+  });
+
+  // Float > 0.25 AND FeatureIds < 100 OR (Double < 0 AND FeatureIds != 1)
+  runner.addBenchmark("MultiThresholdObjects2", "NestedComparisons", [volumeDimension](BenchmarkState& state) {
+    ComparisonSet::Pointer innerSet = ComparisonSet::New();
+    innerSet->setUnionOperator(SIMPL::Union::Operator_Or);
+    innerSet->addComparison(CreateComparison("Double", SIMPL::Comparison::Operator_LessThan, 0.0, SIMPL::Union::Operator_And));
+    innerSet->addComparison(CreateComparison("FeatureIds", SIMPL::Comparison::Operator_NotEqual, 1.0, SIMPL::Union::Operator_And));
+
+    ComparisonInputsAdvanced thresholds;
+    thresholds.setDataContainerName(BenchmarkData::DataContainerName);
+    thresholds.setAttributeMatrixName(BenchmarkData::CellAttributeMatrixName);
+    thresholds.addInput(CreateComparison("Float", SIMPL::Comparison::Operator_GreaterThan, 0.25, SIMPL::Union::Operator_And));
+    thresholds.addInput(CreateComparison("FeatureIds", SIMPL::Comparison::Operator_LessThan, 100.0, SIMPL::Union::Operator_And));
+    thresholds.addInput(innerSet);
+
+    MultiThresholdObjects2::Pointer filter = MultiThresholdObjects2::New();
+    filter->setDataContainerArray(BenchmarkData::CreateImageVolume(volumeDimension));
+    filter->setSelectedThresholds(thresholds);
+    filter->setDestinationArrayName("Mask");
+    RunFilter(state, filter, volumeDimension * volumeDimension * volumeDimension);
+  });
+}
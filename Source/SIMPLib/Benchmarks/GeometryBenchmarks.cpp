@@ -0,0 +1,127 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "GeometryBenchmarks.h"
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+namespace
+{
+using TopologyFunction = int (TriangleGeom::*)();
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AddTopologyBenchmark(BenchmarkRunner& runner, const QString& name, size_t meshDimension, TopologyFunction prerequisite, TopologyFunction function)
+{
+  runner.addBenchmark("TriangleGeom", name, [meshDimension, prerequisite, function](BenchmarkState& state) {
+    TriangleGeom::Pointer mesh = BenchmarkData::CreateTriangleMesh(meshDimension);
+    if(nullptr != prerequisite)
+    {
+      ((*mesh).*prerequisite)();
+    }
+    state.startTimer();
+    int err = ((*mesh).*function)();
+    state.stopTimer();
+    if(err < 0)
+    {
+      state.fail(QString("Error %1").arg(err));
+    }
+    state.setItemsProcessed(static_cast<quint64>(mesh->getNumberOfTris()));
+  });
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+GeometryBenchmarks::GeometryBenchmarks() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+GeometryBenchmarks::~GeometryBenchmarks() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GeometryBenchmarks::Register(BenchmarkRunner& runner, const BenchmarkSize& size)
+{
+  size_t meshDimension = size.meshDimension;
+  size_t volumeDimension = size.volumeDimension;
+
+  AddTopologyBenchmark(runner, "FindElementsContainingVert", meshDimension, nullptr, &TriangleGeom::findElementsContainingVert);
+  AddTopologyBenchmark(runner, "FindElementNeighbors", meshDimension, &TriangleGeom::findElementsContainingVert, &TriangleGeom::findElementNeighbors);
+  AddTopologyBenchmark(runner, "FindEdges", meshDimension, nullptr, &TriangleGeom::findEdges);
+  AddTopologyBenchmark(runner, "FindUnsharedEdges", meshDimension, nullptr, &TriangleGeom::findUnsharedEdges);
+  AddTopologyBenchmark(runner, "FindElementCentroids", meshDimension, nullptr, &TriangleGeom::findElementCentroids);
+  AddTopologyBenchmark(runner, "FindElementSizes", meshDimension, nullptr, &TriangleGeom::findElementSizes);
+
+  // A 3 component field on the vertices gives 9 derivatives per triangle
+  runner.addBenchmark("TriangleGeom", "FindDerivatives", [meshDimension](BenchmarkState& state) {
+    TriangleGeom::Pointer mesh = BenchmarkData::CreateTriangleMesh(meshDimension);
+    int64_t numVerts = mesh->getNumberOfVertices();
+    int64_t numTris = mesh->getNumberOfTris();
+    DoubleArrayType::Pointer field = DoubleArrayType::CreateArray(static_cast<size_t>(numVerts), QVector<size_t>(1, 3), "Field");
+    float* vertPtr = mesh->getVertices()->getPointer(0);
+    double* fieldPtr = field->getPointer(0);
+    for(int64_t i = 0; i < 3 * numVerts; i++)
+    {
+      fieldPtr[i] = static_cast<double>(vertPtr[i]) * vertPtr[i];
+    }
+    DoubleArrayType::Pointer derivatives = DoubleArrayType::CreateArray(static_cast<size_t>(numTris), QVector<size_t>(1, 9), "Derivatives");
+
+    state.startTimer();
+    mesh->findDerivatives(field, derivatives);
+    state.stopTimer();
+    state.setItemsProcessed(static_cast<quint64>(numTris));
+  });
+
+  runner.addBenchmark("ImageGeom", "FindDerivatives", [volumeDimension](BenchmarkState& state) {
+    DataContainerArray::Pointer dca = BenchmarkData::CreateImageVolume(volumeDimension);
+    DataContainer::Pointer dc = dca->getDataContainer(BenchmarkData::DataContainerName);
+    ImageGeom::Pointer image = dc->getGeometryAs<ImageGeom>();
+    DoubleArrayType::Pointer field = dc->getAttributeMatrix(BenchmarkData::CellAttributeMatrixName)->getAttributeArrayAs<DoubleArrayType>("Double");
+    size_t numCells = field->getNumberOfTuples();
+    DoubleArrayType::Pointer derivatives = DoubleArrayType::CreateArray(numCells, QVector<size_t>(1, 3), "Derivatives");
+
+    state.startTimer();
+    image->findDerivatives(field, derivatives);
+    state.stopTimer();
+    state.setItemsProcessed(numCells);
+  });
+}
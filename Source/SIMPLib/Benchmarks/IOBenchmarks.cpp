@@ -0,0 +1,178 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "IOBenchmarks.h"
+
+#include <QtCore/QFileInfo>
+
+#include "SIMPLib/CoreFilters/DataContainerReader.h"
+#include "SIMPLib/CoreFilters/DataContainerWriter.h"
+#include "SIMPLib/CoreFilters/ReadASCIIData.h"
+#include "SIMPLib/CoreFilters/util/ASCIIWizardData.hpp"
+#include "SIMPLib/DataContainers/DataContainer.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+quint64 CountBytes(const DataContainerArray::Pointer& dca)
+{
+  quint64 bytes = 0;
+  for(const DataContainer::Pointer& dc : dca->getDataContainers())
+  {
+    for(const AttributeMatrix::Pointer& am : dc->getAttributeMatrices())
+    {
+      for(const QString& name : am->getAttributeArrayNames())
+      {
+        IDataArray::Pointer array = am->getAttributeArray(name);
+        bytes += static_cast<quint64>(array->getSize()) * array->getTypeSize();
+      }
+    }
+  }
+  return bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int WriteVolume(const DataContainerArray::Pointer& dca, const QString& filePath)
+{
+  DataContainerWriter::Pointer writer = DataContainerWriter::New();
+  writer->setDataContainerArray(dca);
+  writer->setOutputFile(filePath);
+  writer->setWritePipeline(false);
+  writer->setWriteXdmfFile(false);
+  writer->execute();
+  return writer->getErrorCondition();
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IOBenchmarks::IOBenchmarks() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IOBenchmarks::~IOBenchmarks() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IOBenchmarks::Register(BenchmarkRunner& runner, const BenchmarkSize& size)
+{
+  size_t asciiLines = size.asciiLines;
+  size_t volumeDimension = size.volumeDimension;
+
+  // The input files are generated by the first repetition that needs them and reused by all later ones
+  runner.addBenchmark("ReadASCIIData", "FloatAndIntColumns", [asciiLines](BenchmarkState& state) {
+    QString filePath = QString("%1/Benchmark_%2_Lines.csv").arg(state.getTempDir()).arg(asciiLines);
+    if(!QFileInfo::exists(filePath) && !BenchmarkData::WriteAsciiFile(filePath, asciiLines))
+    {
+      state.fail("Could not write " + filePath);
+      return;
+    }
+
+    ASCIIWizardData data;
+    data.inputFilePath = filePath;
+    data.dataHeaders << "Value"
+                     << "Id";
+    data.dataTypes << SIMPL::TypeNames::Float << SIMPL::TypeNames::Int32;
+    data.delimiters.push_back(',');
+    data.beginIndex = 1;
+    data.numberOfLines = static_cast<int>(asciiLines);
+    data.tupleDims = QVector<size_t>(1, asciiLines);
+    data.automaticAM = false;
+    data.selectedPath = DataArrayPath(BenchmarkData::DataContainerName, BenchmarkData::CellAttributeMatrixName, "");
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(BenchmarkData::DataContainerName);
+    dc->addAttributeMatrix(BenchmarkData::CellAttributeMatrixName, AttributeMatrix::New(data.tupleDims, BenchmarkData::CellAttributeMatrixName, AttributeMatrix::Type::Cell));
+    dca->addDataContainer(dc);
+
+    ReadASCIIData::Pointer filter = ReadASCIIData::New();
+    filter->setDataContainerArray(dca);
+    filter->setWizardData(data);
+    state.startTimer();
+    filter->execute();
+    state.stopTimer();
+    if(filter->getErrorCondition() < 0)
+    {
+      state.fail(QString("ReadASCIIData failed with error %1").arg(filter->getErrorCondition()));
+    }
+    state.setItemsProcessed(asciiLines);
+    state.setBytesProcessed(static_cast<quint64>(QFileInfo(filePath).size()));
+  });
+
+  runner.addBenchmark("DataContainerWriter", "ImageVolume", [volumeDimension](BenchmarkState& state) {
+    QString filePath = QString("%1/Benchmark_Write_%2.dream3d").arg(state.getTempDir()).arg(volumeDimension);
+    DataContainerArray::Pointer dca = BenchmarkData::CreateImageVolume(volumeDimension);
+    state.startTimer();
+    int err = WriteVolume(dca, filePath);
+    state.stopTimer();
+    if(err < 0)
+    {
+      state.fail(QString("DataContainerWriter failed with error %1").arg(err));
+    }
+    state.setItemsProcessed(volumeDimension * volumeDimension * volumeDimension);
+    state.setBytesProcessed(CountBytes(dca));
+  });
+
+  runner.addBenchmark("DataContainerReader", "ImageVolume", [volumeDimension](BenchmarkState& state) {
+    QString filePath = QString("%1/Benchmark_Read_%2.dream3d").arg(state.getTempDir()).arg(volumeDimension);
+    if(!QFileInfo::exists(filePath) && WriteVolume(BenchmarkData::CreateImageVolume(volumeDimension), filePath) < 0)
+    {
+      state.fail("Could not write " + filePath);
+      return;
+    }
+
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setDataContainerArray(dca);
+    reader->setInputFile(filePath);
+    state.startTimer();
+    reader->setInputFileDataContainerArrayProxy(reader->readDataContainerArrayStructure(filePath));
+    reader->execute();
+    state.stopTimer();
+    if(reader->getErrorCondition() < 0)
+    {
+      state.fail(QString("DataContainerReader failed with error %1").arg(reader->getErrorCondition()));
+    }
+    state.setItemsProcessed(volumeDimension * volumeDimension * volumeDimension);
+    state.setBytesProcessed(CountBytes(dca));
+  });
+}
@@ -0,0 +1,244 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <iostream>
+
+#include <QtCore/QCommandLineOption>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QSysInfo>
+#include <QtCore/QThread>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/SIMPLibVersion.h"
+
+#include "BenchmarkData.h"
+#include "BenchmarkRunner.h"
+#include "DataArrayBenchmarks.h"
+#include "FilterBenchmarks.h"
+#include "GeometryBenchmarks.h"
+#include "IOBenchmarks.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject CreateMetadata(const BenchmarkSize& size, const BenchmarkRunner& runner)
+{
+  QJsonObject metadata;
+  metadata["SIMPLib Version"] = SIMPLib::Version::PackageComplete();
+#ifdef NDEBUG
+  metadata["Build Type"] = "Release";
+#else
+  metadata["Build Type"] = "Debug";
+#endif
+#if defined(__clang__)
+  metadata["Compiler"] = QString("Clang %1.%2.%3").arg(__clang_major__).arg(__clang_minor__).arg(__clang_patchlevel__);
+#elif defined(__GNUC__)
+  metadata["Compiler"] = QString("GCC %1.%2.%3").arg(__GNUC__).arg(__GNUC_MINOR__).arg(__GNUC_PATCHLEVEL__);
+#elif defined(_MSC_VER)
+  metadata["Compiler"] = QString("MSVC %1").arg(_MSC_FULL_VER);
+#else
+  metadata["Compiler"] = "Unknown";
+#endif
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  metadata["Parallel Algorithms"] = true;
+#else
+  metadata["Parallel Algorithms"] = false;
+#endif
+  metadata["Qt Version"] = QString(qVersion());
+  metadata["Host"] = QSysInfo::machineHostName();
+  metadata["Operating System"] = QSysInfo::prettyProductName();
+  metadata["CPU Architecture"] = QSysInfo::currentCpuArchitecture();
+  metadata["Threads"] = QThread::idealThreadCount();
+  metadata["Date"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+  metadata["Size"] = size.name;
+  metadata["Repetitions"] = runner.getRepetitions();
+  metadata["Warmup Repetitions"] = runner.getWarmupRepetitions();
+  metadata["Time Unit"] = "ns";
+  return metadata;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ReadJsonFile(const QString& filePath, QJsonObject& root)
+{
+  QFile file(filePath);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+  QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
+  root = doc.object();
+  return doc.isObject();
+}
+}
+
+// -----------------------------------------------------------------------------
+// SIMPLibBenchmarks measures the core code paths of SIMPLib on synthetic data
+// and writes the results as JSON. Two result files of different builds can be
+// compared with --compare, which exits with a non zero code if a benchmark got
+// slower than the threshold.
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setOrganizationName("BlueQuartz Software");
+  QCoreApplication::setOrganizationDomain("bluequartz.net");
+  QCoreApplication::setApplicationName("SIMPLibBenchmarks");
+  QCoreApplication::setApplicationVersion(SIMPLib::Version::Major() + "." + SIMPLib::Version::Minor() + "." + SIMPLib::Version::Patch());
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Runs the SIMPLib benchmarks and writes the results as JSON.");
+  parser.addHelpOption();
+  parser.addVersionOption();
+
+  QCommandLineOption outputArg(QStringList() << "o"
+                                             << "output",
+                               "JSON file the results are written to.", "file");
+  parser.addOption(outputArg);
+
+  QCommandLineOption sizeArg(QStringList() << "size", "Problem size: small, medium or large. Defaults to medium.", "preset", "medium");
+  parser.addOption(sizeArg);
+
+  QCommandLineOption repetitionsArg(QStringList() << "repetitions", "Measured repetitions of every benchmark. Defaults to 5.", "count", "5");
+  parser.addOption(repetitionsArg);
+
+  QCommandLineOption warmupArg(QStringList() << "warmup", "Unmeasured repetitions that run first. Defaults to 1.", "count", "1");
+  parser.addOption(warmupArg);
+
+  QCommandLineOption filterArg(QStringList() << "filter", "Only run the benchmarks whose group/name matches this regular expression.", "regex", ".*");
+  parser.addOption(filterArg);
+
+  QCommandLineOption listArg(QStringList() << "list", "List the benchmarks and exit.");
+  parser.addOption(listArg);
+
+  QCommandLineOption tempDirArg(QStringList() << "temp-dir", "Directory for the files the IO benchmarks create. Defaults to the system temp directory.", "directory");
+  parser.addOption(tempDirArg);
+
+  QCommandLineOption compareArg(QStringList() << "compare", "Compare the results with those of a previous run.", "baseline");
+  parser.addOption(compareArg);
+
+  QCommandLineOption thresholdArg(QStringList() << "threshold", "Slow down in percent above which --compare reports a regression. Defaults to 10.", "percent", "10");
+  parser.addOption(thresholdArg);
+
+  parser.process(app);
+
+  BenchmarkSize size = BenchmarkData::Size(parser.value(sizeArg));
+  if(size.name.isEmpty())
+  {
+    std::cout << "Unknown size '" << parser.value(sizeArg).toStdString() << "'. Use small, medium or large." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  QJsonObject baseline;
+  if(parser.isSet(compareArg) && !ReadJsonFile(parser.value(compareArg), baseline))
+  {
+    std::cout << "The baseline '" << parser.value(compareArg).toStdString() << "' could not be read." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  QString tempDir = parser.isSet(tempDirArg) ? parser.value(tempDirArg) : QDir::tempPath() + "/SIMPLibBenchmarks";
+  QDir().mkpath(tempDir);
+
+  BenchmarkRunner runner;
+  runner.setTempDir(tempDir);
+  runner.setRepetitions(parser.value(repetitionsArg).toInt());
+  runner.setWarmupRepetitions(parser.value(warmupArg).toInt());
+  DataArrayBenchmarks::Register(runner, size);
+  GeometryBenchmarks::Register(runner, size);
+  FilterBenchmarks::Register(runner, size);
+  IOBenchmarks::Register(runner, size);
+
+  if(parser.isSet(listArg))
+  {
+    for(const QString& name : runner.getBenchmarkNames())
+    {
+      std::cout << name.toStdString() << std::endl;
+    }
+    return EXIT_SUCCESS;
+  }
+
+  QRegularExpression filter(parser.value(filterArg));
+  if(!filter.isValid())
+  {
+    std::cout << "Invalid --filter expression: " << filter.errorString().toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "SIMPLibBenchmarks (" << size.name.toStdString() << ")" << std::endl;
+  QJsonObject results = runner.run(filter, CreateMetadata(size, runner));
+
+  if(parser.isSet(outputArg))
+  {
+    QFile file(parser.value(outputArg));
+    if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+      std::cout << "The results could not be written to '" << parser.value(outputArg).toStdString() << "'" << std::endl;
+      return EXIT_FAILURE;
+    }
+    file.write(QJsonDocument(results).toJson());
+  }
+
+  int err = EXIT_SUCCESS;
+  for(const QJsonValue& value : results["Benchmarks"].toArray())
+  {
+    if(value.toObject()["Status"].toString() != "Ok")
+    {
+      err = EXIT_FAILURE;
+    }
+  }
+
+  if(parser.isSet(compareArg))
+  {
+    if(baseline["Metadata"].toObject()["Size"].toString() != size.name)
+    {
+      std::cout << "WARNING: The baseline was run with a different size" << std::endl;
+    }
+    if(BenchmarkRunner::Compare(baseline, results, parser.value(thresholdArg).toDouble() / 100.0) > 0)
+    {
+      err = EXIT_FAILURE;
+    }
+  }
+
+  return err;
+}
@@ -0,0 +1,187 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _boundedmessagequeue_hpp_
+#define _boundedmessagequeue_hpp_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @class BoundedMessageQueue BoundedMessageQueue.hpp SIMPLib/Common/BoundedMessageQueue.hpp
+ * @brief A fixed capacity, lock-free, multi-producer/multi-consumer queue. Each slot carries a
+ * sequence number that producers and consumers use to claim the slot without taking a lock
+ * (the classic bounded MPMC ring buffer design). The capacity is rounded up to a power of two.
+ *
+ * tryPush() never blocks and never allocates: when the queue is full the value is rejected and
+ * the caller decides what to do (usually drop it). This makes the queue safe to use from inside
+ * parallel TBB bodies.
+ */
+template <typename T>
+class BoundedMessageQueue
+{
+public:
+  explicit BoundedMessageQueue(size_t capacity = 256)
+  : m_Slots(RoundUpToPowerOfTwo(capacity))
+  , m_Mask(m_Slots.size() - 1)
+  , m_EnqueuePos(0)
+  , m_DequeuePos(0)
+  {
+    for(size_t i = 0; i < m_Slots.size(); i++)
+    {
+      m_Slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  virtual ~BoundedMessageQueue() = default;
+
+  /**
+   * @brief Returns the number of slots in the queue
+   */
+  size_t capacity() const
+  {
+    return m_Slots.size();
+  }
+
+  /**
+   * @brief Attempts to append a value to the queue.
+   * @param value
+   * @return false if the queue was full
+   */
+  bool tryPush(T value)
+  {
+    size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    for(;;)
+    {
+      slot = &m_Slots[pos & m_Mask];
+      size_t seq = slot->sequence.load(std::memory_order_acquire);
+      intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if(diff == 0)
+      {
+        if(m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          break;
+        }
+      }
+      else if(diff < 0)
+      {
+        return false;
+      }
+      else
+      {
+        pos = m_EnqueuePos.load(std::memory_order_relaxed);
+      }
+    }
+    slot->value = std::move(value);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Attempts to remove the oldest value from the queue.
+   * @param value Receives the value
+   * @return false if the queue was empty
+   */
+  bool tryPop(T& value)
+  {
+    size_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    for(;;)
+    {
+      slot = &m_Slots[pos & m_Mask];
+      size_t seq = slot->sequence.load(std::memory_order_acquire);
+      intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+      if(diff == 0)
+      {
+        if(m_DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          break;
+        }
+      }
+      else if(diff < 0)
+      {
+        return false;
+      }
+      else
+      {
+        pos = m_DequeuePos.load(std::memory_order_relaxed);
+      }
+    }
+    value = std::move(slot->value);
+    slot->value = T();
+    slot->sequence.store(pos + m_Mask + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Returns true if there is nothing to pop. This is only a snapshot when other threads are pushing.
+   */
+  bool empty() const
+  {
+    return m_EnqueuePos.load(std::memory_order_acquire) == m_DequeuePos.load(std::memory_order_acquire);
+  }
+
+private:
+  struct Slot
+  {
+    std::atomic<size_t> sequence;
+    T value;
+  };
+
+  static size_t RoundUpToPowerOfTwo(size_t value)
+  {
+    size_t pow2 = 2;
+    while(pow2 < value)
+    {
+      pow2 <<= 1;
+    }
+    return pow2;
+  }
+
+  std::vector<Slot> m_Slots;
+  const size_t m_Mask;
+  // Keep the producer and consumer cursors on separate cache lines
+  alignas(64) std::atomic<size_t> m_EnqueuePos;
+  alignas(64) std::atomic<size_t> m_DequeuePos;
+
+  BoundedMessageQueue(const BoundedMessageQueue&) = delete; // Copy Constructor Not Implemented
+  void operator=(const BoundedMessageQueue&) = delete;      // Move assignment Not Implemented
+};
+
+#endif /* _boundedmessagequeue_hpp_ */
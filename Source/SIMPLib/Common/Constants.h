@@ -536,6 +536,7 @@ namespace SIMPL
     const QString ComponentDimensions("ComponentDimensions");
     const QString AxisDimensions("Tuple Axis Dimensions");
     const QString DataArrayVersion("DataArrayVersion");
+    const QString PyramidLevels("PyramidLevels");
   }
 
   namespace StringConstants
@@ -561,6 +562,8 @@ namespace SIMPL
     const QString CrystalStructure("CrystalStructure");
     const QString DataContainerGroupName("DataContainers");
     const QString DataContainerBundleGroupName("DataContainerBundles");
+    const QString DataContainerPyramidGroupName("DataContainerPyramids");
+    const QString DataStructureIndexName("DataStructureIndex");
     const QString DataContainerNames("DataContainerNames");
     const QString MetaDataArrays("MetaDataArrays");
     const QString DataContainerType("DataContainerType");
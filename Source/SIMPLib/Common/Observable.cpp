@@ -35,6 +35,8 @@
 
 #include "Observable.h"
 
+#include <QtCore/QMetaMethod>
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -84,6 +86,10 @@ void Observable::notifyErrorMessage(const QString& humanLabel, const QString& st
 // -----------------------------------------------------------------------------
 void Observable::notifyStatusMessage(const QString& humanLabel, const QString& str)
 {
+  if(!hasMessageReceivers())
+  {
+    return;
+  }
   PipelineMessage pm = PipelineMessage::CreateStatusMessage(getNameOfClass(), humanLabel, str);
   emit filterGeneratedMessage(pm);
 }
@@ -93,6 +99,10 @@ void Observable::notifyStatusMessage(const QString& humanLabel, const QString& s
 // -----------------------------------------------------------------------------
 void Observable::notifyStatusMessage(const QString& prefix, const QString& humanLabel, const QString& str)
 {
+  if(!hasMessageReceivers())
+  {
+    return;
+  }
   PipelineMessage pm = PipelineMessage::CreateStatusMessage(getNameOfClass(), humanLabel, str);
   pm.setPrefix(prefix);
   emit filterGeneratedMessage(pm);
@@ -121,9 +131,58 @@ void Observable::notifyWarningMessage(const QString& humanLabel, const QString&
 // -----------------------------------------------------------------------------
 void Observable::notifyProgressMessage(const QString& prefix, const QString& humanLabel, const QString& str, int progress)
 {
+  if(!hasMessageReceivers())
+  {
+    return;
+  }
   PipelineMessage pm = PipelineMessage::CreateStatusMessage(getNameOfClass(), humanLabel, str);
   pm.setPrefix(prefix);
   pm.setProgressValue(progress);
   pm.setType(PipelineMessage::MessageType::StatusMessageAndProgressValue);
   emit filterGeneratedMessage(pm);
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool Observable::hasMessageReceivers() const
+{
+  static const QMetaMethod signal = QMetaMethod::fromSignal(&Observable::filterGeneratedMessage);
+  return isSignalConnected(signal);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProgressChannel& Observable::getProgressChannel()
+{
+  return m_ProgressChannel;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Observable::beginProgress(uint64_t total, const QString& title)
+{
+  if(!hasMessageReceivers())
+  {
+    return;
+  }
+  m_ProgressChannel.open(total, title, [this](int progress, const QString& message) { publishProgress(progress, message); });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Observable::endProgress()
+{
+  m_ProgressChannel.close();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void Observable::publishProgress(int progress, const QString& message)
+{
+  notifyProgressMessage("", getNameOfClass(), message, progress);
+}
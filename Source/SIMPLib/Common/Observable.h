@@ -42,6 +42,7 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Common/PipelineMessage.h"
+#include "SIMPLib/Common/ProgressChannel.h"
 
 
 /**
@@ -84,6 +85,40 @@ class SIMPLib_EXPORT Observable : public QObject
 
     virtual void notifyProgressMessage(const QString& prefix, const QString& humanLabel, const QString& str, int progress);
 
+    /**
+     * @brief Returns true if anything is connected to the filterGeneratedMessage() signal. The status and
+     * progress notifications return early when this is false so that no PipelineMessage is ever built.
+     */
+    bool hasMessageReceivers() const;
+
+    /**
+     * @brief Returns the thread safe progress channel for this object. Worker threads should use
+     * getProgressChannel().advance() and getProgressChannel().postMessage() instead of the notify methods.
+     * @return
+     */
+    ProgressChannel& getProgressChannel();
+
+    /**
+     * @brief Opens the progress channel if anything is observing this object. Must be called from the
+     * thread that will publish the messages (normally the thread running execute()).
+     * @param total The amount of work that corresponds to 100% complete
+     * @param title Text used to build the "|| N% Complete" messages
+     */
+    void beginProgress(uint64_t total, const QString& title);
+
+    /**
+     * @brief Publishes any pending progress and closes the progress channel
+     */
+    void endProgress();
+
+  protected:
+    /**
+     * @brief Called on the owning thread by the progress channel at the sampling rate.
+     * @param progress Percent complete
+     * @param message
+     */
+    virtual void publishProgress(int progress, const QString& message);
+
   public slots:
 
     /**
@@ -102,6 +137,9 @@ class SIMPLib_EXPORT Observable : public QObject
      * @param msg
      */
     void filterGeneratedMessage(const PipelineMessage& msg);
+
+  private:
+    ProgressChannel m_ProgressChannel;
 };
 
 #endif /* OBSERVABLE_H_ */
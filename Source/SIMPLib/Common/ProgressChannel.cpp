@@ -0,0 +1,234 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ProgressChannel.h"
+
+#include <chrono>
+
+#include <QtCore/QObject>
+
+namespace
+{
+const int k_DefaultSampleInterval = 100; // milliseconds
+const size_t k_MessageQueueCapacity = 256;
+
+int64_t CurrentMilliseconds()
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProgressChannel::ProgressChannel()
+: m_Open(false)
+, m_Completed(0)
+, m_Total(0)
+, m_DroppedMessages(0)
+, m_SampleInterval(k_DefaultSampleInterval)
+, m_Messages(k_MessageQueueCapacity)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ProgressChannel::~ProgressChannel() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressChannel::open(uint64_t total, const QString& title, PublishFunctionType publisher)
+{
+  // Throw away anything left over from a previous run that was never closed
+  QString stale;
+  while(m_Messages.tryPop(stale))
+  {
+  }
+
+  m_OwnerThread = std::this_thread::get_id();
+  m_Title = title;
+  m_Publisher = publisher;
+  m_LastPublishedPercent = -1;
+  m_NextPublishTime = CurrentMilliseconds() + m_SampleInterval.load(std::memory_order_relaxed);
+  m_Completed.store(0, std::memory_order_relaxed);
+  m_Total.store(total, std::memory_order_relaxed);
+  m_DroppedMessages.store(0, std::memory_order_relaxed);
+  m_Open.store(true, std::memory_order_release);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressChannel::close()
+{
+  if(!isOpen())
+  {
+    return;
+  }
+  if(std::this_thread::get_id() == m_OwnerThread)
+  {
+    publish();
+  }
+  m_Open.store(false, std::memory_order_release);
+  m_Publisher = PublishFunctionType();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressChannel::setSampleInterval(int milliseconds)
+{
+  m_SampleInterval.store(milliseconds < 0 ? 0 : milliseconds, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ProgressChannel::getSampleInterval() const
+{
+  return m_SampleInterval.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressChannel::setTotal(uint64_t total)
+{
+  m_Total.store(total, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t ProgressChannel::getTotal() const
+{
+  return m_Total.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t ProgressChannel::getCompleted() const
+{
+  return m_Completed.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ProgressChannel::getPercentComplete() const
+{
+  uint64_t total = getTotal();
+  if(total == 0)
+  {
+    return 0;
+  }
+  uint64_t completed = getCompleted();
+  if(completed >= total)
+  {
+    return 100;
+  }
+  return static_cast<int>((completed * 100) / total);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t ProgressChannel::getDroppedMessageCount() const
+{
+  return m_DroppedMessages.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressChannel::postMessage(const QString& message)
+{
+  if(!isOpen())
+  {
+    return;
+  }
+  if(!m_Messages.tryPush(message))
+  {
+    m_DroppedMessages.fetch_add(1, std::memory_order_relaxed);
+  }
+  update();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressChannel::update()
+{
+  if(!m_Open.load(std::memory_order_acquire) || std::this_thread::get_id() != m_OwnerThread)
+  {
+    return;
+  }
+  int64_t now = CurrentMilliseconds();
+  if(now < m_NextPublishTime)
+  {
+    return;
+  }
+  m_NextPublishTime = now + m_SampleInterval.load(std::memory_order_relaxed);
+  publish();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ProgressChannel::publish()
+{
+  if(!m_Publisher)
+  {
+    return;
+  }
+
+  int percent = getPercentComplete();
+  bool published = false;
+  QString message;
+  while(m_Messages.tryPop(message))
+  {
+    m_Publisher(percent, message);
+    published = true;
+  }
+
+  if(!published && getTotal() > 0 && percent != m_LastPublishedPercent)
+  {
+    m_Publisher(percent, m_Title + QObject::tr(" || %1% Complete").arg(percent));
+  }
+  m_LastPublishedPercent = percent;
+}
@@ -0,0 +1,171 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _progresschannel_h_
+#define _progresschannel_h_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+#include <QtCore/QString>
+
+#include "SIMPLib/Common/BoundedMessageQueue.hpp"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @class ProgressChannel ProgressChannel.h SIMPLib/Common/ProgressChannel.h
+ * @brief This class is a lightweight progress reporting channel that is safe to use from worker
+ * threads (including TBB parallel bodies). Workers only bump an atomic counter with advance() or
+ * push text into a bounded lock-free queue with postMessage(). The channel is sampled at a fixed
+ * rate (see setSampleInterval()) from the thread that opened it, which is the only thread that
+ * ever hands messages to the publish function, so observers never see calls from worker threads.
+ *
+ * When the channel has not been opened (for example because nothing is observing the filter)
+ * advance() and postMessage() reduce to a single relaxed atomic load.
+ */
+class SIMPLib_EXPORT ProgressChannel
+{
+public:
+  using PublishFunctionType = std::function<void(int progress, const QString& message)>;
+
+  ProgressChannel();
+  virtual ~ProgressChannel();
+
+  /**
+   * @brief Starts a new progress run. The calling thread becomes the owner of the channel and is
+   * the only thread that will call the publisher.
+   * @param total The value that corresponds to 100% complete
+   * @param title Text that prefixes the generated "|| N% Complete" messages
+   * @param publisher Function that receives the sampled progress and messages
+   */
+  void open(uint64_t total, const QString& title, PublishFunctionType publisher);
+
+  /**
+   * @brief Publishes anything that is still pending and closes the channel.
+   */
+  void close();
+
+  /**
+   * @brief Returns true if the channel is collecting progress
+   */
+  bool isOpen() const
+  {
+    return m_Open.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Sets the minimum time between two published updates
+   * @param milliseconds
+   */
+  void setSampleInterval(int milliseconds);
+  int getSampleInterval() const;
+
+  /**
+   * @brief Sets the value that corresponds to 100% complete
+   * @param total
+   */
+  void setTotal(uint64_t total);
+  uint64_t getTotal() const;
+
+  /**
+   * @brief Adds count to the completed work. This is safe to call from any thread.
+   * @param count
+   */
+  void advance(uint64_t count = 1)
+  {
+    if(!isOpen())
+    {
+      return;
+    }
+    m_Completed.fetch_add(count, std::memory_order_relaxed);
+    update();
+  }
+
+  /**
+   * @brief Queues a status message. This is safe to call from any thread. If the queue is full
+   * the message is dropped and counted in getDroppedMessageCount().
+   * @param message
+   */
+  void postMessage(const QString& message);
+
+  /**
+   * @brief Publishes the current state if the calling thread owns the channel and the sample
+   * interval has elapsed. Calls from any other thread return immediately.
+   */
+  void update();
+
+  /**
+   * @brief Returns the completed work
+   */
+  uint64_t getCompleted() const;
+
+  /**
+   * @brief Returns the completed work as a percentage of the total, clamped to [0, 100]
+   */
+  int getPercentComplete() const;
+
+  /**
+   * @brief Returns the number of messages that were dropped because the queue was full
+   */
+  uint64_t getDroppedMessageCount() const;
+
+protected:
+  /**
+   * @brief Drains the message queue and publishes the current progress. Owner thread only.
+   */
+  void publish();
+
+private:
+  std::atomic<bool> m_Open;
+  std::atomic<uint64_t> m_Completed;
+  std::atomic<uint64_t> m_Total;
+  std::atomic<uint64_t> m_DroppedMessages;
+  std::atomic<int> m_SampleInterval;
+  BoundedMessageQueue<QString> m_Messages;
+
+  // These are only touched by the owning thread
+  std::thread::id m_OwnerThread;
+  int64_t m_NextPublishTime = 0;
+  int m_LastPublishedPercent = -1;
+  QString m_Title;
+  PublishFunctionType m_Publisher;
+
+  ProgressChannel(const ProgressChannel&) = delete; // Copy Constructor Not Implemented
+  void operator=(const ProgressChannel&) = delete;  // Move assignment Not Implemented
+};
+
+#endif /* _progresschannel_h_ */
@@ -19,12 +19,14 @@ set_source_files_properties( ${SIMPLib_${SUBDIR_NAME}_Generated_MOC_SRCS} PROPER
 
 set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/AppVersion.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/BoundedMessageQueue.hpp
 
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Constants.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/CreatedArrayHelpIndexEntry.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/IObserver.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PhaseType.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineMessage.h
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ProgressChannel.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibDLLExport.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/SIMPLibSetGetMacros.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ScopedFileMonitor.hpp
@@ -44,6 +46,7 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Observer.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PhaseType.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/PipelineMessage.cpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ProgressChannel.cpp
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/ShapeType.cpp
 
 )
@@ -62,3 +65,10 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
 )
 
 
+#-------------------------------------------------------------------------------
+# Add the unit testing sources
+# --------------------------------------------------------------------
+# If Testing is enabled, turn on the Unit Tests
+if(SIMPL_BUILD_TESTING)
+  include(${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Testing/Cxx/SourceList.cmake)
+endif()
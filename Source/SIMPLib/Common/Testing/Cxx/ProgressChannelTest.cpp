@@ -0,0 +1,188 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <QtCore/QStringList>
+
+#include "SIMPLib/Common/BoundedMessageQueue.hpp"
+#include "SIMPLib/Common/ProgressChannel.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+/**
+ * @brief The ProgressChannelTest class
+ */
+class ProgressChannelTest
+{
+public:
+  ProgressChannelTest()
+  {
+  }
+  virtual ~ProgressChannelTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBoundedMessageQueue()
+  {
+    BoundedMessageQueue<int> queue(5);
+    DREAM3D_REQUIRE_EQUAL(queue.capacity(), 8)
+    DREAM3D_REQUIRE(queue.empty())
+
+    for(int i = 0; i < 8; i++)
+    {
+      DREAM3D_REQUIRE(queue.tryPush(i))
+    }
+    DREAM3D_REQUIRE(queue.tryPush(8) == false)
+
+    int value = -1;
+    for(int i = 0; i < 8; i++)
+    {
+      DREAM3D_REQUIRE(queue.tryPop(value))
+      DREAM3D_REQUIRE_EQUAL(value, i)
+    }
+    DREAM3D_REQUIRE(queue.tryPop(value) == false)
+    DREAM3D_REQUIRE(queue.empty())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestClosedChannelIsInert()
+  {
+    ProgressChannel channel;
+    DREAM3D_REQUIRE(channel.isOpen() == false)
+    channel.advance(10);
+    channel.postMessage("Ignored");
+    DREAM3D_REQUIRE_EQUAL(channel.getCompleted(), 0)
+    DREAM3D_REQUIRE_EQUAL(channel.getDroppedMessageCount(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestWorkerThreads()
+  {
+    const int numThreads = 4;
+    const uint64_t numPerThread = 100000;
+
+    QStringList published;
+    int lastProgress = -1;
+    std::thread::id ownerThread = std::this_thread::get_id();
+    bool publishedFromWorker = false;
+
+    ProgressChannel channel;
+    channel.setSampleInterval(0);
+    channel.open(numThreads * numPerThread, "Testing", [&](int progress, const QString& message) {
+      if(std::this_thread::get_id() != ownerThread)
+      {
+        publishedFromWorker = true;
+      }
+      lastProgress = progress;
+      published.push_back(message);
+    });
+    DREAM3D_REQUIRE(channel.isOpen())
+
+    std::vector<std::thread> workers;
+    for(int t = 0; t < numThreads; t++)
+    {
+      workers.emplace_back([&channel, t, numPerThread]() {
+        for(uint64_t i = 0; i < numPerThread; i++)
+        {
+          channel.advance();
+        }
+        channel.postMessage(QString("Worker %1 finished").arg(t));
+      });
+    }
+    for(std::thread& worker : workers)
+    {
+      worker.join();
+    }
+
+    DREAM3D_REQUIRE_EQUAL(channel.getCompleted(), numThreads * numPerThread)
+    DREAM3D_REQUIRE_EQUAL(channel.getPercentComplete(), 100)
+
+    channel.close();
+    DREAM3D_REQUIRE(channel.isOpen() == false)
+    DREAM3D_REQUIRE(publishedFromWorker == false)
+    DREAM3D_REQUIRE_EQUAL(lastProgress, 100)
+    DREAM3D_REQUIRE_EQUAL(published.filter("finished").size(), numThreads)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSampleInterval()
+  {
+    int publishCount = 0;
+    ProgressChannel channel;
+    channel.setSampleInterval(60 * 60 * 1000);
+    channel.open(1000, "Testing", [&publishCount](int, const QString&) { publishCount++; });
+    for(int i = 0; i < 1000; i++)
+    {
+      channel.advance();
+    }
+    DREAM3D_REQUIRE_EQUAL(publishCount, 0)
+    channel.close();
+    DREAM3D_REQUIRE_EQUAL(publishCount, 1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ProgressChannelTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestBoundedMessageQueue())
+    DREAM3D_REGISTER_TEST(TestClosedChannelIsInert())
+    DREAM3D_REGISTER_TEST(TestWorkerThreads())
+    DREAM3D_REGISTER_TEST(TestSampleInterval())
+  }
+
+private:
+  ProgressChannelTest(const ProgressChannelTest&); // Copy Constructor Not Implemented
+  void operator=(const ProgressChannelTest&);      // Move assignment Not Implemented
+};
@@ -217,6 +217,8 @@ template <typename T> IDataArray::Pointer copyCellData(AbstractFilter* filter, I
     // Now just raw copy the bytes from the source to the destination
     ::memcpy(fDestPtr, cSourcePtr, sizeof(T) * numComp);
   }
+  // The values were written through a raw pointer, so anything cached from them is stale
+  feature->markModified();
   return feature;
 }
 
@@ -237,24 +239,18 @@ void CreateFeatureArrayFromElementArray::execute()
   // Feature Id; the filter would not crash otherwise, but the user should
   // be notified of unanticipated behavior ; this cannot be done in the dataCheck since
   // we don't have acces to the data yet
+  // The largest Feature Id comes from a parallel statistics pass over the array. The pass
+  // is forced because earlier filters may have written the ids through raw pointers
+  // without calling markModified().
   int32_t totalFeatures = getDataContainerArray()->getAttributeMatrix(m_CellFeatureAttributeMatrixName)->getNumberOfTuples();
-  bool mismatchedFeatures = false;
   int32_t largestFeature = 0;
-  size_t totalPoints = m_FeatureIdsPtr.lock()->getNumberOfTuples();
-  for(size_t i = 0; i < totalPoints; i++)
+  ArrayStatistics featureIdStats = m_FeatureIdsPtr.lock()->getStatistics(0, true);
+  if(featureIdStats.count[0] > 0 && featureIdStats.max[0] > largestFeature)
   {
-    if(m_FeatureIds[i] > largestFeature)
-    {
-      largestFeature = m_FeatureIds[i];
-      if(largestFeature >= totalFeatures)
-      {
-        mismatchedFeatures = true;
-        break;
-      }
-    }
+    largestFeature = static_cast<int32_t>(featureIdStats.max[0]);
   }
 
-  if(mismatchedFeatures == true)
+  if(largestFeature >= totalFeatures)
   {
     QString ss = QObject::tr("Attribute Matrix %1 has %2 tuples but the input array %3 has a Feature ID value of at least %4").arg(m_CellFeatureAttributeMatrixName.serialize("/")).arg(totalFeatures).arg(getFeatureIdsArrayPath().serialize("/")).arg(largestFeature);
     setErrorCondition(-5555);
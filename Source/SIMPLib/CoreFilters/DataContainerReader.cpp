@@ -35,6 +35,8 @@
 
 #include "DataContainerReader.h"
 
+#include <algorithm>
+
 #include <QtCore/QFileInfo>
 
 #include "H5Support/QH5Utilities.h"
@@ -47,7 +49,10 @@
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerReaderFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersReader.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/HDF5/H5ImagePyramid.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReader.h"
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
@@ -61,6 +66,7 @@ DataContainerReader::DataContainerReader()
 , m_LastFileRead("")
 , m_LastRead(QDateTime::currentDateTime())
 , m_InputFileDataContainerArrayProxy()
+, m_PyramidLevel(0)
 {
   m_PipelineFromFile = FilterPipeline::New();
 
@@ -92,6 +98,7 @@ void DataContainerReader::setupFilterParameters()
     parameter->setFilter(this);
     parameters.push_back(parameter);
   }
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Preview Level (0 = Full Resolution)", PyramidLevel, FilterParameter::Parameter, DataContainerReader));
 
   setFilterParameters(parameters);
 }
@@ -106,6 +113,7 @@ void DataContainerReader::readFilterParameters(AbstractFilterParametersReader* r
   setInputFileDataContainerArrayProxy(reader->readDataContainerArrayProxy("InputFileDataContainerArrayProxy", getInputFileDataContainerArrayProxy()));
   syncProxies(); // Sync the file proxy and currently cached proxy together into one proxy
   setOverwriteExistingDataContainers(reader->readValue("OverwriteExistingDataContainers", getOverwriteExistingDataContainers()));
+  setPyramidLevel(reader->readValue("PyramidLevel", getPyramidLevel()));
   reader->closeFilterGroup();
 }
 
@@ -268,12 +276,6 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
     return DataContainerArray::NullPointer();
   }
 
-  DataContainerArray::Pointer dca = simplReader->readSIMPLDataUsingProxy(proxy, getInPreflight());
-  if (dca == DataContainerArray::NullPointer())
-  {
-    return DataContainerArray::NullPointer();
-  }
-
   hid_t fileId = QH5Utilities::openFile(getInputFile(), true); // Open the file Read Only
   if(fileId < 0)
   {
@@ -284,6 +286,25 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
   }
   H5ScopedFileSentinel sentinel(&fileId, true);
 
+  // The cell arrays that are replaced by a downsampled level are not read at full resolution
+  DataContainerArrayProxy readProxy = proxy;
+  QMap<QString, int> pyramidLevels;
+  if(m_PyramidLevel > 0)
+  {
+    pyramidLevels = selectPyramidLevels(fileId, readProxy);
+  }
+
+  DataContainerArray::Pointer dca = simplReader->readSIMPLDataUsingProxy(readProxy, getInPreflight());
+  if (dca == DataContainerArray::NullPointer())
+  {
+    return DataContainerArray::NullPointer();
+  }
+
+  if(!pyramidLevels.isEmpty() && readPyramidLevels(fileId, proxy, pyramidLevels, dca) < 0)
+  {
+    return DataContainerArray::NullPointer();
+  }
+
   if(!getInPreflight())
   {
     int32_t err = readExistingPipelineFromFile(fileId);
@@ -299,6 +320,133 @@ DataContainerArray::Pointer DataContainerReader::readData(DataContainerArrayProx
   return dca;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QMap<QString, int> DataContainerReader::selectPyramidLevels(hid_t fileId, DataContainerArrayProxy& proxy)
+{
+  QMap<QString, int> levels;
+
+  hid_t dcaGid = H5Gopen(fileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
+  if(dcaGid < 0)
+  {
+    return levels;
+  }
+  H5ScopedGroupSentinel dcaSentinel(&dcaGid, false);
+
+  for(QMap<QString, DataContainerProxy>::iterator dcIter = proxy.dataContainers.begin(); dcIter != proxy.dataContainers.end(); ++dcIter)
+  {
+    DataContainerProxy& dcProxy = dcIter.value();
+    if(dcProxy.flag == Qt::Unchecked || dcProxy.dcType != static_cast<unsigned int>(IGeometry::Type::Image))
+    {
+      continue;
+    }
+    hid_t dcGid = H5Gopen(dcaGid, dcProxy.name.toLatin1().data(), H5P_DEFAULT);
+    if(dcGid < 0)
+    {
+      continue;
+    }
+    H5ScopedGroupSentinel dcSentinel(&dcGid, false);
+
+    // Every cell AttributeMatrix shares the geometry, so all of them are read at the finest level they all have
+    int level = m_PyramidLevel;
+    int cellMatrixCount = 0;
+    for(QMap<QString, AttributeMatrixProxy>::iterator amIter = dcProxy.attributeMatricies.begin(); amIter != dcProxy.attributeMatricies.end(); ++amIter)
+    {
+      AttributeMatrixProxy& amProxy = amIter.value();
+      if(amProxy.flag == Qt::Unchecked || amProxy.amType != AttributeMatrix::Type::Cell)
+      {
+        continue;
+      }
+      level = std::min(level, H5ImagePyramid::ReadLevelCount(dcGid, amProxy.name));
+      cellMatrixCount++;
+    }
+    if(cellMatrixCount == 0)
+    {
+      continue;
+    }
+    if(level < m_PyramidLevel)
+    {
+      setWarningCondition(-155);
+      QString ss = QObject::tr("Data Container '%1' only stores %2 preview levels; reading level %2 instead of %3").arg(dcProxy.name).arg(level).arg(m_PyramidLevel);
+      notifyWarningMessage(getHumanLabel(), ss, getWarningCondition());
+    }
+    if(level < 1)
+    {
+      continue;
+    }
+
+    for(QMap<QString, AttributeMatrixProxy>::iterator amIter = dcProxy.attributeMatricies.begin(); amIter != dcProxy.attributeMatricies.end(); ++amIter)
+    {
+      AttributeMatrixProxy& amProxy = amIter.value();
+      if(amProxy.flag == Qt::Unchecked || amProxy.amType != AttributeMatrix::Type::Cell)
+      {
+        continue;
+      }
+      for(QMap<QString, DataArrayProxy>::iterator daIter = amProxy.dataArrays.begin(); daIter != amProxy.dataArrays.end(); ++daIter)
+      {
+        daIter.value().flag = Qt::Unchecked;
+      }
+    }
+    levels.insert(dcProxy.name, level);
+  }
+  return levels;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int DataContainerReader::readPyramidLevels(hid_t fileId, const DataContainerArrayProxy& proxy, const QMap<QString, int>& levels, DataContainerArray::Pointer dca)
+{
+  for(QMap<QString, int>::const_iterator levelIter = levels.begin(); levelIter != levels.end(); ++levelIter)
+  {
+    DataContainer::Pointer dc = dca->getDataContainer(levelIter.key());
+    if(nullptr == dc.get())
+    {
+      continue;
+    }
+    ImageGeom::Pointer geom = dc->getGeometryAs<ImageGeom>();
+    const DataContainerProxy& dcProxy = proxy.dataContainers[levelIter.key()];
+    for(QMap<QString, AttributeMatrixProxy>::const_iterator amIter = dcProxy.attributeMatricies.begin(); amIter != dcProxy.attributeMatricies.end(); ++amIter)
+    {
+      const AttributeMatrixProxy& amProxy = amIter.value();
+      if(amProxy.flag == Qt::Unchecked || amProxy.amType != AttributeMatrix::Type::Cell)
+      {
+        continue;
+      }
+      QVector<QString> arrayNames;
+      for(QMap<QString, DataArrayProxy>::const_iterator daIter = amProxy.dataArrays.begin(); daIter != amProxy.dataArrays.end(); ++daIter)
+      {
+        if(daIter.value().flag != Qt::Unchecked)
+        {
+          arrayNames.push_back(daIter.key());
+        }
+      }
+
+      AttributeMatrix::Pointer levelData = H5ImagePyramid::ReadLevel(fileId, dcProxy.name, amProxy.name, levelIter.value(), arrayNames, getInPreflight(), geom);
+      if(nullptr == levelData.get())
+      {
+        setErrorCondition(-156);
+        QString ss = QObject::tr("Error reading preview level %1 of Attribute Matrix '%2/%3'").arg(levelIter.value()).arg(dcProxy.name).arg(amProxy.name);
+        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+        return getErrorCondition();
+      }
+      for(const QString& arrayName : arrayNames)
+      {
+        if(!levelData->doesAttributeArrayExist(arrayName))
+        {
+          setWarningCondition(-157);
+          QString ss = QObject::tr("Attribute Array '%1/%2/%3' is not stored at preview level %4 and was not read").arg(dcProxy.name).arg(amProxy.name).arg(arrayName).arg(levelIter.value());
+          notifyWarningMessage(getHumanLabel(), ss, getWarningCondition());
+        }
+      }
+      dc->removeAttributeMatrix(amProxy.name);
+      dc->addAttributeMatrix(amProxy.name, levelData);
+    }
+  }
+  return 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -67,6 +67,7 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
     PYB11_PROPERTY(QString LastFileRead READ getLastFileRead WRITE setLastFileRead)
     PYB11_PROPERTY(QDateTime LastRead READ getLastRead WRITE setLastRead)
     PYB11_PROPERTY(DataContainerArrayProxy InputFileDataContainerArrayProxy READ getInputFileDataContainerArrayProxy WRITE setInputFileDataContainerArrayProxy)
+    PYB11_PROPERTY(int PyramidLevel READ getPyramidLevel WRITE setPyramidLevel)
 
     PYB11_METHOD(DataContainerArrayProxy readDataContainerArrayStructure ARGS path)
   
@@ -92,6 +93,9 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
     SIMPL_FILTER_PARAMETER(DataContainerArrayProxy, InputFileDataContainerArrayProxy)
     Q_PROPERTY(DataContainerArrayProxy InputFileDataContainerArrayProxy READ getInputFileDataContainerArrayProxy WRITE setInputFileDataContainerArrayProxy)
 
+    SIMPL_FILTER_PARAMETER(int, PyramidLevel)
+    Q_PROPERTY(int PyramidLevel READ getPyramidLevel WRITE setPyramidLevel)
+
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
      */
@@ -182,6 +186,26 @@ class SIMPLib_EXPORT DataContainerReader : public AbstractFilter
      */
     int readExistingPipelineFromFile(hid_t fileId);
 
+    /**
+     * @brief selectPyramidLevels Decides which preview level is read for each selected ImageGeom DataContainer
+     * and unchecks the cell arrays in proxy that will be read from that level instead of the full resolution data
+     * @param fileId The open input file
+     * @param proxy The proxy that will be used to read the full resolution data
+     * @return Map of DataContainer names to the level that is read for them
+     */
+    QMap<QString, int> selectPyramidLevels(hid_t fileId, DataContainerArrayProxy& proxy);
+
+    /**
+     * @brief readPyramidLevels Replaces the selected cell AttributeMatrices of each DataContainer in levels with
+     * the stored preview level and updates the ImageGeom to match
+     * @param fileId The open input file
+     * @param proxy The proxy holding the original selection
+     * @param levels Map of DataContainer names to the level to read
+     * @param dca The DataContainerArray read at full resolution
+     * @return Integer error value
+     */
+    int readPyramidLevels(hid_t fileId, const DataContainerArrayProxy& proxy, const QMap<QString, int>& levels, DataContainerArray::Pointer dca);
+
     /**
      * @brief writeExistingPipelineToFile Writes the filter parameters of the existing pipline to a
      * SIMPLView file
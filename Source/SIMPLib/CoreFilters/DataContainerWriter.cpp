@@ -35,6 +35,8 @@
 
 #include "DataContainerWriter.h"
 
+#include <algorithm>
+
 #include <QtCore/QDir>
 
 #include "H5Support/H5Utilities.h"
@@ -44,8 +46,14 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/FloatFilterParameter.h"
 #include "SIMPLib/FilterParameters/H5FilterParametersWriter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/HDF5/H5ImagePyramid.h"
+#include "SIMPLib/HDF5/H5StructureIndex.h"
 #include "SIMPLib/SIMPLibVersion.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
@@ -57,6 +65,21 @@ extern Q_CORE_EXPORT int qt_ntfs_permission_lookup;
 #define APPEND_DATA_TRUE 1
 #define APPEND_DATA_FALSE 0
 
+namespace
+{
+const QString k_TimeStepCount("TimeStepCount");
+const QString k_TimeStep("TimeStep");
+const QString k_TimeValue("TimeValue");
+
+/**
+ * @brief Returns the name of the HDF5 group that holds one time step of a DataContainer
+ */
+QString timeStepGroupName(const QString& dcName, int timeStep)
+{
+  return QString("%1_Step_%2").arg(dcName).arg(timeStep, 6, 10, QChar('0'));
+}
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -65,6 +88,11 @@ DataContainerWriter::DataContainerWriter()
 , m_WritePipeline(true)
 , m_WriteXdmfFile(true)
 , m_WriteTimeSeries(false)
+, m_AppendTimeStep(false)
+, m_UseTimeValue(false)
+, m_TimeValue(0.0f)
+, m_WritePyramidLevels(false)
+, m_PyramidLevelCount(3)
 , m_AppendToExisting(false)
 , m_FileId(-1)
 {
@@ -88,6 +116,13 @@ void DataContainerWriter::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output File", OutputFile, FilterParameter::Parameter, DataContainerWriter, "*.dream3d", ""));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Write Xdmf File", WriteXdmfFile, FilterParameter::Parameter, DataContainerWriter));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Include Xdmf Time Markers", WriteTimeSeries, FilterParameter::Parameter, DataContainerWriter));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Append As Time Step", AppendTimeStep, FilterParameter::Parameter, DataContainerWriter));
+  QStringList linkedTimeProps("TimeValue");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Custom Time Value", UseTimeValue, FilterParameter::Parameter, DataContainerWriter, linkedTimeProps));
+  parameters.push_back(SIMPL_NEW_FLOAT_FP("Time Value", TimeValue, FilterParameter::Parameter, DataContainerWriter));
+  QStringList linkedProps("PyramidLevelCount");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Write Downsampled Preview Levels", WritePyramidLevels, FilterParameter::Parameter, DataContainerWriter, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Preview Levels", PyramidLevelCount, FilterParameter::Parameter, DataContainerWriter));
 
   setFilterParameters(parameters);
 }
@@ -100,6 +135,12 @@ void DataContainerWriter::readFilterParameters(AbstractFilterParametersReader* r
   reader->openFilterGroup(this, index);
   setOutputFile(reader->readString("OutputFile", getOutputFile()));
   setWriteXdmfFile(reader->readValue("WriteXdmfFile", getWriteXdmfFile()));
+  setWriteTimeSeries(reader->readValue("WriteTimeSeries", getWriteTimeSeries()));
+  setAppendTimeStep(reader->readValue("AppendTimeStep", getAppendTimeStep()));
+  setUseTimeValue(reader->readValue("UseTimeValue", getUseTimeValue()));
+  setTimeValue(reader->readValue("TimeValue", getTimeValue()));
+  setWritePyramidLevels(reader->readValue("WritePyramidLevels", getWritePyramidLevels()));
+  setPyramidLevelCount(reader->readValue("PyramidLevelCount", getPyramidLevelCount()));
   reader->closeFilterGroup();
 }
 
@@ -145,6 +186,12 @@ void DataContainerWriter::dataCheck()
     ss = QObject::tr("The output file must have its actual filename set");
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
   }
+  if(m_WritePyramidLevels && m_PyramidLevelCount < 1)
+  {
+    setErrorCondition(-10004);
+    ss = QObject::tr("The number of preview levels must be at least 1");
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
 
 #ifdef _WIN32
   // Turn file permission checking on, if requested
@@ -211,7 +258,8 @@ void DataContainerWriter::execute()
     return;
   }
 
-  err = openFile(m_AppendToExisting); // Do NOT append to any existing file
+  bool fileExisted = fi.exists();
+  err = openFile(m_AppendToExisting || m_AppendTimeStep); // Only append when asked to
   if(err < 0)
   {
     QString ss = QObject::tr("The HDF5 file could not be opened or created.\n The given filename was:\n\t[%1]").arg(m_OutputFile);
@@ -219,6 +267,24 @@ void DataContainerWriter::execute()
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
     return;
   }
+  // In time step mode each execution adds one step to the file without touching
+  // the steps that are already there. A file that was not written in this mode
+  // is never replaced; the user has to pick a new file or delete the old one.
+  int timeStep = -1;
+  if(m_AppendTimeStep)
+  {
+    timeStep = readTimeStepCount();
+    if(timeStep < 0 && fileExisted)
+    {
+      closeFile();
+      QString ss = QObject::tr("The file '%1' already exists but was not written with 'Append As Time Step'. Choose a new output file or remove the existing one.").arg(m_OutputFile);
+      setErrorCondition(-11117);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+    timeStep = std::max(timeStep, 0);
+  }
+  float timeValue = m_UseTimeValue ? m_TimeValue : static_cast<float>(timeStep);
   // qDebug() << "DREAM3D File: " << m_OutputFile;
 
   // This will make sure if we return early from this method that the HDF5 File is properly closed.
@@ -229,6 +295,8 @@ void DataContainerWriter::execute()
   QH5Lite::writeStringAttribute(m_FileId, "/", SIMPL::HDF5::DREAM3DVersion, SIMPLib::Version::Complete());
   QFile xdmfFile;
   QTextStream xdmfOut(&xdmfFile);
+  QString xdmfFilePath;
+  QString xdmfGrids;
   if(m_WriteXdmfFile == true)
   {
     QFileInfo ofFi(m_OutputFile);
@@ -241,15 +309,28 @@ void DataContainerWriter::execute()
     {
       name = parentPath + "/" + name + ".xdmf";
     }
-    xdmfFile.setFileName(name);
-    if(xdmfFile.open(QIODevice::WriteOnly | QIODevice::Text))
+    xdmfFilePath = name;
+    if(timeStep >= 0)
+    {
+      // Collect only this step's grids; they are spliced into the existing file at the end
+      xdmfOut.setString(&xdmfGrids);
+    }
+    else
     {
-      writeXdmfHeader(xdmfOut);
+      // No text mode translation, so a later append run finds the footer byte for byte
+      xdmfFile.setFileName(name);
+      if(xdmfFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+      {
+        writeXdmfHeader(xdmfOut);
+      }
     }
   }
 
-  // Write the Pipeline to the File
-  err = writePipeline();
+  // Write the Pipeline to the File. Later time steps run the same pipeline so it is only stored once.
+  if(timeStep <= 0)
+  {
+    err = writePipeline();
+  }
 
   err = H5Utilities::createGroupsFromPath(SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), m_FileId);
   if(err < 0)
@@ -262,21 +343,41 @@ void DataContainerWriter::execute()
   hid_t dcaGid = H5Gopen(m_FileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
   scopedFileSentinel.addGroupId(&dcaGid);
 
+  // Stamp the group before changing it so an existing index is ignored even if writing is interrupted
+  err = H5StructureIndex::MarkModified(dcaGid);
+  if(err < 0)
+  {
+    QString ss = QObject::tr("Error updating the write stamp of HDF5 Group '%1'").arg(SIMPL::StringConstants::DataContainerGroupName);
+    setErrorCondition(-11116);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+
   QList<QString> dcNames = getDataContainerArray()->getDataContainerNames();
   for(int iter = 0; iter < getDataContainerArray()->getNumDataContainers(); iter++)
   {
     DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(dcNames[iter]);
     IGeometry::Pointer geometry = dc->getGeometry();
-    err = H5Utilities::createGroupsFromPath(dcNames[iter].toLatin1().data(), dcaGid);
+    QString dcGroupName = dcNames[iter];
+    if(timeStep >= 0)
+    {
+      dcGroupName = timeStepGroupName(dcNames[iter], timeStep);
+      // A step left behind by an interrupted execution was never counted; discard it
+      if(H5Lexists(dcaGid, dcGroupName.toLatin1().data(), H5P_DEFAULT) > 0)
+      {
+        H5Ldelete(dcaGid, dcGroupName.toLatin1().data(), H5P_DEFAULT);
+      }
+    }
+    err = H5Utilities::createGroupsFromPath(dcGroupName.toLatin1().data(), dcaGid);
     if(err < 0)
     {
-      QString ss = QObject::tr("Error creating HDF5 Group '%1'").arg(dcNames[iter]);
+      QString ss = QObject::tr("Error creating HDF5 Group '%1'").arg(dcGroupName);
       setErrorCondition(-60);
       notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
       return;
     }
 
-    hid_t dcGid = H5Gopen(dcaGid, dcNames[iter].toLatin1().data(), H5P_DEFAULT);
+    hid_t dcGid = H5Gopen(dcaGid, dcGroupName.toLatin1().data(), H5P_DEFAULT);
     H5ScopedGroupSentinel groupSentinel(&dcGid, false);
     // QString ss = QObject::tr("%1 |--> Writing %2 DataContainer ").arg(getMessagePrefix()).arg(dcNames[iter]);
 
@@ -287,16 +388,46 @@ void DataContainerWriter::execute()
       notifyErrorMessage(getHumanLabel(), "Error writing DataContainer AttributeMatrices", -803);
       return;
     }
+    ImageGeom::Pointer imageGeom = std::dynamic_pointer_cast<ImageGeom>(geometry);
+    if(m_WritePyramidLevels && nullptr != imageGeom.get())
+    {
+      DataContainer::AttributeMatrixMap_t& attrMats = dc->getAttributeMatrices();
+      for(DataContainer::AttributeMatrixMap_t::iterator amIter = attrMats.begin(); amIter != attrMats.end(); ++amIter)
+      {
+        AttributeMatrix::Pointer am = amIter.value();
+        if(am->getType() != AttributeMatrix::Type::Cell)
+        {
+          continue;
+        }
+        err = H5ImagePyramid::WriteLevels(m_FileId, dcGid, dcGroupName, imageGeom, am, m_PyramidLevelCount);
+        if(err < 0)
+        {
+          QString ss = QObject::tr("Error writing the preview levels of AttributeMatrix '%1'").arg(am->getName());
+          notifyErrorMessage(getHumanLabel(), ss, -806);
+          return;
+        }
+      }
+    }
     err = dc->writeMeshToHDF5(dcGid, m_WriteXdmfFile);
     if(err < 0)
     {
       notifyErrorMessage(getHumanLabel(), "Error writing DataContainer Geometry", -804);
       return;
     }
+    if(timeStep >= 0)
+    {
+      QH5Lite::writeScalarAttribute(dcaGid, dcGroupName, k_TimeStep, timeStep);
+      QH5Lite::writeScalarAttribute(dcaGid, dcGroupName, k_TimeValue, timeValue);
+    }
     if(m_WriteXdmfFile == true && geometry.get() != nullptr)
     {
 
-      if(getWriteTimeSeries())
+      if(timeStep >= 0)
+      {
+        dc->getGeometry()->setEnableTimeSeries(true);
+        dc->getGeometry()->setTimeValue(timeValue);
+      }
+      else if(getWriteTimeSeries())
       {
         dc->getGeometry()->setEnableTimeSeries(true);
         dc->getGeometry()->setTimeValue(static_cast<float>(iter));
@@ -307,31 +438,73 @@ void DataContainerWriter::execute()
 #endif
 
       QString hdfFileName = QH5Utilities::fileNameFromFileId(m_FileId);
-      err = dc->writeXdmf(xdmfOut, hdfFileName);
+      QString dcXdmf;
+      QTextStream dcXdmfOut(&dcXdmf);
+      err = dc->writeXdmf(dcXdmfOut, hdfFileName);
       if(err < 0)
       {
         notifyErrorMessage(getHumanLabel(), "Error writing Xdmf File", -805);
         return;
       }
+      dcXdmfOut.flush();
+      if(timeStep >= 0)
+      {
+        // The geometry writes its HDF5 paths from the DataContainer name; point them at this step's group
+        QString dcPath = QString(":/%1/%2/").arg(SIMPL::StringConstants::DataContainerGroupName).arg(dcNames[iter]);
+        QString stepPath = QString(":/%1/%2/").arg(SIMPL::StringConstants::DataContainerGroupName).arg(dcGroupName);
+        dcXdmf.replace(dcPath, stepPath);
+      }
+      xdmfOut << dcXdmf;
     }
   }
 
   // Write the Data ContainerBundles
-  err = writeDataContainerBundles(m_FileId);
+  if(timeStep <= 0)
+  {
+    err = writeDataContainerBundles(m_FileId);
+    if(err < 0)
+    {
+      QString ss = QObject::tr("Error writing DataContainerBundles");
+      setErrorCondition(-11113);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+  }
+
+  // Index the structure of everything now in the file so readers do not have to open every array.
+  // Readers fall back to walking the file without an index, so failing to write one is not fatal.
+  err = H5StructureIndex::Write(m_FileId);
   if(err < 0)
   {
-    QString ss = QObject::tr("Error writing DataContainerBundles");
-    setErrorCondition(-11113);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
+    QString ss = QObject::tr("The structure index could not be written. Reading the structure of this file will be slower.");
+    setWarningCondition(-11115);
+    notifyWarningMessage(getHumanLabel(), ss, getWarningCondition());
   }
 
   // Write the XDMF File
-  if(m_WriteXdmfFile == true)
+  if(m_WriteXdmfFile == true && timeStep >= 0)
+  {
+    xdmfOut.flush();
+    err = appendXdmfTimeStep(xdmfFilePath, xdmfGrids, timeStep == 0);
+    if(err < 0)
+    {
+      QString ss = QObject::tr("Error appending time step %1 to the Xdmf file '%2'").arg(timeStep).arg(xdmfFilePath);
+      setErrorCondition(-11114);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+  }
+  else if(m_WriteXdmfFile == true)
   {
     writeXdmfFooter(xdmfOut);
   }
 
+  // The step is only counted once all of its data is in the file
+  if(timeStep >= 0)
+  {
+    QH5Lite::writeScalarAttribute(m_FileId, "/", k_TimeStepCount, timeStep + 1);
+  }
+
   H5Gclose(dcaGid);
 
   dcaGid = -1;
@@ -386,7 +559,7 @@ void DataContainerWriter::writeXdmfHeader(QTextStream& xdmf)
        << "\n";
   xdmf << " <Domain>"
        << "\n";
-  if(getWriteTimeSeries())
+  if(getWriteTimeSeries() || getAppendTimeStep())
   {
     xdmf << "<Grid Name=\"CellTime\" GridType=\"Collection\" CollectionType=\"Temporal\">"
          << "\n";
@@ -398,7 +571,7 @@ void DataContainerWriter::writeXdmfHeader(QTextStream& xdmf)
 // -----------------------------------------------------------------------------
 void DataContainerWriter::writeXdmfFooter(QTextStream& xdmf)
 {
-  if(getWriteTimeSeries())
+  if(getWriteTimeSeries() || getAppendTimeStep())
   {
     xdmf << " </Grid>" << "\n";
   }
@@ -408,6 +581,73 @@ void DataContainerWriter::writeXdmfFooter(QTextStream& xdmf)
        << "\n";
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int DataContainerWriter::readTimeStepCount()
+{
+  if(QH5Lite::findAttribute(m_FileId, k_TimeStepCount) <= 0)
+  {
+    return -1;
+  }
+  int count = -1;
+  if(QH5Lite::readScalarAttribute(m_FileId, "/", k_TimeStepCount, count) < 0)
+  {
+    return -1;
+  }
+  return count;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int DataContainerWriter::appendXdmfTimeStep(const QString& xdmfFilePath, const QString& grids, bool newSeries)
+{
+  QString footer;
+  QTextStream footerOut(&footer);
+  writeXdmfFooter(footerOut);
+  footerOut.flush();
+  QByteArray footerBytes = footer.toLatin1();
+
+  // The file is written without text mode translation so the footer has a known byte length
+  QFile xdmfFile(xdmfFilePath);
+  // The HDF5 file was just recreated, so whatever Xdmf file is there describes other data
+  if(newSeries || xdmfFile.exists() == false || xdmfFile.size() < footerBytes.size())
+  {
+    if(xdmfFile.open(QIODevice::WriteOnly | QIODevice::Truncate) == false)
+    {
+      return -1;
+    }
+    QString header;
+    QTextStream headerOut(&header);
+    writeXdmfHeader(headerOut);
+    headerOut.flush();
+    xdmfFile.write(header.toLatin1());
+  }
+  else
+  {
+    if(xdmfFile.open(QIODevice::ReadWrite) == false)
+    {
+      return -1;
+    }
+    qint64 footerPos = xdmfFile.size() - footerBytes.size();
+    xdmfFile.seek(footerPos);
+    if(xdmfFile.read(footerBytes.size()) != footerBytes)
+    {
+      // Not a temporal collection written by this filter
+      return -2;
+    }
+    xdmfFile.seek(footerPos);
+  }
+
+  xdmfFile.write(grids.toLatin1());
+  if(xdmfFile.write(footerBytes) != footerBytes.size())
+  {
+    return -3;
+  }
+  return 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
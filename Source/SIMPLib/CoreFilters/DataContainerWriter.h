@@ -56,6 +56,11 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
     PYB11_PROPERTY(QString OutputFile READ getOutputFile WRITE setOutputFile)
     PYB11_PROPERTY(bool WriteXdmfFile READ getWriteXdmfFile WRITE setWriteXdmfFile)
     PYB11_PROPERTY(bool WriteTimeSeries READ getWriteTimeSeries WRITE setWriteTimeSeries)
+    PYB11_PROPERTY(bool AppendTimeStep READ getAppendTimeStep WRITE setAppendTimeStep)
+    PYB11_PROPERTY(bool UseTimeValue READ getUseTimeValue WRITE setUseTimeValue)
+    PYB11_PROPERTY(float TimeValue READ getTimeValue WRITE setTimeValue)
+    PYB11_PROPERTY(bool WritePyramidLevels READ getWritePyramidLevels WRITE setWritePyramidLevels)
+    PYB11_PROPERTY(int PyramidLevelCount READ getPyramidLevelCount WRITE setPyramidLevelCount)
 
   public:
     SIMPL_SHARED_POINTERS(DataContainerWriter)
@@ -75,6 +80,21 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
     SIMPL_FILTER_PARAMETER(bool, WriteTimeSeries)
     Q_PROPERTY(bool WriteTimeSeries READ getWriteTimeSeries WRITE setWriteTimeSeries)
 
+    SIMPL_FILTER_PARAMETER(bool, AppendTimeStep)
+    Q_PROPERTY(bool AppendTimeStep READ getAppendTimeStep WRITE setAppendTimeStep)
+
+    SIMPL_FILTER_PARAMETER(bool, UseTimeValue)
+    Q_PROPERTY(bool UseTimeValue READ getUseTimeValue WRITE setUseTimeValue)
+
+    SIMPL_FILTER_PARAMETER(float, TimeValue)
+    Q_PROPERTY(float TimeValue READ getTimeValue WRITE setTimeValue)
+
+    SIMPL_FILTER_PARAMETER(bool, WritePyramidLevels)
+    Q_PROPERTY(bool WritePyramidLevels READ getWritePyramidLevels WRITE setWritePyramidLevels)
+
+    SIMPL_FILTER_PARAMETER(int, PyramidLevelCount)
+    Q_PROPERTY(int PyramidLevelCount READ getPyramidLevelCount WRITE setPyramidLevelCount)
+
     SIMPL_INSTANCE_PROPERTY(bool, AppendToExisting)
 
     /**
@@ -216,6 +236,23 @@ class SIMPLib_EXPORT DataContainerWriter : public AbstractFilter
      */
     void writeXdmfFooter(QTextStream& out);
 
+    /**
+     * @brief readTimeStepCount Returns the number of time steps already stored in
+     * the open file, or -1 if the file was not written in time step append mode
+     */
+    int readTimeStepCount();
+
+    /**
+     * @brief appendXdmfTimeStep Inserts the Xdmf grids of a single time step in front
+     * of the footer of an existing temporal collection. Only the footer is rewritten,
+     * so the cost does not grow with the number of steps already in the file.
+     * @param xdmfFilePath Path to the Xdmf file. It is created if it does not exist.
+     * @param grids The Xdmf text for the grids of this time step
+     * @param newSeries True for the first step of a series; any existing Xdmf file is replaced
+     * @return Integer error value
+     */
+    int appendXdmfTimeStep(const QString& xdmfFilePath, const QString& grids, bool newSeries);
+
   private:
     hid_t m_FileId;
 
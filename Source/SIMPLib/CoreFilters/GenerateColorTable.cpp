@@ -4,14 +4,20 @@
 
 #include "GenerateColorTable.h"
 
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
 #include <tbb/partitioner.h>
 #include <tbb/task_scheduler_init.h>
 #endif
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/FilterParameters/GenerateColorTableFilterParameter.h"
@@ -57,76 +63,226 @@ int findRightBinIndex_Binary(float nValue, QVector<float> binPoints)
 }
 
 /**
- * @brief The GenerateColorTableImpl class implements a threaded algorithm that computes the RGB values
- * for each element in a given array of data
+ * @brief The ColorTableLookup class holds the preset control points in a flat layout together with a
+ * fixed resolution table that maps a quantized normalized value straight to its color bin, so that the
+ * per element work is a table read, a short forward scan and one interpolation instead of a binary search.
+ * The interpolation itself is performed exactly as before so the generated colors do not change.
  */
-template <typename T>
-class GenerateColorTableImpl
+class ColorTableLookup
 {
 public:
-  GenerateColorTableImpl(typename DataArray<T>::Pointer arrayPtr, QVector<float> binPoints,
-                         std::vector<std::vector<double> > controlPoints, int numControlColors, UInt8ArrayType::Pointer colorArray) :
-    m_ArrayPtr(arrayPtr),
-    m_BinPoints(binPoints),
-    m_NumControlColors(numControlColors),
-    m_ControlPoints(controlPoints),
-    m_ColorArray(colorArray)
-  {
-    m_ArrayMin = arrayPtr->getValue(0);
-    m_ArrayMax = arrayPtr->getValue(0);
-    for (int i=1; i<arrayPtr->getNumberOfTuples(); i++)
+  static const int k_Resolution = 4096;
+
+  ColorTableLookup(const QVector<float>& binPoints, const std::vector<std::vector<double>>& controlPoints)
+  : m_BinPoints(binPoints)
+  , m_NumControlColors(static_cast<int>(controlPoints.size()))
+  , m_Rgb(controlPoints.size() * 3)
+  , m_CellBins(k_Resolution + 1)
+  {
+    for(size_t i = 0; i < controlPoints.size(); i++)
     {
-      if (arrayPtr->getValue(i) < m_ArrayMin) { m_ArrayMin = arrayPtr->getValue(i); }
-      if (arrayPtr->getValue(i) > m_ArrayMax) { m_ArrayMax = arrayPtr->getValue(i); }
+      m_Rgb[i * 3 + 0] = controlPoints[i][1];
+      m_Rgb[i * 3 + 1] = controlPoints[i][2];
+      m_Rgb[i * 3 + 2] = controlPoints[i][3];
+    }
+
+    // Each cell stores the right bin of its lower edge; any value inside the cell has the same or a later right bin
+    for(int c = 0; c <= k_Resolution; c++)
+    {
+      m_CellBins[c] = findRightBinIndex_Binary(static_cast<float>(c) / static_cast<float>(k_Resolution), m_BinPoints);
     }
   }
-  virtual ~GenerateColorTableImpl()
+
+  /**
+   * @brief Writes the color for the normalized value into rgb. When numComps is 4 an alpha value is also
+   * written, which is opaque for every value except NaN.
+   */
+  void color(float nValue, uint8_t* rgb, int numComps) const
   {
+    if(std::isnan(nValue))
+    {
+      for(int c = 0; c < numComps; c++)
+      {
+        rgb[c] = 0;
+      }
+      return;
+    }
+
+    // nValue * k_Resolution is exact because k_Resolution is a power of two, so the cell edge never exceeds nValue
+    int cell = static_cast<int>(nValue * static_cast<float>(k_Resolution));
+    if(cell < 0)
+    {
+      cell = 0;
+    }
+    if(cell > k_Resolution)
+    {
+      cell = k_Resolution;
+    }
+    int rightBinIndex = m_CellBins[cell];
+    const int lastBin = m_BinPoints.size() - 1;
+    while(rightBinIndex < lastBin && m_BinPoints[rightBinIndex] < nValue)
+    {
+      rightBinIndex++;
+    }
+
+    int leftBinIndex = rightBinIndex - 1;
+    if(leftBinIndex < 0)
+    {
+      leftBinIndex = 0;
+      rightBinIndex = (lastBin > 0) ? 1 : 0;
+    }
+
+    // Find the fractional distance traveled between the beginning and end of the current color bin
+    float currFraction = 0.0f;
+    if(rightBinIndex == leftBinIndex)
+    {
+      currFraction = 0.0f;
+    }
+    else if(rightBinIndex < m_BinPoints.size())
+    {
+      currFraction = (nValue - m_BinPoints[leftBinIndex]) / (m_BinPoints[rightBinIndex] - m_BinPoints[leftBinIndex]);
+    }
+    else
+    {
+      currFraction = (nValue - m_BinPoints[leftBinIndex]) / (1 - m_BinPoints[leftBinIndex]);
+    }
+
+    // If the current color bin index is larger than the total number of control colors, automatically set the currentBinIndex
+    // to the last control color.
+    if(leftBinIndex > m_NumControlColors - 1)
+    {
+      leftBinIndex = m_NumControlColors - 1;
+    }
+
+    // Calculate the RGB values
+    const double* left = m_Rgb.data() + leftBinIndex * 3;
+    const double* right = m_Rgb.data() + rightBinIndex * 3;
+    rgb[0] = static_cast<unsigned char>((left[0] * (1.0 - currFraction) + right[0] * currFraction) * 255);
+    rgb[1] = static_cast<unsigned char>((left[1] * (1.0 - currFraction) + right[1] * currFraction) * 255);
+    rgb[2] = static_cast<unsigned char>((left[2] * (1.0 - currFraction) + right[2] * currFraction) * 255);
+    if(numComps == 4)
+    {
+      rgb[3] = 255;
+    }
   }
 
-  void convert(size_t start, size_t end) const
+private:
+  QVector<float> m_BinPoints;
+  int m_NumControlColors;
+  std::vector<double> m_Rgb;
+  std::vector<int> m_CellBins;
+};
+
+/**
+ * @brief The ColorTableMinMaxImpl class finds the range of the input array as a parallel reduction
+ */
+template <typename T>
+class ColorTableMinMaxImpl
+{
+public:
+  ColorTableMinMaxImpl(const T* data)
+  : m_Data(data)
+  , m_Min(std::numeric_limits<T>::max())
+  , m_Max(std::numeric_limits<T>::lowest())
+  {
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  ColorTableMinMaxImpl(ColorTableMinMaxImpl& other, tbb::split)
+  : m_Data(other.m_Data)
+  , m_Min(std::numeric_limits<T>::max())
+  , m_Max(std::numeric_limits<T>::lowest())
   {
-    for (size_t i = start; i < end; i++)
+  }
+#endif
+
+  void compute(size_t start, size_t end)
+  {
+    T localMin = m_Min;
+    T localMax = m_Max;
+    for(size_t i = start; i < end; i++)
     {
-      // Normalize value
-      float nValue = (static_cast<float>(m_ArrayPtr->getValue(i) - m_ArrayMin)) / static_cast<float>((m_ArrayMax - m_ArrayMin));
+      if(m_Data[i] < localMin) { localMin = m_Data[i]; }
+      if(m_Data[i] > localMax) { localMax = m_Data[i]; }
+    }
+    m_Min = localMin;
+    m_Max = localMax;
+  }
 
-      int rightBinIndex = findRightBinIndex_Binary(nValue, m_BinPoints);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r)
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
 
-      int leftBinIndex = rightBinIndex - 1;
-      if (leftBinIndex < 0)
-      {
-        leftBinIndex = 0;
-        rightBinIndex = 1;
-      }
+  void join(const ColorTableMinMaxImpl& rhs)
+  {
+    if(rhs.m_Min < m_Min) { m_Min = rhs.m_Min; }
+    if(rhs.m_Max > m_Max) { m_Max = rhs.m_Max; }
+  }
 
-      // Find the fractional distance traveled between the beginning and end of the current color bin
-      float currFraction = 0.0f;
-      if (rightBinIndex < m_BinPoints.size())
-      {
-        currFraction = (nValue - m_BinPoints[leftBinIndex]) / (m_BinPoints[rightBinIndex] - m_BinPoints[leftBinIndex]);
-      }
-      else
-      {
-        currFraction = (nValue - m_BinPoints[leftBinIndex]) / (1 - m_BinPoints[leftBinIndex]);
-      }
+  T getMin() const { return m_Min; }
+  T getMax() const { return m_Max; }
+
+private:
+  const T* m_Data;
+  T m_Min;
+  T m_Max;
+};
+
+/**
+ * @brief The GenerateColorTableImpl class implements a threaded algorithm that computes the RGB values
+ * for each element in a given array of data. Integer arrays with a small enough range are converted
+ * through a direct index table holding one color per representable value.
+ */
+template <typename T>
+class GenerateColorTableImpl
+{
+public:
+  GenerateColorTableImpl(const T* data, T arrayMin, T arrayMax, const ColorTableLookup* lookup, const uint8_t* directLut, uint8_t* colors, int numComps)
+  : m_Data(data)
+  , m_ArrayMin(arrayMin)
+  , m_ArrayMax(arrayMax)
+  , m_Lookup(lookup)
+  , m_DirectLut(directLut)
+  , m_Colors(colors)
+  , m_NumComps(numComps)
+  {
+  }
+  virtual ~GenerateColorTableImpl()
+  {
+  }
 
-      // If the current color bin index is larger than the total number of control colors, automatically set the currentBinIndex
-      // to the last control color.
-      if(leftBinIndex > m_NumControlColors - 1)
+  void convert(size_t start, size_t end) const
+  {
+    if(m_DirectLut != nullptr)
+    {
+      for(size_t i = start; i < end; i++)
       {
-        leftBinIndex = m_NumControlColors - 1;
+        const uint8_t* src = m_DirectLut + static_cast<size_t>(m_Data[i] - m_ArrayMin) * m_NumComps;
+        uint8_t* dst = m_Colors + i * m_NumComps;
+        for(int c = 0; c < m_NumComps; c++)
+        {
+          dst[c] = src[c];
+        }
       }
+      return;
+    }
 
-      // Calculate the RGB values
-      unsigned char r = (m_ControlPoints[leftBinIndex][1] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][1] * currFraction) * 255;
-      unsigned char g = (m_ControlPoints[leftBinIndex][2] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][2] * currFraction) * 255;
-      unsigned char b = (m_ControlPoints[leftBinIndex][3] * (1.0 - currFraction) + m_ControlPoints[rightBinIndex][3] * currFraction) * 255;
+    for(size_t i = start; i < end; i++)
+    {
+      m_Lookup->color(normalize(m_Data[i]), m_Colors + i * m_NumComps, m_NumComps);
+    }
+  }
 
-      m_ColorArray->setComponent(i, 0, r);
-      m_ColorArray->setComponent(i, 1, g);
-      m_ColorArray->setComponent(i, 2, b);
+  float normalize(T value) const
+  {
+    if(m_ArrayMax == m_ArrayMin)
+    {
+      return 0.0f;
     }
+    return (static_cast<float>(value - m_ArrayMin)) / static_cast<float>((m_ArrayMax - m_ArrayMin));
   }
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
@@ -136,20 +292,21 @@ public:
   }
 #endif
 private:
-  typename DataArray<T>::Pointer                        m_ArrayPtr;
-  QVector<float>                                        m_BinPoints;
-  T                                                     m_ArrayMin;
-  T                                                     m_ArrayMax;
-  int                                                   m_NumControlColors;
-  std::vector<std::vector<double> >                     m_ControlPoints;
-  UInt8ArrayType::Pointer                               m_ColorArray;
+  const T* m_Data;
+  T m_ArrayMin;
+  T m_ArrayMax;
+  const ColorTableLookup* m_Lookup;
+  const uint8_t* m_DirectLut;
+  uint8_t* m_Colors;
+  int m_NumComps;
 };
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 template <typename T>
-void generateColorArray(typename DataArray<T>::Pointer arrayPtr, QJsonArray presetControlPoints, DataArrayPath selectedDAP, QString rgbArrayName, DataContainerArray::Pointer dca)
+void generateColorArray(typename DataArray<T>::Pointer arrayPtr, QJsonArray presetControlPoints, DataArrayPath selectedDAP, QString rgbArrayName, bool includeAlpha,
+                        DataContainerArray::Pointer dca)
 {
   if (arrayPtr->getNumberOfTuples() <= 0) { return; }
 
@@ -184,24 +341,66 @@ void generateColorArray(typename DataArray<T>::Pointer arrayPtr, QJsonArray pres
   DataArrayPath tmpPath = selectedDAP;
   tmpPath.setDataArrayName(rgbArrayName);
 
-  UInt8ArrayType::Pointer colorArray = dca->getPrereqArrayFromPath<UInt8ArrayType, AbstractFilter>(nullptr, tmpPath, QVector<size_t>(1, 3));
+  int numColorComps = includeAlpha ? 4 : 3;
+  UInt8ArrayType::Pointer colorArray = dca->getPrereqArrayFromPath<UInt8ArrayType, AbstractFilter>(nullptr, tmpPath, QVector<size_t>(1, numColorComps));
   if (colorArray.get() == nullptr) { return; }
 
+  size_t numTuples = arrayPtr->getNumberOfTuples();
+  const T* data = arrayPtr->getConstPointer(0);
+  uint8_t* colors = colorArray->getPointer(0);
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   bool doParallel = true;
 #endif
 
+  ColorTableMinMaxImpl<T> minMax(data);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_reduce(tbb::blocked_range<size_t>(0, numTuples), minMax, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    minMax.compute(0, numTuples);
+  }
+  T arrayMin = minMax.getMin();
+  T arrayMax = minMax.getMax();
+  if(arrayMax < arrayMin)
+  {
+    // Every value was NaN
+    arrayMin = arrayMax = static_cast<T>(0);
+  }
+
+  ColorTableLookup lookup(binPoints, controlPoints);
+
+  // Integer arrays whose range fits into a modest table get one precomputed color per representable value
+  std::vector<uint8_t> directLut;
+  const size_t k_MaxDirectLutSize = 65536;
+  if(std::is_integral<T>::value && static_cast<double>(arrayMax) - static_cast<double>(arrayMin) < static_cast<double>(k_MaxDirectLutSize))
+  {
+    GenerateColorTableImpl<T> lutBuilder(data, arrayMin, arrayMax, &lookup, nullptr, colors, numColorComps);
+    size_t lutSize = static_cast<size_t>(arrayMax - arrayMin) + 1;
+    directLut.resize(lutSize * numColorComps);
+    for(size_t k = 0; k < lutSize; k++)
+    {
+      T value = static_cast<T>(arrayMin + static_cast<T>(k));
+      lookup.color(lutBuilder.normalize(value), directLut.data() + k * numColorComps, numColorComps);
+    }
+  }
+  const uint8_t* directLutPtr = directLut.empty() ? nullptr : directLut.data();
+
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   if(doParallel == true)
   {
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, arrayPtr->getNumberOfTuples()), GenerateColorTableImpl<T>(arrayPtr, binPoints, controlPoints, numControlColors, colorArray),
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numTuples), GenerateColorTableImpl<T>(data, arrayMin, arrayMax, &lookup, directLutPtr, colors, numColorComps),
                       tbb::auto_partitioner());
   }
   else
 #endif
   {
-    GenerateColorTableImpl<T> serial(arrayPtr, binPoints, controlPoints, numControlColors, colorArray);
-    serial.convert(0, arrayPtr->getNumberOfTuples());
+    GenerateColorTableImpl<T> serial(data, arrayMin, arrayMax, &lookup, directLutPtr, colors, numColorComps);
+    serial.convert(0, numTuples);
   }
 }
 
@@ -213,6 +412,7 @@ GenerateColorTable::GenerateColorTable()
 , m_SelectedPresetControlPoints(QJsonArray())
 , m_SelectedDataArrayPath(DataArrayPath("", "", ""))
 , m_RgbArrayName("")
+, m_IncludeAlphaChannel(false)
 {
   initialize();
 }
@@ -254,6 +454,7 @@ void GenerateColorTable::setupFilterParameters()
   }
 
   parameters.push_back(SIMPL_NEW_STRING_FP("RGB Array Name", RgbArrayName, FilterParameter::CreatedArray, GenerateColorTable));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Include Alpha Channel", IncludeAlphaChannel, FilterParameter::Parameter, GenerateColorTable));
 
   setFilterParameters(parameters);
 }
@@ -271,7 +472,7 @@ void GenerateColorTable::dataCheck()
   DataArrayPath tmpPath = getSelectedDataArrayPath();
   tmpPath.setDataArrayName(getRgbArrayName());
 
-  getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<uint8_t>, AbstractFilter, uint8_t>(this, tmpPath, 0, QVector<size_t>(1, 3));
+  getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<uint8_t>, AbstractFilter, uint8_t>(this, tmpPath, 0, QVector<size_t>(1, getIncludeAlphaChannel() ? 4 : 3));
 }
 
 // -----------------------------------------------------------------------------
@@ -300,57 +501,57 @@ void GenerateColorTable::execute()
   if (getDataContainerArray()->getPrereqArrayFromPath<Int8ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     Int8ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<Int8ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<int8_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<int8_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getIncludeAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<UInt8ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     UInt8ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<UInt8ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<uint8_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<uint8_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getIncludeAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<Int16ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     Int16ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<Int16ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<int16_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<int16_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getIncludeAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<UInt16ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     UInt16ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<UInt16ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<uint16_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<uint16_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getIncludeAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     Int32ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<Int32ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<int32_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<int32_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getIncludeAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<UInt32ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     UInt32ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<UInt32ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<uint32_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<uint32_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getIncludeAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<Int64ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     Int64ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<Int64ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<int64_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<int64_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getIncludeAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<UInt64ArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     UInt64ArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<UInt64ArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<uint64_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<uint64_t>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getIncludeAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<DoubleArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     DoubleArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<DoubleArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<double>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<double>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getIncludeAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<FloatArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     FloatArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<FloatArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<float>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<float>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getIncludeAlphaChannel(), getDataContainerArray());
   }
   else if (getDataContainerArray()->getPrereqArrayFromPath<BoolArrayType, AbstractFilter>(nullptr, getSelectedDataArrayPath(), QVector<size_t>(1, 1)).get() != nullptr)
   {
     BoolArrayType::Pointer ptr = getDataContainerArray()->getPrereqArrayFromPath<BoolArrayType, AbstractFilter>(this, getSelectedDataArrayPath(), QVector<size_t>(1, 1));
-    generateColorArray<bool>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getDataContainerArray());
+    generateColorArray<bool>(ptr, getSelectedPresetControlPoints(), getSelectedDataArrayPath(), getRgbArrayName(), getIncludeAlphaChannel(), getDataContainerArray());
   }
   else
   {
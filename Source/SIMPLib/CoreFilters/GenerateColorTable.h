@@ -23,6 +23,7 @@ class SIMPLib_EXPORT GenerateColorTable : public AbstractFilter
   PYB11_PROPERTY(QJsonArray SelectedPresetControlPoints READ getSelectedPresetControlPoints WRITE setSelectedPresetControlPoints)
   PYB11_PROPERTY(DataArrayPath SelectedDataArrayPath READ getSelectedDataArrayPath WRITE setSelectedDataArrayPath)
   PYB11_PROPERTY(QString RgbArrayName READ getRgbArrayName WRITE setRgbArrayName)
+  PYB11_PROPERTY(bool IncludeAlphaChannel READ getIncludeAlphaChannel WRITE setIncludeAlphaChannel)
 
   public:
     SIMPL_SHARED_POINTERS(GenerateColorTable)
@@ -43,6 +44,9 @@ class SIMPLib_EXPORT GenerateColorTable : public AbstractFilter
     SIMPL_INSTANCE_PROPERTY(QString, RgbArrayName)
     Q_PROPERTY(QString RgbArrayName READ getRgbArrayName WRITE setRgbArrayName)
 
+    SIMPL_INSTANCE_PROPERTY(bool, IncludeAlphaChannel)
+    Q_PROPERTY(bool IncludeAlphaChannel READ getIncludeAlphaChannel WRITE setIncludeAlphaChannel)
+
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
      */
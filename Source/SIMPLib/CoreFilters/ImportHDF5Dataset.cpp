@@ -33,10 +33,13 @@
 #include "ImportHDF5Dataset.h"
 
 #include <QtCore/QFileInfo>
+#include <QtCore/QSet>
 
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Common/TemplateHelpers.hpp"
 #include "SIMPLib/FilterParameters/AttributeMatrixSelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/ImportHDF5DatasetFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
@@ -46,31 +49,88 @@
 
 namespace Detail
 {
+/**
+ * @brief One dataset to read into a preallocated array
+ */
+struct DatasetReadJob
+{
+  QString datasetPath;
+  ImportHDF5Dataset::HyperslabSelection selection;
+  IDataArray::Pointer array;
+  herr_t err;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename T> IDataArray::Pointer readH5Dataset(hid_t locId, const QString& datasetPath, const size_t& numOfTuples, const QVector<size_t>& cDims)
+template <typename T> herr_t readH5Dataset(hid_t locId, const DatasetReadJob& job, size_t chunkCacheBytes)
 {
-  herr_t err = -1;
-  IDataArray::Pointer ptr;
-
-  ptr = DataArray<T>::CreateArray(numOfTuples, cDims, datasetPath);
-
-  T* data = (T*)(ptr->getVoidPointer(0));
-  err = QH5Lite::readPointerDataset(locId, datasetPath, data);
+  T* data = reinterpret_cast<T*>(job.array->getVoidPointer(0));
+  herr_t err = QH5Lite::readPointerDatasetHyperslab(locId, job.datasetPath, job.selection.offset, job.selection.count, job.selection.stride, chunkCacheBytes, data);
+  job.array->markModified();
   if(err < 0)
   {
     qDebug() << "readH5Data read error: " << __FILE__ << "(" << __LINE__ << ")";
-    ptr = IDataArray::NullPointer();
   }
-  return ptr;
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+herr_t readH5Dataset(hid_t locId, const DatasetReadJob& job, size_t chunkCacheBytes)
+{
+  IDataArray::Pointer ptr = job.array;
+  if(TemplateHelpers::CanDynamicCast<Int8ArrayType>()(ptr))
+  {
+    return readH5Dataset<int8_t>(locId, job, chunkCacheBytes);
+  }
+  if(TemplateHelpers::CanDynamicCast<UInt8ArrayType>()(ptr))
+  {
+    return readH5Dataset<uint8_t>(locId, job, chunkCacheBytes);
+  }
+  if(TemplateHelpers::CanDynamicCast<Int16ArrayType>()(ptr))
+  {
+    return readH5Dataset<int16_t>(locId, job, chunkCacheBytes);
+  }
+  if(TemplateHelpers::CanDynamicCast<UInt16ArrayType>()(ptr))
+  {
+    return readH5Dataset<uint16_t>(locId, job, chunkCacheBytes);
+  }
+  if(TemplateHelpers::CanDynamicCast<Int32ArrayType>()(ptr))
+  {
+    return readH5Dataset<int32_t>(locId, job, chunkCacheBytes);
+  }
+  if(TemplateHelpers::CanDynamicCast<UInt32ArrayType>()(ptr))
+  {
+    return readH5Dataset<uint32_t>(locId, job, chunkCacheBytes);
+  }
+  if(TemplateHelpers::CanDynamicCast<Int64ArrayType>()(ptr))
+  {
+    return readH5Dataset<int64_t>(locId, job, chunkCacheBytes);
+  }
+  if(TemplateHelpers::CanDynamicCast<UInt64ArrayType>()(ptr))
+  {
+    return readH5Dataset<uint64_t>(locId, job, chunkCacheBytes);
+  }
+  if(TemplateHelpers::CanDynamicCast<FloatArrayType>()(ptr))
+  {
+    return readH5Dataset<float>(locId, job, chunkCacheBytes);
+  }
+  if(TemplateHelpers::CanDynamicCast<DoubleArrayType>()(ptr))
+  {
+    return readH5Dataset<double>(locId, job, chunkCacheBytes);
+  }
+  return -1;
 }
+
 } // namespace Detail
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 ImportHDF5Dataset::ImportHDF5Dataset()
+: m_ChunkCacheSize(0)
 {
   initialize();
 }
@@ -107,6 +167,8 @@ void ImportHDF5Dataset::setupFilterParameters()
   parameters.push_back(parameter);
 
   parameters.push_back(SIMPL_NEW_STRING_FP("Component Dimensions", ComponentDimensions, FilterParameter::Parameter, ImportHDF5Dataset));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Hyperslab Selections", HyperslabSelections, FilterParameter::Parameter, ImportHDF5Dataset));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Chunk Cache Size (MB)", ChunkCacheSize, FilterParameter::Parameter, ImportHDF5Dataset));
 
   {
     AttributeMatrixSelectionFilterParameter::RequirementType req;
@@ -156,15 +218,25 @@ void ImportHDF5Dataset::dataCheck()
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
     return;
   }
-  else if(m_DatasetPaths.size() > 1)
+
+  if(m_ChunkCacheSize < 0)
   {
-    QString ss = tr("Only one dataset can be checked at a time.  Please check one dataset.");
-    setErrorCondition(-20004);
+    QString ss = tr("The chunk cache size must be 0 (HDF5 default) or a positive number of megabytes.");
+    setErrorCondition(-20010);
     notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
     return;
   }
 
-  QString datasetPath = m_DatasetPaths[0];
+  bool selectionsOk = false;
+  QVector<HyperslabSelection> selections = createHyperslabSelections(selectionsOk);
+  if(selectionsOk == false)
+  {
+    QString ss = tr("The hyperslab selections are not in the right format. Use one 'offset/count[/stride]' entry per dataset, separated by ';', "
+                    "with comma-separated values for each dataset dimension (ex: '0,0,0/1,64,64; ; 2,0/4,10/2,1').");
+    setErrorCondition(-20009);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
 
   int err = 0;
   AttributeMatrix::Pointer am = getDataContainerArray()->getPrereqAttributeMatrixFromPath<AbstractFilter>(this, m_SelectedAttributeMatrix, err);
@@ -181,106 +253,150 @@ void ImportHDF5Dataset::dataCheck()
   }
   H5ScopedFileSentinel sentinel(&fileId, true);
 
-  QString parentPath = QH5Utilities::getParentPath(datasetPath);
-  hid_t parentId;
-  if(parentPath.isEmpty())
-  {
-    parentId = fileId;
-  }
-  else
+  QSet<QString> arrayNames;
+  for(int dsetIndex = 0; dsetIndex < m_DatasetPaths.size(); dsetIndex++)
   {
-    parentId = QH5Utilities::openHDF5Object(fileId, parentPath);
-    sentinel.addGroupId(&parentId);
-  }
+    QString datasetPath = m_DatasetPaths[dsetIndex];
+    const HyperslabSelection& selection = selections[dsetIndex];
+
+    QString parentPath = QH5Utilities::getParentPath(datasetPath);
+    hid_t parentId;
+    if(parentPath.isEmpty())
+    {
+      parentId = fileId;
+    }
+    else
+    {
+      parentId = QH5Utilities::openHDF5Object(fileId, parentPath);
+      sentinel.addGroupId(&parentId);
+    }
 
-  // Read dataset into DREAM.3D structure
-  QString objectName = QH5Utilities::getObjectNameFromPath(datasetPath);
+    // Read dataset into DREAM.3D structure
+    QString objectName = QH5Utilities::getObjectNameFromPath(datasetPath);
 
-  QVector<hsize_t> dims;
-  H5T_class_t type_class;
-  size_t type_size;
-  err = QH5Lite::getDatasetInfo(parentId, objectName, dims, type_class, type_size);
-  if(err < 0)
-  {
-    QString ss = tr("Error reading type info from dataset with path '%1'").arg(datasetPath);
-    setErrorCondition(-20005);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
+    QVector<hsize_t> dims;
+    H5T_class_t type_class;
+    size_t type_size;
+    err = QH5Lite::getDatasetInfo(parentId, objectName, dims, type_class, type_size);
+    if(err < 0)
+    {
+      QString ss = tr("Error reading type info from dataset with path '%1'").arg(datasetPath);
+      setErrorCondition(-20005);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
 
-  if(m_ComponentDimensions.isEmpty())
-  {
-    QString ss = tr("The component dimensions are empty.  Please enter the component dimensions, using comma-separated values (ex: 4x2 would be '4, 2').");
-    setErrorCondition(-20006);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
+    if(m_ComponentDimensions.isEmpty())
+    {
+      QString ss = tr("The component dimensions are empty.  Please enter the component dimensions, using comma-separated values (ex: 4x2 would be '4, 2').");
+      setErrorCondition(-20006);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
 
-  QVector<size_t> cDims = createComponentDimensions();
-  if(cDims.isEmpty())
-  {
-    QString ss = tr("Component Dimensions are not in the right format. Use comma-separated values (ex: 4x2 would be '4, 2').");
-    setErrorCondition(-20007);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
+    QVector<size_t> cDims = createComponentDimensions();
+    if(cDims.isEmpty())
+    {
+      QString ss = tr("Component Dimensions are not in the right format. Use comma-separated values (ex: 4x2 would be '4, 2').");
+      setErrorCondition(-20007);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+
+    // A hyperslab replaces the dataset dimensions by its count in every dimension
+    QVector<hsize_t> selectedDims = dims;
+    if(!selection.offset.isEmpty())
+    {
+      bool inside = (selection.offset.size() == dims.size());
+      for(int i = 0; inside && i < dims.size(); i++)
+      {
+        hsize_t stride = selection.stride.isEmpty() ? 1 : selection.stride[i];
+        inside = (selection.offset[i] + (selection.count[i] - 1) * stride < dims[i]);
+      }
+      if(inside == false)
+      {
+        QString ss = tr("The hyperslab selected for dataset '%1' does not have one value per dataset dimension or reaches past the end of the dataset.").arg(datasetPath);
+        setErrorCondition(-20011);
+        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+        return;
+      }
+      selectedDims = selection.count;
+    }
 
-  // Calculate the product of the dataset dimensions and the product of the component dimensions.
-  // Since we're already looping over both of these sets of dimensions, let's also create our error message
-  // in case the equation does not work and we have to bail.
-  QString ss = "";
-  QTextStream stream(&ss);
+    // Calculate the product of the dataset dimensions and the product of the component dimensions.
+    // Since we're already looping over both of these sets of dimensions, let's also create our error message
+    // in case the equation does not work and we have to bail.
+    QString ss = "";
+    QTextStream stream(&ss);
 
-  stream << tr("HDF5 File Path: %1\n").arg(m_HDF5FilePath);
-  stream << tr("HDF5 Dataset Path: %1\n").arg(datasetPath);
+    stream << tr("HDF5 File Path: %1\n").arg(m_HDF5FilePath);
+    stream << tr("HDF5 Dataset Path: %1\n").arg(datasetPath);
 
-  size_t cDimsProduct = 1;
-  stream << tr("Component Dimensions: (");
-  for(int i = 0; i < cDims.size(); i++)
-  {
-    stream << cDims[i];
-    cDimsProduct = cDimsProduct * cDims[i];
-    if(i != cDims.size() - 1)
+    size_t cDimsProduct = 1;
+    stream << tr("Component Dimensions: (");
+    for(int i = 0; i < cDims.size(); i++)
     {
-      stream << ", ";
+      stream << cDims[i];
+      cDimsProduct = cDimsProduct * cDims[i];
+      if(i != cDims.size() - 1)
+      {
+        stream << ", ";
+      }
     }
-  }
-  stream << ")\n";
+    stream << ")\n";
 
-  size_t dsetDimsProduct = 1;
-  stream << tr("HDF5 Dataset Dimensions: (");
-  for(int i = 0; i < dims.size(); i++)
-  {
-    stream << dims[i];
-    dsetDimsProduct = dsetDimsProduct * dims[i];
-    if(i != dims.size() - 1)
+    size_t dsetDimsProduct = 1;
+    stream << (selection.offset.isEmpty() ? tr("HDF5 Dataset Dimensions: (") : tr("HDF5 Hyperslab Dimensions: ("));
+    for(int i = 0; i < selectedDims.size(); i++)
     {
-      stream << ", ";
+      stream << selectedDims[i];
+      dsetDimsProduct = dsetDimsProduct * selectedDims[i];
+      if(i != selectedDims.size() - 1)
+      {
+        stream << ", ";
+      }
     }
-  }
-  stream << ")\n";
+    stream << ")\n";
 
-  stream << tr("Attribute Matrix Path: %1/%2\n").arg(m_SelectedAttributeMatrix.getDataContainerName()).arg(m_SelectedAttributeMatrix.getAttributeMatrixName());
-  stream << tr("Attribute Matrix Tuple Count: %1\n\n").arg(am->getNumberOfTuples());
+    stream << tr("Attribute Matrix Path: %1/%2\n").arg(m_SelectedAttributeMatrix.getDataContainerName()).arg(m_SelectedAttributeMatrix.getAttributeMatrixName());
+    stream << tr("Attribute Matrix Tuple Count: %1\n\n").arg(am->getNumberOfTuples());
 
-  if(dsetDimsProduct % cDimsProduct != 0 || dsetDimsProduct / cDimsProduct != am->getNumberOfTuples())
-  {
-    stream << tr("This dataset cannot be read because this equation is not satisfied:\n"
-                 "(Product of dataset dimensions) / (Product of component dimensions) = (Attribute Matrix Tuple Count)\n"
-                 "%1 / %2 = %3\n%4 = %5")
-                  .arg(QString::number(dsetDimsProduct))
-                  .arg(QString::number(cDimsProduct))
-                  .arg(QString::number(am->getNumberOfTuples()))
-                  .arg(QString::number(dsetDimsProduct / cDimsProduct))
-                  .arg(QString::number(am->getNumberOfTuples()));
+    if(dsetDimsProduct % cDimsProduct != 0 || dsetDimsProduct / cDimsProduct != am->getNumberOfTuples())
+    {
+      stream << tr("This dataset cannot be read because this equation is not satisfied:\n"
+                   "(Product of dataset dimensions) / (Product of component dimensions) = (Attribute Matrix Tuple Count)\n"
+                   "%1 / %2 = %3\n%4 = %5")
+                    .arg(QString::number(dsetDimsProduct))
+                    .arg(QString::number(cDimsProduct))
+                    .arg(QString::number(am->getNumberOfTuples()))
+                    .arg(QString::number(dsetDimsProduct / cDimsProduct))
+                    .arg(QString::number(am->getNumberOfTuples()));
+
+      setErrorCondition(-20008);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
 
-    setErrorCondition(-20008);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
+    if(arrayNames.contains(objectName))
+    {
+      QString ss = tr("More than one of the selected datasets is named '%1'. Each dataset becomes an array with that name in the same Attribute Matrix.").arg(objectName);
+      setErrorCondition(-20012);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+    arrayNames.insert(objectName);
 
-  IDataArray::Pointer dPtr = readIDataArray(parentId, objectName, am->getNumberOfTuples(), cDims, getInPreflight());
-  am->addAttributeArray(dPtr->getName(), dPtr);
+    // The data itself is read by execute() once every array has been allocated
+    IDataArray::Pointer dPtr = createIDataArray(parentId, objectName, am->getNumberOfTuples(), cDims, !getInPreflight());
+    if(nullptr == dPtr.get())
+    {
+      QString ss = tr("The dataset '%1' has a type that cannot be imported.").arg(datasetPath);
+      setErrorCondition(-20013);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+    am->addAttributeArray(dPtr->getName(), dPtr);
+  }
 
   // The sentinel will close the HDF5 File and any groups that were open.
 }
@@ -311,9 +427,119 @@ void ImportHDF5Dataset::execute()
     return;
   }
 
+  readDatasets();
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+
   notifyStatusMessage(getHumanLabel(), "Complete");
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<ImportHDF5Dataset::HyperslabSelection> ImportHDF5Dataset::createHyperslabSelections(bool& ok)
+{
+  ok = true;
+  QVector<HyperslabSelection> selections(m_DatasetPaths.size());
+  QStringList entries = m_HyperslabSelections.split(';', QString::KeepEmptyParts);
+  for(int i = 0; i < entries.size(); i++)
+  {
+    QString entry = entries[i].trimmed();
+    if(entry.isEmpty())
+    {
+      continue;
+    }
+    QStringList parts = entry.split('/', QString::KeepEmptyParts);
+    if(i >= selections.size() || parts.size() < 2 || parts.size() > 3)
+    {
+      ok = false;
+      return selections;
+    }
+
+    QVector<QVector<hsize_t>> values(parts.size());
+    for(int p = 0; p < parts.size(); p++)
+    {
+      QStringList valueStrs = parts[p].split(',', QString::SkipEmptyParts);
+      for(int v = 0; v < valueStrs.size(); v++)
+      {
+        QString valueStr = valueStrs[v];
+        valueStr = valueStr.remove(" ");
+        bool valueOk = false;
+        qulonglong value = valueStr.toULongLong(&valueOk);
+        // Counts and strides of 0 would select nothing
+        if(valueOk == false || (p > 0 && value == 0))
+        {
+          ok = false;
+          return selections;
+        }
+        values[p].push_back(static_cast<hsize_t>(value));
+      }
+      if(values[p].isEmpty() || values[p].size() != values[0].size())
+      {
+        ok = false;
+        return selections;
+      }
+    }
+
+    selections[i].offset = values[0];
+    selections[i].count = values[1];
+    if(values.size() == 3)
+    {
+      selections[i].stride = values[2];
+    }
+  }
+
+  return selections;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImportHDF5Dataset::readDatasets()
+{
+  bool selectionsOk = false;
+  QVector<HyperslabSelection> selections = createHyperslabSelections(selectionsOk);
+  AttributeMatrix::Pointer am = getDataContainerArray()->getAttributeMatrix(m_SelectedAttributeMatrix);
+
+  std::vector<Detail::DatasetReadJob> jobs(m_DatasetPaths.size());
+  for(int i = 0; i < m_DatasetPaths.size(); i++)
+  {
+    jobs[i].datasetPath = m_DatasetPaths[i];
+    jobs[i].selection = selections[i];
+    jobs[i].array = am->getAttributeArray(QH5Utilities::getObjectNameFromPath(m_DatasetPaths[i]));
+    jobs[i].err = 0;
+  }
+
+  hid_t fileId = H5Utilities::openFile(m_HDF5FilePath.toStdString(), true);
+  if(fileId < 0)
+  {
+    QString ss = tr("Error opening HDF5 file '%1'").arg(m_HDF5FilePath);
+    setErrorCondition(-20014);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return;
+  }
+  H5ScopedFileSentinel sentinel(&fileId, true);
+
+  size_t chunkCacheBytes = static_cast<size_t>(m_ChunkCacheSize) * 1024 * 1024;
+
+  // The HDF5 library serializes every call behind one global lock, even when it is built
+  // thread safe, so the datasets are read one after another. Concurrent reads would only
+  // add contention.
+  for(size_t i = 0; i < jobs.size(); i++)
+  {
+    jobs[i].err = Detail::readH5Dataset(fileId, jobs[i], chunkCacheBytes);
+    if(jobs[i].err < 0)
+    {
+      QString ss = tr("Error reading the data of dataset '%1'").arg(jobs[i].datasetPath);
+      setErrorCondition(-20015);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -342,14 +568,13 @@ QVector<size_t> ImportHDF5Dataset::createComponentDimensions()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-IDataArray::Pointer ImportHDF5Dataset::readIDataArray(hid_t gid, const QString& name, size_t numOfTuples, QVector<size_t> cDims, bool metaDataOnly)
+IDataArray::Pointer ImportHDF5Dataset::createIDataArray(hid_t gid, const QString& name, size_t numOfTuples, QVector<size_t> cDims, bool allocate)
 {
   herr_t err = -1;
   // herr_t retErr = 1;
   hid_t typeId = -1;
   H5T_class_t attr_type;
   size_t attr_size;
-  QString res;
 
   QVector<hsize_t> dims; // Reusable for the loop
   IDataArray::Pointer ptr = IDataArray::NullPointer();
@@ -369,104 +594,41 @@ IDataArray::Pointer ImportHDF5Dataset::readIDataArray(hid_t gid, const QString&
   switch(attr_type)
   {
   case H5T_STRING:
-    res.clear(); // Clear the string out first
-    err = QH5Lite::readStringDataset(gid, name, res);
-    //        if(err >= 0)
-    //        {
-    //          IDataArray::Pointer attr = MXAAsciiStringData::Create(res);
-    //          attr->setName(name);
-    //          attributes[*iter] = attr;
-    //        }
+    // String datasets have no matching numeric array type
     break;
   case H5T_INTEGER:
     // qDebug() << "User Meta Data Type is Integer" ;
     if(H5Tequal(typeId, H5T_STD_U8BE) || H5Tequal(typeId, H5T_STD_U8LE))
     {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<uint8_t>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<uint8_t>::CreateArray(numOfTuples, cDims, name, false);
-      }
+      ptr = DataArray<uint8_t>::CreateArray(numOfTuples, cDims, name, allocate);
     }
     else if(H5Tequal(typeId, H5T_STD_U16BE) || H5Tequal(typeId, H5T_STD_U16LE))
     {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<uint16_t>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<uint16_t>::CreateArray(numOfTuples, cDims, name, false);
-      }
+      ptr = DataArray<uint16_t>::CreateArray(numOfTuples, cDims, name, allocate);
     }
     else if(H5Tequal(typeId, H5T_STD_U32BE) || H5Tequal(typeId, H5T_STD_U32LE))
     {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<uint32_t>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<uint32_t>::CreateArray(numOfTuples, cDims, name, false);
-      }
+      ptr = DataArray<uint32_t>::CreateArray(numOfTuples, cDims, name, allocate);
     }
     else if(H5Tequal(typeId, H5T_STD_U64BE) || H5Tequal(typeId, H5T_STD_U64LE))
     {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<uint64_t>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<uint64_t>::CreateArray(numOfTuples, cDims, name, false);
-      }
+      ptr = DataArray<uint64_t>::CreateArray(numOfTuples, cDims, name, allocate);
     }
     else if(H5Tequal(typeId, H5T_STD_I8BE) || H5Tequal(typeId, H5T_STD_I8LE))
     {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<int8_t>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<int8_t>::CreateArray(numOfTuples, cDims, name, false);
-      }
+      ptr = DataArray<int8_t>::CreateArray(numOfTuples, cDims, name, allocate);
     }
     else if(H5Tequal(typeId, H5T_STD_I16BE) || H5Tequal(typeId, H5T_STD_I16LE))
     {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<int16_t>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<int16_t>::CreateArray(numOfTuples, cDims, name, false);
-      }
+      ptr = DataArray<int16_t>::CreateArray(numOfTuples, cDims, name, allocate);
     }
     else if(H5Tequal(typeId, H5T_STD_I32BE) || H5Tequal(typeId, H5T_STD_I32LE))
     {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<int32_t>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<int32_t>::CreateArray(numOfTuples, cDims, name, false);
-      }
+      ptr = DataArray<int32_t>::CreateArray(numOfTuples, cDims, name, allocate);
     }
     else if(H5Tequal(typeId, H5T_STD_I64BE) || H5Tequal(typeId, H5T_STD_I64LE))
     {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<int64_t>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<int64_t>::CreateArray(numOfTuples, cDims, name, false);
-      }
+      ptr = DataArray<int64_t>::CreateArray(numOfTuples, cDims, name, allocate);
     }
     else
     {
@@ -477,25 +639,11 @@ IDataArray::Pointer ImportHDF5Dataset::readIDataArray(hid_t gid, const QString&
   case H5T_FLOAT:
     if(attr_size == 4)
     {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<float>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<float>::CreateArray(numOfTuples, cDims, name, false);
-      }
+      ptr = DataArray<float>::CreateArray(numOfTuples, cDims, name, allocate);
     }
     else if(attr_size == 8)
     {
-      if(metaDataOnly == false)
-      {
-        ptr = Detail::readH5Dataset<double>(gid, name, numOfTuples, cDims);
-      }
-      else
-      {
-        ptr = DataArray<double>::CreateArray(numOfTuples, cDims, name, false);
-      }
+      ptr = DataArray<double>::CreateArray(numOfTuples, cDims, name, allocate);
     }
     else
     {
@@ -535,6 +683,8 @@ AbstractFilter::Pointer ImportHDF5Dataset::newFilterInstance(bool copyFilterPara
     filter->setDatasetPaths(getDatasetPaths());
     filter->setComponentDimensions(getComponentDimensions());
     filter->setSelectedAttributeMatrix(getSelectedAttributeMatrix());
+    filter->setHyperslabSelections(getHyperslabSelections());
+    filter->setChunkCacheSize(getChunkCacheSize());
   }
   return filter;
 }
@@ -33,6 +33,8 @@
 #ifndef _importhdf5dataset_h_
 #define _importhdf5dataset_h_
 
+#include <hdf5.h>
+
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/SIMPLib.h"
@@ -48,6 +50,8 @@ class SIMPLib_EXPORT ImportHDF5Dataset : public AbstractFilter
     PYB11_PROPERTY(QStringList DatasetPaths READ getDatasetPaths WRITE setDatasetPaths)
     PYB11_PROPERTY(QString ComponentDimensions READ getComponentDimensions WRITE setComponentDimensions)
     PYB11_PROPERTY(DataArrayPath SelectedAttributeMatrix READ getSelectedAttributeMatrix WRITE setSelectedAttributeMatrix)
+    PYB11_PROPERTY(QString HyperslabSelections READ getHyperslabSelections WRITE setHyperslabSelections)
+    PYB11_PROPERTY(int ChunkCacheSize READ getChunkCacheSize WRITE setChunkCacheSize)
 
 public:
   SIMPL_SHARED_POINTERS(ImportHDF5Dataset)
@@ -71,6 +75,24 @@ public:
   SIMPL_FILTER_PARAMETER(DataArrayPath, SelectedAttributeMatrix)
   Q_PROPERTY(DataArrayPath SelectedAttributeMatrix READ getSelectedAttributeMatrix WRITE setSelectedAttributeMatrix)
 
+  SIMPL_FILTER_PARAMETER(QString, HyperslabSelections)
+  Q_PROPERTY(QString HyperslabSelections READ getHyperslabSelections WRITE setHyperslabSelections)
+
+  SIMPL_FILTER_PARAMETER(int, ChunkCacheSize)
+  Q_PROPERTY(int ChunkCacheSize READ getChunkCacheSize WRITE setChunkCacheSize)
+
+  /**
+   * @brief The HyperslabSelection struct is the part of one dataset that gets imported,
+   * one value per dataset dimension. An empty offset selects the whole dataset and an
+   * empty stride means a stride of 1.
+   */
+  struct HyperslabSelection
+  {
+    QVector<hsize_t> offset;
+    QVector<hsize_t> count;
+    QVector<hsize_t> stride;
+  };
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -170,7 +192,28 @@ protected:
 private:
   QString m_HDF5Dimensions = "";
 
-  IDataArray::Pointer readIDataArray(hid_t gid, const QString& name, size_t numOfTuples, QVector<size_t> cDims, bool metaDataOnly);
+  /**
+   * @brief Creates an array whose type matches the HDF5 dataset
+   * @param gid The parent location that contains the dataset
+   * @param name The name of the dataset
+   * @param numOfTuples The number of tuples of the array
+   * @param cDims The component dimensions of the array
+   * @param allocate Whether the array memory is allocated
+   * @return The array, or a null pointer for unsupported dataset types
+   */
+  IDataArray::Pointer createIDataArray(hid_t gid, const QString& name, size_t numOfTuples, QVector<size_t> cDims, bool allocate);
+
+  /**
+   * @brief Parses the HyperslabSelections string into one selection per dataset path
+   * @param ok Set to false if the string is not in the right format
+   * @return The selections
+   */
+  QVector<HyperslabSelection> createHyperslabSelections(bool& ok);
+
+  /**
+   * @brief Reads every selected dataset into the arrays that dataCheck() preallocated
+   */
+  void readDatasets();
 
   /**
    * @brief createComponentDimensions
@@ -49,7 +49,6 @@ MaskCountDecision::MaskCountDecision()
 : AbstractDecisionFilter()
 , m_MaskArrayPath("", "", "")
 , m_NumberOfTrues(0)
-, m_Mask(nullptr)
 {
 }
 
@@ -100,12 +99,10 @@ void MaskCountDecision::dataCheck()
 
   QVector<size_t> cDims(1, 1);
 
+  // Only read access is needed, so no raw pointer is taken; that keeps the mask's cached
+  // statistics valid between executions
   m_MaskPtr =
       getDataContainerArray()->getPrereqArrayFromPath<DataArray<bool>, AbstractFilter>(this, getMaskArrayPath(), cDims); /* Assigns the shared_ptr<> to an instance variable that is a weak_ptr<> */
-  if(nullptr != m_MaskPtr.lock()) /* Validate the Weak Pointer wraps a non-nullptr pointer to a DataArray<T> object */
-  {
-    m_Mask = m_MaskPtr.lock()->getPointer(0);
-  } /* Now assign the raw pointer to data from the DataArray<T> object */
 }
 
 // -----------------------------------------------------------------------------
@@ -134,27 +131,39 @@ void MaskCountDecision::execute()
     return;
   }
 
-  size_t numTuples = m_MaskPtr.lock()->getNumberOfTuples();
+  DataArray<bool>::Pointer maskPtr = m_MaskPtr.lock();
+  size_t numTuples = maskPtr->getNumberOfTuples();
 
   int32_t trueCount = 0;
   bool dm = true;
 
   qDebug() << "NumberOfTrues: " << m_NumberOfTrues;
 
-  for(size_t i = 0; i < numTuples; i++)
+  if(numTuples > 0 && m_NumberOfTrues <= 0)
   {
-    if(m_NumberOfTrues < 0 && !m_Mask[i])
+    // The threshold is already reached (or, for a negative threshold, failed) at the first tuple
+    if(m_NumberOfTrues < 0 && !maskPtr->getValue(0))
     {
       qDebug() << "First if check: " << dm;
       emit decisionMade(dm);
       return;
     }
-    if(m_Mask[i])
-    {
-      trueCount++;
-    }
-    if(trueCount >= m_NumberOfTrues)
+    trueCount = maskPtr->getValue(0) ? 1 : 0;
+    dm = false;
+    emit decisionMade(dm);
+    emit targetValue(trueCount);
+    return;
+  }
+
+  if(numTuples > 0)
+  {
+    // The number of true values is the sum of the mask. Earlier filters may have written
+    // the mask through raw pointers without calling markModified(), so a cached sum can
+    // not be trusted.
+    ArrayStatistics maskStats = maskPtr->getStatistics(0, true);
+    if(maskStats.sum[0] >= static_cast<double>(m_NumberOfTrues))
     {
+      trueCount = m_NumberOfTrues;
       dm = false;
       qDebug() << "Second if check: " << dm;
 
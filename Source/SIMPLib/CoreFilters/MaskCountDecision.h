@@ -137,7 +137,7 @@ class SIMPLib_EXPORT MaskCountDecision : public AbstractDecisionFilter
 
 
   private:
-    DEFINE_DATAARRAY_VARIABLE(bool, Mask)
+    DEFINE_DATAARRAY_WEAKPTR(bool, Mask)
 
     MaskCountDecision(const MaskCountDecision&) = delete; // Copy Constructor Not Implemented
     void operator=(const MaskCountDecision&) = delete;    // Move assignment Not Implemented
@@ -530,8 +530,8 @@ void ReadASCIIData::execute()
       in.readLine();
     }
 
-    float threshold = 0.0f;
     size_t numTuples = numLines - beginIndex + 1;
+    beginProgress(numTuples, "Importing ASCII Data");
 
     for(int lineNum = beginIndex; lineNum <= numLines; lineNum++)
     {
@@ -568,26 +568,18 @@ void ReadASCIIData::execute()
         }
       }
 
-      if(((float)lineNum / numTuples) * 100.0f > threshold)
-      {
-        // Print the status of the import
-        QString ss = QObject::tr("Importing ASCII Data || %1% Complete").arg(((float)lineNum / numTuples) * 100.0f, 0, 'f', 0);
-        notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
-        threshold = threshold + 5.0f;
-        if(threshold < ((float)lineNum / numTuples) * 100.0f)
-        {
-          threshold = ((float)lineNum / numTuples) * 100.0f;
-        }
-      }
+      getProgressChannel().advance();
 
       if(getCancel())
       {
+        endProgress();
         return;
       }
 
       insertIndex++;
     }
     inputFile.close();
+    endProgress();
   }
 
   notifyStatusMessage(getHumanLabel(), "Complete");
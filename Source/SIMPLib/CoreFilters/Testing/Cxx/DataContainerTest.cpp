@@ -35,7 +35,10 @@
 
 #include <stdlib.h>
 
+#include <cmath>
+
 #include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QFile>
 #include <QtCore/QList>
 #include <QtCore/QMap>
@@ -60,6 +63,12 @@
 #include "SIMPLib/FilterParameters/JsonFilterParametersWriter.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
 #include "SIMPLib/Filtering/QMetaObjectUtilities.h"
+#include "SIMPLib/HDF5/H5StructureIndex.h"
+#include "SIMPLib/Utilities/SIMPLH5DataReader.h"
+#include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
+
+#include "H5Support/QH5Lite.h"
+#include "H5Support/QH5Utilities.h"
 
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
@@ -110,6 +119,26 @@ QString TestFile3()
   return TestDir() + QString::fromLatin1("/DataContainerIOTest_Subset.h5");
 }
 
+QString TestFile4()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_Pyramid.h5");
+}
+
+QString TestFile5()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_Index.h5");
+}
+
+QString TestFile6()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_TimeSteps.h5");
+}
+
+QString TestFile6Xdmf()
+{
+  return TestDir() + QString::fromLatin1("/DataContainerIOTest_TimeSteps.xdmf");
+}
+
 QString JsonFile()
 {
   return TestDir() + QString::fromLatin1("/DataContainerProxyTest.json");
@@ -140,6 +169,10 @@ public:
     QFile::remove(DataContainerIOTest::TestFile());
     QFile::remove(DataContainerIOTest::TestFile2());
     QFile::remove(DataContainerIOTest::TestFile3());
+    QFile::remove(DataContainerIOTest::TestFile4());
+    QFile::remove(DataContainerIOTest::TestFile5());
+    QFile::remove(DataContainerIOTest::TestFile6());
+    QFile::remove(DataContainerIOTest::TestFile6Xdmf());
     QFile::remove(DataContainerIOTest::JsonFile());
     QFile::remove(DataContainerIOTest::H5File());
 
@@ -516,6 +549,337 @@ public:
     m->removeAttributeMatrix(getCellAttributeMatrixName());
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPyramidLevels()
+  {
+    size_t nx = 4;
+    size_t ny = 4;
+    size_t nz = 2;
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = dca->createNonPrereqDataContainer<AbstractFilter>(nullptr, "PyramidDataContainer");
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(std::make_tuple(nx, ny, nz));
+    image->setResolution(1.0f, 1.0f, 1.0f);
+    image->setOrigin(0.0f, 0.0f, 0.0f);
+    dc->setGeometry(image);
+
+    QVector<size_t> tDims = {nx, ny, nz};
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    dc->addAttributeMatrix(am->getName(), am);
+    QVector<size_t> cDims(1, 1);
+    FloatArrayType::Pointer values = FloatArrayType::CreateArray(tDims, cDims, "Values", true);
+    Int32ArrayType::Pointer labels = Int32ArrayType::CreateArray(tDims, cDims, "Labels", true);
+    for(size_t z = 0; z < nz; z++)
+    {
+      for(size_t y = 0; y < ny; y++)
+      {
+        for(size_t x = 0; x < nx; x++)
+        {
+          size_t index = (z * ny + y) * nx + x;
+          values->setValue(index, static_cast<float>(x + 4 * y + 16 * z));
+          labels->setValue(index, (x < 2 || (x == 2 && y == 0 && z == 0)) ? 1 : 2);
+        }
+      }
+    }
+    am->addAttributeArray(values->getName(), values);
+    am->addAttributeArray(labels->getName(), labels);
+
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(DataContainerIOTest::TestFile4());
+    writer->setWriteXdmfFile(false);
+    writer->setWritePyramidLevels(true);
+    writer->setPyramidLevelCount(3);
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCondition(), 0)
+
+    DataContainerReader::Pointer reader = DataContainerReader::New();
+    reader->setInputFile(DataContainerIOTest::TestFile4());
+    DataContainerArrayProxy proxy = reader->readDataContainerArrayStructure(DataContainerIOTest::TestFile4());
+    // 4x4x2 stops at 1x1x1 after two levels
+    DREAM3D_REQUIRE_EQUAL(proxy.dataContainers["PyramidDataContainer"].attributeMatricies["CellData"].pyramidLevels, 2)
+
+    reader->setInputFileDataContainerArrayProxy(proxy);
+    reader->setPyramidLevel(1);
+    reader->setDataContainerArray(DataContainerArray::New());
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCondition() >= 0)
+
+    DataContainer::Pointer levelDc = reader->getDataContainerArray()->getDataContainer("PyramidDataContainer");
+    DREAM3D_REQUIRE_VALID_POINTER(levelDc.get())
+    ImageGeom::Pointer levelGeom = levelDc->getGeometryAs<ImageGeom>();
+    DREAM3D_REQUIRE_VALID_POINTER(levelGeom.get())
+    size_t levelDims[3] = {0, 0, 0};
+    std::tie(levelDims[0], levelDims[1], levelDims[2]) = levelGeom->getDimensions();
+    DREAM3D_REQUIRE_EQUAL(levelDims[0], 2)
+    DREAM3D_REQUIRE_EQUAL(levelDims[1], 2)
+    DREAM3D_REQUIRE_EQUAL(levelDims[2], 1)
+    float res[3] = {0.0f, 0.0f, 0.0f};
+    levelGeom->getResolution(res);
+    DREAM3D_REQUIRE(std::fabs(res[0] - 2.0f) < 1.0E-6f && std::fabs(res[2] - 2.0f) < 1.0E-6f)
+
+    AttributeMatrix::Pointer levelAm = levelDc->getAttributeMatrix("CellData");
+    DREAM3D_REQUIRE_EQUAL(levelAm->getNumberOfTuples(), 4)
+    FloatArrayType::Pointer levelValues = std::dynamic_pointer_cast<FloatArrayType>(levelAm->getAttributeArray("Values"));
+    Int32ArrayType::Pointer levelLabels = std::dynamic_pointer_cast<Int32ArrayType>(levelAm->getAttributeArray("Labels"));
+    DREAM3D_REQUIRE_VALID_POINTER(levelValues.get())
+    DREAM3D_REQUIRE_VALID_POINTER(levelLabels.get())
+    for(size_t j = 0; j < 2; j++)
+    {
+      for(size_t i = 0; i < 2; i++)
+      {
+        // Mean over each 2x2x2 block and most frequent label of the block
+        float expected = 2.0f * i + 8.0f * j + 10.5f;
+        float diff = std::fabs(levelValues->getValue(j * 2 + i) - expected);
+        DREAM3D_REQUIRE(diff < 1.0E-5f)
+        DREAM3D_REQUIRE_EQUAL(levelLabels->getValue(j * 2 + i), (i == 0 ? 1 : 2))
+      }
+    }
+
+    // Asking for more levels than are stored reads the coarsest one
+    reader->setPyramidLevel(5);
+    reader->setDataContainerArray(DataContainerArray::New());
+    reader->execute();
+    DREAM3D_REQUIRE(reader->getErrorCondition() >= 0)
+    DREAM3D_REQUIRE(reader->getWarningCondition() < 0)
+    levelDc = reader->getDataContainerArray()->getDataContainer("PyramidDataContainer");
+    DREAM3D_REQUIRE_EQUAL(levelDc->getAttributeMatrix("CellData")->getNumberOfTuples(), 1)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArrayProxy ReadStructure(const QString& file, SIMPLH5DataReaderRequirements* req, bool useIndex)
+  {
+    DataContainerArrayProxy proxy;
+    if(useIndex)
+    {
+      SIMPLH5DataReader::Pointer reader = SIMPLH5DataReader::New();
+      DREAM3D_REQUIRE(reader->openFile(file))
+      int err = 0;
+      proxy = reader->readDataContainerArrayStructure(req, err);
+      DREAM3D_REQUIRE(err >= 0)
+      reader->closeFile();
+      return proxy;
+    }
+
+    hid_t fileId = QH5Utilities::openFile(file, true);
+    DREAM3D_REQUIRE(fileId > 0)
+    hid_t dcArrayGroupId = H5Gopen(fileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().constData(), H5P_DEFAULT);
+    DREAM3D_REQUIRE(dcArrayGroupId > 0)
+    DataContainer::ReadDataContainerStructure(dcArrayGroupId, proxy, req, QString("/") + SIMPL::StringConstants::DataContainerGroupName);
+    H5Gclose(dcArrayGroupId);
+    QH5Utilities::closeFile(fileId);
+    return proxy;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestStructureIndex()
+  {
+    // A synthetic file with many small arrays, where reading the attributes of each array dominates the structure scan
+    const int numArrays = 2000;
+    size_t nx = 4;
+    size_t ny = 3;
+    size_t nz = 2;
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = dca->createNonPrereqDataContainer<AbstractFilter>(nullptr, "IndexDataContainer");
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(std::make_tuple(nx, ny, nz));
+    dc->setGeometry(image);
+    QVector<size_t> tDims = {nx, ny, nz};
+    AttributeMatrix::Pointer cellAm = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    dc->addAttributeMatrix(cellAm->getName(), cellAm);
+    for(int i = 0; i < numArrays; i++)
+    {
+      QVector<size_t> cDims(1, static_cast<size_t>(1 + i % 3));
+      IDataArray::Pointer array;
+      if(i % 2 == 0)
+      {
+        array = FloatArrayType::CreateArray(tDims, cDims, QString("Float_%1").arg(i), true);
+      }
+      else
+      {
+        array = Int32ArrayType::CreateArray(tDims, cDims, QString("Int32_%1").arg(i), true);
+      }
+      array->initializeWithZeros();
+      cellAm->addAttributeArray(array->getName(), array);
+    }
+    QVector<size_t> ensembleDims(1, 3);
+    AttributeMatrix::Pointer ensembleAm = AttributeMatrix::New(ensembleDims, "EnsembleData", AttributeMatrix::Type::CellEnsemble);
+    dc->addAttributeMatrix(ensembleAm->getName(), ensembleAm);
+    ensembleAm->addAttributeArray("Phases", UInt32ArrayType::CreateArray(ensembleDims, QVector<size_t>(1, 1), "Phases", true));
+    // A DataContainer without a geometry is stored with the Unknown geometry type
+    dca->createNonPrereqDataContainer<AbstractFilter>(nullptr, "NoGeometryDataContainer");
+
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(DataContainerIOTest::TestFile5());
+    writer->setWriteXdmfFile(false);
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCondition(), 0)
+    DREAM3D_REQUIRE_EQUAL(writer->getWarningCondition(), 0)
+
+    // The index has to yield exactly what the walk yields, with and without requirements
+    SIMPLH5DataReaderRequirements anyReq;
+    SIMPLH5DataReaderRequirements floatReq(SIMPL::TypeNames::Float, 2, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
+    QVector<SIMPLH5DataReaderRequirements*> reqs = {nullptr, &anyReq, &floatReq};
+    foreach(SIMPLH5DataReaderRequirements* req, reqs)
+    {
+      QElapsedTimer timer;
+      timer.start();
+      DataContainerArrayProxy walked = ReadStructure(DataContainerIOTest::TestFile5(), req, false);
+      qint64 walkTime = timer.restart();
+      DataContainerArrayProxy indexed = ReadStructure(DataContainerIOTest::TestFile5(), req, true);
+      qint64 indexTime = timer.elapsed();
+      std::cout << "Structure of " << numArrays << " arrays: walk " << walkTime << " ms, index " << indexTime << " ms" << std::endl;
+
+      DREAM3D_REQUIRE_EQUAL(indexed.dataContainers.size(), 2)
+      DREAM3D_REQUIRE_EQUAL(indexed.dataContainers["IndexDataContainer"].attributeMatricies["CellData"].dataArrays.size(), numArrays)
+      DREAM3D_REQUIRE(indexed == walked)
+    }
+
+    // Removing an array without updating the index makes the reader fall back to the walk
+    hid_t fileId = QH5Utilities::openFile(DataContainerIOTest::TestFile5(), false);
+    DREAM3D_REQUIRE(fileId > 0)
+    QString arrayPath = QString("%1/IndexDataContainer/CellData/Float_0").arg(SIMPL::StringConstants::DataContainerGroupName);
+    DREAM3D_REQUIRE(H5Ldelete(fileId, arrayPath.toLatin1().constData(), H5P_DEFAULT) >= 0)
+    QH5Utilities::closeFile(fileId);
+
+    DataContainerArrayProxy walked = ReadStructure(DataContainerIOTest::TestFile5(), &anyReq, false);
+    DataContainerArrayProxy indexed = ReadStructure(DataContainerIOTest::TestFile5(), &anyReq, true);
+    DREAM3D_REQUIRE_EQUAL(indexed.dataContainers["IndexDataContainer"].attributeMatricies["CellData"].dataArrays.size(), numArrays - 1)
+    DREAM3D_REQUIRE(indexed == walked)
+
+    // Renaming an array keeps every link count, so the writer bumps the stamp to make the reader walk
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCondition(), 0)
+    fileId = QH5Utilities::openFile(DataContainerIOTest::TestFile5(), false);
+    DREAM3D_REQUIRE(fileId > 0)
+    QString cellDataPath = QString("%1/IndexDataContainer/CellData/").arg(SIMPL::StringConstants::DataContainerGroupName);
+    DREAM3D_REQUIRE(H5Lmove(fileId, (cellDataPath + "Int32_1").toLatin1().constData(), fileId, (cellDataPath + "Renamed_1").toLatin1().constData(), H5P_DEFAULT, H5P_DEFAULT) >= 0)
+    hid_t renamedGroupId = H5Gopen(fileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().constData(), H5P_DEFAULT);
+    DREAM3D_REQUIRE(renamedGroupId > 0)
+    DREAM3D_REQUIRE_EQUAL(H5StructureIndex::MarkModified(renamedGroupId), 0)
+    H5Gclose(renamedGroupId);
+    QH5Utilities::closeFile(fileId);
+
+    walked = ReadStructure(DataContainerIOTest::TestFile5(), &anyReq, false);
+    indexed = ReadStructure(DataContainerIOTest::TestFile5(), &anyReq, true);
+    DREAM3D_REQUIRE(indexed.dataContainers["IndexDataContainer"].attributeMatricies["CellData"].dataArrays.contains("Renamed_1"))
+    DREAM3D_REQUIRE(indexed == walked)
+
+    // A bumped write stamp invalidates the index until it is written again
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCondition(), 0)
+    fileId = QH5Utilities::openFile(DataContainerIOTest::TestFile5(), false);
+    DREAM3D_REQUIRE(fileId > 0)
+    hid_t dcArrayGroupId = H5Gopen(fileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().constData(), H5P_DEFAULT);
+    DREAM3D_REQUIRE(dcArrayGroupId > 0)
+    DataContainerArrayProxy proxy;
+    DREAM3D_REQUIRE(H5StructureIndex::Read(fileId, dcArrayGroupId, &anyReq, proxy))
+    DREAM3D_REQUIRE_EQUAL(H5StructureIndex::MarkModified(dcArrayGroupId), 0)
+    DREAM3D_REQUIRE(H5StructureIndex::Read(fileId, dcArrayGroupId, &anyReq, proxy) == false)
+    DREAM3D_REQUIRE_EQUAL(H5StructureIndex::Write(fileId), 0)
+    DREAM3D_REQUIRE(H5StructureIndex::Read(fileId, dcArrayGroupId, &anyReq, proxy))
+    H5Gclose(dcArrayGroupId);
+    QH5Utilities::closeFile(fileId);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void WriteTimeStepFile(bool appendTimeStep, float value, int expectedError = 0, bool useTimeValue = false)
+  {
+    size_t nx = 3;
+    size_t ny = 2;
+    size_t nz = 2;
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = dca->createNonPrereqDataContainer<AbstractFilter>(nullptr, "StepDataContainer");
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    image->setDimensions(std::make_tuple(nx, ny, nz));
+    dc->setGeometry(image);
+    QVector<size_t> tDims = {nx, ny, nz};
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    dc->addAttributeMatrix(am->getName(), am);
+    FloatArrayType::Pointer values = FloatArrayType::CreateArray(tDims, QVector<size_t>(1, 1), "Values", true);
+    values->initializeWithValue(value);
+    am->addAttributeArray(values->getName(), values);
+
+    DataContainerWriter::Pointer writer = DataContainerWriter::New();
+    writer->setDataContainerArray(dca);
+    writer->setOutputFile(DataContainerIOTest::TestFile6());
+    writer->setWriteXdmfFile(true);
+    writer->setAppendTimeStep(appendTimeStep);
+    writer->setUseTimeValue(useTimeValue);
+    writer->setTimeValue(value);
+    writer->execute();
+    DREAM3D_REQUIRE_EQUAL(writer->getErrorCondition(), expectedError)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAppendTimeStep()
+  {
+    // A file from a normal run must never be replaced by append mode
+    WriteTimeStepFile(false, 0.0f);
+    qint64 normalSize = QFileInfo(DataContainerIOTest::TestFile6()).size();
+    WriteTimeStepFile(true, 0.0f, -11117);
+    DREAM3D_REQUIRE_EQUAL(QFileInfo(DataContainerIOTest::TestFile6()).size(), normalSize)
+    {
+      hid_t fileId = QH5Utilities::openFile(DataContainerIOTest::TestFile6(), true);
+      DREAM3D_REQUIRE(fileId > 0)
+      QString dcPath = SIMPL::StringConstants::DataContainerGroupName + "/StepDataContainer";
+      DREAM3D_REQUIRE(H5Lexists(fileId, dcPath.toLatin1().data(), H5P_DEFAULT) > 0)
+      QH5Utilities::closeFile(fileId);
+    }
+
+    // The Xdmf file of the normal run is left behind; the first appended step
+    // starts a new series and has to replace it
+    QFile::remove(DataContainerIOTest::TestFile6());
+    const int numSteps = 3;
+    for(int step = 0; step < numSteps; step++)
+    {
+      WriteTimeStepFile(true, 0.5f * static_cast<float>(step), 0, step > 0);
+    }
+
+    QFile xdmfFile(DataContainerIOTest::TestFile6Xdmf());
+    DREAM3D_REQUIRE(xdmfFile.open(QIODevice::ReadOnly))
+    QString xdmf = QString::fromLatin1(xdmfFile.readAll());
+    xdmfFile.close();
+    DREAM3D_REQUIRE_EQUAL(xdmf.count("GridType=\"Uniform\""), numSteps)
+    DREAM3D_REQUIRE_EQUAL(xdmf.count("CollectionType=\"Temporal\""), 1)
+    DREAM3D_REQUIRE_EQUAL(xdmf.count("</Xdmf>"), 1)
+    DREAM3D_REQUIRE(xdmf.contains("StepDataContainer_Step_000002"))
+
+    hid_t fileId = QH5Utilities::openFile(DataContainerIOTest::TestFile6(), true);
+    DREAM3D_REQUIRE(fileId > 0)
+    int count = 0;
+    DREAM3D_REQUIRE(QH5Lite::readScalarAttribute(fileId, "/", "TimeStepCount", count) >= 0)
+    DREAM3D_REQUIRE_EQUAL(count, numSteps)
+    hid_t dcaGid = H5Gopen(fileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().data(), H5P_DEFAULT);
+    DREAM3D_REQUIRE(dcaGid > 0)
+    QList<QString> groups;
+    QH5Utilities::getGroupObjects(dcaGid, H5Utilities::H5Support_GROUP, groups);
+    // Step 0 is stamped with its index, the later steps with the custom time value
+    float timeValue = -1.0f;
+    DREAM3D_REQUIRE(QH5Lite::readScalarAttribute(dcaGid, "StepDataContainer_Step_000000", "TimeValue", timeValue) >= 0)
+    DREAM3D_REQUIRE_EQUAL(timeValue, 0.0f)
+    DREAM3D_REQUIRE(QH5Lite::readScalarAttribute(dcaGid, "StepDataContainer_Step_000002", "TimeValue", timeValue) >= 0)
+    DREAM3D_REQUIRE_EQUAL(timeValue, 1.0f)
+    H5Gclose(dcaGid);
+    QH5Utilities::closeFile(fileId);
+    DREAM3D_REQUIRE_EQUAL(groups.size(), numSteps)
+    for(int step = 0; step < numSteps; step++)
+    {
+      DREAM3D_REQUIRE(groups.contains(QString("StepDataContainer_Step_%1").arg(step, 6, 10, QChar('0'))))
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -909,6 +1273,9 @@ public:
     DREAM3D_REGISTER_TEST(TestDataContainerArrayProxy())
 
     DREAM3D_REGISTER_TEST(TestDataContainerReader())
+    DREAM3D_REGISTER_TEST(TestPyramidLevels())
+    DREAM3D_REGISTER_TEST(TestStructureIndex())
+    DREAM3D_REGISTER_TEST(TestAppendTimeStep())
     DREAM3D_REGISTER_TEST(TestDataArrayPath())
 
 #if REMOVE_TEST_FILES
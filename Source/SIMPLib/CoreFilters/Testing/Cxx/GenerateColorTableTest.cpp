@@ -282,6 +282,84 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestIntegerLookupTableAndAlpha()
+  {
+    if(m_PresetMap.isEmpty())
+    {
+      ReadPresets();
+    }
+
+    const size_t numTuples = 5000;
+    DataContainerArray::Pointer dca = DataContainerArray::New();
+    DataContainer::Pointer dc = DataContainer::New(SIMPL::Defaults::ImageDataContainerName);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(QVector<size_t>(1, numTuples), SIMPL::Defaults::CellAttributeMatrixName, AttributeMatrix::Type::Generic);
+    dc->addAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName, am);
+    dca->addDataContainer(dc);
+
+    // The same values stored as integers (direct table path) and as floats (interpolated path)
+    Int32ArrayType::Pointer intArray = Int32ArrayType::CreateArray(numTuples, "IntValues");
+    FloatArrayType::Pointer floatArray = FloatArrayType::CreateArray(numTuples, "FloatValues");
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      int32_t value = static_cast<int32_t>((i * 7919) % 1000) - 500;
+      intArray->setValue(i, value);
+      floatArray->setValue(i, static_cast<float>(value));
+    }
+    am->addAttributeArray(intArray->getName(), intArray);
+    am->addAttributeArray(floatArray->getName(), floatArray);
+
+    QJsonArray presetPoints = m_PresetMap.value("jet");
+    DREAM3D_REQUIRE(presetPoints.size() > 0)
+
+    struct Run
+    {
+      QString input;
+      QString output;
+      bool alpha;
+    };
+    QVector<Run> runs = {{"IntValues", "IntRGB", false}, {"FloatValues", "FloatRGB", false}, {"IntValues", "IntRGBA", true}};
+    for(const Run& run : runs)
+    {
+      GenerateColorTable::Pointer filter = GenerateColorTable::New();
+      filter->setRgbArrayName(run.output);
+      filter->setSelectedDataArrayPath(DataArrayPath(SIMPL::Defaults::ImageDataContainerName, SIMPL::Defaults::CellAttributeMatrixName, run.input));
+      filter->setSelectedPresetName("jet");
+      filter->setSelectedPresetControlPoints(presetPoints);
+      filter->setIncludeAlphaChannel(run.alpha);
+      filter->setDataContainerArray(dca);
+      filter->execute();
+      DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0)
+    }
+
+    UInt8ArrayType::Pointer intRgb = std::dynamic_pointer_cast<UInt8ArrayType>(am->getAttributeArray("IntRGB"));
+    UInt8ArrayType::Pointer floatRgb = std::dynamic_pointer_cast<UInt8ArrayType>(am->getAttributeArray("FloatRGB"));
+    UInt8ArrayType::Pointer intRgba = std::dynamic_pointer_cast<UInt8ArrayType>(am->getAttributeArray("IntRGBA"));
+    DREAM3D_REQUIRE_VALID_POINTER(intRgb.get())
+    DREAM3D_REQUIRE_VALID_POINTER(floatRgb.get())
+    DREAM3D_REQUIRE_VALID_POINTER(intRgba.get())
+    DREAM3D_REQUIRE_EQUAL(intRgb->getNumberOfComponents(), 3)
+    DREAM3D_REQUIRE_EQUAL(intRgba->getNumberOfComponents(), 4)
+
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      for(int c = 0; c < 3; c++)
+      {
+        int fromLut = intRgb->getComponent(i, c);
+        int interpolated = floatRgb->getComponent(i, c);
+        int withAlpha = intRgba->getComponent(i, c);
+        DREAM3D_REQUIRE_EQUAL(fromLut, interpolated)
+        DREAM3D_REQUIRE_EQUAL(fromLut, withAlpha)
+      }
+      int alpha = intRgba->getComponent(i, 3);
+      DREAM3D_REQUIRE_EQUAL(alpha, 255)
+    }
+
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -294,6 +372,8 @@ public:
     DREAM3D_REGISTER_TEST(TestFilterAvailability());
 
     DREAM3D_REGISTER_TEST(TestGenerateColorTable())
+
+    DREAM3D_REGISTER_TEST(TestIntegerLookupTableAndAlpha())
   }
 
 private:
@@ -606,6 +606,101 @@ public:
     }
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHyperslabsAndMultipleDatasets()
+  {
+    writeHDF5File();
+
+    // Add a chunked dataset so that the chunk cache setting is exercised
+    {
+      hid_t file_id = QH5Utilities::openFile(m_FilePath, false);
+      DREAM3D_REQUIRE(file_id > 0);
+      H5ScopedFileSentinel sentinel(&file_id, false);
+
+      hsize_t dims[2] = {6, 2};
+      hsize_t chunkDims[2] = {2, 2};
+      QVector<float> data(12);
+      for(int i = 0; i < 12; i++)
+      {
+        data[i] = static_cast<float>(i) * 0.5f;
+      }
+      hid_t sid = H5Screate_simple(2, dims, nullptr);
+      hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+      H5Pset_chunk(dcpl, 2, chunkDims);
+      hid_t did = H5Dcreate(file_id, "Pointer/Chunked", H5T_NATIVE_FLOAT, sid, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+      DREAM3D_REQUIRE(did > 0);
+      herr_t err = H5Dwrite(did, H5T_NATIVE_FLOAT, H5S_ALL, H5S_ALL, H5P_DEFAULT, data.data());
+      DREAM3D_REQUIRED(err, >=, 0);
+      H5Dclose(did);
+      H5Pclose(dcpl);
+      H5Sclose(sid);
+    }
+
+    int32_t value = 0x0;
+    QString typeStr = QH5Lite::HDFTypeForPrimitiveAsStr(value);
+    QString slabName = "Pointer3DArrayDataset<" + typeStr + ">";
+
+    AbstractFilter::Pointer filter = createFilter();
+    DataContainerArray::Pointer dca = createDataContainerArray(QVector<size_t>(1, 6));
+    filter->setDataContainerArray(dca);
+
+    QVariant var;
+    QStringList paths;
+    paths.push_back("/Pointer/" + slabName);
+    paths.push_back("/Pointer/Chunked");
+    var.setValue(paths);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("DatasetPaths", var), true);
+    var.setValue(QString("2"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("ComponentDimensions", var), true);
+    var.setValue(1);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("ChunkCacheSize", var), true);
+
+    // Badly formed selections and selections past the end of the dataset are rejected
+    var.setValue(QString("1,2/2,2,3"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("HyperslabSelections", var), true);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -20009);
+
+    var.setValue(QString("9,2,0/2,2,3/3,1,2"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("HyperslabSelections", var), true);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -20011);
+
+    // The 10 x 8 x 36 dataset is cut down to 2 x 2 x 3 values, the chunked one is read whole
+    var.setValue(QString("1,2,0/2,2,3/3,1,2; "));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("HyperslabSelections", var), true);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), 0);
+
+    Int32ArrayType::Pointer slab = dca->getPrereqIDataArrayFromPath<Int32ArrayType, AbstractFilter>(filter.get(), DataArrayPath("DataContainer", "AttributeMatrix", slabName));
+    DREAM3D_REQUIRE_VALID_POINTER(slab.get());
+    DREAM3D_REQUIRE_EQUAL(slab->getNumberOfTuples(), 6);
+    size_t index = 0;
+    for(int32_t z = 0; z < 2; z++)
+    {
+      for(int32_t y = 0; y < 2; y++)
+      {
+        for(int32_t x = 0; x < 3; x++)
+        {
+          int32_t fileIndex = (1 + 3 * z) * 8 * 36 + (2 + y) * 36 + 2 * x;
+          DREAM3D_REQUIRE_EQUAL(slab->getValue(index), fileIndex * 5);
+          index++;
+        }
+      }
+    }
+
+    FloatArrayType::Pointer chunked = dca->getPrereqIDataArrayFromPath<FloatArrayType, AbstractFilter>(filter.get(), DataArrayPath("DataContainer", "AttributeMatrix", "Chunked"));
+    DREAM3D_REQUIRE_VALID_POINTER(chunked.get());
+    for(size_t i = 0; i < 12; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(chunked->getValue(i), static_cast<float>(i) * 0.5f);
+    }
+
+    QFile::remove(m_FilePath);
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -620,6 +715,7 @@ public:
     //#endif
 
     DREAM3D_REGISTER_TEST(RunImportHDF5DatasetTest())
+    DREAM3D_REGISTER_TEST(TestHyperslabsAndMultipleDatasets())
 
     //#if REMOVE_TEST_FILES
     //    DREAM3D_REGISTER_TEST(RemoveTestFiles())
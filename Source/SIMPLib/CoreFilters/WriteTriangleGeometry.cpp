@@ -42,8 +42,11 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataContainerSelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
+#include "SIMPLib/FilterParameters/MultiDataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
+#include "SIMPLib/Geometry/SurfaceMeshExporter.h"
 #include "SIMPLib/Geometry/TriangleGeom.h"
 #include "SIMPLib/SIMPLibVersion.h"
 
@@ -56,6 +59,9 @@ WriteTriangleGeometry::WriteTriangleGeometry()
 : m_DataContainerSelection("")
 , m_OutputNodesFile("")
 , m_OutputTrianglesFile("")
+, m_OutputFormat(0)
+, m_OutputStlFile("")
+, m_OutputPlyFile("")
 {
 }
 
@@ -71,13 +77,51 @@ void WriteTriangleGeometry::setupFilterParameters()
 {
   FilterParameterVector parameters;
 
-  parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output Nodes File", OutputNodesFile, FilterParameter::Parameter, WriteTriangleGeometry));
-  parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output Triangles File", OutputTrianglesFile, FilterParameter::Parameter, WriteTriangleGeometry));
+  QStringList linkedProps;
+  linkedProps << "OutputNodesFile"
+              << "OutputTrianglesFile"
+              << "OutputStlFile"
+              << "OutputPlyFile"
+              << "VertexArrayPaths"
+              << "FaceArrayPaths";
+  {
+    LinkedChoicesFilterParameter::Pointer parameter = LinkedChoicesFilterParameter::New();
+    parameter->setHumanLabel("Output Format");
+    parameter->setPropertyName("OutputFormat");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(WriteTriangleGeometry, this, OutputFormat));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(WriteTriangleGeometry, this, OutputFormat));
+
+    parameter->setDefaultValue(getOutputFormat());
+    QVector<QString> choices;
+    choices.push_back("Nodes and Triangles Text Files");
+    choices.push_back("Binary STL");
+    choices.push_back("Binary PLY");
+    parameter->setChoices(choices);
+    parameter->setLinkedProperties(linkedProps);
+    parameter->setEditable(false);
+    parameter->setCategory(FilterParameter::Parameter);
+    parameters.push_back(parameter);
+  }
+
+  parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output Nodes File", OutputNodesFile, FilterParameter::Parameter, WriteTriangleGeometry, "", "", 0));
+  parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output Triangles File", OutputTrianglesFile, FilterParameter::Parameter, WriteTriangleGeometry, "", "", 0));
+  parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output STL File", OutputStlFile, FilterParameter::Parameter, WriteTriangleGeometry, "*.stl", "STL File", 1));
+  parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output PLY File", OutputPlyFile, FilterParameter::Parameter, WriteTriangleGeometry, "*.ply", "PLY File", 2));
 
   {
     DataContainerSelectionFilterParameter::RequirementType req;
     parameters.push_back(SIMPL_NEW_DC_SELECTION_FP("DataContainer", DataContainerSelection, FilterParameter::RequiredArray, WriteTriangleGeometry, req));
   }
+  {
+    MultiDataArraySelectionFilterParameter::RequirementType req =
+        MultiDataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Type::Vertex, IGeometry::Type::Triangle);
+    parameters.push_back(SIMPL_NEW_MDA_SELECTION_FP("Vertex Attribute Arrays", VertexArrayPaths, FilterParameter::RequiredArray, WriteTriangleGeometry, req, 2));
+  }
+  {
+    MultiDataArraySelectionFilterParameter::RequirementType req =
+        MultiDataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Type::Face, IGeometry::Type::Triangle);
+    parameters.push_back(SIMPL_NEW_MDA_SELECTION_FP("Face Attribute Arrays", FaceArrayPaths, FilterParameter::RequiredArray, WriteTriangleGeometry, req, 2));
+  }
 
   setFilterParameters(parameters);
 }
@@ -91,6 +135,11 @@ void WriteTriangleGeometry::readFilterParameters(AbstractFilterParametersReader*
   setDataContainerSelection(reader->readString("DataContainerSelection", getDataContainerSelection()));
   setOutputNodesFile(reader->readString("OutputNodesFile", getOutputNodesFile()));
   setOutputTrianglesFile(reader->readString("OutputTrianglesFile", getOutputTrianglesFile()));
+  setOutputFormat(reader->readValue("OutputFormat", getOutputFormat()));
+  setOutputStlFile(reader->readString("OutputStlFile", getOutputStlFile()));
+  setOutputPlyFile(reader->readString("OutputPlyFile", getOutputPlyFile()));
+  setVertexArrayPaths(reader->readDataArrayPathVector("VertexArrayPaths", getVertexArrayPaths()));
+  setFaceArrayPaths(reader->readDataArrayPathVector("FaceArrayPaths", getFaceArrayPaths()));
   reader->closeFilterGroup();
 }
 
@@ -109,18 +158,36 @@ void WriteTriangleGeometry::dataCheck()
   setErrorCondition(0);
   setWarningCondition(0);
 
-  if(true == m_OutputNodesFile.isEmpty())
+  if(m_OutputFormat < 0 || m_OutputFormat > 2)
+  {
+    setErrorCondition(-379);
+    notifyErrorMessage(getHumanLabel(), "The output format is not valid", getErrorCondition());
+  }
+
+  if(m_OutputFormat == 0 && true == m_OutputNodesFile.isEmpty())
   {
     setErrorCondition(-380);
     notifyErrorMessage(getHumanLabel(), "The output Nodes file needs to be set", getErrorCondition());
   }
 
-  if(true == m_OutputTrianglesFile.isEmpty())
+  if(m_OutputFormat == 0 && true == m_OutputTrianglesFile.isEmpty())
   {
     setErrorCondition(-382);
     notifyErrorMessage(getHumanLabel(), "The output Triangles file needs to be set", getErrorCondition());
   }
 
+  if(m_OutputFormat == 1 && true == m_OutputStlFile.isEmpty())
+  {
+    setErrorCondition(-383);
+    notifyErrorMessage(getHumanLabel(), "The output STL file needs to be set", getErrorCondition());
+  }
+
+  if(m_OutputFormat == 2 && true == m_OutputPlyFile.isEmpty())
+  {
+    setErrorCondition(-384);
+    notifyErrorMessage(getHumanLabel(), "The output PLY file needs to be set", getErrorCondition());
+  }
+
   DataContainer::Pointer dataContainer = getDataContainerArray()->getPrereqDataContainer(this, getDataContainerSelection());
   if(getErrorCondition() < 0)
   {
@@ -145,6 +212,43 @@ void WriteTriangleGeometry::dataCheck()
     setErrorCondition(-387);
     notifyErrorMessage(getHumanLabel(), "DataContainer Geometry missing Triangles", getErrorCondition());
   }
+
+  if(m_OutputFormat == 2)
+  {
+    checkArrayPaths(m_VertexArrayPaths, AttributeMatrix::Type::Vertex);
+    checkArrayPaths(m_FaceArrayPaths, AttributeMatrix::Type::Face);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WriteTriangleGeometry::checkArrayPaths(const QVector<DataArrayPath>& paths, AttributeMatrix::Type amType)
+{
+  QString amTypeName = (amType == AttributeMatrix::Type::Vertex) ? "Vertex" : "Face";
+  for(const DataArrayPath& path : paths)
+  {
+    IDataArray::Pointer array = getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, path);
+    if(getErrorCondition() < 0)
+    {
+      return;
+    }
+    AttributeMatrix::Pointer am = getDataContainerArray()->getAttributeMatrix(path);
+    if(path.getDataContainerName() != getDataContainerSelection() || nullptr == am.get() || am->getType() != amType)
+    {
+      setErrorCondition(-388);
+      QString ss = QObject::tr("The Attribute Array '%1' must belong to a %2 Attribute Matrix of the selected Data Container").arg(path.serialize("/")).arg(amTypeName);
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+    if(SurfaceMeshExporter::PLYPropertyType(array).isEmpty())
+    {
+      setErrorCondition(-389);
+      QString ss = QObject::tr("The Attribute Array '%1' of type %2 can not be written to a PLY file").arg(path.serialize("/")).arg(array->getTypeAsString());
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      return;
+    }
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -160,6 +264,25 @@ void WriteTriangleGeometry::preflight()
   setInPreflight(false);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool WriteTriangleGeometry::createParentPath(const QString& filePath)
+{
+  // Make sure any directory path is also available as the user may have just typed
+  // in a path without actually creating the full path
+  QFileInfo fi(filePath);
+  QDir parentPath = fi.path();
+  if(!parentPath.mkpath("."))
+  {
+    QString ss = QObject::tr("Error creating parent path '%1'").arg(parentPath.absolutePath());
+    setErrorCondition(-1);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return false;
+  }
+  return true;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -177,89 +300,101 @@ void WriteTriangleGeometry::execute()
 
   TriangleGeom::Pointer triangleGeom = dataContainer->getGeometryAs<TriangleGeom>();
   QString geometryType = triangleGeom->getGeometryTypeAsString();
-  float* nodes = triangleGeom->getVertexPointer(0);
-  int64_t* triangles = triangleGeom->getTriPointer(0);
 
   qint64 numNodes = triangleGeom->getNumberOfVertices();
   qint64 maxNodeId = numNodes - 1;
   int64_t numTriangles = triangleGeom->getNumberOfTris();
 
-  // ++++++++++++++ Write the Nodes File +++++++++++++++++++++++++++++++++++++++++++
-  // Make sure any directory path is also available as the user may have just typed
-  // in a path without actually creating the full path
-  notifyStatusMessage(getHumanLabel(), "Writing Nodes Text File");
-  QFileInfo fi(getOutputNodesFile());
-  QDir parentPath = fi.path();
+  SurfaceMeshExporter::Pointer exporter = SurfaceMeshExporter::New();
+  exporter->setGeometry(triangleGeom);
 
-  if(!parentPath.mkpath("."))
+  if(m_OutputFormat == 1)
   {
-
-    QString ss = QObject::tr("Error creating parent path '%1'").arg(parentPath.absolutePath());
-    setErrorCondition(-1);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
+    notifyStatusMessage(getHumanLabel(), "Writing Binary STL File");
+    if(!createParentPath(getOutputStlFile()))
+    {
+      return;
+    }
+    err = exporter->writeBinarySTL(getOutputStlFile(), QString("DREAM.3D %1 %2").arg(SIMPLib::Version::Complete()).arg(geometryType));
   }
-  FILE* nodesFile = nullptr;
-  nodesFile = fopen(getOutputNodesFile().toLatin1().data(), "wb");
-  if(nullptr == nodesFile)
+  else if(m_OutputFormat == 2)
   {
-    setErrorCondition(-100);
-    notifyErrorMessage(getHumanLabel(), "Error opening Nodes file for writing", -100);
-    return;
+    notifyStatusMessage(getHumanLabel(), "Writing Binary PLY File");
+    if(!createParentPath(getOutputPlyFile()))
+    {
+      return;
+    }
+    for(const DataArrayPath& path : m_VertexArrayPaths)
+    {
+      exporter->addVertexArray(getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, path));
+    }
+    for(const DataArrayPath& path : m_FaceArrayPaths)
+    {
+      exporter->addFaceArray(getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, path));
+    }
+    err = exporter->writeBinaryPLY(getOutputPlyFile(), QString("DREAM.3D Version %1").arg(SIMPLib::Version::Complete()));
   }
-  fprintf(nodesFile, "# All lines starting with '#' are comments\n");
-  fprintf(nodesFile, "# DREAM.3D Nodes file\n");
-  fprintf(nodesFile, "# DREAM.3D Version %s\n", SIMPLib::Version::Complete().toLatin1().constData());
-  fprintf(nodesFile, "# Node Data is X Y Z space delimited.\n");
-  fprintf(nodesFile, "Node Count: %lld\n", numNodes);
-  for(int i = 0; i < numNodes; i++)
+  else
   {
-    fprintf(nodesFile, "%8.5f %8.5f %8.5f\n", nodes[i * 3], nodes[i * 3 + 1], nodes[i * 3 + 2]);
+    // ++++++++++++++ Write the Nodes File +++++++++++++++++++++++++++++++++++++++++++
+    notifyStatusMessage(getHumanLabel(), "Writing Nodes Text File");
+    if(!createParentPath(getOutputNodesFile()))
+    {
+      return;
+    }
+    FILE* nodesFile = nullptr;
+    nodesFile = fopen(getOutputNodesFile().toLatin1().data(), "wb");
+    if(nullptr == nodesFile)
+    {
+      setErrorCondition(-100);
+      notifyErrorMessage(getHumanLabel(), "Error opening Nodes file for writing", -100);
+      return;
+    }
+    fprintf(nodesFile, "# All lines starting with '#' are comments\n");
+    fprintf(nodesFile, "# DREAM.3D Nodes file\n");
+    fprintf(nodesFile, "# DREAM.3D Version %s\n", SIMPLib::Version::Complete().toLatin1().constData());
+    fprintf(nodesFile, "# Node Data is X Y Z space delimited.\n");
+    fprintf(nodesFile, "Node Count: %lld\n", numNodes);
+    err = exporter->writeVertexText(nodesFile);
+    fclose(nodesFile);
+
+    // ++++++++++++++ Write the Triangles File +++++++++++++++++++++++++++++++++++++++++++
+    if(err >= 0)
+    {
+      notifyStatusMessage(getHumanLabel(), "Writing Triangles Text File");
+      if(!createParentPath(getOutputTrianglesFile()))
+      {
+        return;
+      }
+      FILE* triFile = fopen(getOutputTrianglesFile().toLatin1().data(), "wb");
+      if(nullptr == triFile)
+      {
+        setErrorCondition(-100);
+        notifyErrorMessage(getHumanLabel(), "Error opening Triangles file for writing", -100);
+        return;
+      }
+
+      fprintf(triFile, "# All lines starting with '#' are comments\n");
+      fprintf(triFile, "# DREAM.3D Triangle file\n");
+      fprintf(triFile, "# DREAM.3D Version %s\n", SIMPLib::Version::Complete().toLatin1().constData());
+      fprintf(triFile, "# Each Triangle consists of 3 Node Ids.\n");
+      fprintf(triFile, "# NODE IDs START AT 0.\n");
+      fprintf(triFile, "Geometry Type: %s\n", geometryType.toLatin1().constData());
+      fprintf(triFile, "Node Count: %lld\n", numNodes);
+      fprintf(triFile, "Max Node Id: %lld\n", maxNodeId);
+      fprintf(triFile, "Triangle Count: %lld\n", (long long int)(numTriangles));
+      err = exporter->writeFaceText(triFile);
+      fclose(triFile);
+    }
   }
-  fclose(nodesFile);
-
-  // ++++++++++++++ Write the Triangles File +++++++++++++++++++++++++++++++++++++++++++
-  notifyStatusMessage(getHumanLabel(), "Writing Triangles Text File");
-  QFileInfo triFI(getOutputTrianglesFile());
-  parentPath = triFI.path();
-  if(!parentPath.mkpath("."))
-  {
 
-    QString ss = QObject::tr("Error creating parent path '%1'").arg(parentPath.absolutePath());
-    setErrorCondition(-1);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
-    return;
-  }
-  FILE* triFile = fopen(getOutputTrianglesFile().toLatin1().data(), "wb");
-  if(nullptr == triFile)
+  if(err < 0)
   {
-    setErrorCondition(-100);
-    notifyErrorMessage(getHumanLabel(), "Error opening Triangles file for writing", -100);
+    setErrorCondition(-390);
+    notifyErrorMessage(getHumanLabel(), exporter->getErrorMessage(), getErrorCondition());
     return;
   }
 
-  fprintf(triFile, "# All lines starting with '#' are comments\n");
-  fprintf(triFile, "# DREAM.3D Triangle file\n");
-  fprintf(triFile, "# DREAM.3D Version %s\n", SIMPLib::Version::Complete().toLatin1().constData());
-  fprintf(triFile, "# Each Triangle consists of 3 Node Ids.\n");
-  fprintf(triFile, "# NODE IDs START AT 0.\n");
-  fprintf(triFile, "Geometry Type: %s\n", geometryType.toLatin1().constData());
-  fprintf(triFile, "Node Count: %lld\n", numNodes);
-  fprintf(triFile, "Max Node Id: %lld\n", maxNodeId);
-  fprintf(triFile, "Triangle Count: %lld\n", (long long int)(numTriangles));
-
-  int n1, n2, n3;
-  for(int64_t j = 0; j < numTriangles; ++j)
-  {
-    n1 = triangles[j * 3];
-    n2 = triangles[j * 3 + 1];
-    n3 = triangles[j * 3 + 2];
-
-    fprintf(triFile, "%d %d %d\n", n1, n2, n3);
-  }
-
-  fclose(triFile);
-
   /* Let the GUI know we are done with this filter */
   notifyStatusMessage(getHumanLabel(), "Complete");
 }
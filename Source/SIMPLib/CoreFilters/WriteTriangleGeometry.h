@@ -60,6 +60,11 @@ class SIMPLib_EXPORT WriteTriangleGeometry : public AbstractFilter
     PYB11_PROPERTY(QString DataContainerSelection READ getDataContainerSelection WRITE setDataContainerSelection)
     PYB11_PROPERTY(QString OutputNodesFile READ getOutputNodesFile WRITE setOutputNodesFile)
     PYB11_PROPERTY(QString OutputTrianglesFile READ getOutputTrianglesFile WRITE setOutputTrianglesFile)
+    PYB11_PROPERTY(int OutputFormat READ getOutputFormat WRITE setOutputFormat)
+    PYB11_PROPERTY(QString OutputStlFile READ getOutputStlFile WRITE setOutputStlFile)
+    PYB11_PROPERTY(QString OutputPlyFile READ getOutputPlyFile WRITE setOutputPlyFile)
+    PYB11_PROPERTY(QVector<DataArrayPath> VertexArrayPaths READ getVertexArrayPaths WRITE setVertexArrayPaths)
+    PYB11_PROPERTY(QVector<DataArrayPath> FaceArrayPaths READ getFaceArrayPaths WRITE setFaceArrayPaths)
 
   public:
     SIMPL_SHARED_POINTERS(WriteTriangleGeometry)
@@ -77,6 +82,21 @@ class SIMPLib_EXPORT WriteTriangleGeometry : public AbstractFilter
     SIMPL_FILTER_PARAMETER(QString, OutputTrianglesFile)
     Q_PROPERTY(QString OutputTrianglesFile READ getOutputTrianglesFile WRITE setOutputTrianglesFile)
 
+    SIMPL_FILTER_PARAMETER(int, OutputFormat)
+    Q_PROPERTY(int OutputFormat READ getOutputFormat WRITE setOutputFormat)
+
+    SIMPL_FILTER_PARAMETER(QString, OutputStlFile)
+    Q_PROPERTY(QString OutputStlFile READ getOutputStlFile WRITE setOutputStlFile)
+
+    SIMPL_FILTER_PARAMETER(QString, OutputPlyFile)
+    Q_PROPERTY(QString OutputPlyFile READ getOutputPlyFile WRITE setOutputPlyFile)
+
+    SIMPL_FILTER_PARAMETER(QVector<DataArrayPath>, VertexArrayPaths)
+    Q_PROPERTY(QVector<DataArrayPath> VertexArrayPaths READ getVertexArrayPaths WRITE setVertexArrayPaths)
+
+    SIMPL_FILTER_PARAMETER(QVector<DataArrayPath>, FaceArrayPaths)
+    Q_PROPERTY(QVector<DataArrayPath> FaceArrayPaths READ getFaceArrayPaths WRITE setFaceArrayPaths)
+
     /**
      * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
      */
@@ -178,6 +198,21 @@ class SIMPLib_EXPORT WriteTriangleGeometry : public AbstractFilter
      */
     void initialize();
 
+    /**
+     * @brief createParentPath Creates the directory of an output file, reporting an error if that fails
+     * @param filePath
+     * @return true if the directory exists
+     */
+    bool createParentPath(const QString& filePath);
+
+    /**
+     * @brief checkArrayPaths Checks that the selected PLY arrays belong to an Attribute Matrix of the
+     * given type in the selected Data Container and can be written to a PLY file
+     * @param paths
+     * @param amType
+     */
+    void checkArrayPaths(const QVector<DataArrayPath>& paths, AttributeMatrix::Type amType);
+
 
   public:
     WriteTriangleGeometry(const WriteTriangleGeometry&) = delete; // Copy Constructor Not Implemented
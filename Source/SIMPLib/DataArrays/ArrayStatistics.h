@@ -0,0 +1,82 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _arraystatistics_h_
+#define _arraystatistics_h_
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief The ArrayStatistics struct holds the per component summary of an array as
+ * returned by IDataArray::getStatistics(). All values are stored as double whatever
+ * the type of the array. NaN values are only counted in nanCount; count, sum, mean,
+ * variance, min, max and the histogram cover the remaining values. The variance is
+ * the population variance. The histogram is stored flat, numBins counts per
+ * component, with the bins spanning [min, max] of that component. It is empty when
+ * no bins were requested.
+ */
+struct ArrayStatistics
+{
+  ArrayStatistics() :
+    valid(false),
+    numComponents(0),
+    numBins(0)
+  {}
+
+  bool valid;
+  size_t numComponents;
+  int numBins;
+  std::vector<size_t> count;
+  std::vector<size_t> nanCount;
+  std::vector<double> min;
+  std::vector<double> max;
+  std::vector<double> sum;
+  std::vector<double> mean;
+  std::vector<double> variance;
+  std::vector<uint64_t> histogram;
+
+  /**
+   * @brief Returns the histogram count of a bin
+   * @param comp The component index
+   * @param bin The bin index
+   */
+  uint64_t getHistogramCount(size_t comp, int bin) const
+  {
+    return histogram[comp * static_cast<size_t>(numBins) + static_cast<size_t>(bin)];
+  }
+};
+
+#endif /* _arraystatistics_h_ */
@@ -37,11 +37,25 @@
 #define _dataarray_h_
 
 // STL Includes
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
 #include <vector>
 #include <cstring>
+#include <memory>
 
 #include "SIMPLib/SIMPLib.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/partitioner.h>
+#include <tbb/tbb_stddef.h>
+#endif
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/DataArrayAllocator.h"
 #include "SIMPLib/DataArrays/IDataArray.h"
 #include "SIMPLib/HDF5/H5DataArrayWriter.hpp"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
@@ -65,11 +79,338 @@
 #define INIT_DataArray(var, Type)\
   var = DataArray<Type>::CreateArray(0, #var);
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+/**
+ * @brief The InitializeWithValueImpl class fills a range of a buffer with a single
+ * value. Filling a freshly allocated buffer this way is what first touches its pages,
+ * so each thread's block ends up on the NUMA node of the thread that later works on it.
+ */
+template<typename T>
+class InitializeWithValueImpl
+{
+  public:
+    InitializeWithValueImpl(T* data, T value) :
+      m_Data(data),
+      m_Value(value),
+      m_Zero(value == static_cast<T>(0))
+    {}
+
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      if(m_Zero)
+      {
+        ::memset(m_Data + r.begin(), 0, (r.end() - r.begin()) * sizeof(T));
+      }
+      else
+      {
+        std::fill(m_Data + r.begin(), m_Data + r.end(), m_Value);
+      }
+    }
+
+  private:
+    T* m_Data;
+    T m_Value;
+    bool m_Zero;
+};
+
+/**
+ * @brief The CompactTuplesImpl class copies the runs of kept tuples of a
+ * TupleCompactionMap into a new buffer, one block of runs per task.
+ */
+template<typename T>
+class CompactTuplesImpl
+{
+  public:
+    CompactTuplesImpl(const T* src, T* dest, const std::vector<TupleCompactionMap::Run>& runs, size_t numComps) :
+      m_Source(src),
+      m_Dest(dest),
+      m_Runs(runs),
+      m_NumComps(numComps)
+    {}
+
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      for(size_t i = r.begin(); i != r.end(); ++i)
+      {
+        const TupleCompactionMap::Run& run = m_Runs[i];
+        std::memcpy(m_Dest + run.dest * m_NumComps, m_Source + run.source * m_NumComps, run.count * m_NumComps * sizeof(T));
+      }
+    }
+
+  private:
+    const T* m_Source;
+    T* m_Dest;
+    const std::vector<TupleCompactionMap::Run>& m_Runs;
+    size_t m_NumComps;
+};
+#endif
+
+/**
+ * @brief The ArrayStatisticsImpl class accumulates the count, NaN count, min, max,
+ * sum, mean and sum of squared deviations of every component over a range of tuples.
+ * Within a range the moments are summed relative to the first value of the range and
+ * the sum uses Kahan compensation. Ranges are merged with the pairwise update of
+ * Chan et al., so large arrays keep their accuracy however the tuples get split.
+ */
+template<typename T>
+class ArrayStatisticsImpl
+{
+  public:
+    ArrayStatisticsImpl(const T* data, size_t numComps) :
+      m_Data(data),
+      m_NumComps(numComps),
+      m_Count(numComps, 0),
+      m_NanCount(numComps, 0),
+      m_Min(numComps, std::numeric_limits<double>::max()),
+      m_Max(numComps, std::numeric_limits<double>::lowest()),
+      m_Sum(numComps, 0.0),
+      m_SumCompensation(numComps, 0.0),
+      m_Mean(numComps, 0.0),
+      m_M2(numComps, 0.0)
+    {}
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    ArrayStatisticsImpl(ArrayStatisticsImpl& other, tbb::split) :
+      ArrayStatisticsImpl(other.m_Data, other.m_NumComps)
+    {}
+#endif
+
+    void accumulate(size_t start, size_t end)
+    {
+      std::vector<size_t> count(m_NumComps, 0);
+      std::vector<double> shift(m_NumComps, 0.0);
+      std::vector<double> s1(m_NumComps, 0.0);
+      std::vector<double> s2(m_NumComps, 0.0);
+      for(size_t i = start; i < end; i++)
+      {
+        const T* tuple = m_Data + i * m_NumComps;
+        for(size_t c = 0; c < m_NumComps; c++)
+        {
+          double value = static_cast<double>(tuple[c]);
+          if(std::isnan(value))
+          {
+            m_NanCount[c]++;
+            continue;
+          }
+          if(count[c] == 0)
+          {
+            shift[c] = value;
+          }
+          count[c]++;
+          if(value < m_Min[c]) { m_Min[c] = value; }
+          if(value > m_Max[c]) { m_Max[c] = value; }
+
+          double adjustedValue = value - m_SumCompensation[c];
+          double newSum = m_Sum[c] + adjustedValue;
+          m_SumCompensation[c] = (newSum - m_Sum[c]) - adjustedValue;
+          m_Sum[c] = newSum;
+
+          double delta = value - shift[c];
+          s1[c] += delta;
+          s2[c] += delta * delta;
+        }
+      }
+      for(size_t c = 0; c < m_NumComps; c++)
+      {
+        if(count[c] > 0)
+        {
+          double n = static_cast<double>(count[c]);
+          mergeMoments(c, count[c], shift[c] + s1[c] / n, s2[c] - s1[c] * s1[c] / n);
+        }
+      }
+    }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r)
+    {
+      accumulate(r.begin(), r.end());
+    }
+#endif
+
+    void join(const ArrayStatisticsImpl& rhs)
+    {
+      for(size_t c = 0; c < m_NumComps; c++)
+      {
+        m_NanCount[c] += rhs.m_NanCount[c];
+        if(rhs.m_Count[c] == 0)
+        {
+          continue;
+        }
+        if(rhs.m_Min[c] < m_Min[c]) { m_Min[c] = rhs.m_Min[c]; }
+        if(rhs.m_Max[c] > m_Max[c]) { m_Max[c] = rhs.m_Max[c]; }
+
+        double adjustedValue = (rhs.m_Sum[c] - rhs.m_SumCompensation[c]) - m_SumCompensation[c];
+        double newSum = m_Sum[c] + adjustedValue;
+        m_SumCompensation[c] = (newSum - m_Sum[c]) - adjustedValue;
+        m_Sum[c] = newSum;
+
+        mergeMoments(c, rhs.m_Count[c], rhs.m_Mean[c], rhs.m_M2[c]);
+      }
+    }
+
+    void store(ArrayStatistics& stats) const
+    {
+      stats.valid = true;
+      stats.numComponents = m_NumComps;
+      stats.numBins = 0;
+      stats.histogram.clear();
+      stats.count = m_Count;
+      stats.nanCount = m_NanCount;
+      stats.min.resize(m_NumComps);
+      stats.max.resize(m_NumComps);
+      stats.sum.resize(m_NumComps);
+      stats.mean.resize(m_NumComps);
+      stats.variance.resize(m_NumComps);
+      for(size_t c = 0; c < m_NumComps; c++)
+      {
+        if(m_Count[c] == 0)
+        {
+          stats.min[c] = std::numeric_limits<double>::quiet_NaN();
+          stats.max[c] = std::numeric_limits<double>::quiet_NaN();
+          stats.sum[c] = 0.0;
+          stats.mean[c] = std::numeric_limits<double>::quiet_NaN();
+          stats.variance[c] = std::numeric_limits<double>::quiet_NaN();
+          continue;
+        }
+        stats.min[c] = m_Min[c];
+        stats.max[c] = m_Max[c];
+        stats.sum[c] = m_Sum[c] - m_SumCompensation[c];
+        stats.mean[c] = m_Mean[c];
+        stats.variance[c] = m_M2[c] / static_cast<double>(m_Count[c]);
+      }
+    }
+
+  private:
+    void mergeMoments(size_t c, size_t count, double mean, double m2)
+    {
+      if(m_Count[c] == 0)
+      {
+        m_Count[c] = count;
+        m_Mean[c] = mean;
+        m_M2[c] = m2;
+        return;
+      }
+      double n1 = static_cast<double>(m_Count[c]);
+      double n2 = static_cast<double>(count);
+      double n = n1 + n2;
+      double delta = mean - m_Mean[c];
+      m_Mean[c] += delta * n2 / n;
+      m_M2[c] += m2 + delta * delta * n1 * n2 / n;
+      m_Count[c] += count;
+    }
+
+    const T* m_Data;
+    size_t m_NumComps;
+    std::vector<size_t> m_Count;
+    std::vector<size_t> m_NanCount;
+    std::vector<double> m_Min;
+    std::vector<double> m_Max;
+    std::vector<double> m_Sum;
+    std::vector<double> m_SumCompensation;
+    std::vector<double> m_Mean;
+    std::vector<double> m_M2;
+};
+
+/**
+ * @brief The ArrayHistogramImpl class bins every component of a range of tuples into
+ * numBins equal bins between the component's min and max. NaN values are skipped.
+ */
+template<typename T>
+class ArrayHistogramImpl
+{
+  public:
+    ArrayHistogramImpl(const T* data, size_t numComps, int numBins, const std::vector<double>& min, const std::vector<double>& max) :
+      m_Data(data),
+      m_NumComps(numComps),
+      m_NumBins(numBins),
+      m_Min(min),
+      m_Scale(numComps, 0.0),
+      m_Counts(numComps * static_cast<size_t>(numBins), 0)
+    {
+      for(size_t c = 0; c < m_NumComps; c++)
+      {
+        double range = max[c] - min[c];
+        m_Scale[c] = (range > 0.0) ? static_cast<double>(numBins) / range : 0.0;
+      }
+    }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    ArrayHistogramImpl(ArrayHistogramImpl& other, tbb::split) :
+      m_Data(other.m_Data),
+      m_NumComps(other.m_NumComps),
+      m_NumBins(other.m_NumBins),
+      m_Min(other.m_Min),
+      m_Scale(other.m_Scale),
+      m_Counts(other.m_Counts.size(), 0)
+    {}
+#endif
+
+    void accumulate(size_t start, size_t end)
+    {
+      for(size_t i = start; i < end; i++)
+      {
+        const T* tuple = m_Data + i * m_NumComps;
+        for(size_t c = 0; c < m_NumComps; c++)
+        {
+          double value = static_cast<double>(tuple[c]);
+          if(std::isnan(value))
+          {
+            continue;
+          }
+          int bin = static_cast<int>((value - m_Min[c]) * m_Scale[c]);
+          if(bin >= m_NumBins)
+          {
+            bin = m_NumBins - 1;
+          }
+          m_Counts[c * m_NumBins + bin]++;
+        }
+      }
+    }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r)
+    {
+      accumulate(r.begin(), r.end());
+    }
+#endif
+
+    void join(const ArrayHistogramImpl& rhs)
+    {
+      for(size_t i = 0; i < m_Counts.size(); i++)
+      {
+        m_Counts[i] += rhs.m_Counts[i];
+      }
+    }
+
+    const std::vector<uint64_t>& getCounts() const
+    {
+      return m_Counts;
+    }
+
+  private:
+    const T* m_Data;
+    size_t m_NumComps;
+    int m_NumBins;
+    std::vector<double> m_Min;
+    std::vector<double> m_Scale;
+    std::vector<uint64_t> m_Counts;
+};
+
+
 
 
 /**
  * @class DataArray DataArray.hpp DREAM3DLib/Common/DataArray.hpp
  * @brief Template class for wrapping raw arrays of data.
+ *
+ * deepCopy() always duplicates the data. shallowCopy() (shallowCopyArray() through
+ * IDataArray, which is how AttributeMatrix::deepCopy() copies its arrays) is the lazy
+ * alternative: the copy shares the buffer with the original and the first array that asks for
+ * mutable access (getPointer, getVoidPointer, setValue, resize, eraseTuples, ...)
+ * takes a private copy of the data first. Raw pointers are only ever handed out
+ * after that copy, so a pointer obtained from getPointer() can not write into the
+ * other array. Read only code should use getConstPointer()/getConstTuplePointer(),
+ * getConstVoidPointer(), getValue() and getComponent() which never trigger the copy.
  * @author mjackson
  * @date July 3, 2008
  * @version $Revision: 1.2 $
@@ -381,7 +722,8 @@ class DataArray : public IDataArray
     /**
      * @brief WrapPointer Creates a DataArray<T> object that references the pointer. The original caller can
      * set if the memory should be "free()'ed" when the object goes away. The original memory MUST have been
-     * "alloc()'ed" and <b>NOT</b> new 'ed.
+     * "alloc()'ed" and <b>NOT</b> new 'ed. Buffers released from another DataArray through releaseOwnership()
+     * are "alloc()'ed" as well.
      * @param data
      * @param numTuples
      * @param cDims
@@ -403,6 +745,26 @@ class DataArray : public IDataArray
       return p;
     }
 
+    /**
+     * @brief WrapExternalBuffer Creates a DataArray<T> object that uses memory allocated and owned by
+     * another library (an ITK pixel container for example) as its storage without copying it. The
+     * <b>owner</b> object is held for as long as the array references the memory and is released
+     * when the array is destroyed, resized or reallocated. The memory is never "free()'ed" by the array,
+     * takeOwnership() and releaseOwnership() switch the array to a private copy first.
+     * @param data
+     * @param numTuples
+     * @param cDims
+     * @param name
+     * @param owner Keeps the memory alive. Its deleter is responsible for releasing the memory.
+     * @return
+     */
+    static Pointer WrapExternalBuffer(T* data, size_t numTuples, QVector<size_t> cDims, const QString& name, std::shared_ptr<void> owner)
+    {
+      Pointer p = WrapPointer(data, numTuples, cDims, name, false);
+      p->m_ExternalBuffer = owner;
+      return p;
+    }
+
 
     // This line must be here, because we are overloading the copyData pure virtual function in IDataArray.
     // This is required so that other classes can call this version of copyData from the subclasses.
@@ -434,7 +796,7 @@ class DataArray : public IDataArray
       if(destTupleOffset > m_MaxId) { return false; }
       if(!sourceArray->isAllocated()) { return false; }
       Self* source = dynamic_cast<Self*>(sourceArray.get());
-      if(nullptr == source->getPointer(0)) { return false; }
+      if(nullptr == source->getConstPointer(0)) { return false; }
 
       if(sourceArray->getNumberOfComponents() != getNumberOfComponents()) { return false; }
 
@@ -448,9 +810,11 @@ class DataArray : public IDataArray
         return false;
       }
 
+      detach();
+      markModified();
       size_t elementStart = destTupleOffset*getNumberOfComponents();
       size_t totalBytes = (totalSrcTuples * sourceArray->getNumberOfComponents()) * sizeof(T);
-      std::memcpy(m_Array + elementStart, source->getPointer(srcTupleOffset * sourceArray->getNumberOfComponents()), totalBytes);
+      std::memcpy(m_Array + elementStart, source->getConstPointer(srcTupleOffset * sourceArray->getNumberOfComponents()), totalBytes);
       return true;
     }
 
@@ -519,6 +883,7 @@ class DataArray : public IDataArray
       {
         _deallocate();
       }
+      dropSharedBuffer();
     }
 
     /**
@@ -559,30 +924,93 @@ class DataArray : public IDataArray
      */
     virtual void takeOwnership()
     {
+      detach();
+      if(nullptr != m_ExternalBuffer)
+      {
+        // Memory from another allocator can not be handed to free() so take a copy instead
+        detachExternalBuffer();
+        if(nullptr != m_ExternalBuffer) { return; }
+      }
       m_OwnsData = true;
     }
 
     /**
      * @brief This class will NOT free the memory associated with the internal pointer.
      * This can be useful if the user wishes to keep the data around after this
-     * class goes out of scope.
+     * class goes out of scope. The released memory is always "alloc()'ed" and must be
+     * given back with free(): buffers from the DataArrayAllocator are handed over with
+     * DataArrayAllocator::release(), which moves or copies all but huge page buffers, and
+     * adopted external buffers are copied first.
      */
     virtual void releaseOwnership()
     {
+      detach();
+      if(nullptr != m_ExternalBuffer)
+      {
+        // The memory still belongs to another library
+        detachExternalBuffer();
+        if(nullptr != m_ExternalBuffer) { return; }
+        m_OwnsData = true;
+      }
+      if(m_OwnsData && nullptr != m_Array && nullptr != m_Allocator)
+      {
+        T* released = static_cast<T*>(m_Allocator->release(m_Array));
+        if (nullptr == released)
+        {
+          qDebug() << "Unable to release " << m_Size << " elements of size " << sizeof(T) << " bytes. " ;
+          return;
+        }
+        m_Array = released;
+        m_Allocator.reset();
+      }
       m_OwnsData = false;
     }
 
+    /**
+     * @brief Returns true if the data buffer is currently shared with another array
+     * that was created through shallowCopy()
+     */
+    bool isShared() const
+    {
+      if(!m_Shared.load(std::memory_order_acquire))
+      {
+        return false;
+      }
+      QMutexLocker lock(&CopyOnWriteMutex());
+      return (nullptr != m_SharedBuffer && m_SharedBuffer.use_count() > 1);
+    }
+
+    /**
+     * @brief Returns true if the data buffer belongs to another library and was
+     * adopted through WrapExternalBuffer()
+     */
+    bool hasExternalBuffer() const
+    {
+      return (nullptr != m_ExternalBuffer);
+    }
+
+    /**
+     * @brief Makes sure this array is the only one referencing its data buffer,
+     * copying the buffer if it is still shared with another array. All of the mutable
+     * accessors call this before handing out writable memory. It is safe to call from
+     * several threads at once, so parallel code may call getPointer() on a shared array.
+     * An unshared array pays for one atomic load and nothing else.
+     */
+    inline void detach()
+    {
+      if(m_Shared.load(std::memory_order_acquire))
+      {
+        detachSharedBuffer();
+      }
+    }
+
     /**
      * @brief Allocates the memory needed for this class
      * @return 1 on success, -1 on failure
      */
     virtual int32_t allocate()
     {
-      if ((nullptr != m_Array) && (true == m_OwnsData))
-      {
-        _deallocate();
-      }
-      m_Array = nullptr;
+      releaseArray();
       m_OwnsData = true;
       m_IsAllocated = false;
       if (m_Size == 0)
@@ -593,11 +1021,9 @@ class DataArray : public IDataArray
 
 
       size_t newSize = m_Size;
-#if defined ( AIM_USE_SSE ) && defined ( __SSE2__ )
-      m_Array = static_cast<T*>( _mm_malloc (newSize * sizeof(T), 16) );
-#else
-      m_Array = (T*)malloc(newSize * sizeof(T));
-#endif
+      // The pages are not touched here, see initializeWithValue()
+      m_Allocator = DataArrayAllocator::Instance();
+      m_Array = static_cast<T*>(m_Allocator->allocate(newSize * sizeof(T)));
       if (!m_Array)
       {
         qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
@@ -615,11 +1041,7 @@ class DataArray : public IDataArray
      */
     virtual void clear()
     {
-      if (nullptr != m_Array && true == m_OwnsData)
-      {
-        _deallocate();
-      }
-      m_Array = nullptr;
+      releaseArray();
       m_Size = 0;
       m_OwnsData = true;
       m_MaxId = 0;
@@ -635,21 +1057,40 @@ class DataArray : public IDataArray
      */
     virtual void initializeWithZeros()
     {
-      if(!m_IsAllocated || nullptr == m_Array) { return; }
-      size_t typeSize = sizeof(T);
-      ::memset(m_Array, 0, m_Size * typeSize);
+      initializeWithValue(static_cast<T>(0));
     }
 
     /**
-     * @brief Sets all the values to value.
+     * @brief Sets all the values to value. Large arrays are filled in parallel with
+     * one contiguous block per thread, which places their pages on the NUMA nodes of
+     * the threads that will work on them.
      */
     virtual void initializeWithValue(T initValue, size_t offset = 0)
     {
-      if(!m_IsAllocated || nullptr == m_Array) { return; }
-      for (size_t i = offset; i < m_Size; i++)
+      if(!m_IsAllocated || nullptr == m_Array || offset >= m_Size) { return; }
+      detach();
+      markModified();
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      // Below this size a thread pool costs more than the fill itself
+      static const size_t k_ParallelInitializeBytes = 4 * 1024 * 1024;
+      if((m_Size - offset) * sizeof(T) >= k_ParallelInitializeBytes)
+      {
+        tbb::blocked_range<size_t> range(offset, m_Size);
+#if TBB_INTERFACE_VERSION >= 9100
+        // An even split per thread is how the filters' blocked_range loops divide an array
+        tbb::parallel_for(range, InitializeWithValueImpl<T>(m_Array, initValue), tbb::static_partitioner());
+#else
+        tbb::parallel_for(range, InitializeWithValueImpl<T>(m_Array, initValue), tbb::auto_partitioner());
+#endif
+        return;
+      }
+#endif
+      if(initValue == static_cast<T>(0))
       {
-        m_Array[i] = initValue;
+        ::memset(m_Array + offset, 0, (m_Size - offset) * sizeof(T));
+        return;
       }
+      std::fill(m_Array + offset, m_Array + m_Size, initValue);
     }
 
     /**
@@ -688,7 +1129,13 @@ class DataArray : public IDataArray
       size_t newSize = (getNumberOfTuples() - idxs.size()) * m_NumComponents ;
 
       // Create a new m_Array to copy into
-      T* newArray = (T*)malloc(newSize * sizeof(T));
+      DataArrayAllocator::Pointer allocator = DataArrayAllocator::Instance();
+      T* newArray = static_cast<T*>(allocator->allocate(newSize * sizeof(T)));
+      if (!newArray)
+      {
+        qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
+        return -1;
+      }
       // Splat AB across the array so we know if we are copying the values or not
       ::memset(newArray, 0xAB, newSize * sizeof(T));
 
@@ -714,9 +1161,10 @@ class DataArray : public IDataArray
       {
         T* currentSrc = m_Array + (j * m_NumComponents);
         std::memcpy(currentDest, currentSrc, (getNumberOfTuples() - idxs.size()) * m_NumComponents * sizeof(T));
-        _deallocate(); // We are done copying - delete the current m_Array
+        releaseArray(); // We are done copying - let go of the current m_Array
         m_Size = newSize;
         m_Array = newArray;
+        m_Allocator = allocator;
         m_OwnsData = true;
         m_MaxId = newSize - 1;
         m_IsAllocated = true;
@@ -754,12 +1202,13 @@ class DataArray : public IDataArray
         std::memcpy(currentDest, currentSrc, bytes);
       }
 
-      // We are done copying - delete the current m_Array
-      _deallocate();
+      // We are done copying - let go of the current m_Array
+      releaseArray();
 
       // Allocation was successful.  Save it.
       m_Size = newSize;
       m_Array = newArray;
+      m_Allocator = allocator;
       // This object has now allocated its memory and owns it.
       m_OwnsData = true;
       m_IsAllocated = true;
@@ -768,6 +1217,75 @@ class DataArray : public IDataArray
       return err;
     }
 
+    /**
+     * @brief Removes every tuple the map does not keep. Arrays that own their memory are
+     * compacted in place with one move per run of kept tuples; large, shared or wrapped
+     * arrays are copied run by run (in parallel) into a new buffer of the final size.
+     * No intermediate index tables are built.
+     * @param map The compaction map
+     * @return error code.
+     */
+    virtual int compactTuples(const TupleCompactionMap& map)
+    {
+      if(map.getNumberOfTuples() != getNumberOfTuples()) { return -100; }
+      size_t newNumTuples = map.getNumberOfKeptTuples();
+      if(newNumTuples == getNumberOfTuples()) { return 0; }
+      if(newNumTuples == 0 || nullptr == m_Array)
+      {
+        resize(newNumTuples);
+        return 0;
+      }
+
+      const std::vector<TupleCompactionMap::Run>& runs = map.getRuns();
+      size_t newSize = newNumTuples * m_NumComponents;
+      bool inPlace = m_OwnsData;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      // Below this size the moves are too cheap to be worth a second buffer and a thread pool
+      static const size_t k_ParallelCompactionBytes = 8 * 1024 * 1024;
+      if(m_Size * sizeof(T) >= k_ParallelCompactionBytes && runs.size() > 1) { inPlace = false; }
+#endif
+
+      if(inPlace)
+      {
+        // Kept tuples only ever move towards the front so the runs can be moved in order
+        for(size_t i = 0; i < runs.size(); i++)
+        {
+          const TupleCompactionMap::Run& run = runs[i];
+          if(run.source != run.dest)
+          {
+            std::memmove(m_Array + run.dest * m_NumComponents, m_Array + run.source * m_NumComponents, run.count * m_NumComponents * sizeof(T));
+          }
+        }
+        return (resize(newNumTuples) > 0) ? 0 : -1;
+      }
+
+      DataArrayAllocator::Pointer allocator = DataArrayAllocator::Instance();
+      T* newArray = static_cast<T*>(allocator->allocate(newSize * sizeof(T)));
+      if (!newArray)
+      {
+        qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
+        return -1;
+      }
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, runs.size()), CompactTuplesImpl<T>(m_Array, newArray, runs, m_NumComponents), tbb::auto_partitioner());
+#else
+      for(size_t i = 0; i < runs.size(); i++)
+      {
+        const TupleCompactionMap::Run& run = runs[i];
+        std::memcpy(newArray + run.dest * m_NumComponents, m_Array + run.source * m_NumComponents, run.count * m_NumComponents * sizeof(T));
+      }
+#endif
+      releaseArray();
+      m_Array = newArray;
+      m_Allocator = allocator;
+      m_Size = newSize;
+      m_OwnsData = true;
+      m_IsAllocated = true;
+      m_MaxId = newSize - 1;
+      m_NumTuples = newNumTuples;
+      return 0;
+    }
+
     /**
      * @brief
      * @param currentPos
@@ -780,6 +1298,7 @@ class DataArray : public IDataArray
       if (currentPos >= max
           || newPos >= max )
       {return -1;}
+      detach();
       T* src = m_Array + (currentPos * m_NumComponents);
       T* dest = m_Array + (newPos * m_NumComponents);
       size_t bytes = sizeof(T) * m_NumComponents;
@@ -847,10 +1366,22 @@ class DataArray : public IDataArray
     virtual void* getVoidPointer(size_t i)
     {
       if (i >= m_Size) { return nullptr;}
-
+      detach();
       return (void*)(&(m_Array[i]));
     }
 
+    /**
+     * @brief Returns a read only void pointer to the index of the array. Unlike
+     * getVoidPointer() this never copies a buffer that is shared with another array.
+     * @param i The index to have the returned pointer pointing to.
+     * @return Void Pointer. Possibly nullptr.
+     */
+    virtual const void* getConstVoidPointer(size_t i) const
+    {
+      if (i >= m_Size) { return nullptr;}
+      return static_cast<const void*>(m_Array + i);
+    }
+
 
     /**
      * @brief Returns the pointer to a specific index into the array. No checks are made
@@ -864,9 +1395,24 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i < m_Size);}
 #endif
+      detach();
       return (T*)(&(m_Array[i]));
     }
 
+    /**
+     * @brief Returns a read only pointer to a specific index into the array. Unlike
+     * getPointer() this never copies a buffer that is shared with another array.
+     * @param i The index to return the pointer to.
+     * @return The pointer to the index
+     */
+    const T* getConstPointer(size_t i) const
+    {
+#ifndef NDEBUG
+      if (m_Size > 0) { Q_ASSERT(i < m_Size);}
+#endif
+      return m_Array + i;
+    }
+
     /**
      * @brief Returns the value for a given index
      * @param i The index to return the value at
@@ -891,6 +1437,7 @@ class DataArray : public IDataArray
       if (m_Size > 0)
       { Q_ASSERT(i < m_Size);}
 #endif
+      detach();
       m_Array[i] = value;
     }
 
@@ -915,6 +1462,7 @@ class DataArray : public IDataArray
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(i * m_NumComponents + j < m_Size);}
 #endif
+      detach();
       m_Array[i * m_NumComponents + j] = c;
     }
 
@@ -956,6 +1504,7 @@ class DataArray : public IDataArray
       if (m_Size > 0) { Q_ASSERT(i * m_NumComponents < m_Size);}
 #endif
       if(nullptr == p) { return; }
+      detach();
       T* c = reinterpret_cast<T*>(p);
       for (size_t j = 0; j < m_NumComponents; ++j)
       {
@@ -971,6 +1520,19 @@ class DataArray : public IDataArray
     {
 #ifndef NDEBUG
       if (m_Size > 0) { Q_ASSERT(tupleIndex * m_NumComponents < m_Size);}
+#endif
+      detach();
+      return m_Array + (tupleIndex * m_NumComponents);
+    }
+
+    /**
+     * @brief getConstTuplePointer Returns a read only pointer to a specific tuple
+     * @param tupleIndex The index of tuple
+     */
+    const T* getConstTuplePointer(size_t tupleIndex) const
+    {
+#ifndef NDEBUG
+      if (m_Size > 0) { Q_ASSERT(tupleIndex * m_NumComponents < m_Size);}
 #endif
       return m_Array + (tupleIndex * m_NumComponents);
     }
@@ -1101,7 +1663,52 @@ class DataArray : public IDataArray
     }
 
     /**
-     * @brief deepCopy
+     * @brief shallowCopy Creates a copy that shares the data buffer with this array
+     * until either of them asks for mutable access. Memory that belongs to someone
+     * else (see WrapPointer() and WrapExternalBuffer()) can go away underneath us so
+     * that is still copied up front.
+     * @return
+     */
+    Pointer shallowCopy()
+    {
+      if(m_IsAllocated == false || nullptr == m_Array || (m_OwnsData == false && false == m_Shared.load(std::memory_order_acquire)))
+      {
+        return std::dynamic_pointer_cast<DataArray<T>>(deepCopy());
+      }
+      DataArray<T>* d = new DataArray<T>(getNumberOfTuples(), getComponentDimensions(), getName(), false);
+      Pointer daCopy(d);
+      QMutexLocker lock(&CopyOnWriteMutex());
+      if(nullptr == m_SharedBuffer)
+      {
+        SharedBufferDeleter deleter;
+        deleter.allocator = m_Allocator;
+        m_SharedBuffer = SharedBufferType(m_Array, deleter);
+        m_OwnsData = false;
+      }
+      d->m_SharedBuffer = m_SharedBuffer;
+      d->m_Array = m_Array;
+      d->m_Allocator = m_Allocator;
+      d->m_Size = m_Size;
+      d->m_MaxId = m_MaxId;
+      d->m_IsAllocated = true;
+      d->m_InitValue = m_InitValue;
+      m_Shared.store(true, std::memory_order_release);
+      d->m_Shared.store(true, std::memory_order_release);
+      return daCopy;
+    }
+
+    /**
+     * @brief shallowCopyArray Reimplemented from IDataArray, see shallowCopy()
+     * @return
+     */
+    virtual IDataArray::Pointer shallowCopyArray()
+    {
+      return shallowCopy();
+    }
+
+    /**
+     * @brief deepCopy Creates a copy with its own duplicate of the data. See
+     * shallowCopy() for a copy that defers the duplication until the first write.
      * @param forceNoAllocate
      * @return
      */
@@ -1110,7 +1717,7 @@ class DataArray : public IDataArray
       IDataArray::Pointer daCopy = createNewArray(getNumberOfTuples(), getComponentDimensions(), getName(), m_IsAllocated);
       if(m_IsAllocated == true && forceNoAllocate == false)
       {
-        T* src = getPointer(0);
+        const T* src = getConstPointer(0);
         void* dest = daCopy->getVoidPointer(0);
         size_t totalBytes = (getNumberOfTuples() * getNumberOfComponents() * sizeof(T));
         std::memcpy(dest, src, totalBytes);
@@ -1233,6 +1840,31 @@ class DataArray : public IDataArray
         ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Total Elements:</th><td>" << numStr << "</td></tr>";
         numStr = usa.toString(static_cast<qlonglong>(m_Size * sizeof(T)));
         ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Total Memory Required:</th><td>" << numStr << "</td></tr>";
+        // Only statistics that are already cached are shown; building the info string
+        // should never start a pass over a large array.
+        if(m_Statistics.valid && m_StatisticsModificationCount == m_ModificationCount)
+        {
+          QString minStr;
+          QString maxStr;
+          QString meanStr;
+          size_t nanCount = 0;
+          for(size_t i = 0; i < m_Statistics.numComponents; i++)
+          {
+            QString sep = (i < m_Statistics.numComponents - 1) ? QString(", ") : QString("");
+            minStr = minStr + QString::number(m_Statistics.min[i]) + sep;
+            maxStr = maxStr + QString::number(m_Statistics.max[i]) + sep;
+            meanStr = meanStr + QString::number(m_Statistics.mean[i]) + sep;
+            nanCount += m_Statistics.nanCount[i];
+          }
+          ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Min:</th><td>" << minStr << "</td></tr>";
+          ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Max:</th><td>" << maxStr << "</td></tr>";
+          ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">Mean:</th><td>" << meanStr << "</td></tr>";
+          if(nanCount > 0)
+          {
+            numStr = usa.toString(static_cast<qlonglong>(nanCount));
+            ss << "<tr bgcolor=\"#FFFCEA\"><th align=\"right\">NaN Values:</th><td>" << numStr << "</td></tr>";
+          }
+        }
         ss << "</tbody></table>\n";
         ss << "</body></html>";
       }
@@ -1243,6 +1875,94 @@ class DataArray : public IDataArray
       return info;
     }
 
+    /**
+     * @brief Computes the per component statistics in one parallel pass over the data,
+     * plus a second pass for the histogram when numBins is greater than zero. The
+     * result is cached and returned as is until the array is resized, filled, erased
+     * or copied into, or until markModified() is called. Element writes, whether through
+     * setValue() or a raw pointer, do not invalidate the cache on their own.
+     * Asking for a histogram with a different number of bins only redoes the histogram
+     * pass. This is not thread safe on the same array.
+     * @param numBins Number of histogram bins per component, 0 for no histogram
+     * @param forceRecompute Ignore the cached result and read the data again
+     * @return The statistics
+     */
+    virtual ArrayStatistics getStatistics(int numBins = 0, bool forceRecompute = false)
+    {
+      if(numBins < 0)
+      {
+        numBins = 0;
+      }
+      bool current = (!forceRecompute && m_Statistics.valid && m_StatisticsModificationCount == m_ModificationCount);
+      if(current && (numBins == 0 || numBins == m_Statistics.numBins))
+      {
+        return m_Statistics;
+      }
+
+      size_t numTuples = getNumberOfTuples();
+      if(nullptr == m_Array)
+      {
+        numTuples = 0;
+      }
+      bool doParallel = false;
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      // Small arrays are summed faster than a thread pool can be woken up
+      static const size_t k_ParallelStatisticsElements = 64 * 1024;
+      doParallel = (numTuples * m_NumComponents >= k_ParallelStatisticsElements);
+#endif
+
+      if(!current)
+      {
+        ArrayStatisticsImpl<T> moments(m_Array, m_NumComponents);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+        if(doParallel)
+        {
+          tbb::parallel_reduce(tbb::blocked_range<size_t>(0, numTuples), moments, tbb::auto_partitioner());
+        }
+#endif
+        if(!doParallel)
+        {
+          moments.accumulate(0, numTuples);
+        }
+        moments.store(m_Statistics);
+      }
+
+      if(numBins > 0)
+      {
+        ArrayHistogramImpl<T> histogram(m_Array, m_NumComponents, numBins, m_Statistics.min, m_Statistics.max);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+        if(doParallel)
+        {
+          tbb::parallel_reduce(tbb::blocked_range<size_t>(0, numTuples), histogram, tbb::auto_partitioner());
+        }
+#endif
+        if(!doParallel)
+        {
+          histogram.accumulate(0, numTuples);
+        }
+        m_Statistics.histogram = histogram.getCounts();
+        m_Statistics.numBins = numBins;
+      }
+      m_StatisticsModificationCount = m_ModificationCount;
+      return m_Statistics;
+    }
+
+    /**
+     * @brief Returns the modification counter, see IDataArray::getModificationCount()
+     */
+    virtual uint64_t getModificationCount() const
+    {
+      return m_ModificationCount;
+    }
+
+    /**
+     * @brief Bumps the modification counter, see IDataArray::markModified()
+     */
+    virtual void markModified()
+    {
+      m_ModificationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
     /**
      * @brief
      * @param parentId
@@ -1258,7 +1978,22 @@ class DataArray : public IDataArray
       {
         return -1;
       }
-      m_Array = reinterpret_cast<T*>(p->getVoidPointer(0));
+      DataArray<T>* typedArray = dynamic_cast<DataArray<T>*>(p.get());
+      if(nullptr != typedArray && typedArray->m_OwnsData && nullptr == typedArray->m_ExternalBuffer)
+      {
+        // Take the buffer over as it is, it goes back to whichever allocator the reader got it from
+        m_Array = typedArray->m_Array;
+        m_Allocator = typedArray->m_Allocator;
+        typedArray->m_OwnsData = false;
+      }
+      else
+      {
+        // Tell the intermediate DataArray to release ownership of the data as we are going to be responsible
+        // for deleting the memory. Released buffers are always malloc()'ed.
+        p->releaseOwnership();
+        m_Array = reinterpret_cast<T*>(p->getVoidPointer(0));
+        m_Allocator.reset();
+      }
       m_Size = p->getSize();
       m_OwnsData = true;
       m_MaxId = (m_Size == 0) ? 0 : m_Size - 1;
@@ -1267,10 +2002,7 @@ class DataArray : public IDataArray
       m_NumTuples = p->getNumberOfTuples();
       m_CompDims = p->getComponentDimensions();
       m_NumComponents = p->getNumberOfComponents();
-
-      // Tell the intermediate DataArray to release ownership of the data as we are going to be responsible
-      // for deleting the memory
-      p->releaseOwnership();
+      m_ModificationCount++;
       return err;
     }
 
@@ -1279,6 +2011,8 @@ class DataArray : public IDataArray
      */
     virtual void byteSwapElements()
     {
+      detach();
+      markModified();
       char* ptr = (char*)(m_Array);
       char t[8];
       size_t size = getTypeSize();
@@ -1312,6 +2046,7 @@ class DataArray : public IDataArray
     inline T& operator[](size_t i)
     {
       Q_ASSERT(i < m_Size);
+      detach();
       return m_Array[i];
     }
 
@@ -1342,6 +2077,9 @@ class DataArray : public IDataArray
       m_MaxId = (m_Size > 0) ? m_Size - 1 : m_Size;
 
       m_InitValue = static_cast<T>(0);
+      m_Shared = false;
+      m_ModificationCount = 0;
+      m_StatisticsModificationCount = 0;
       //  MUD_FLAP_0 = MUD_FLAP_1 = MUD_FLAP_2 = MUD_FLAP_3 = MUD_FLAP_4 = MUD_FLAP_5 = 0xABABABABABABABABul;
     }
 
@@ -1374,15 +2112,37 @@ class DataArray : public IDataArray
       }
 #endif
 
-#if defined ( AIM_USE_SSE ) && defined ( __SSE2__ )
-      _mm_free( m_buffer );
-#else
-      free(m_Array);
-#endif
+      if(nullptr != m_Allocator)
+      {
+        m_Allocator->deallocate(m_Array);
+      }
+      else
+      {
+        // Memory adopted through WrapPointer()
+        free(m_Array);
+      }
+      m_Allocator.reset();
       m_Array = nullptr;
       m_IsAllocated = false;
     }
 
+    /**
+     * @brief Lets go of the current buffer. The memory is only freed if this array
+     * owns it, or if it was the last array sharing it.
+     */
+    void releaseArray()
+    {
+      if ((nullptr != m_Array) && (true == m_OwnsData))
+      {
+        _deallocate();
+      }
+      dropSharedBuffer();
+      m_ExternalBuffer.reset();
+      m_Allocator.reset();
+      m_Array = nullptr;
+      m_ModificationCount++;
+    }
+
     /**
      * @brief Resizes the internal array
      * @param size The new size of the internal array
@@ -1423,6 +2183,7 @@ class DataArray : public IDataArray
       {
         return m_Array;
       }
+      m_ModificationCount++;
       newSize = size;
       oldSize = m_Size;
 
@@ -1440,12 +2201,15 @@ class DataArray : public IDataArray
       dontUseRealloc = true;
 #endif
 
-      // Allocate a new array if we DO NOT own the current array
-      if ((nullptr != m_Array) && (false == m_OwnsData))
+      DataArrayAllocator::Pointer allocator = m_Allocator;
+
+      // Allocate a new array if we DO NOT have or own the current array
+      if ((nullptr == m_Array) || (false == m_OwnsData))
       {
-        // The old array is owned by the user so we cannot try to
-        // reallocate it.  Just allocate new memory that we will own.
-        newArray = (T*)malloc(newSize * sizeof(T));
+        // The old array is owned by the user or shared with another array so we
+        // cannot try to reallocate it.  Just allocate new memory that we will own.
+        allocator = DataArrayAllocator::Instance();
+        newArray = static_cast<T*>(allocator->allocate(newSize * sizeof(T)));
         if (!newArray)
         {
           qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
@@ -1453,7 +2217,20 @@ class DataArray : public IDataArray
         }
 
         // Copy the data from the old array.
-        std::memcpy(newArray, m_Array, (newSize < m_Size ? newSize : m_Size) * sizeof(T));
+        if (m_Array != nullptr)
+        {
+          std::memcpy(newArray, m_Array, (newSize < m_Size ? newSize : m_Size) * sizeof(T));
+        }
+      }
+      else if (nullptr != allocator)
+      {
+        // Grows and shrinks within the size class of the buffer without copying
+        newArray = static_cast<T*>(allocator->reallocate(m_Array, newSize * sizeof(T)));
+        if (!newArray)
+        {
+          qDebug() << "Unable to allocate " << newSize << " elements of size " << sizeof(T) << " bytes. " ;
+          return nullptr;
+        }
       }
       else if (!dontUseRealloc)
       {
@@ -1486,6 +2263,9 @@ class DataArray : public IDataArray
       // Allocation was successful.  Save it.
       m_Size = newSize;
       m_Array = newArray;
+      m_Allocator = allocator;
+      dropSharedBuffer();
+      m_ExternalBuffer.reset();
 
       // This object has now allocated its memory and owns it.
       m_OwnsData = true;
@@ -1505,6 +2285,92 @@ class DataArray : public IDataArray
 
   private:
 
+    /**
+     * @brief Frees a shared buffer once the last array referencing it goes away, unless
+     * that array reclaimed the buffer as its own.
+     */
+    struct SharedBufferDeleter
+    {
+      bool released = false;
+      DataArrayAllocator::Pointer allocator;
+      void operator()(T* ptr)
+      {
+        if(released) { return; }
+        if(nullptr != allocator) { allocator->deallocate(ptr); }
+        else { free(ptr); }
+      }
+    };
+    typedef std::shared_ptr<T> SharedBufferType;
+
+    /**
+     * @brief Slow path of detach(). The last array holding a shared buffer takes it
+     * back without copying; otherwise the data is copied into a new private buffer.
+     * Every change to who holds a shared buffer happens under CopyOnWriteMutex() so the
+     * holder count is exact here and concurrent callers only copy once.
+     */
+    void detachSharedBuffer()
+    {
+      QMutexLocker lock(&CopyOnWriteMutex());
+      if(!m_Shared.load(std::memory_order_relaxed))
+      {
+        return;
+      }
+      if(m_SharedBuffer.use_count() == 1)
+      {
+        std::get_deleter<SharedBufferDeleter>(m_SharedBuffer)->released = true;
+        m_SharedBuffer.reset();
+        m_OwnsData = true;
+        m_Shared.store(false, std::memory_order_release);
+        return;
+      }
+      DataArrayAllocator::Pointer allocator = DataArrayAllocator::Instance();
+      T* newArray = static_cast<T*>(allocator->allocate(m_Size * sizeof(T)));
+      if (!newArray)
+      {
+        qDebug() << "Unable to allocate " << m_Size << " elements of size " << sizeof(T) << " bytes. " ;
+        return;
+      }
+      std::memcpy(newArray, m_Array, m_Size * sizeof(T));
+      m_SharedBuffer.reset();
+      m_Array = newArray;
+      m_Allocator = allocator;
+      m_OwnsData = true;
+      m_Shared.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Lets go of a shared buffer without touching the data. The deleter frees
+     * it if this was the last array holding it.
+     */
+    void dropSharedBuffer()
+    {
+      if(!m_Shared.load(std::memory_order_acquire))
+      {
+        return;
+      }
+      QMutexLocker lock(&CopyOnWriteMutex());
+      m_SharedBuffer.reset();
+      m_Shared.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Replaces an adopted external buffer with a private copy that this array can free().
+     */
+    void detachExternalBuffer()
+    {
+      DataArrayAllocator::Pointer allocator = DataArrayAllocator::Instance();
+      T* newArray = static_cast<T*>(allocator->allocate(m_Size * sizeof(T)));
+      if (!newArray)
+      {
+        qDebug() << "Unable to allocate " << m_Size << " elements of size " << sizeof(T) << " bytes. " ;
+        return;
+      }
+      std::memcpy(newArray, m_Array, m_Size * sizeof(T));
+      m_ExternalBuffer.reset();
+      m_Array = newArray;
+      m_Allocator = allocator;
+    }
+
     //  unsigned long long int MUD_FLAP_0;
     T* m_Array;
     //  unsigned long long int MUD_FLAP_1;
@@ -1526,6 +2392,16 @@ class DataArray : public IDataArray
 
     T m_InitValue;
 
+    SharedBufferType m_SharedBuffer;
+    std::shared_ptr<void> m_ExternalBuffer;
+    DataArrayAllocator::Pointer m_Allocator;
+
+    std::atomic<bool> m_Shared;
+
+    std::atomic<uint64_t> m_ModificationCount;
+    ArrayStatistics m_Statistics;
+    uint64_t m_StatisticsModificationCount;
+
     DataArray(const DataArray&); //Not Implemented
     void operator=(const DataArray&); //Not Implemented
 
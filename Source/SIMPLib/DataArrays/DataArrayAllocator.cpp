@@ -0,0 +1,637 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DataArrayAllocator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <new>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#endif
+
+const size_t DataArrayAllocator::Alignment = 64;
+const size_t DataArrayAllocator::HugePageSize = 2 * 1024 * 1024;
+
+namespace
+{
+DataArrayAllocator::Pointer s_Instance;
+
+size_t roundUp(size_t value, size_t multiple)
+{
+  return ((value + multiple - 1) / multiple) * multiple;
+}
+
+void updateMaximum(std::atomic<quint64>& maximum, quint64 value)
+{
+  quint64 current = maximum.load(std::memory_order_relaxed);
+  while(current < value && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+  {
+  }
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::DataArrayAllocator()
+#if defined(__linux__)
+: m_HugePageMode(HugePageMode::Transparent)
+#else
+: m_HugePageMode(HugePageMode::None)
+#endif
+, m_HugePageThreshold(2 * HugePageSize)
+, m_PoolThreshold(1024 * 1024)
+, m_PoolCapacity(512 * 1024 * 1024)
+, m_Allocations(0)
+, m_Deallocations(0)
+, m_InPlaceReallocations(0)
+, m_HugePageAllocations(0)
+, m_LiveBuffers(0)
+, m_BytesInUse(0)
+, m_PeakBytesInUse(0)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::~DataArrayAllocator()
+{
+  // Arrays hold a reference to the allocator of their buffer so only pooled blocks are left
+  releaseCachedMemory();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Pointer DataArrayAllocator::Instance()
+{
+  // Called for every new buffer, so this only ever takes the spin lock of the shared_ptr atomics
+  Pointer instance = std::atomic_load(&s_Instance);
+  if(nullptr == instance)
+  {
+    Pointer created = DataArrayAllocator::New();
+    if(std::atomic_compare_exchange_strong(&s_Instance, &instance, created))
+    {
+      instance = created;
+    }
+  }
+  return instance;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::SetInstance(Pointer allocator)
+{
+  std::atomic_store(&s_Instance, allocator);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject DataArrayAllocator::StatisticsToJson(const Statistics& stats)
+{
+  QJsonObject json;
+  json["allocations"] = static_cast<double>(stats.allocations);
+  json["deallocations"] = static_cast<double>(stats.deallocations);
+  json["inPlaceReallocations"] = static_cast<double>(stats.inPlaceReallocations);
+  json["poolHits"] = static_cast<double>(stats.poolHits);
+  json["poolMisses"] = static_cast<double>(stats.poolMisses);
+  json["hugePageAllocations"] = static_cast<double>(stats.hugePageAllocations);
+  json["liveBuffers"] = static_cast<double>(stats.liveBuffers);
+  json["bytesInUse"] = static_cast<double>(stats.bytesInUse);
+  json["peakBytesInUse"] = static_cast<double>(stats.peakBytesInUse);
+  json["pooledBuffers"] = static_cast<double>(stats.pooledBuffers);
+  json["pooledBytes"] = static_cast<double>(stats.pooledBytes);
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataArrayAllocator::SizeClass(size_t bytes)
+{
+  if(bytes <= Alignment)
+  {
+    return Alignment;
+  }
+  // Four classes per power of two waste at most a quarter of a buffer and leave
+  // room for a growing array to be resized in place
+  size_t power = Alignment;
+  while(power <= bytes / 2)
+  {
+    power *= 2;
+  }
+  size_t step = std::max(power / 4, Alignment);
+  return roundUp(bytes, step);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Block* DataArrayAllocator::HeaderOf(void* ptr)
+{
+  return reinterpret_cast<Block*>(static_cast<char*>(ptr) - Alignment);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Block* DataArrayAllocator::findHugeBlock(void* ptr)
+{
+  if(reinterpret_cast<uintptr_t>(ptr) % HugePageSize != 0)
+  {
+    return nullptr;
+  }
+  // Entries are only added and removed by the owner of their buffer, so the
+  // returned entry stays valid after unlocking
+  QMutexLocker lock(&m_Mutex);
+  auto iter = m_HugeBlocks.find(ptr);
+  return (iter != m_HugeBlocks.end()) ? &iter->second : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Block* DataArrayAllocator::blockOf(void* ptr)
+{
+  Block* block = findHugeBlock(ptr);
+  return (nullptr != block) ? block : HeaderOf(ptr);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* DataArrayAllocator::allocate(size_t bytes)
+{
+  if(bytes == 0)
+  {
+    return nullptr;
+  }
+  size_t sizeClass = SizeClass(bytes);
+
+  // Buffers below the pool threshold never touch the mutex
+  void* ptr = nullptr;
+  if(m_PoolCapacity.load(std::memory_order_relaxed) > 0 && sizeClass >= m_PoolThreshold.load(std::memory_order_relaxed))
+  {
+    QMutexLocker lock(&m_Mutex);
+    auto iter = m_Pool.find(sizeClass);
+    if(iter != m_Pool.end() && !iter->second.empty())
+    {
+      ptr = iter->second.back();
+      iter->second.pop_back();
+      m_Statistics.poolHits++;
+      m_Statistics.pooledBuffers--;
+      m_Statistics.pooledBytes -= sizeClass;
+    }
+    else
+    {
+      m_Statistics.poolMisses++;
+    }
+  }
+
+  if(nullptr == ptr)
+  {
+    // Going to the operating system can take a while so this is never done under the mutex
+    ptr = allocateBlock(sizeClass, m_HugePageMode.load(std::memory_order_relaxed), m_HugePageThreshold.load(std::memory_order_relaxed));
+    if(nullptr == ptr)
+    {
+      return nullptr;
+    }
+  }
+
+  Block* block = blockOf(ptr);
+  if(block->hugePages)
+  {
+    m_HugePageAllocations.fetch_add(1, std::memory_order_relaxed);
+  }
+  block->bytes = bytes;
+  m_Allocations.fetch_add(1, std::memory_order_relaxed);
+  m_LiveBuffers.fetch_add(1, std::memory_order_relaxed);
+  quint64 bytesInUse = m_BytesInUse.fetch_add(sizeClass, std::memory_order_relaxed) + sizeClass;
+  updateMaximum(m_PeakBytesInUse, bytesInUse);
+  return ptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* DataArrayAllocator::reallocate(void* ptr, size_t bytes)
+{
+  if(nullptr == ptr)
+  {
+    return allocate(bytes);
+  }
+  if(bytes == 0)
+  {
+    deallocate(ptr);
+    return nullptr;
+  }
+
+  // The block belongs to the caller so its bookkeeping can be changed without the mutex
+  Block* block = blockOf(ptr);
+  // Stay put while the new size still fits and does not leave most of the block unused
+  if(bytes <= block->sizeClass && bytes > block->sizeClass / 2)
+  {
+    block->bytes = bytes;
+    m_InPlaceReallocations.fetch_add(1, std::memory_order_relaxed);
+    return ptr;
+  }
+
+  size_t oldBytes = block->bytes;
+  void* newPtr = allocate(bytes);
+  if(nullptr == newPtr)
+  {
+    return nullptr;
+  }
+  std::memcpy(newPtr, ptr, std::min(oldBytes, bytes));
+  deallocate(ptr);
+  return newPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::deallocate(void* ptr)
+{
+  if(nullptr == ptr)
+  {
+    return;
+  }
+
+  size_t sizeClass = blockOf(ptr)->sizeClass;
+  m_Deallocations.fetch_add(1, std::memory_order_relaxed);
+  m_LiveBuffers.fetch_sub(1, std::memory_order_relaxed);
+  m_BytesInUse.fetch_sub(sizeClass, std::memory_order_relaxed);
+
+  if(sizeClass >= m_PoolThreshold.load(std::memory_order_relaxed) && m_PoolCapacity.load(std::memory_order_relaxed) > 0)
+  {
+    QMutexLocker lock(&m_Mutex);
+    if(m_Statistics.pooledBytes + sizeClass <= m_PoolCapacity.load(std::memory_order_relaxed))
+    {
+      m_Pool[sizeClass].push_back(ptr);
+      m_Statistics.pooledBuffers++;
+      m_Statistics.pooledBytes += sizeClass;
+      return;
+    }
+  }
+  freeBlock(ptr);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* DataArrayAllocator::release(void* ptr)
+{
+  if(nullptr == ptr)
+  {
+    return nullptr;
+  }
+
+  Block* hugeBlock = findHugeBlock(ptr);
+  Block block = (nullptr != hugeBlock) ? *hugeBlock : *HeaderOf(ptr);
+  void* released = nullptr;
+#if defined(_WIN32)
+  bool needsCopy = true;
+#else
+  // posix_memalign() memory can go to free() once the data starts where the block does
+  bool needsCopy = (block.mappedBytes > 0);
+#endif
+  if(needsCopy)
+  {
+    released = malloc(block.bytes);
+    if(nullptr == released)
+    {
+      return nullptr;
+    }
+    std::memcpy(released, ptr, block.bytes);
+  }
+  else if(nullptr != hugeBlock)
+  {
+    // Huge page blocks have no header, so the buffer is handed over without touching it
+    released = ptr;
+    QMutexLocker lock(&m_Mutex);
+    m_HugeBlocks.erase(ptr);
+  }
+  else
+  {
+    // Blocks with a header are below the huge page threshold, which bounds the cost of the move
+    released = HeaderOf(ptr);
+    std::memmove(released, ptr, block.bytes);
+  }
+
+  m_Deallocations.fetch_add(1, std::memory_order_relaxed);
+  m_LiveBuffers.fetch_sub(1, std::memory_order_relaxed);
+  m_BytesInUse.fetch_sub(block.sizeClass, std::memory_order_relaxed);
+  if(needsCopy)
+  {
+    freeBlock(ptr);
+  }
+  return released;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::releaseCachedMemory()
+{
+  std::vector<void*> blocks;
+  {
+    QMutexLocker lock(&m_Mutex);
+    blocks = trimPool(0);
+  }
+  for(void* block : blocks)
+  {
+    freeBlock(block);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::Statistics DataArrayAllocator::getStatistics()
+{
+  Statistics stats;
+  {
+    QMutexLocker lock(&m_Mutex);
+    stats = m_Statistics;
+  }
+  stats.allocations = m_Allocations.load(std::memory_order_relaxed);
+  stats.deallocations = m_Deallocations.load(std::memory_order_relaxed);
+  stats.inPlaceReallocations = m_InPlaceReallocations.load(std::memory_order_relaxed);
+  stats.hugePageAllocations = m_HugePageAllocations.load(std::memory_order_relaxed);
+  stats.liveBuffers = m_LiveBuffers.load(std::memory_order_relaxed);
+  stats.bytesInUse = m_BytesInUse.load(std::memory_order_relaxed);
+  stats.peakBytesInUse = m_PeakBytesInUse.load(std::memory_order_relaxed);
+  return stats;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::setHugePageMode(HugePageMode mode)
+{
+  m_HugePageMode.store(mode, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataArrayAllocator::HugePageMode DataArrayAllocator::getHugePageMode()
+{
+  return m_HugePageMode.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::setHugePageThreshold(size_t bytes)
+{
+  m_HugePageThreshold.store(bytes, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataArrayAllocator::getHugePageThreshold()
+{
+  return m_HugePageThreshold.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::setPoolThreshold(size_t bytes)
+{
+  m_PoolThreshold.store(bytes, std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataArrayAllocator::getPoolThreshold()
+{
+  return m_PoolThreshold.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::setPoolCapacity(size_t bytes)
+{
+  std::vector<void*> blocks;
+  {
+    QMutexLocker lock(&m_Mutex);
+    m_PoolCapacity.store(bytes, std::memory_order_relaxed);
+    blocks = trimPool(bytes);
+  }
+  for(void* block : blocks)
+  {
+    freeBlock(block);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t DataArrayAllocator::getPoolCapacity()
+{
+  return m_PoolCapacity.load(std::memory_order_relaxed);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<void*> DataArrayAllocator::trimPool(size_t capacity)
+{
+  std::vector<void*> blocks;
+  // Largest blocks go first, they are the least likely to be asked for again
+  while(m_Statistics.pooledBytes > capacity && !m_Pool.empty())
+  {
+    auto iter = std::prev(m_Pool.end());
+    while(!iter->second.empty() && m_Statistics.pooledBytes > capacity)
+    {
+      blocks.push_back(iter->second.back());
+      iter->second.pop_back();
+      m_Statistics.pooledBuffers--;
+      m_Statistics.pooledBytes -= iter->first;
+    }
+    if(iter->second.empty())
+    {
+      m_Pool.erase(iter);
+    }
+  }
+  return blocks;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* DataArrayAllocator::allocateBlock(size_t sizeClass, HugePageMode mode, size_t hugePageThreshold)
+{
+  if(mode != HugePageMode::None && sizeClass >= hugePageThreshold)
+  {
+    return allocateHugeBlock(sizeClass, mode);
+  }
+
+  static_assert(sizeof(Block) <= 64, "The block header has to fit in front of an aligned buffer");
+  // The header takes a whole cache line in front of the data so the data stays aligned
+  size_t totalBytes = sizeClass + Alignment;
+  void* base = nullptr;
+#if defined(_WIN32)
+  base = _aligned_malloc(totalBytes, Alignment);
+  if(nullptr == base)
+  {
+    return nullptr;
+  }
+#else
+  if(posix_memalign(&base, Alignment, totalBytes) != 0)
+  {
+    return nullptr;
+  }
+#endif
+
+  Block* block = new(base) Block();
+  block->sizeClass = sizeClass;
+  return static_cast<char*>(base) + Alignment;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void* DataArrayAllocator::allocateHugeBlock(size_t sizeClass, HugePageMode mode)
+{
+  // Without a header the buffer starts on a huge page boundary, so every whole huge
+  // page of it can be backed by one and a whole number of huge pages maps exactly
+  Block block;
+  block.sizeClass = sizeClass;
+  void* base = nullptr;
+
+#if defined(_WIN32)
+  // Large pages need the SeLockMemoryPrivilege on Windows so only the alignment is honored
+  (void)mode;
+  base = _aligned_malloc(sizeClass, HugePageSize);
+  if(nullptr == base)
+  {
+    return nullptr;
+  }
+#else
+#if defined(MAP_HUGETLB)
+  if(mode == HugePageMode::Explicit)
+  {
+    size_t bytes = roundUp(sizeClass, HugePageSize);
+    void* mapped = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if(mapped != MAP_FAILED)
+    {
+      base = mapped;
+      block.mappedBytes = bytes;
+      block.hugePages = true;
+    }
+    // Otherwise the reserved huge page pool is exhausted or not configured
+  }
+#endif
+
+  if(nullptr == base)
+  {
+    if(posix_memalign(&base, HugePageSize, sizeClass) != 0)
+    {
+      return nullptr;
+    }
+#if defined(MADV_HUGEPAGE)
+    // Only whole huge pages can be backed by one, the tail stays on regular pages
+    size_t hugeBytes = (sizeClass / HugePageSize) * HugePageSize;
+    block.hugePages = (hugeBytes > 0 && madvise(base, hugeBytes, MADV_HUGEPAGE) == 0);
+#endif
+  }
+#endif
+
+  QMutexLocker lock(&m_Mutex);
+  m_HugeBlocks[base] = block;
+  return base;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataArrayAllocator::freeBlock(void* ptr)
+{
+  if(reinterpret_cast<uintptr_t>(ptr) % HugePageSize == 0)
+  {
+    Block hugeBlock;
+    bool found = false;
+    {
+      // The entry goes before the memory does so a new block at the same address can be recorded
+      QMutexLocker lock(&m_Mutex);
+      auto iter = m_HugeBlocks.find(ptr);
+      if(iter != m_HugeBlocks.end())
+      {
+        hugeBlock = iter->second;
+        m_HugeBlocks.erase(iter);
+        found = true;
+      }
+    }
+    if(found)
+    {
+#if defined(_WIN32)
+      _aligned_free(ptr);
+#else
+      if(hugeBlock.mappedBytes > 0)
+      {
+        munmap(ptr, hugeBlock.mappedBytes);
+      }
+      else
+      {
+        free(ptr);
+      }
+#endif
+      return;
+    }
+  }
+
+  Block* block = HeaderOf(ptr);
+#if defined(_WIN32)
+  _aligned_free(block);
+#else
+  free(block);
+#endif
+}
@@ -0,0 +1,294 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _dataarrayallocator_h_
+#define _dataarrayallocator_h_
+
+#include <atomic>
+#include <map>
+#include <vector>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutex>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+
+/**
+ * @brief The DataArrayAllocator class provides the memory behind every DataArray buffer.
+ * Buffers are aligned to a cache line, large buffers are placed on huge pages and
+ * freed buffers above the pool threshold are kept in size classes so the next filter
+ * that needs an array of about the same size gets them back without a round trip to
+ * the operating system. Allocation never touches the pages, so the threads that
+ * initialize or first write an array decide which NUMA node its memory lives on.
+ *
+ * The allocator used for new buffers can be replaced with SetInstance(). Every array
+ * remembers the allocator its buffer came from, so replacing it at run time is safe.
+ *
+ * Blocks below the huge page threshold keep their size in a header one cache line in
+ * front of the buffer, so small buffers are allocated and freed without taking a lock.
+ * Huge page blocks keep it in a table guarded by the mutex instead so that their buffer
+ * starts on a huge page boundary. Only pooled and huge page blocks go through the mutex.
+ */
+class SIMPLib_EXPORT DataArrayAllocator
+{
+  public:
+    SIMPL_SHARED_POINTERS(DataArrayAllocator)
+    SIMPL_STATIC_NEW_MACRO(DataArrayAllocator)
+    SIMPL_TYPE_MACRO(DataArrayAllocator)
+
+    virtual ~DataArrayAllocator();
+
+    /**
+     * @brief Alignment of every buffer in bytes (one cache line). Buffers placed on huge
+     * pages start on a huge page boundary.
+     */
+    static const size_t Alignment;
+
+    /**
+     * @brief Size of a huge page in bytes
+     */
+    static const size_t HugePageSize;
+
+    /**
+     * @brief How buffers above the huge page threshold are placed on huge pages
+     */
+    enum class HugePageMode : unsigned int
+    {
+      None = 0,        //!< Regular pages only
+      Transparent = 1, //!< Align to a huge page and ask the kernel for transparent huge pages
+      Explicit = 2     //!< Map from the reserved huge page pool, falling back to Transparent
+    };
+
+    /**
+     * @brief Counters describing the activity of an allocator
+     */
+    struct Statistics
+    {
+      quint64 allocations = 0;
+      quint64 deallocations = 0;
+      quint64 inPlaceReallocations = 0;
+      quint64 poolHits = 0;
+      quint64 poolMisses = 0;
+      quint64 hugePageAllocations = 0;
+      quint64 liveBuffers = 0;
+      quint64 bytesInUse = 0;
+      quint64 peakBytesInUse = 0;
+      quint64 pooledBuffers = 0;
+      quint64 pooledBytes = 0;
+    };
+
+    /**
+     * @brief Returns the allocator used for new DataArray buffers
+     */
+    static Pointer Instance();
+
+    /**
+     * @brief Replaces the allocator used for new DataArray buffers. Passing a null
+     * pointer restores a default allocator.
+     * @param allocator
+     */
+    static void SetInstance(Pointer allocator);
+
+    /**
+     * @brief Converts a set of statistics to JSON
+     * @param stats
+     * @return
+     */
+    static QJsonObject StatisticsToJson(const Statistics& stats);
+
+    /**
+     * @brief Returns an aligned buffer of at least bytes bytes, or nullptr on failure.
+     * The contents are undefined.
+     * @param bytes
+     * @return
+     */
+    virtual void* allocate(size_t bytes);
+
+    /**
+     * @brief Resizes a buffer returned by allocate(), keeping its contents up to the
+     * smaller of the two sizes. The buffer is resized in place when it still fits its
+     * size class. On failure nullptr is returned and the old buffer is left untouched.
+     * @param ptr
+     * @param bytes
+     * @return
+     */
+    virtual void* reallocate(void* ptr, size_t bytes);
+
+    /**
+     * @brief Returns a buffer to the allocator. The buffer must have been returned by
+     * allocate() or reallocate() of this allocator.
+     * @param ptr
+     */
+    virtual void deallocate(void* ptr);
+
+    /**
+     * @brief Hands a buffer returned by allocate() over to the caller. The allocator stops
+     * tracking it and returns memory holding the same bytes that the caller must give back
+     * with free(). Transparent huge page blocks start where their memory does and are
+     * handed over as they are. Blocks with a header have their data moved over the header,
+     * which is a pass over the whole buffer, and blocks free() can not take (huge page
+     * mappings, Windows aligned blocks) are copied into malloc()'ed memory. Returns
+     * nullptr, leaving the buffer with the allocator, if that copy can not be made.
+     * @param ptr
+     * @return
+     */
+    virtual void* release(void* ptr);
+
+    /**
+     * @brief Gives every pooled buffer back to the operating system
+     */
+    virtual void releaseCachedMemory();
+
+    /**
+     * @brief Returns a snapshot of the allocation counters
+     */
+    virtual Statistics getStatistics();
+
+    /**
+     * @brief Sets how large buffers are placed on huge pages
+     * @param mode
+     */
+    void setHugePageMode(HugePageMode mode);
+    HugePageMode getHugePageMode();
+
+    /**
+     * @brief Sets the size in bytes from which buffers are placed on huge pages
+     * @param bytes
+     */
+    void setHugePageThreshold(size_t bytes);
+    size_t getHugePageThreshold();
+
+    /**
+     * @brief Sets the size in bytes from which freed buffers are kept for reuse
+     * @param bytes
+     */
+    void setPoolThreshold(size_t bytes);
+    size_t getPoolThreshold();
+
+    /**
+     * @brief Sets the maximum number of bytes kept in the pool. Zero disables pooling
+     * and releases the buffers currently pooled.
+     * @param bytes
+     */
+    void setPoolCapacity(size_t bytes);
+    size_t getPoolCapacity();
+
+    /**
+     * @brief Returns the number of bytes actually reserved for a request of bytes
+     * bytes. Sizes are rounded up to one of four classes per power of two.
+     * @param bytes
+     * @return
+     */
+    static size_t SizeClass(size_t bytes);
+
+  protected:
+    DataArrayAllocator();
+
+  private:
+    /**
+     * @brief Bookkeeping of a block, stored one cache line in front of the buffer or in
+     * m_HugeBlocks for huge page blocks
+     */
+    struct Block
+    {
+      size_t bytes = 0;
+      size_t sizeClass = 0;
+      size_t mappedBytes = 0;
+      bool hugePages = false;
+    };
+
+    /**
+     * @brief Returns the header in front of a buffer that is not a huge page block
+     */
+    static Block* HeaderOf(void* ptr);
+
+    /**
+     * @brief Returns the entry of a huge page block in m_HugeBlocks or nullptr for a block
+     * with a header. Only buffers on a huge page boundary are looked up, so small buffers
+     * never take the mutex.
+     */
+    Block* findHugeBlock(void* ptr);
+
+    /**
+     * @brief Returns the bookkeeping of a buffer returned by allocate()
+     */
+    Block* blockOf(void* ptr);
+
+    /**
+     * @brief Gets a new block of sizeClass bytes from the operating system and returns its
+     * buffer. Blocks below the huge page threshold get a header in front of the buffer.
+     */
+    void* allocateBlock(size_t sizeClass, HugePageMode mode, size_t hugePageThreshold);
+
+    /**
+     * @brief Gets a new block of sizeClass bytes on huge pages and records it in m_HugeBlocks
+     */
+    void* allocateHugeBlock(size_t sizeClass, HugePageMode mode);
+
+    /**
+     * @brief Gives a block back to the operating system
+     */
+    void freeBlock(void* ptr);
+
+    /**
+     * @brief Drops pooled blocks until at most capacity bytes are pooled. Called with
+     * the mutex held, returns the blocks that have to be freed after unlocking.
+     */
+    std::vector<void*> trimPool(size_t capacity);
+
+    QMutex m_Mutex;
+    std::atomic<HugePageMode> m_HugePageMode;
+    std::atomic<size_t> m_HugePageThreshold;
+    std::atomic<size_t> m_PoolThreshold;
+    std::atomic<size_t> m_PoolCapacity;
+    // Guarded by m_Mutex, only the pool counters of m_Statistics are used
+    std::map<size_t, std::vector<void*>> m_Pool;
+    std::map<void*, Block> m_HugeBlocks;
+    Statistics m_Statistics;
+    // Updated without the mutex
+    std::atomic<quint64> m_Allocations;
+    std::atomic<quint64> m_Deallocations;
+    std::atomic<quint64> m_InPlaceReallocations;
+    std::atomic<quint64> m_HugePageAllocations;
+    std::atomic<quint64> m_LiveBuffers;
+    std::atomic<quint64> m_BytesInUse;
+    std::atomic<quint64> m_PeakBytesInUse;
+
+    DataArrayAllocator(const DataArrayAllocator&) = delete; // Copy Constructor Not Implemented
+    void operator=(const DataArrayAllocator&) = delete;     // Move assignment Not Implemented
+};
+
+#endif /* _dataarrayallocator_h_ */
@@ -30,3 +30,70 @@ bool IDataArray::copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourc
 {
   return copyFromArray(destTupleOffset, sourceArray, 0, sourceArray->getNumberOfTuples());
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IDataArray::compactTuples(const TupleCompactionMap& map)
+{
+  if(map.getNumberOfTuples() != getNumberOfTuples())
+  {
+    return -100;
+  }
+  if(map.getNumberOfRemovedTuples() == 0)
+  {
+    return 0;
+  }
+  QVector<size_t> idxs = map.getRemovedTuples();
+  return eraseTuples(idxs);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ArrayStatistics IDataArray::getStatistics(int numBins, bool forceRecompute)
+{
+  Q_UNUSED(numBins)
+  Q_UNUSED(forceRecompute)
+  return ArrayStatistics();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t IDataArray::getModificationCount() const
+{
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IDataArray::markModified()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const void* IDataArray::getConstVoidPointer(size_t i) const
+{
+  return const_cast<IDataArray*>(this)->getVoidPointer(i);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer IDataArray::shallowCopyArray()
+{
+  return deepCopy(false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QMutex& IDataArray::CopyOnWriteMutex()
+{
+  static QMutex mutex;
+  return mutex;
+}
@@ -18,6 +18,7 @@
 #include <hdf5.h>
 
 //--Qt Includes
+#include <QtCore/QMutex>
 #include <QtCore/QString>
 #include <QtCore/QtDebug>
 
@@ -25,6 +26,8 @@
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/ArrayStatistics.h"
+#include "SIMPLib/DataArrays/TupleCompactionMap.h"
 
 
 /**
@@ -108,6 +111,16 @@ class SIMPLib_EXPORT IDataArray
      */
     virtual void* getVoidPointer ( size_t i) = 0;
 
+    /**
+     * @brief Returns a read only void pointer to the index of the array. Arrays that
+     * share their buffer with a shallow copy hand this out without detaching, so
+     * generic code that only reads should prefer it over getVoidPointer(). The default
+     * implementation calls getVoidPointer().
+     * @param i The index to have the returned pointer pointing to.
+     * @return Void Pointer. Possibly nullptr.
+     */
+    virtual const void* getConstVoidPointer(size_t i) const;
+
     /**
     * @brief Returns the number of Tuples in the array.
     */
@@ -147,6 +160,15 @@ class SIMPLib_EXPORT IDataArray
      */
     virtual int eraseTuples(QVector<size_t>& idxs) = 0;
 
+    /**
+     * @brief Removes every tuple that the map does not keep in a single pass. The default
+     * implementation falls back to eraseTuples(); subclasses override it to move the
+     * runs of kept tuples directly.
+     * @param map The compaction map, which must have been built for this number of tuples
+     * @return error code.
+     */
+    virtual int compactTuples(const TupleCompactionMap& map);
+
     /**
      * @brief Copies a Tuple from one position to another.
      * @param currentPos The index of the source data
@@ -248,6 +270,15 @@ class SIMPLib_EXPORT IDataArray
      */
     virtual IDataArray::Pointer deepCopy(bool forceNoAllocate = false) = 0;
 
+    /**
+     * @brief shallowCopyArray Creates a copy that shares its data with this array until
+     * either of them is written to. This is what AttributeMatrix::deepCopy() uses, so
+     * copying a DataContainer does not duplicate any data up front. The default
+     * implementation returns deepCopy().
+     * @return
+     */
+    virtual IDataArray::Pointer shallowCopyArray();
+
     /**
      * @brief writeH5Data
      * @param parentId
@@ -287,7 +318,43 @@ class SIMPLib_EXPORT IDataArray
      */
     virtual QString getInfoString(SIMPL::InfoStringFormat format) = 0;
 
+    /**
+     * @brief Returns the per component min, max, mean, variance, NaN count and,
+     * if numBins is greater than zero, histogram of the array. Arrays cache the result
+     * until getModificationCount() changes, so asking again is cheap. Element writes,
+     * including writes through getPointer(), do not change the counter: code that writes
+     * an array element by element must call markModified() when it is done. Readers that
+     * can not rule out such writes, such as a filter reading an array an unknown earlier
+     * filter wrote, should pass forceRecompute. The default implementation returns an
+     * invalid result for arrays that have no numeric values.
+     * @param numBins Number of histogram bins per component, 0 for no histogram
+     * @param forceRecompute Ignore any cached result and read the data again
+     * @return The statistics; ArrayStatistics::valid is false if they could not be computed
+     */
+    virtual ArrayStatistics getStatistics(int numBins = 0, bool forceRecompute = false);
+
+    /**
+     * @brief Returns a counter that changes every time the array is resized, erased,
+     * filled, copied into or read from a file, and every time markModified() is called.
+     * Callers can compare two values to find out whether anything derived from the data
+     * is still current.
+     */
+    virtual uint64_t getModificationCount() const;
+
+    /**
+     * @brief Tells the array its values were changed behind its back, for example
+     * through a pointer returned by getVoidPointer(). Anything cached from the data,
+     * such as getStatistics(), is computed again on the next request. The default
+     * implementation does nothing.
+     */
+    virtual void markModified();
+
   protected:
+    /**
+     * @brief Serializes copy-on-write bookkeeping between arrays that share a buffer
+     * through shallowCopyArray(). It is only taken while a buffer is actually shared.
+     */
+    static QMutex& CopyOnWriteMutex();
 
   private:
     IDataArray (const IDataArray&);    //Not Implemented
@@ -37,6 +37,8 @@
 #ifndef _NEIGHBORLIST_H_
 #define _NEIGHBORLIST_H_
 
+#include <algorithm>
+#include <atomic>
 #include <vector>
 
 #include <QtCore/QString>
@@ -58,6 +60,16 @@
 /**
  * @class NeighborList NeighborList.hpp DREAM3DLib/Common/NeighborList.hpp
  * @brief Template class for wrapping raw arrays of data.
+ *
+ * deepCopy() duplicates every list. shallowCopy() instead shares the individual lists
+ * with the copy and a list is only duplicated when one of the two arrays asks for
+ * mutable access to it (addEntry, getListReference, getList or operator[]) while the
+ * other still references it; use getConstListReference(), getValue() or copyOfList()
+ * to read without triggering that copy. Lists that are shared on purpose, either
+ * handed in through setList() or handed out through getList(), are always written in
+ * place and shallowCopy() duplicates them up front. shallowCopy() never modifies the
+ * array it copies from. Different lists may be detached from different threads at the
+ * same time.
  * @author mjackson
  * @date July 3, 2008
  * @version 1.0
@@ -381,11 +393,60 @@ class NeighborList : public IDataArray
           if (idxsIndex == idxsSize ) { idxsIndex--;}
         }
       }
+      std::vector<uint8_t> adopted(arraySize - idxsSize, 0);
+      idxsIndex = 0;
+      rIdx = 0;
+      for(size_t dIdx = 0; dIdx < arraySize; ++dIdx)
+      {
+        if (dIdx != idxs[idxsIndex])
+        {
+          adopted[rIdx] = m_Adopted[dIdx];
+          ++rIdx;
+        }
+        else
+        {
+          ++idxsIndex;
+          if (idxsIndex == idxsSize ) { idxsIndex--;}
+        }
+      }
+      m_Adopted.swap(adopted);
       m_Array = replacement;
       m_NumTuples = m_Array.size();
       return err;
     }
 
+    /**
+     * @brief Removes every list the map does not keep by moving the list pointers of
+     * each run of kept lists to the front. The lists themselves are not copied.
+     * @param map The compaction map
+     * @return error code.
+     */
+    virtual int compactTuples(const TupleCompactionMap& map)
+    {
+      if(map.getNumberOfTuples() != m_Array.size()) { return -100; }
+      size_t newNumTuples = map.getNumberOfKeptTuples();
+      if(newNumTuples == m_Array.size()) { return 0; }
+
+      const std::vector<TupleCompactionMap::Run>& runs = map.getRuns();
+      for(size_t i = 0; i < runs.size(); i++)
+      {
+        const TupleCompactionMap::Run& run = runs[i];
+        for(size_t t = 0; t < run.count; t++)
+        {
+          if(run.source != run.dest)
+          {
+            m_Array[run.dest + t].swap(m_Array[run.source + t]);
+          }
+          m_Adopted[run.dest + t] = m_Adopted[run.source + t];
+        }
+      }
+      m_Array.resize(newNumTuples);
+      m_Adopted.resize(newNumTuples);
+      m_NumTuples = newNumTuples;
+      if(newNumTuples == 0) { m_IsAllocated = false; }
+      return 0;
+    }
+
     /**
      * @brief copyTuple
      * @param currentPos
@@ -395,6 +456,7 @@ class NeighborList : public IDataArray
     virtual int copyTuple(size_t currentPos, size_t newPos)
     {
       m_Array[newPos] = m_Array[currentPos];
+      m_Adopted[newPos] = m_Adopted[currentPos];
       return 0;
     }
 
@@ -445,7 +507,7 @@ class NeighborList : public IDataArray
 
       for(size_t i = srcTupleOffset; i < srcTupleOffset + totalSrcTuples; i++)
       {
-        m_Array[destTupleOffset + i] = source->getList(i);
+        setList(static_cast<int>(destTupleOffset + i), source->getList(i));
       }
       return true;
 
@@ -550,6 +612,7 @@ class NeighborList : public IDataArray
      */
     void initializeWithZeros() {
       m_Array.clear();
+      m_Adopted.clear();
       m_IsAllocated = false;
     }
 
@@ -563,7 +626,7 @@ class NeighborList : public IDataArray
 
       if(forceNoAllocate == false)
       {
-        size_t count = (m_IsAllocated ? getNumberOfTuples(): 0);
+        size_t count = (m_IsAllocated ? std::min(getNumberOfTuples(), m_Array.size()) : 0);
         for(size_t i = 0; i < count; i++)
         {
           typename NeighborList<T>::SharedVectorType sharedNeiLst(new std::vector<T>(*(m_Array[i])));
@@ -573,6 +636,40 @@ class NeighborList : public IDataArray
       return daCopyPtr;
     }
 
+    /**
+     * @brief shallowCopy Creates a copy that references the same lists as this array.
+     * A list is duplicated the first time either array asks for mutable access to it
+     * while the other one still references it. Lists this array writes in place (see
+     * setList() and getList()) are duplicated right away.
+     * @return
+     */
+    Pointer shallowCopy()
+    {
+      size_t count = m_IsAllocated ? std::min(getNumberOfTuples(), m_Array.size()) : 0;
+      typename NeighborList<T>::Pointer daCopyPtr = NeighborList<T>::CreateArray(getNumberOfTuples(), getName(), m_IsAllocated && count == 0);
+
+      if(count > 0)
+      {
+        daCopyPtr->m_Array.resize(count);
+        daCopyPtr->m_Adopted.assign(count, 0);
+        for(size_t i = 0; i < count; i++)
+        {
+          daCopyPtr->m_Array[i] = (m_Adopted[i] != 0) ? SharedVectorType(new VectorType(*(m_Array[i]))) : m_Array[i];
+        }
+        daCopyPtr->resize(getNumberOfTuples());
+      }
+      return daCopyPtr;
+    }
+
+    /**
+     * @brief shallowCopyArray Reimplemented from IDataArray, see shallowCopy()
+     * @return
+     */
+    IDataArray::Pointer shallowCopyArray()
+    {
+      return shallowCopy();
+    }
+
     /**
      * @brief resizeTotalElements
      * @param size
@@ -583,6 +680,7 @@ class NeighborList : public IDataArray
       //std::cout << "NeighborList::resizeTotalElements(" << size << ")" << std::endl;
       size_t old = m_Array.size();
       m_Array.resize(size);
+      m_Adopted.resize(size, 0);
       m_NumTuples = size;
       if (size == 0) { m_IsAllocated = false; }
       else { m_IsAllocated = true; }
@@ -847,6 +945,7 @@ class NeighborList : public IDataArray
       }
       // Loop over all the entries and make new Vectors to hold the incoming data
       m_Array.resize(numNeighbors.size());
+      m_Adopted.assign(numNeighbors.size(), 0);
       m_IsAllocated = true;
       size_t currentStart = 0;
       qint32 count = static_cast<qint32>(numNeighbors.size());
@@ -883,6 +982,7 @@ class NeighborList : public IDataArray
       {
         size_t old = m_Array.size();
         m_Array.resize(grainId + 1);
+        m_Adopted.resize(grainId + 1, 0);
         m_IsAllocated = true;
         // Initialize with zero length Vectors
         for(size_t i = old; i < m_Array.size(); ++i)
@@ -890,6 +990,7 @@ class NeighborList : public IDataArray
           m_Array[i] = SharedVectorType(new VectorType);
         }
       }
+      detachList(grainId);
       m_Array[grainId]->push_back(value);
       m_NumTuples = m_Array.size();
     }
@@ -900,6 +1001,7 @@ class NeighborList : public IDataArray
     void clearAllLists()
     {
       m_Array.clear();
+      m_Adopted.clear();
       m_IsAllocated = false;
     }
 
@@ -915,6 +1017,7 @@ class NeighborList : public IDataArray
       {
         size_t old = m_Array.size();
         m_Array.resize(grainId + 1);
+        m_Adopted.resize(grainId + 1, 0);
         m_IsAllocated = true;
         // Initialize with zero length Vectors
         for(size_t i = old; i < m_Array.size(); ++i)
@@ -923,6 +1026,7 @@ class NeighborList : public IDataArray
         }
       }
       m_Array[grainId] = neighborList;
+      m_Adopted[grainId] = 1;
     }
 
     /**
@@ -972,6 +1076,21 @@ class NeighborList : public IDataArray
     {
 #ifndef NDEBUG
       if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
+#endif
+      detachList(grainId);
+      return *(m_Array[grainId]);
+    }
+
+    /**
+     * @brief getConstListReference Read only access to a list that never copies a list
+     * shared with another array.
+     * @param grainId
+     * @return
+     */
+    const VectorType& getConstListReference(int grainId) const
+    {
+#ifndef NDEBUG
+      if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
 #endif
       return *(m_Array[grainId]);
     }
@@ -986,6 +1105,9 @@ class NeighborList : public IDataArray
 #ifndef NDEBUG
       if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
 #endif
+      detachList(grainId);
+      // The caller now holds a reference to the list, so it is written in place from now on
+      m_Adopted[grainId] = 1;
       return m_Array[grainId];
     }
 
@@ -1014,6 +1136,7 @@ class NeighborList : public IDataArray
 #ifndef NDEBUG
       if (m_Array.size() > 0u) { Q_ASSERT(grainId < static_cast<int>(m_Array.size()));}
 #endif
+      detachList(grainId);
       return *(m_Array[grainId]);
     }
 
@@ -1027,6 +1150,7 @@ class NeighborList : public IDataArray
 #ifndef NDEBUG
       if (m_Array.size() > 0ul) { Q_ASSERT(grainId < m_Array.size());}
 #endif
+      detachList(grainId);
       return *(m_Array[grainId]);
 
     }
@@ -1044,7 +1168,32 @@ class NeighborList : public IDataArray
     {    }
 
   private:
+    /**
+     * @brief detachList Gives this array a private copy of a list that is still referenced
+     * by another NeighborList. Lists handed in through setList() or out through getList()
+     * are never copied.
+     * @param grainId
+     */
+    inline void detachList(size_t grainId)
+    {
+      if(m_Adopted[grainId] != 0)
+      {
+        return;
+      }
+      if(m_Array[grainId].use_count() > 1)
+      {
+        m_Array[grainId] = SharedVectorType(new VectorType(*(m_Array[grainId])));
+      }
+      else
+      {
+        // Another array may have let go of the list from a different thread; make its
+        // reads of the list visible before this one starts writing to it
+        std::atomic_thread_fence(std::memory_order_acquire);
+      }
+    }
+
     std::vector<SharedVectorType> m_Array;
+    std::vector<uint8_t> m_Adopted; //!< 1 for lists that are shared on purpose and always written in place
     QString m_Name;
     size_t m_NumTuples;
     bool m_IsAllocated;
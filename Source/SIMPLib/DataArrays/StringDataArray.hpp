@@ -42,6 +42,7 @@
 
 
 #include <QtCore/QString>
+#include <QtCore/QVector>
 
 #include "H5Support/H5Lite.h"
 
@@ -54,6 +55,9 @@
  * @class StringDataArray StringDataArray.h DREAM3DLib/Common/StringDataArray.h
  * @brief Stores an array of QString objects
  *
+ * Like DataArray, deepCopy() duplicates the strings while shallowCopy() shares the
+ * implicitly shared QVector, which is copied the first time either array is modified.
+ *
  * @date Nov 13, 2012
  * @version 1.0
  */
@@ -318,8 +322,9 @@ class StringDataArray : public IDataArray
 
 
       // Create a new Array to copy into
-      std::vector<QString> newArray;
-      std::vector<size_t>::size_type start = 0;
+      QVector<QString> newArray;
+      newArray.reserve(m_Array.size() - idxs.size());
+      QVector<size_t>::size_type start = 0;
       for(QVector<QString>::size_type i = 0; i < m_Array.size(); ++i)
       {
         bool keep = true;
@@ -329,13 +334,40 @@ class StringDataArray : public IDataArray
         }
         if (keep)
         {
-          newArray.push_back(m_Array[i]);
+          newArray.push_back(m_Array.at(i));
         }
       }
       m_Array = newArray;
       return err;
     }
 
+    /**
+     * @brief Removes every string the map does not keep in a single pass
+     * @param map The compaction map
+     * @return error code.
+     */
+    virtual int compactTuples(const TupleCompactionMap& map)
+    {
+      if(map.getNumberOfTuples() != static_cast<size_t>(m_Array.size())) { return -100; }
+      size_t newNumTuples = map.getNumberOfKeptTuples();
+      if(newNumTuples == static_cast<size_t>(m_Array.size())) { return 0; }
+
+      const std::vector<TupleCompactionMap::Run>& runs = map.getRuns();
+      for(size_t i = 0; i < runs.size(); i++)
+      {
+        const TupleCompactionMap::Run& run = runs[i];
+        for(size_t t = 0; t < run.count; t++)
+        {
+          if(run.source != run.dest)
+          {
+            m_Array[static_cast<int>(run.dest + t)].swap(m_Array[static_cast<int>(run.source + t)]);
+          }
+        }
+      }
+      m_Array.resize(static_cast<int>(newNumTuples));
+      return 0;
+    }
+
     /**
      * @brief Copies a Tuple from one position to another.
      * @param currentPos The index of the source data
@@ -344,8 +376,8 @@ class StringDataArray : public IDataArray
      */
     virtual int copyTuple(size_t currentPos, size_t newPos)
     {
-      if(currentPos >= m_Array.size()) { return -1; }
-      if(newPos >= m_Array.size()) { return -1; }
+      if(currentPos >= static_cast<size_t>(m_Array.size())) { return -1; }
+      if(newPos >= static_cast<size_t>(m_Array.size())) { return -1; }
      // QString s = m_Array[currentPos];
       m_Array[newPos] = m_Array[currentPos];
       return 0;
@@ -376,7 +408,7 @@ class StringDataArray : public IDataArray
      */
     bool copyFromArray(size_t destTupleOffset, IDataArray::Pointer sourceArray, size_t srcTupleOffset, size_t totalSrcTuples)
     {
-      if(destTupleOffset >= m_Array.size()) { return false; }
+      if(destTupleOffset >= static_cast<size_t>(m_Array.size())) { return false; }
       if(!sourceArray->isAllocated()) { return false; }
 
       Self* source = dynamic_cast<Self*>(sourceArray.get());
@@ -385,7 +417,7 @@ class StringDataArray : public IDataArray
       {
         return false;
       }
-      if(totalSrcTuples + destTupleOffset > m_Array.size())
+      if(totalSrcTuples + destTupleOffset > static_cast<size_t>(m_Array.size()))
       {
         return false;
       }
@@ -413,7 +445,7 @@ class StringDataArray : public IDataArray
      */
     virtual void initializeWithZeros()
     {
-      m_Array.assign(m_Array.size(), QString(""));
+      m_Array.fill(QString(""));
     }
 
     /**
@@ -422,7 +454,7 @@ class StringDataArray : public IDataArray
      */
     virtual void initializeWithValue(QString value)
     {
-      m_Array.assign(m_Array.size(), value);
+      m_Array.fill(value);
     }
 
     /**
@@ -431,7 +463,7 @@ class StringDataArray : public IDataArray
      */
     virtual void initializeWithValue(const std::string& value)
     {
-      m_Array.assign(m_Array.size(), QString::fromStdString(value));
+      m_Array.fill(QString::fromStdString(value));
     }
 
     /**
@@ -442,16 +474,38 @@ class StringDataArray : public IDataArray
     virtual IDataArray::Pointer deepCopy(bool forceNoAllocate = false)
     {
       StringDataArray::Pointer daCopy = StringDataArray::CreateArray(getNumberOfTuples(), getName());
-      if(forceNoAllocate == false)
+      if(forceNoAllocate == false && nullptr != daCopy.get())
       {
-        for(std::vector<QString>::size_type i = 0; i < m_Array.size(); ++i)
-        {
-          daCopy->setValue(i, m_Array[i]);
-        }
+        daCopy->m_Array = m_Array;
+        daCopy->m_Array.detach();
       }
       return daCopy;
     }
 
+    /**
+     * @brief shallowCopy Creates a copy that shares the strings with this array until
+     * either of them is modified.
+     * @return
+     */
+    Pointer shallowCopy()
+    {
+      StringDataArray::Pointer daCopy = StringDataArray::CreateArray(getNumberOfTuples(), getName());
+      if(nullptr != daCopy.get())
+      {
+        daCopy->m_Array = m_Array;
+      }
+      return daCopy;
+    }
+
+    /**
+     * @brief shallowCopyArray Reimplemented from IDataArray, see shallowCopy()
+     * @return
+     */
+    virtual IDataArray::Pointer shallowCopyArray()
+    {
+      return shallowCopy();
+    }
+
 
     /**
      * @brief Reseizes the internal array
@@ -495,7 +549,7 @@ class StringDataArray : public IDataArray
      */
     virtual void printTuple(QTextStream& out, size_t i, char delimiter = ',')
     {
-      out << m_Array[i];
+      out << m_Array.at(i);
     }
 
     /**
@@ -506,7 +560,7 @@ class StringDataArray : public IDataArray
      */
     virtual void printComponent(QTextStream& out, size_t i, int j)
     {
-      out << m_Array[i];
+      out << m_Array.at(i);
     }
 
     /**
@@ -589,7 +643,7 @@ class StringDataArray : public IDataArray
       err = H5Lite::readVectorOfStringDataset(parentId, getName().toStdString(), strings);
 
       m_Array.resize(strings.size());
-      for(std::vector<QString>::size_type i = 0; i < strings.size(); i++)
+      for(std::vector<std::string>::size_type i = 0; i < strings.size(); i++)
       {
         m_Array[i] = QString::fromStdString(strings[i]);
       }
@@ -648,7 +702,7 @@ class StringDataArray : public IDataArray
   private:
     QString m_Name;
     QString m_InitValue;
-    std::vector<QString> m_Array;
+    QVector<QString> m_Array;
     bool _ownsData;
 
     StringDataArray(const StringDataArray&); //Not Implemented
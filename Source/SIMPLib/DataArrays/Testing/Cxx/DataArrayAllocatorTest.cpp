@@ -0,0 +1,406 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/DataArrayAllocator.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+/**
+ * @brief The DataArrayAllocatorTest class
+ */
+class DataArrayAllocatorTest
+{
+public:
+  DataArrayAllocatorTest()
+  {
+  }
+  virtual ~DataArrayAllocatorTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestSizeClasses()
+  {
+    DREAM3D_REQUIRE_EQUAL(DataArrayAllocator::SizeClass(1), DataArrayAllocator::Alignment)
+    DREAM3D_REQUIRE_EQUAL(DataArrayAllocator::SizeClass(64), 64)
+    DREAM3D_REQUIRE_EQUAL(DataArrayAllocator::SizeClass(65), 128)
+    DREAM3D_REQUIRE_EQUAL(DataArrayAllocator::SizeClass(1024 * 1024), 1024 * 1024)
+    DREAM3D_REQUIRE_EQUAL(DataArrayAllocator::SizeClass(1024 * 1024 + 1), 1280 * 1024)
+    DREAM3D_REQUIRE_EQUAL(DataArrayAllocator::SizeClass(1700 * 1024), 1792 * 1024)
+
+    for(size_t bytes = 1; bytes < 64 * 1024 * 1024; bytes = bytes * 3 + 7)
+    {
+      size_t sizeClass = DataArrayAllocator::SizeClass(bytes);
+      DREAM3D_REQUIRED(sizeClass, >=, bytes)
+      DREAM3D_REQUIRED(sizeClass % DataArrayAllocator::Alignment, ==, 0)
+      // At most a quarter of a class is wasted
+      DREAM3D_REQUIRED(sizeClass - bytes, <=, std::max(bytes / 4, DataArrayAllocator::Alignment))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAlignment()
+  {
+    DataArrayAllocator::Pointer allocator = DataArrayAllocator::New();
+    allocator->setHugePageThreshold(4 * DataArrayAllocator::HugePageSize);
+    size_t sizes[] = {1, 3, 100, 4096, 100000, 5 * DataArrayAllocator::HugePageSize};
+    for(size_t bytes : sizes)
+    {
+      void* ptr = allocator->allocate(bytes);
+      DREAM3D_REQUIRED_PTR(ptr, !=, nullptr)
+      DREAM3D_REQUIRED(reinterpret_cast<uintptr_t>(ptr) % DataArrayAllocator::Alignment, ==, 0)
+      ::memset(ptr, 0x5A, bytes);
+      allocator->deallocate(ptr);
+    }
+
+    DataArrayAllocator::Statistics stats = allocator->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.allocations, 6)
+    DREAM3D_REQUIRE_EQUAL(stats.deallocations, 6)
+    DREAM3D_REQUIRE_EQUAL(stats.liveBuffers, 0)
+    DREAM3D_REQUIRE_EQUAL(stats.bytesInUse, 0)
+    DREAM3D_REQUIRED(stats.peakBytesInUse, >=, 5 * DataArrayAllocator::HugePageSize)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestHugePageBlocks()
+  {
+    const size_t hugePageSize = DataArrayAllocator::HugePageSize;
+    DataArrayAllocator::Pointer allocator = DataArrayAllocator::New();
+    allocator->setHugePageMode(DataArrayAllocator::HugePageMode::Transparent);
+    allocator->setHugePageThreshold(hugePageSize);
+    allocator->setPoolCapacity(0);
+
+    // Huge page buffers have no header in front and start on a huge page boundary
+    size_t sizes[] = {hugePageSize, 4 * hugePageSize, 5 * hugePageSize + 100};
+    for(size_t bytes : sizes)
+    {
+      uint8_t* ptr = static_cast<uint8_t*>(allocator->allocate(bytes));
+      DREAM3D_REQUIRED_PTR(ptr, !=, nullptr)
+      DREAM3D_REQUIRED(reinterpret_cast<uintptr_t>(ptr) % hugePageSize, ==, 0)
+      ::memset(ptr, 0x5A, bytes);
+      DREAM3D_REQUIRE_EQUAL(allocator->reallocate(ptr, bytes - 64), ptr)
+      allocator->deallocate(ptr);
+    }
+
+    // Smaller buffers keep their header next to them
+    void* small = allocator->allocate(1000);
+    DREAM3D_REQUIRED(reinterpret_cast<uintptr_t>(small) % DataArrayAllocator::Alignment, ==, 0)
+    allocator->deallocate(small);
+
+    DataArrayAllocator::Statistics stats = allocator->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.allocations, 4)
+    DREAM3D_REQUIRE_EQUAL(stats.liveBuffers, 0)
+    DREAM3D_REQUIRE_EQUAL(stats.bytesInUse, 0)
+
+#if !defined(_WIN32)
+    // They are also handed over by release() without moving the data
+    uint8_t* ptr = static_cast<uint8_t*>(allocator->allocate(3 * hugePageSize));
+    ptr[3 * hugePageSize - 1] = 0x3C;
+    uint8_t* released = static_cast<uint8_t*>(allocator->release(ptr));
+    DREAM3D_REQUIRE_EQUAL(released, ptr)
+    DREAM3D_REQUIRE_EQUAL(released[3 * hugePageSize - 1], 0x3C)
+    DREAM3D_REQUIRE_EQUAL(allocator->getStatistics().liveBuffers, 0)
+    free(released);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConcurrentAllocation()
+  {
+    DataArrayAllocator::Pointer allocator = DataArrayAllocator::New();
+    allocator->setPoolThreshold(64 * 1024);
+    const int numThreads = 4;
+    const int numIterations = 2000;
+    std::atomic<int> corrupted(0);
+    std::vector<std::thread> threads;
+    for(int t = 0; t < numThreads; t++)
+    {
+      threads.push_back(std::thread([allocator, t, numIterations, &corrupted]() {
+        for(int i = 0; i < numIterations; i++)
+        {
+          // Mostly small buffers that skip the mutex, with a pooled one now and then
+          size_t bytes = (i % 100 == 0) ? 100000 : static_cast<size_t>(16 + (i * 7 + t) % 4000);
+          uint8_t* ptr = static_cast<uint8_t*>(allocator->allocate(bytes));
+          ptr[0] = static_cast<uint8_t>(t);
+          ptr[bytes - 1] = static_cast<uint8_t>(i);
+          ptr = static_cast<uint8_t*>(allocator->reallocate(ptr, bytes * 2));
+          if(ptr[0] != static_cast<uint8_t>(t) || ptr[bytes - 1] != static_cast<uint8_t>(i))
+          {
+            corrupted++;
+          }
+          allocator->deallocate(ptr);
+        }
+      }));
+    }
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+
+    DREAM3D_REQUIRE_EQUAL(corrupted.load(), 0)
+    DataArrayAllocator::Statistics stats = allocator->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.liveBuffers, 0)
+    DREAM3D_REQUIRE_EQUAL(stats.bytesInUse, 0)
+    DREAM3D_REQUIRE_EQUAL(stats.allocations, stats.deallocations)
+    DREAM3D_REQUIRED(stats.allocations, >=, numThreads * numIterations)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPoolReuse()
+  {
+    DataArrayAllocator::Pointer allocator = DataArrayAllocator::New();
+    allocator->setPoolThreshold(64 * 1024);
+    allocator->setPoolCapacity(16 * 1024 * 1024);
+
+    void* first = allocator->allocate(1000000);
+    allocator->deallocate(first);
+    DataArrayAllocator::Statistics stats = allocator->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.poolMisses, 1)
+    DREAM3D_REQUIRE_EQUAL(stats.pooledBuffers, 1)
+    DREAM3D_REQUIRE_EQUAL(stats.pooledBytes, DataArrayAllocator::SizeClass(1000000))
+
+    // A request in the same size class gets the pooled buffer back
+    void* second = allocator->allocate(990000);
+    DREAM3D_REQUIRE_EQUAL(second, first)
+    stats = allocator->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.poolHits, 1)
+    DREAM3D_REQUIRE_EQUAL(stats.pooledBuffers, 0)
+
+    // Small buffers are never pooled
+    void* small = allocator->allocate(1000);
+    allocator->deallocate(small);
+    DREAM3D_REQUIRE_EQUAL(allocator->getStatistics().pooledBuffers, 0)
+
+    // Buffers that do not fit in the pool are released
+    void* large = allocator->allocate(32 * 1024 * 1024);
+    allocator->deallocate(large);
+    allocator->deallocate(second);
+    stats = allocator->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.pooledBuffers, 1)
+    DREAM3D_REQUIRED(stats.pooledBytes, <=, 16 * 1024 * 1024)
+
+    allocator->releaseCachedMemory();
+    stats = allocator->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.pooledBuffers, 0)
+    DREAM3D_REQUIRE_EQUAL(stats.pooledBytes, 0)
+    DREAM3D_REQUIRE_EQUAL(stats.liveBuffers, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReallocate()
+  {
+    DataArrayAllocator::Pointer allocator = DataArrayAllocator::New();
+    uint8_t* ptr = static_cast<uint8_t*>(allocator->allocate(1000));
+    for(size_t i = 0; i < 1000; i++)
+    {
+      ptr[i] = static_cast<uint8_t>(i);
+    }
+
+    // Still fits the size class of the buffer
+    uint8_t* grown = static_cast<uint8_t*>(allocator->reallocate(ptr, 1020));
+    DREAM3D_REQUIRE_EQUAL(grown, ptr)
+    DREAM3D_REQUIRE_EQUAL(allocator->getStatistics().inPlaceReallocations, 1)
+
+    grown = static_cast<uint8_t*>(allocator->reallocate(grown, 100000));
+    DREAM3D_REQUIRED_PTR(grown, !=, nullptr)
+    for(size_t i = 0; i < 1000; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(grown[i], static_cast<uint8_t>(i))
+    }
+    allocator->deallocate(grown);
+    DREAM3D_REQUIRE_EQUAL(allocator->getStatistics().liveBuffers, 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRelease()
+  {
+    DataArrayAllocator::Pointer previous = DataArrayAllocator::Instance();
+    DataArrayAllocator::Pointer allocator = DataArrayAllocator::New();
+    allocator->setHugePageMode(DataArrayAllocator::HugePageMode::Explicit);
+    DataArrayAllocator::SetInstance(allocator);
+    {
+      // Released buffers leave the allocator and are handed to free(), whether or not they had to be moved
+      size_t sizes[] = {100, 3 * DataArrayAllocator::HugePageSize};
+      QVector<size_t> cDims(1, 1);
+      for(size_t numTuples : sizes)
+      {
+        Int32ArrayType::Pointer array = Int32ArrayType::CreateArray(numTuples, cDims, "Released", true);
+        array->initializeWithValue(42);
+        array->releaseOwnership();
+        DREAM3D_REQUIRE_EQUAL(allocator->getStatistics().liveBuffers, 0)
+        int32_t* released = array->getPointer(0);
+        DREAM3D_REQUIRE_EQUAL(released[0], 42)
+        DREAM3D_REQUIRE_EQUAL(released[numTuples - 1], 42)
+        array = Int32ArrayType::NullPointer();
+        free(released);
+      }
+
+      // A wrapped external buffer is copied, the other library keeps its memory
+      std::vector<int32_t> external(10, 7);
+      std::shared_ptr<void> owner(external.data(), [](void*) {});
+      Int32ArrayType::Pointer wrapped = Int32ArrayType::WrapExternalBuffer(external.data(), external.size(), cDims, "External", owner);
+      wrapped->releaseOwnership();
+      int32_t* copy = wrapped->getPointer(0);
+      DREAM3D_REQUIRED_PTR(copy, !=, external.data())
+      DREAM3D_REQUIRE_EQUAL(copy[9], 7)
+      DREAM3D_REQUIRE_EQUAL(wrapped->hasExternalBuffer(), false)
+      wrapped = Int32ArrayType::NullPointer();
+      free(copy);
+      DREAM3D_REQUIRE_EQUAL(allocator->getStatistics().liveBuffers, 0)
+    }
+    DataArrayAllocator::SetInstance(previous);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestDataArrayAllocation()
+  {
+    DataArrayAllocator::Pointer previous = DataArrayAllocator::Instance();
+    DataArrayAllocator::Pointer allocator = DataArrayAllocator::New();
+    DataArrayAllocator::SetInstance(allocator);
+    {
+      // Large enough to be initialized in parallel
+      size_t numTuples = 3 * 1024 * 1024;
+      QVector<size_t> cDims(1, 1);
+      FloatArrayType::Pointer array = FloatArrayType::CreateArray(numTuples, cDims, "Float", true);
+      DREAM3D_REQUIRED(reinterpret_cast<uintptr_t>(array->getPointer(0)) % DataArrayAllocator::Alignment, ==, 0)
+      DREAM3D_REQUIRE_EQUAL(allocator->getStatistics().liveBuffers, 1)
+
+      array->initializeWithValue(2.5f);
+      for(size_t i = 0; i < numTuples; i += 4099)
+      {
+        DREAM3D_REQUIRE_EQUAL(array->getValue(i), 2.5f)
+      }
+      array->initializeWithZeros();
+      DREAM3D_REQUIRE_EQUAL(array->getValue(numTuples - 1), 0.0f)
+
+      // Only the new tuples get the init value
+      array->setValue(numTuples - 1, 7.0f);
+      array->setInitValue(1.0f);
+      array->resize(numTuples * 2);
+      DREAM3D_REQUIRE_EQUAL(array->getValue(numTuples - 1), 7.0f)
+      DREAM3D_REQUIRE_EQUAL(array->getValue(numTuples), 1.0f)
+      DREAM3D_REQUIRE_EQUAL(array->getValue(numTuples * 2 - 1), 1.0f)
+
+      // Buffers go back to the allocator they came from after it has been replaced
+      IDataArray::Pointer copy = array->deepCopy();
+      DataArrayAllocator::SetInstance(previous);
+      array->setValue(0, 3.0f);
+      DREAM3D_REQUIRE_EQUAL(allocator->getStatistics().liveBuffers, 1)
+      DREAM3D_REQUIRE_EQUAL(std::dynamic_pointer_cast<FloatArrayType>(copy)->getValue(0), 0.0f)
+      copy = IDataArray::NullPointer();
+      DataArrayAllocator::Statistics stats = allocator->getStatistics();
+      DREAM3D_REQUIRE_EQUAL(stats.liveBuffers, 0)
+      DREAM3D_REQUIRE_EQUAL(stats.pooledBuffers, 2)
+
+      // Memory malloc()'ed by the caller is still handed to free()
+      int32_t* raw = static_cast<int32_t*>(malloc(10 * sizeof(int32_t)));
+      Int32ArrayType::Pointer wrapped = Int32ArrayType::WrapPointer(raw, 10, cDims, "Wrapped", true);
+      wrapped->resize(20);
+      wrapped = Int32ArrayType::NullPointer();
+
+      // The resized buffer is recycled for the next array of that size
+      DataArrayAllocator::SetInstance(allocator);
+      array = FloatArrayType::CreateArray(numTuples * 2, cDims, "Float", true);
+      stats = allocator->getStatistics();
+      DREAM3D_REQUIRE_EQUAL(stats.poolHits, 1)
+      DREAM3D_REQUIRE_EQUAL(stats.pooledBuffers, 1)
+    }
+    DataArrayAllocator::SetInstance(previous);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### DataArrayAllocatorTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+#if !REMOVE_TEST_FILES
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+#endif
+    DREAM3D_REGISTER_TEST(TestSizeClasses())
+    DREAM3D_REGISTER_TEST(TestAlignment())
+    DREAM3D_REGISTER_TEST(TestHugePageBlocks())
+    DREAM3D_REGISTER_TEST(TestConcurrentAllocation())
+    DREAM3D_REGISTER_TEST(TestPoolReuse())
+    DREAM3D_REGISTER_TEST(TestReallocate())
+    DREAM3D_REGISTER_TEST(TestRelease())
+    DREAM3D_REGISTER_TEST(TestDataArrayAllocation())
+
+#if REMOVE_TEST_FILES
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+#endif
+  }
+
+private:
+  DataArrayAllocatorTest(const DataArrayAllocatorTest&); // Copy Constructor Not Implemented
+  void operator=(const DataArrayAllocatorTest&);         // Move assignment Not Implemented
+};
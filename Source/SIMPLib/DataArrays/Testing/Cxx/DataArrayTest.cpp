@@ -35,7 +35,10 @@
 
 #include <stdlib.h>
 
+#include <cmath>
 #include <iostream>
+#include <limits>
+#include <thread>
 #include <vector>
 
 #include <QtCore/QDir>
@@ -971,6 +974,322 @@ public:
     TestDeepCopyDataArrayForType<double>();
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> void TestCopyOnWriteForType()
+  {
+    size_t numTuples = 10;
+    QVector<size_t> cDims(1, 3);
+
+    typename DataArray<T>::Pointer src = DataArray<T>::CreateArray(numTuples, cDims, "Source Array", true);
+    for(size_t i = 0; i < numTuples * cDims[0]; i++)
+    {
+      src->setValue(i, static_cast<T>(i));
+    }
+    const T* srcBuffer = src->getConstPointer(0);
+
+    // deepCopy() duplicates the data right away, so raw pointers stay isolated
+    typename DataArray<T>::Pointer eager = std::dynamic_pointer_cast<DataArray<T>>(src->deepCopy());
+    DREAM3D_REQUIRE(eager->getConstPointer(0) != srcBuffer)
+    DREAM3D_REQUIRE_EQUAL(src->isShared(), false)
+    T* eagerPtr = eager->getPointer(0);
+    eagerPtr[1] = static_cast<T>(77);
+    DREAM3D_REQUIRE_EQUAL(src->getValue(1), static_cast<T>(1))
+
+    // The copy shares the buffer and reading from it does not change that
+    typename DataArray<T>::Pointer copy = src->shallowCopy();
+    DREAM3D_REQUIRE_EQUAL(copy->getConstPointer(0), srcBuffer)
+    DREAM3D_REQUIRE_EQUAL(src->isShared(), true)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(4), static_cast<T>(4))
+    DREAM3D_REQUIRE_EQUAL(copy->getComponent(2, 1), static_cast<T>(7))
+    DREAM3D_REQUIRE_EQUAL(copy->getConstTuplePointer(3)[0], static_cast<T>(9))
+    DREAM3D_REQUIRE_EQUAL(copy->isShared(), true)
+
+    // Read only generic access does not detach either
+    DREAM3D_REQUIRE_EQUAL(copy->getConstVoidPointer(0), static_cast<const void*>(srcBuffer))
+    DREAM3D_REQUIRE_EQUAL(copy->isShared(), true)
+
+    // Writing to the copy detaches it and leaves the source alone
+    copy->setValue(0, static_cast<T>(99));
+    DREAM3D_REQUIRE(copy->getConstPointer(0) != srcBuffer)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(0), static_cast<T>(99))
+    DREAM3D_REQUIRE_EQUAL(src->getValue(0), static_cast<T>(0))
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(5), static_cast<T>(5))
+
+    // The source is the last holder of the buffer so it takes it back without copying
+    DREAM3D_REQUIRE_EQUAL(src->isShared(), false)
+    DREAM3D_REQUIRE_EQUAL(src->getPointer(0), srcBuffer)
+
+    // A raw pointer is only handed out after the copy detached
+    copy = src->shallowCopy();
+    T* copyPtr = copy->getPointer(0);
+    DREAM3D_REQUIRE(copyPtr != srcBuffer)
+    copyPtr[2] = static_cast<T>(55);
+    DREAM3D_REQUIRE_EQUAL(src->getValue(2), static_cast<T>(2))
+
+    // Resizing and erasing a shared copy must not touch the source either
+    copy = src->shallowCopy();
+    copy->resize(numTuples * 2);
+    DREAM3D_REQUIRE_EQUAL(src->getNumberOfTuples(), numTuples)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(numTuples * cDims[0] - 1), src->getValue(numTuples * cDims[0] - 1))
+
+    copy = src->shallowCopy();
+    QVector<size_t> eraseIdx(1, 0);
+    copy->eraseTuples(eraseIdx);
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfTuples(), numTuples - 1)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(0), static_cast<T>(3))
+    DREAM3D_REQUIRE_EQUAL(src->getValue(0), static_cast<T>(0))
+
+    // The copy keeps the data alive after the source goes away
+    copy = src->shallowCopy();
+    src = typename DataArray<T>::Pointer();
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(8), static_cast<T>(8))
+    copy->initializeWithZeros();
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(8), static_cast<T>(0))
+
+    // Wrapped memory is not owned by the array so it is still copied up front
+    std::vector<T> external(numTuples, static_cast<T>(1));
+    QVector<size_t> wDims(1, 1);
+    typename DataArray<T>::Pointer wrapped = DataArray<T>::WrapPointer(external.data(), numTuples, wDims, "Wrapped", false);
+    copy = wrapped->shallowCopy();
+    DREAM3D_REQUIRE(copy->getConstPointer(0) != wrapped->getConstPointer(0))
+    DREAM3D_REQUIRE_EQUAL(copy->isShared(), false)
+
+    // Several threads asking for mutable access at once detach exactly once
+    src = copy->shallowCopy();
+    std::vector<T*> pointers(4, nullptr);
+    std::vector<std::thread> threads;
+    for(size_t t = 0; t < pointers.size(); t++)
+    {
+      threads.push_back(std::thread([&pointers, &src, t]() { pointers[t] = src->getPointer(0); }));
+    }
+    for(std::thread& thread : threads)
+    {
+      thread.join();
+    }
+    for(T* ptr : pointers)
+    {
+      DREAM3D_REQUIRE_EQUAL(ptr, pointers[0])
+    }
+    DREAM3D_REQUIRE(pointers[0] != copy->getConstPointer(0))
+    DREAM3D_REQUIRE_EQUAL(src->isShared(), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestNeighborListCopyOnWrite()
+  {
+    Int32NeighborListType::Pointer neiList = Int32NeighborListType::CreateArray(5, "NeighborList");
+    for(int i = 0; i < 5; ++i)
+    {
+      for(int j = 0; j < i + 1; ++j)
+      {
+        neiList->addEntry(i, i * 10 + j);
+      }
+    }
+
+    // deepCopy() duplicates every list
+    Int32NeighborListType::Pointer eager = std::dynamic_pointer_cast<Int32NeighborListType>(neiList->deepCopy());
+    DREAM3D_REQUIRE(&(eager->getConstListReference(2)) != &(neiList->getConstListReference(2)))
+    eager->getListReference(2)[0] = -5;
+    DREAM3D_REQUIRE_EQUAL(neiList->getConstListReference(2)[0], 20)
+
+    Int32NeighborListType::Pointer copy = neiList->shallowCopy();
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfTuples(), neiList->getNumberOfTuples())
+    for(int i = 0; i < 5; ++i)
+    {
+      DREAM3D_REQUIRE_EQUAL(&(copy->getConstListReference(i)), &(neiList->getConstListReference(i)))
+    }
+
+    // Only the list that is written to gets duplicated
+    copy->addEntry(2, 1000);
+    DREAM3D_REQUIRE_EQUAL(copy->getListSize(2), 4)
+    DREAM3D_REQUIRE_EQUAL(neiList->getListSize(2), 3)
+    DREAM3D_REQUIRE(&(copy->getConstListReference(2)) != &(neiList->getConstListReference(2)))
+    DREAM3D_REQUIRE_EQUAL(&(copy->getConstListReference(3)), &(neiList->getConstListReference(3)))
+
+    neiList->getListReference(4)[0] = -1;
+    DREAM3D_REQUIRE_EQUAL(copy->getConstListReference(4)[0], 40)
+
+    // Lists handed in through setList keep their reference semantics
+    Int32NeighborListType::SharedVectorType shared(new std::vector<int32_t>(2, 7));
+    copy->setList(1, shared);
+    copy->getListReference(1).push_back(8);
+    DREAM3D_REQUIRE_EQUAL(shared->size(), 3)
+    DREAM3D_REQUIRE_EQUAL(neiList->getListSize(1), 2)
+
+    // Erasing from the copy keeps track of which lists are still shared
+    QVector<size_t> eraseIdx(1, 0);
+    copy->eraseTuples(eraseIdx);
+    copy->getListReference(2).push_back(5);
+    DREAM3D_REQUIRE_EQUAL(neiList->getListSize(3), 4)
+    DREAM3D_REQUIRE_EQUAL(copy->getListSize(2), 5)
+
+    // A list handed out through getList() is written in place, so a later copy gets
+    // its own duplicate of it and the source is never marked as shared
+    Int32NeighborListType::SharedVectorType held = neiList->getList(0);
+    Int32NeighborListType::Pointer second = neiList->shallowCopy();
+    DREAM3D_REQUIRE(&(second->getConstListReference(0)) != &(neiList->getConstListReference(0)))
+    held->push_back(77);
+    DREAM3D_REQUIRE_EQUAL(second->getListSize(0), 1)
+    neiList->addEntry(0, 78);
+    DREAM3D_REQUIRE_EQUAL(held->size(), 3)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAttributeMatrixCopyOnWrite()
+  {
+    QVector<size_t> tDims(1, 10);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    Int32ArrayType::Pointer ids = Int32ArrayType::CreateArray(10, "Ids");
+    ids->initializeWithValue(3);
+    am->addAttributeArray(ids->getName(), ids);
+    StringDataArray::Pointer names = StringDataArray::CreateArray(10, "Names");
+    names->setValue(0, "first");
+    am->addAttributeArray(names->getName(), names);
+
+    // Copying the matrix does not duplicate any data up front
+    AttributeMatrix::Pointer copy = am->deepCopy();
+    Int32ArrayType::Pointer copyIds = std::dynamic_pointer_cast<Int32ArrayType>(copy->getAttributeArray("Ids"));
+    DREAM3D_REQUIRE_VALID_POINTER(copyIds.get())
+    DREAM3D_REQUIRE_EQUAL(copyIds->getConstPointer(0), ids->getConstPointer(0))
+    DREAM3D_REQUIRE_EQUAL(ids->isShared(), true)
+
+    copyIds->setValue(0, 9);
+    DREAM3D_REQUIRE_EQUAL(ids->getValue(0), 3)
+    DREAM3D_REQUIRE(copyIds->getConstPointer(0) != ids->getConstPointer(0))
+
+    StringDataArray::Pointer copyNames = std::dynamic_pointer_cast<StringDataArray>(copy->getAttributeArray("Names"));
+    DREAM3D_REQUIRE_VALID_POINTER(copyNames.get())
+    copyNames->setValue(0, "changed");
+    DREAM3D_REQUIRE(names->getValue(0) == "first")
+
+    // forceNoAllocate still gives every array its own buffer
+    AttributeMatrix::Pointer structure = am->deepCopy(true);
+    DREAM3D_REQUIRE(structure->getAttributeArray("Ids")->getConstVoidPointer(0) != ids->getConstVoidPointer(0))
+
+    // StringDataArray::deepCopy duplicates the strings like every other array type
+    StringDataArray::Pointer eagerNames = std::dynamic_pointer_cast<StringDataArray>(names->deepCopy());
+    DREAM3D_REQUIRE(eagerNames->getValue(0) == "first")
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCopyOnWrite()
+  {
+    TestCopyOnWriteForType<uint8_t>();
+    TestCopyOnWriteForType<int16_t>();
+    TestCopyOnWriteForType<int32_t>();
+    TestCopyOnWriteForType<uint64_t>();
+    TestCopyOnWriteForType<float>();
+    TestCopyOnWriteForType<double>();
+    TestNeighborListCopyOnWrite();
+    TestAttributeMatrixCopyOnWrite();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestStatistics()
+  {
+    // Large enough to take the parallel path when it is compiled in
+    size_t numTuples = 100000;
+    QVector<size_t> cDims(1, 2);
+    FloatArrayType::Pointer array = FloatArrayType::CreateArray(numTuples, cDims, "Statistics", true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      array->setComponent(i, 0, static_cast<float>(i % 10));
+      array->setComponent(i, 1, (i % 4 == 0) ? std::numeric_limits<float>::quiet_NaN() : 1000000.0f + static_cast<float>(i % 2));
+    }
+
+    ArrayStatistics stats = array->getStatistics(10);
+    DREAM3D_REQUIRE_EQUAL(stats.valid, true)
+    DREAM3D_REQUIRE_EQUAL(stats.numComponents, 2)
+    DREAM3D_REQUIRE_EQUAL(stats.count[0], numTuples)
+    DREAM3D_REQUIRE_EQUAL(stats.nanCount[0], 0)
+    DREAM3D_REQUIRE_EQUAL(stats.min[0], 0.0)
+    DREAM3D_REQUIRE_EQUAL(stats.max[0], 9.0)
+    DREAM3D_REQUIRE_EQUAL(stats.sum[0], 450000.0)
+    DREAM3D_REQUIRE(std::abs(stats.mean[0] - 4.5) < 1.0E-12)
+    DREAM3D_REQUIRE(std::abs(stats.variance[0] - 8.25) < 1.0E-9)
+    for(int bin = 0; bin < 10; bin++)
+    {
+      DREAM3D_REQUIRE_EQUAL(stats.getHistogramCount(0, bin), numTuples / 10)
+    }
+
+    // Every fourth value is NaN and the others alternate around a large offset
+    DREAM3D_REQUIRE_EQUAL(stats.nanCount[1], numTuples / 4)
+    DREAM3D_REQUIRE_EQUAL(stats.count[1], numTuples - numTuples / 4)
+    DREAM3D_REQUIRE_EQUAL(stats.min[1], 1000000.0)
+    DREAM3D_REQUIRE_EQUAL(stats.max[1], 1000001.0)
+    double expectedMean = 1000000.0 + 2.0 / 3.0;
+    DREAM3D_REQUIRE(std::abs(stats.mean[1] - expectedMean) < 1.0E-6)
+    DREAM3D_REQUIRE(std::abs(stats.variance[1] - 2.0 / 9.0) < 1.0E-6)
+    DREAM3D_REQUIRE_EQUAL(stats.getHistogramCount(1, 0), numTuples / 4)
+    DREAM3D_REQUIRE_EQUAL(stats.getHistogramCount(1, 9), numTuples / 2)
+
+    // The result is cached until the array is marked as modified; element access,
+    // mutable or not, leaves the counter alone
+    uint64_t modCount = array->getModificationCount();
+    array->getValue(5);
+    array->getConstPointer(0);
+    array->getPointer(0);
+    array->setComponent(0, 0, 100.0f);
+    DREAM3D_REQUIRE_EQUAL(array->getModificationCount(), modCount)
+    QString info = array->getInfoString(SIMPL::HtmlFormat);
+    DREAM3D_REQUIRE(info.contains("NaN Values:"))
+    DREAM3D_REQUIRE_EQUAL(array->getStatistics().max[0], 9.0)
+
+    array->markModified();
+    DREAM3D_REQUIRE(array->getModificationCount() != modCount)
+    info = array->getInfoString(SIMPL::HtmlFormat);
+    DREAM3D_REQUIRE_EQUAL(info.contains("Min:"), false)
+    stats = array->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.max[0], 100.0)
+    DREAM3D_REQUIRE_EQUAL(stats.numBins, 0)
+
+    // Integer arrays go through the same path and empty arrays are valid with no values
+    Int32ArrayType::Pointer ids = Int32ArrayType::CreateArray(5, "Ids");
+    for(int32_t i = 0; i < 5; i++)
+    {
+      ids->setValue(i, -2 + i);
+    }
+    stats = ids->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.min[0], -2.0)
+    DREAM3D_REQUIRE_EQUAL(stats.max[0], 2.0)
+    DREAM3D_REQUIRE_EQUAL(stats.sum[0], 0.0)
+
+    // Raw pointer writes are seen once the writer marks the array or the reader forces
+    int32_t* idPtr = ids->getPointer(0);
+    DREAM3D_REQUIRE_EQUAL(ids->getStatistics().max[0], 2.0)
+    idPtr[4] = 50;
+    DREAM3D_REQUIRE_EQUAL(ids->getStatistics().max[0], 2.0)
+    stats = ids->getStatistics(0, true);
+    DREAM3D_REQUIRE_EQUAL(stats.max[0], 50.0)
+    DREAM3D_REQUIRE_EQUAL(ids->getStatistics().max[0], 50.0)
+    idPtr[4] = 60;
+    ids->markModified();
+    DREAM3D_REQUIRE_EQUAL(ids->getStatistics().max[0], 60.0)
+
+    // Whole array operations invalidate the cache themselves
+    ids->initializeWithValue(7);
+    DREAM3D_REQUIRE_EQUAL(ids->getStatistics().max[0], 7.0)
+
+    ids->resize(0);
+    stats = ids->getStatistics();
+    DREAM3D_REQUIRE_EQUAL(stats.valid, true)
+    DREAM3D_REQUIRE_EQUAL(stats.count[0], 0)
+
+    // Arrays without numeric values report invalid statistics
+    StringDataArray::Pointer strings = StringDataArray::CreateArray(3, "Strings");
+    DREAM3D_REQUIRE_EQUAL(strings->getStatistics().valid, false)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1130,6 +1449,67 @@ public:
     TestWrapPointerForType<double>();
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestExternalBuffer()
+  {
+    QVector<size_t> cDims = {1};
+    std::vector<int32_t>* external = new std::vector<int32_t>(TEST_SIZE, 7);
+    bool released = false;
+    std::shared_ptr<void> owner(external, [&released](void* p) {
+      delete static_cast<std::vector<int32_t>*>(p);
+      released = true;
+    });
+
+    Int32ArrayType::Pointer wrapped = Int32ArrayType::WrapExternalBuffer(external->data(), TEST_SIZE, cDims, "External", owner);
+    owner.reset();
+    DREAM3D_REQUIRE_EQUAL(wrapped->hasExternalBuffer(), true)
+    DREAM3D_REQUIRE_EQUAL(released, false)
+    DREAM3D_REQUIRE_EQUAL(wrapped->getValue(TEST_SIZE - 1), 7)
+
+    // Writes go straight to the adopted memory
+    wrapped->setValue(0, 42);
+    DREAM3D_REQUIRE_EQUAL((*external)[0], 42)
+
+    // Copies never share memory they can not free
+    Int32ArrayType::Pointer copy = std::dynamic_pointer_cast<Int32ArrayType>(wrapped->deepCopy());
+    DREAM3D_REQUIRE(copy->getPointer(0) != wrapped->getPointer(0))
+    DREAM3D_REQUIRE_EQUAL(copy->hasExternalBuffer(), false)
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(0), 42)
+
+    // Taking ownership swaps the adopted memory for a private copy
+    wrapped->takeOwnership();
+    DREAM3D_REQUIRE_EQUAL(wrapped->hasExternalBuffer(), false)
+    DREAM3D_REQUIRE_EQUAL(released, true)
+    DREAM3D_REQUIRE_EQUAL(wrapped->getValue(0), 42)
+
+    // Resizing lets go of the adopted memory as well
+    external = new std::vector<int32_t>(TEST_SIZE, 3);
+    released = false;
+    owner = std::shared_ptr<void>(external, [&released](void* p) {
+      delete static_cast<std::vector<int32_t>*>(p);
+      released = true;
+    });
+    wrapped = Int32ArrayType::WrapExternalBuffer(external->data(), TEST_SIZE, cDims, "External", owner);
+    owner.reset();
+    wrapped->resize(TEST_SIZE * 2);
+    DREAM3D_REQUIRE_EQUAL(released, true)
+    DREAM3D_REQUIRE_EQUAL(wrapped->getValue(TEST_SIZE - 1), 3)
+
+    // Destroying the array releases the owner
+    external = new std::vector<int32_t>(TEST_SIZE, 5);
+    released = false;
+    owner = std::shared_ptr<void>(external, [&released](void* p) {
+      delete static_cast<std::vector<int32_t>*>(p);
+      released = true;
+    });
+    wrapped = Int32ArrayType::WrapExternalBuffer(external->data(), TEST_SIZE, cDims, "External", owner);
+    owner.reset();
+    wrapped = Int32ArrayType::NullPointer();
+    DREAM3D_REQUIRE_EQUAL(released, true)
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -1178,8 +1558,11 @@ public:
     DREAM3D_REGISTER_TEST(TestEraseElements())
     DREAM3D_REGISTER_TEST(TestcopyTuples())
     DREAM3D_REGISTER_TEST(TestDeepCopyArray())
+    DREAM3D_REGISTER_TEST(TestCopyOnWrite())
+    DREAM3D_REGISTER_TEST(TestStatistics())
     DREAM3D_REGISTER_TEST(TestNeighborList())
     DREAM3D_REGISTER_TEST(TestWrapPointer())
+    DREAM3D_REGISTER_TEST(TestExternalBuffer())
     DREAM3D_REGISTER_TEST(TestPrintDataArray())
 
 #if REMOVE_TEST_FILES
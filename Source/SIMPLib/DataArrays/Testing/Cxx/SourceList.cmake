@@ -1,6 +1,7 @@
 
 set(TEST_${SUBDIR_NAME}_NAMES
   DataArrayTest
+  DataArrayAllocatorTest
   StringDataArrayTest
   StructArrayTest
 )
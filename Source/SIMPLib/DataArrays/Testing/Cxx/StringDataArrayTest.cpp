@@ -381,6 +381,13 @@ public:
     {
       DREAM3D_REQUIRE_EQUAL(nodes->getValue(i), copy->getValue(i));
     }
+
+    // Writing to the copy must not show up in the source and vice versa
+    copy->setValue(0, ::_9);
+    DREAM3D_REQUIRE_EQUAL(nodes->getValue(0), ::_0);
+    nodes->eraseTuples(QVector<size_t>(1, 1));
+    DREAM3D_REQUIRE_EQUAL(copy->getNumberOfTuples(), k_ArraySize);
+    DREAM3D_REQUIRE_EQUAL(copy->getValue(1), ::_1);
   }
 
   // -----------------------------------------------------------------------------
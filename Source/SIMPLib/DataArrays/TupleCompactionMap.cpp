@@ -0,0 +1,136 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "TupleCompactionMap.h"
+
+const size_t TupleCompactionMap::Removed = std::numeric_limits<size_t>::max();
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TupleCompactionMap::TupleCompactionMap(const QVector<bool>& keep)
+: m_NewIndices(static_cast<size_t>(keep.size()), Removed)
+, m_NumberOfKeptTuples(0)
+{
+  size_t numTuples = static_cast<size_t>(keep.size());
+  for(size_t i = 0; i < numTuples; i++)
+  {
+    if(!keep[static_cast<int>(i)])
+    {
+      continue;
+    }
+    m_NewIndices[i] = m_NumberOfKeptTuples;
+    if(!m_Runs.empty() && m_Runs.back().source + m_Runs.back().count == i)
+    {
+      m_Runs.back().count++;
+    }
+    else
+    {
+      Run run = {i, m_NumberOfKeptTuples, 1};
+      m_Runs.push_back(run);
+    }
+    m_NumberOfKeptTuples++;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+TupleCompactionMap::~TupleCompactionMap() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TupleCompactionMap::getNumberOfTuples() const
+{
+  return m_NewIndices.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TupleCompactionMap::getNumberOfKeptTuples() const
+{
+  return m_NumberOfKeptTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TupleCompactionMap::getNumberOfRemovedTuples() const
+{
+  return m_NewIndices.size() - m_NumberOfKeptTuples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<TupleCompactionMap::Run>& TupleCompactionMap::getRuns() const
+{
+  return m_Runs;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t TupleCompactionMap::getNewIndex(size_t tuple) const
+{
+  return (tuple < m_NewIndices.size()) ? m_NewIndices[tuple] : Removed;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<size_t>& TupleCompactionMap::getNewIndices() const
+{
+  return m_NewIndices;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<size_t> TupleCompactionMap::getRemovedTuples() const
+{
+  QVector<size_t> removed;
+  removed.reserve(static_cast<int>(getNumberOfRemovedTuples()));
+  for(size_t i = 0; i < m_NewIndices.size(); i++)
+  {
+    if(m_NewIndices[i] == Removed)
+    {
+      removed.push_back(i);
+    }
+  }
+  return removed;
+}
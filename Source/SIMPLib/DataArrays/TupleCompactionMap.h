@@ -0,0 +1,123 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _tuplecompactionmap_h_
+#define _tuplecompactionmap_h_
+
+#include <limits>
+#include <vector>
+
+#include <QtCore/QVector>
+
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The TupleCompactionMap class describes which tuples of an array survive a
+ * removal and where they end up. It is computed once from a keep flag per tuple and
+ * can then be applied to any number of arrays with the same tuple count through
+ * IDataArray::compactTuples(). Kept tuples stay in their original order, so the map
+ * is stored as runs of consecutive kept tuples that can each be moved with a single
+ * copy.
+ */
+class SIMPLib_EXPORT TupleCompactionMap
+{
+  public:
+    /**
+     * @brief A run of consecutive kept tuples
+     */
+    struct Run
+    {
+      size_t source;
+      size_t dest;
+      size_t count;
+    };
+
+    /**
+     * @brief Value returned by getNewIndex() for a tuple that is removed
+     */
+    static const size_t Removed;
+
+    /**
+     * @brief TupleCompactionMap
+     * @param keep One flag per tuple, true if the tuple is kept
+     */
+    TupleCompactionMap(const QVector<bool>& keep);
+
+    virtual ~TupleCompactionMap();
+
+    /**
+     * @brief Returns the number of tuples before compaction
+     */
+    size_t getNumberOfTuples() const;
+
+    /**
+     * @brief Returns the number of tuples after compaction
+     */
+    size_t getNumberOfKeptTuples() const;
+
+    /**
+     * @brief Returns the number of tuples that are removed
+     */
+    size_t getNumberOfRemovedTuples() const;
+
+    /**
+     * @brief Returns the runs of kept tuples in ascending order
+     */
+    const std::vector<Run>& getRuns() const;
+
+    /**
+     * @brief Returns the index a tuple will have after compaction or Removed
+     * @param tuple The index before compaction
+     */
+    size_t getNewIndex(size_t tuple) const;
+
+    /**
+     * @brief Returns the new index of every tuple, Removed for tuples that go away
+     */
+    const std::vector<size_t>& getNewIndices() const;
+
+    /**
+     * @brief Returns the sorted indices of the removed tuples in the form that
+     * IDataArray::eraseTuples() expects
+     */
+    QVector<size_t> getRemovedTuples() const;
+
+  private:
+    std::vector<Run> m_Runs;
+    std::vector<size_t> m_NewIndices;
+    size_t m_NumberOfKeptTuples;
+};
+
+#endif /* _tuplecompactionmap_h_ */
@@ -38,9 +38,17 @@
 // C Includes
 
 // C++ Includes
+#include <vector>
 #include <fstream>
 #include <iostream>
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 // HDF5 Includes
 #include "H5Support/H5ScopedSentinel.h"
 #include "H5Support/QH5Lite.h"
@@ -49,13 +57,93 @@
 // DREAM3D Includes
 #include "SIMPLib/DataArrays/StatsDataArray.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/DataArrays/TupleCompactionMap.h"
 #include "SIMPLib/HDF5/H5DataArrayReader.h"
+#include "SIMPLib/HDF5/H5ImagePyramid.h"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
 #include "SIMPLib/DataContainers/AttributeMatrixProxy.h"
 #include "SIMPLib/DataContainers/DataContainerProxy.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 
+namespace
+{
+/**
+ * @brief The CompactArraysImpl class applies one TupleCompactionMap to a set of
+ * arrays. Each array is independent so every task handles whole arrays and
+ * records the result of each array in its own slot of errors.
+ */
+class CompactArraysImpl
+{
+public:
+  CompactArraysImpl(const QVector<IDataArray::Pointer>& arrays, const TupleCompactionMap& map, std::vector<int>& errors)
+  : m_Arrays(arrays)
+  , m_Map(map)
+  , m_Errors(errors)
+  {
+  }
+
+  void compact(int start, int end) const
+  {
+    for(int i = start; i < end; i++)
+    {
+      m_Errors[i] = m_Arrays[i]->compactTuples(m_Map);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<int>& r) const
+  {
+    compact(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const QVector<IDataArray::Pointer>& m_Arrays;
+  const TupleCompactionMap& m_Map;
+  std::vector<int>& m_Errors;
+};
+
+/**
+ * @brief The RenumberFeatureIdsImpl class replaces each feature id by its index
+ * after compaction. Removed features map to 0; ids outside the matrix are left
+ * unchanged.
+ */
+class RenumberFeatureIdsImpl
+{
+public:
+  RenumberFeatureIdsImpl(int32_t* featureIds, const std::vector<int32_t>& newIds)
+  : m_FeatureIds(featureIds)
+  , m_NewIds(newIds)
+  {
+  }
+
+  void renumber(size_t start, size_t end) const
+  {
+    int32_t numIds = static_cast<int32_t>(m_NewIds.size());
+    for(size_t i = start; i < end; i++)
+    {
+      if(m_FeatureIds[i] >= 0 && m_FeatureIds[i] < numIds)
+      {
+        m_FeatureIds[i] = m_NewIds[m_FeatureIds[i]];
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    renumber(r.begin(), r.end());
+  }
+#endif
+
+private:
+  int32_t* m_FeatureIds;
+  const std::vector<int32_t>& m_NewIds;
+};
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -273,6 +361,7 @@ void AttributeMatrix::ReadAttributeMatrixStructure(hid_t containerId, DataContai
       {
         std::cout << "Error Reading the AttributeMatrix Type for AttributeMatrix " << attributeMatrixName.toStdString() << std::endl;
       }
+      amProxy.pyramidLevels = H5ImagePyramid::ReadLevelCount(containerId, attributeMatrixName);
 
       QString h5Path = h5InternalPath + "/" + attributeMatrixName;
 
@@ -432,7 +521,7 @@ size_t AttributeMatrix::getNumberOfTuples()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-bool AttributeMatrix::removeInactiveObjects(const QVector<bool> &activeObjects, DataArray<int32_t> *featureIds)
+bool AttributeMatrix::removeInactiveObjects(const QVector<bool> &activeObjects, DataArray<int32_t> *featureIds, const QStringList& neighborIdLists)
 {
   bool acceptableMatrix = false;
   // Only valid for feature or ensemble type matrices
@@ -443,62 +532,171 @@ bool AttributeMatrix::removeInactiveObjects(const QVector<bool> &activeObjects,
     acceptableMatrix = true;
   }
   size_t totalTuples = getNumberOfTuples();
-  if(static_cast<size_t>(activeObjects.size()) == totalTuples && acceptableMatrix == true)
+  if(static_cast<size_t>(activeObjects.size()) != totalTuples || acceptableMatrix == false)
+  {
+    return false;
+  }
+
+  // Object 0 is never removed. The keep map is computed once and shared by every array.
+  QVector<bool> keep = activeObjects;
+  if(keep.size() > 0)
   {
-    size_t goodcount = 1;
-    QVector<size_t> newNames(totalTuples, 0);
-    QVector<size_t> removeList;
+    keep[0] = true;
+  }
+  TupleCompactionMap compactionMap(keep);
+  if(compactionMap.getNumberOfRemovedTuples() == 0)
+  {
+    return true;
+  }
 
-    for(qint32 i = 1; i < activeObjects.size(); i++)
+  std::vector<int32_t> newIds(totalTuples, 0);
+  for(size_t i = 0; i < totalTuples; i++)
+  {
+    size_t newIndex = compactionMap.getNewIndex(i);
+    newIds[i] = (newIndex == TupleCompactionMap::Removed) ? 0 : static_cast<int32_t>(newIndex);
+  }
+
+  QVector<IDataArray::Pointer> arrays;
+  QVector<IDataArray::Pointer> neighborLists;
+  for(QMap<QString, IDataArray::Pointer>::iterator iter = m_AttributeArrays.begin(); iter != m_AttributeArrays.end(); ++iter)
+  {
+    IDataArray::Pointer p = iter.value();
+    if(p->getTypeAsString().compare("NeighborList<T>") == 0)
     {
-      if(activeObjects[i] == false)
-      {
-        removeList.push_back(i);
-        newNames[i] = 0;
-      }
-      else
+      neighborLists.push_back(p);
+    }
+    else
+    {
+      arrays.push_back(p);
+    }
+  }
+
+  // Only the lists the caller named hold ids of objects in this matrix. As long as none
+  // of the kept lists points at a removed object they are compacted and renumbered, and
+  // the other neighbor lists are compacted with them. Otherwise the neighborhoods they
+  // describe no longer exist and all of the neighbor lists are removed.
+  QVector<Int32NeighborListType::Pointer> idLists;
+  for(int n = 0; n < neighborLists.size(); n++)
+  {
+    if(neighborIdLists.contains(neighborLists[n]->getName()))
+    {
+      Int32NeighborListType::Pointer idList = std::dynamic_pointer_cast<Int32NeighborListType>(neighborLists[n]);
+      if(nullptr == idList.get())
       {
-        newNames[i] = goodcount;
-        goodcount++;
+        return false;
       }
+      idLists.push_back(idList);
     }
-
-    if(removeList.size() > 0)
+  }
+  bool keepNeighborLists = !idLists.isEmpty();
+  for(int n = 0; n < idLists.size() && keepNeighborLists; n++)
+  {
+    Int32NeighborListType::Pointer idList = idLists[n];
+    int32_t numLists = idList->getNumberOfLists();
+    for(int32_t i = 0; i < numLists && keepNeighborLists; i++)
     {
-      QList<QString> headers = getAttributeArrayNames();
-      for(QList<QString>::iterator iter = headers.begin(); iter != headers.end(); ++iter)
+      if(!keep[i])
       {
-        IDataArray::Pointer p = getAttributeArray(*iter);
-        QString type = p->getTypeAsString();
-        if(type.compare("NeighborList<T>") == 0)
-        {
-          removeAttributeArray(*iter);
-        }
-        else
+        continue;
+      }
+      const Int32NeighborListType::VectorType& entries = idList->getConstListReference(i);
+      for(size_t e = 0; e < entries.size(); e++)
+      {
+        if(entries[e] > 0 && entries[e] < keep.size() && !keep[entries[e]])
         {
-          p->eraseTuples(removeList);
+          keepNeighborLists = false;
+          break;
         }
       }
-      QVector<size_t> tDims(1, (totalTuples - removeList.size()));
-      setTupleDimensions(tDims);
+    }
+  }
+  if(keepNeighborLists)
+  {
+    arrays += neighborLists;
+  }
+
+  // Nothing has been modified yet, so bail out while the matrix is still consistent
+  for(int a = 0; a < arrays.size(); a++)
+  {
+    if(arrays[a]->getNumberOfTuples() != totalTuples)
+    {
+      return false;
+    }
+  }
 
-      // Loop over all the points and correct all the feature names
-      size_t totalPoints = featureIds->getNumberOfTuples();
-      int32_t* featureIdPtr = featureIds->getPointer(0);
-      for(size_t i = 0; i < totalPoints; i++)
+  for(int n = 0; n < neighborLists.size() && !keepNeighborLists; n++)
+  {
+    removeAttributeArray(neighborLists[n]->getName());
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+  std::vector<int> compactErrors(static_cast<size_t>(arrays.size()), 0);
+  CompactArraysImpl compactor(arrays, compactionMap, compactErrors);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true && arrays.size() > 1)
+  {
+    tbb::parallel_for(tbb::blocked_range<int>(0, arrays.size(), 1), compactor, tbb::simple_partitioner());
+  }
+  else
+#endif
+  {
+    compactor.compact(0, arrays.size());
+  }
+
+  // The arguments were validated above so this only happens if an array runs out of memory
+  // or does not support compaction. Dropping those arrays keeps every remaining array in step
+  // with the new tuple count and lets the renumbering below finish.
+  bool compacted = true;
+  for(int a = 0; a < arrays.size(); a++)
+  {
+    if(compactErrors[a] < 0)
+    {
+      removeAttributeArray(arrays[a]->getName());
+      compacted = false;
+    }
+  }
+
+  if(keepNeighborLists)
+  {
+    for(int n = 0; n < idLists.size(); n++)
+    {
+      Int32NeighborListType::Pointer idList = idLists[n];
+      int32_t numLists = idList->getNumberOfLists();
+      for(int32_t i = 0; i < numLists; i++)
       {
-        if(featureIdPtr[i] >= 0 && featureIdPtr[i] < newNames.size())
+        Int32NeighborListType::VectorType& entries = idList->getListReference(i);
+        for(size_t e = 0; e < entries.size(); e++)
         {
-          featureIdPtr[i] = static_cast<int32_t>(newNames[featureIdPtr[i]]);
+          if(entries[e] >= 0 && entries[e] < static_cast<int32_t>(newIds.size()))
+          {
+            entries[e] = newIds[entries[e]];
+          }
         }
       }
     }
   }
+
+  QVector<size_t> tDims(1, compactionMap.getNumberOfKeptTuples());
+  setTupleDimensions(tDims);
+
+  // Loop over all the points and correct all the feature names
+  size_t totalPoints = featureIds->getNumberOfTuples();
+  RenumberFeatureIdsImpl renumberer(featureIds->getPointer(0), newIds);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, totalPoints), renumberer, tbb::auto_partitioner());
+  }
   else
+#endif
   {
-    return false;
+    renumberer.renumber(0, totalPoints);
   }
-  return true;
+  return compacted;
 }
 
 // -----------------------------------------------------------------------------
@@ -561,7 +759,8 @@ AttributeMatrix::Pointer AttributeMatrix::deepCopy(bool forceNoAllocate)
   for(QMap<QString, IDataArray::Pointer>::iterator iter = m_AttributeArrays.begin(); iter != m_AttributeArrays.end(); ++iter)
   {
     IDataArray::Pointer d = iter.value();
-    IDataArray::Pointer new_d = d->deepCopy(forceNoAllocate);
+    // The arrays share their data with the originals until either side writes to them
+    IDataArray::Pointer new_d = forceNoAllocate ? d->deepCopy(true) : d->shallowCopyArray();
     if(new_d.get() == nullptr)
     {
       return AttributeMatrix::NullPointer();
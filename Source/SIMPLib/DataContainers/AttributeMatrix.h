@@ -50,6 +50,7 @@
 #include <QtCore/QObject>
 #include <QtCore/QList>
 #include <QtCore/QString>
+#include <QtCore/QStringList>
 #include <QtCore/QMap>
 #include <QtCore/QVector>
 
@@ -561,9 +562,20 @@ public:
     /**
     * @brief Removes inactive objects from the Attribute Matrix and renumbers the active objects to preserve a compact matrix
       (only valid for feature or ensemble type matrices)
-    * @param size The new size of the array
+    *
+    * NeighborLists are removed unless the caller names the Int32 NeighborLists that hold
+    * ids of objects in this matrix. Those are then renumbered like the feature ids and every
+    * other NeighborList, for example one whose entries line up with an id list, is compacted
+    * without touching its values. If a kept object still lists a removed object as a neighbor
+    * all NeighborLists are removed anyway.
+    * @param activeObjects One flag per tuple, false for the objects to remove
+    * @param featureIds The ids that reference this matrix; they are renumbered in place
+    * @param neighborIdLists Names of the Int32 NeighborLists that hold object ids
+    * @return false if the matrix could not be compacted. The matrix is left untouched if the
+    * arguments do not fit it. An array that fails to compact is removed from the matrix, so
+    * the matrix is always left with a consistent tuple count and renumbered feature ids.
     */
-    bool removeInactiveObjects(const QVector<bool> &activeObjects, DataArray<int32_t>* featureIds);
+    bool removeInactiveObjects(const QVector<bool> &activeObjects, DataArray<int32_t>* featureIds, const QStringList& neighborIdLists = QStringList());
 
     /**
      * @brief Sets the Tuple Dimensions for the Attribute Matrix
@@ -586,7 +598,9 @@ public:
     size_t getNumberOfTuples();
 
     /**
-    * @brief creates and returns a copy of the attribute matrix
+    * @brief creates and returns a copy of the attribute matrix. Unless forceNoAllocate is set the
+    * arrays of the copy share their data with the originals until either side writes to them,
+    * see IDataArray::shallowCopyArray().
     * @return On error, will return a null pointer.  It is the responsibility of the calling function to check for errors and return an error message using the PipelineMessage
     */
     virtual AttributeMatrix::Pointer deepCopy(bool forceNoAllocate = false);
@@ -40,6 +40,7 @@ AttributeMatrixProxy::AttributeMatrixProxy()
 : flag(0)
 , name("")
 , amType(AttributeMatrix::Type::Unknown)
+, pyramidLevels(0)
 {
 }
 
@@ -50,6 +51,7 @@ AttributeMatrixProxy::AttributeMatrixProxy(QString am_name, uint8_t read_am , At
 : flag(read_am)
 , name(am_name)
 , amType(am_type)
+, pyramidLevels(0)
 {
 }
 
@@ -62,6 +64,7 @@ AttributeMatrixProxy::AttributeMatrixProxy(const AttributeMatrixProxy& amp)
   name = amp.name;
   amType = amp.amType;
   dataArrays = amp.dataArrays;
+  pyramidLevels = amp.pyramidLevels;
 }
 
 // -----------------------------------------------------------------------------
@@ -78,6 +81,7 @@ void AttributeMatrixProxy::operator=(const AttributeMatrixProxy& amp)
   name = amp.name;
   amType = amp.amType;
   dataArrays = amp.dataArrays;
+  pyramidLevels = amp.pyramidLevels;
 }
 
 
@@ -143,6 +143,7 @@ class SIMPLib_EXPORT AttributeMatrixProxy
     QString name;
     AttributeMatrix::Type amType;
     QMap<QString, DataArrayProxy> dataArrays;
+    int pyramidLevels; // Number of downsampled preview levels stored in the file, not part of the selection
 
   private:
 
@@ -0,0 +1,292 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <iostream>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/DataArrays/StringDataArray.hpp"
+#include "SIMPLib/DataArrays/TupleCompactionMap.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class AttributeMatrixCompactionTest
+{
+public:
+  AttributeMatrixCompactionTest()
+  {
+  }
+  virtual ~AttributeMatrixCompactionTest()
+  {
+  }
+
+  const size_t k_NumFeatures = 6;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCompactionMap()
+  {
+    QVector<bool> keep = {true, false, false, true, true, false, true};
+    TupleCompactionMap map(keep);
+
+    DREAM3D_REQUIRE_EQUAL(map.getNumberOfTuples(), 7)
+    DREAM3D_REQUIRE_EQUAL(map.getNumberOfKeptTuples(), 4)
+    DREAM3D_REQUIRE_EQUAL(map.getNumberOfRemovedTuples(), 3)
+
+    const std::vector<TupleCompactionMap::Run>& runs = map.getRuns();
+    DREAM3D_REQUIRE_EQUAL(runs.size(), 3)
+    DREAM3D_REQUIRE_EQUAL(runs[1].source, 3)
+    DREAM3D_REQUIRE_EQUAL(runs[1].dest, 1)
+    DREAM3D_REQUIRE_EQUAL(runs[1].count, 2)
+
+    DREAM3D_REQUIRE_EQUAL(map.getNewIndex(4), 2)
+    DREAM3D_REQUIRE_EQUAL(map.getNewIndex(5), TupleCompactionMap::Removed)
+
+    QVector<size_t> removed = map.getRemovedTuples();
+    DREAM3D_REQUIRE_EQUAL(removed.size(), 3)
+    DREAM3D_REQUIRE_EQUAL(removed[2], 5)
+
+    // Every array type gives the same result as eraseTuples would
+    Int32ArrayType::Pointer values = Int32ArrayType::CreateArray(7, QVector<size_t>(1, 2), "Values");
+    StringDataArray::Pointer names = StringDataArray::CreateArray(7, "Names");
+    for(int i = 0; i < 7; i++)
+    {
+      values->setComponent(i, 0, i);
+      values->setComponent(i, 1, -i);
+      names->setValue(i, QString::number(i));
+    }
+    DREAM3D_REQUIRE_EQUAL(values->compactTuples(map), 0)
+    DREAM3D_REQUIRE_EQUAL(names->compactTuples(map), 0)
+    DREAM3D_REQUIRE_EQUAL(values->getNumberOfTuples(), 4)
+    DREAM3D_REQUIRE_EQUAL(names->getNumberOfTuples(), 4)
+    DREAM3D_REQUIRE_EQUAL(values->getComponent(2, 0), 4)
+    DREAM3D_REQUIRE_EQUAL(values->getComponent(2, 1), -4)
+    DREAM3D_REQUIRE_EQUAL(values->getComponent(3, 0), 6)
+    DREAM3D_REQUIRE_EQUAL(names->getValue(1), QString("3"))
+
+    // A map for a different tuple count is rejected
+    DREAM3D_REQUIRE_EQUAL(values->compactTuples(map), -100)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AttributeMatrix::Pointer createFeatureMatrix(Int32NeighborListType::Pointer& neighbors)
+  {
+    QVector<size_t> tDims(1, k_NumFeatures);
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellFeatureData", AttributeMatrix::Type::CellFeature);
+
+    Int32ArrayType::Pointer values = Int32ArrayType::CreateArray(k_NumFeatures, QVector<size_t>(1, 2), "Values");
+    FloatArrayType::Pointer sizes = FloatArrayType::CreateArray(k_NumFeatures, "Sizes");
+    for(size_t i = 0; i < k_NumFeatures; i++)
+    {
+      values->setComponent(i, 0, static_cast<int32_t>(i * 10));
+      values->setComponent(i, 1, static_cast<int32_t>(i * 10 + 1));
+      sizes->setValue(i, static_cast<float>(i) * 0.5f);
+    }
+    am->addAttributeArray(values->getName(), values);
+    am->addAttributeArray(sizes->getName(), sizes);
+
+    // Features 2 and 4 only neighbor each other
+    neighbors = Int32NeighborListType::CreateArray(k_NumFeatures, "NeighborList");
+    FloatNeighborListType::Pointer areas = FloatNeighborListType::CreateArray(k_NumFeatures, "SharedSurfaceAreaList");
+    const int32_t lists[6][2] = {{-1, -1}, {3, 5}, {4, -1}, {1, -1}, {2, -1}, {1, 3}};
+    for(size_t i = 1; i < k_NumFeatures; i++)
+    {
+      for(int j = 0; j < 2; j++)
+      {
+        if(lists[i][j] < 0)
+        {
+          continue;
+        }
+        neighbors->addEntry(static_cast<int>(i), lists[i][j]);
+        areas->addEntry(static_cast<int>(i), static_cast<float>(i * 100 + lists[i][j]));
+      }
+    }
+    am->addAttributeArray(neighbors->getName(), neighbors);
+    am->addAttributeArray(areas->getName(), areas);
+    return am;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  Int32ArrayType::Pointer createFeatureIds()
+  {
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(k_NumFeatures * 2, "FeatureIds");
+    for(size_t i = 0; i < k_NumFeatures * 2; i++)
+    {
+      featureIds->setValue(i, static_cast<int32_t>(i % k_NumFeatures));
+    }
+    return featureIds;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRemoveInactiveObjects()
+  {
+    Int32NeighborListType::Pointer neighbors;
+    AttributeMatrix::Pointer am = createFeatureMatrix(neighbors);
+    Int32ArrayType::Pointer featureIds = createFeatureIds();
+
+    // Feature 0 is kept even though it is flagged inactive
+    QVector<bool> active = {false, true, false, true, false, true};
+    QStringList idLists("NeighborList");
+    DREAM3D_REQUIRE_EQUAL(am->removeInactiveObjects(active, featureIds.get(), idLists), true)
+    DREAM3D_REQUIRE_EQUAL(am->getNumberOfTuples(), 4)
+
+    Int32ArrayType::Pointer values = am->getAttributeArrayAs<Int32ArrayType>("Values");
+    DREAM3D_REQUIRE_EQUAL(values->getNumberOfTuples(), 4)
+    DREAM3D_REQUIRE_EQUAL(values->getComponent(2, 0), 30)
+    DREAM3D_REQUIRE_EQUAL(values->getComponent(3, 1), 51)
+    FloatArrayType::Pointer sizes = am->getAttributeArrayAs<FloatArrayType>("Sizes");
+    DREAM3D_REQUIRE_EQUAL(sizes->getValue(3), 2.5f)
+
+    // The named id list moved with its features and was renumbered, the area list moved along
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("NeighborList"), true)
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("SharedSurfaceAreaList"), true)
+    neighbors = am->getAttributeArrayAs<Int32NeighborListType>("NeighborList");
+    DREAM3D_REQUIRE_EQUAL(neighbors->getNumberOfLists(), 4)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getConstListReference(1)[0], 2)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getConstListReference(1)[1], 3)
+    DREAM3D_REQUIRE_EQUAL(neighbors->getConstListReference(3)[1], 2)
+    FloatNeighborListType::Pointer areas = am->getAttributeArrayAs<FloatNeighborListType>("SharedSurfaceAreaList");
+    DREAM3D_REQUIRE_EQUAL(areas->getConstListReference(3)[0], 501.0f)
+
+    const int32_t expected[6] = {0, 1, 0, 2, 0, 3};
+    for(size_t i = 0; i < featureIds->getNumberOfTuples(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(featureIds->getValue(i), expected[i % k_NumFeatures])
+    }
+
+    // Removing a feature that is still somebody's neighbor drops the neighbor lists
+    am = createFeatureMatrix(neighbors);
+    featureIds = createFeatureIds();
+    active = {true, true, true, false, true, true};
+    DREAM3D_REQUIRE_EQUAL(am->removeInactiveObjects(active, featureIds.get(), idLists), true)
+    DREAM3D_REQUIRE_EQUAL(am->getNumberOfTuples(), 5)
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("NeighborList"), false)
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("SharedSurfaceAreaList"), false)
+    DREAM3D_REQUIRE_EQUAL(featureIds->getValue(4), 3)
+
+    // Without named id lists the neighbor lists are removed, as they always were
+    am = createFeatureMatrix(neighbors);
+    featureIds = createFeatureIds();
+    active = {true, true, false, true, false, true};
+    DREAM3D_REQUIRE_EQUAL(am->removeInactiveObjects(active, featureIds.get()), true)
+    DREAM3D_REQUIRE_EQUAL(am->getNumberOfTuples(), 4)
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("NeighborList"), false)
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("SharedSurfaceAreaList"), false)
+    DREAM3D_REQUIRE_EQUAL(am->getAttributeArray("Sizes")->getNumberOfTuples(), 4)
+
+    // Naming a list that does not hold Int32 ids is rejected before anything changes
+    am = createFeatureMatrix(neighbors);
+    DREAM3D_REQUIRE_EQUAL(am->removeInactiveObjects(active, featureIds.get(), QStringList("SharedSurfaceAreaList")), false)
+    DREAM3D_REQUIRE_EQUAL(am->getNumberOfTuples(), k_NumFeatures)
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("NeighborList"), true)
+
+    // An array that does not match the matrix makes it fail without compacting anything
+    am = createFeatureMatrix(neighbors);
+    FloatArrayType::Pointer shortArray = FloatArrayType::CreateArray(k_NumFeatures, "Short");
+    am->addAttributeArray(shortArray->getName(), shortArray);
+    shortArray->resize(k_NumFeatures - 1);
+    DREAM3D_REQUIRE_EQUAL(am->removeInactiveObjects(active, featureIds.get(), idLists), false)
+    DREAM3D_REQUIRE_EQUAL(am->getAttributeArray("Sizes")->getNumberOfTuples(), k_NumFeatures)
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("NeighborList"), true)
+
+    // A keep list that does not match the matrix is rejected
+    QVector<bool> wrongSize(3, true);
+    DREAM3D_REQUIRE_EQUAL(am->removeInactiveObjects(wrongSize, featureIds.get()), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLargeArrayCompaction()
+  {
+    // Large enough to take the parallel, out of place path when TBB is available
+    const size_t numTuples = 1000000;
+    QVector<size_t> cDims(1, 3);
+    FloatArrayType::Pointer data = FloatArrayType::CreateArray(numTuples, cDims, "Large");
+    QVector<bool> keep(static_cast<int>(numTuples), true);
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      data->setComponent(i, 0, static_cast<float>(i));
+      data->setComponent(i, 1, 1.0f);
+      data->setComponent(i, 2, 2.0f);
+      if(i % 7 == 3 || (i > 1000 && i < 5000))
+      {
+        keep[static_cast<int>(i)] = false;
+      }
+    }
+    TupleCompactionMap map(keep);
+    DREAM3D_REQUIRE_EQUAL(data->compactTuples(map), 0)
+    DREAM3D_REQUIRE_EQUAL(data->getNumberOfTuples(), map.getNumberOfKeptTuples())
+    for(size_t i = 0; i < numTuples; i += 997)
+    {
+      size_t newIndex = map.getNewIndex(i);
+      if(newIndex != TupleCompactionMap::Removed)
+      {
+        DREAM3D_REQUIRE_EQUAL(data->getComponent(newIndex, 0), static_cast<float>(i))
+        DREAM3D_REQUIRE_EQUAL(data->getComponent(newIndex, 2), 2.0f)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### AttributeMatrixCompactionTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestCompactionMap());
+    DREAM3D_REGISTER_TEST(TestRemoveInactiveObjects());
+    DREAM3D_REGISTER_TEST(TestLargeArrayCompaction());
+  }
+
+private:
+  AttributeMatrixCompactionTest(const AttributeMatrixCompactionTest&); // Copy Constructor Not Implemented
+  void operator=(const AttributeMatrixCompactionTest&);                // Move assignment Not Implemented
+};
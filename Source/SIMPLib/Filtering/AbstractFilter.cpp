@@ -636,6 +636,10 @@ void AbstractFilter::notifyErrorMessage(const QString& humanLabel, const QString
 // -----------------------------------------------------------------------------
 void AbstractFilter::notifyStatusMessage(const QString& humanLabel, const QString& str)
 {
+  if(!hasMessageReceivers())
+  {
+    return;
+  }
   PipelineMessage pm = PipelineMessage::CreateStatusMessage(getNameOfClass(), humanLabel, str);
   pm.setPipelineIndex(getPipelineIndex());
   emit filterGeneratedMessage(pm);
@@ -646,6 +650,10 @@ void AbstractFilter::notifyStatusMessage(const QString& humanLabel, const QStrin
 // -----------------------------------------------------------------------------
 void AbstractFilter::notifyStatusMessage(const QString& prefix, const QString& humanLabel, const QString& str)
 {
+  if(!hasMessageReceivers())
+  {
+    return;
+  }
   PipelineMessage pm = PipelineMessage::CreateStatusMessage(getNameOfClass(), humanLabel, str);
   pm.setPrefix(prefix);
   pm.setPipelineIndex(getPipelineIndex());
@@ -677,6 +685,10 @@ void AbstractFilter::notifyWarningMessage(const QString& humanLabel, const QStri
 // -----------------------------------------------------------------------------
 void AbstractFilter::notifyProgressMessage(const QString& prefix, const QString& humanLabel, const QString& str, int progress)
 {
+  if(!hasMessageReceivers())
+  {
+    return;
+  }
   PipelineMessage pm = PipelineMessage::CreateStatusMessage(getNameOfClass(), humanLabel, str);
   pm.setPrefix(prefix);
   pm.setProgressValue(progress);
@@ -685,6 +697,14 @@ void AbstractFilter::notifyProgressMessage(const QString& prefix, const QString&
   emit filterGeneratedMessage(pm);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AbstractFilter::publishProgress(int progress, const QString& message)
+{
+  notifyProgressMessage(getMessagePrefix(), getHumanLabel(), message, progress);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
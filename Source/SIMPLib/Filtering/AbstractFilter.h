@@ -418,6 +418,13 @@ public slots:
   virtual void renameDataArrayPaths(DataArrayPath::RenameContainer renamedPaths);
 
 protected:
+  /**
+   * @brief publishProgress Sends the sampled progress with this filter's message prefix and human label
+   * @param progress
+   * @param message
+   */
+  void publishProgress(int progress, const QString& message) override;
+
   AbstractFilter();
 
 protected slots:
@@ -49,6 +49,8 @@
 FilterPipeline::FilterPipeline()
 : QObject()
 , m_ErrorCondition(0)
+, m_ProgressSampleInterval(100)
+, m_ReleaseDeadArrays(false)
 , m_Cancel(false)
 , m_PipelineName("")
 , m_Dca(nullptr)
@@ -617,6 +619,31 @@ int FilterPipeline::preflightPipeline()
   return preflightError;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineMemoryPlanner::Pointer FilterPipeline::createMemoryPlan()
+{
+  // Filters that already executed have released their DataContainerArray
+  for(AbstractFilter::Pointer filter : m_Pipeline)
+  {
+    if(nullptr == filter->getDataContainerArray().get())
+    {
+      filter->setDataContainerArray(DataContainerArray::New());
+    }
+  }
+  if(preflightPipeline() < 0)
+  {
+    return PipelineMemoryPlanner::NullPointer();
+  }
+  PipelineMemoryPlanner::Pointer planner = PipelineMemoryPlanner::New();
+  if(planner->plan(m_Pipeline) < 0)
+  {
+    return PipelineMemoryPlanner::NullPointer();
+  }
+  return planner;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -641,9 +668,24 @@ DataContainerArray::Pointer FilterPipeline::execute()
   }
 
   PipelineMessage progValue("", "", 0, PipelineMessage::MessageType::ProgressValue, -1);
+
+  PipelineMemoryPlanner::Pointer memoryPlan;
+  if(getReleaseDeadArrays())
+  {
+    memoryPlan = createMemoryPlan();
+    if(nullptr != memoryPlan.get())
+    {
+      progValue.setType(PipelineMessage::MessageType::StatusMessage);
+      progValue.setText(memoryPlan->getSummary());
+      emit pipelineGeneratedMessage(progValue);
+    }
+  }
+
+  int filterIndex = -1;
   for(FilterContainerType::iterator filter = m_Pipeline.begin(); filter != m_Pipeline.end(); ++filter)
   {
     AbstractFilter::Pointer filt = *filter;
+    filterIndex++;
     progress = progress + 1.0f;
     progValue.setType(PipelineMessage::MessageType::ProgressValue);
     progValue.setProgressValue(static_cast<int>(progress / (m_Pipeline.size() + 1) * 100.0f));
@@ -663,7 +705,10 @@ DataContainerArray::Pointer FilterPipeline::execute()
       connectFilterNotifications(filt.get());
       filt->setDataContainerArray(m_Dca);
       setCurrentFilter(*filter);
+      filt->getProgressChannel().setSampleInterval(getProgressSampleInterval());
       filt->execute();
+      // Flush anything the filter left in its progress channel (early returns, errors)
+      filt->endProgress();
       disconnectFilterNotifications((*filter).get());
       filt->setDataContainerArray(DataContainerArray::NullPointer());
       err = filt->getErrorCondition();
@@ -685,6 +730,10 @@ DataContainerArray::Pointer FilterPipeline::execute()
 
         return m_Dca;
       }
+      if(nullptr != memoryPlan.get())
+      {
+        memoryPlan->releaseDeadArrays(filterIndex, m_Dca);
+      }
     }
 
     if(this->getCancel() == true)
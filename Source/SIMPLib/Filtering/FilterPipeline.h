@@ -45,6 +45,7 @@
 #include "SIMPLib/Common/Observer.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/PipelineMemoryPlanner.h"
 #include "SIMPLib/SIMPLib.h"
 
 class IObserver;
@@ -91,6 +92,19 @@ public:
   SIMPL_INSTANCE_PROPERTY(int, ErrorCondition)
   SIMPL_INSTANCE_PROPERTY(AbstractFilter::Pointer, CurrentFilter)
 
+  /**
+   * @brief The minimum time in milliseconds between two progress updates sampled from an
+   * executing filter's ProgressChannel.
+   */
+  SIMPL_INSTANCE_PROPERTY(int, ProgressSampleInterval)
+
+  /**
+   * @brief When true, execute() preflights the pipeline, plans the lifetime of
+   * every array and removes intermediate arrays as soon as no later filter needs
+   * them. See PipelineMemoryPlanner for the rules. Defaults to false.
+   */
+  SIMPL_INSTANCE_PROPERTY(bool, ReleaseDeadArrays)
+
   /**
    * @brief Cancel the operation
    */
@@ -109,6 +123,13 @@ public:
    */
   virtual int preflightPipeline();
 
+  /**
+   * @brief createMemoryPlan Preflights the pipeline and returns the array
+   * lifetime analysis, including the predicted peak memory.
+   * @return The plan or a nullptr if the preflight failed
+   */
+  virtual PipelineMemoryPlanner::Pointer createMemoryPlan();
+
   /**
    * @brief
    */
@@ -0,0 +1,177 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "LazyFilterFactory.h"
+
+#include <QtCore/QMutexLocker>
+
+#include "SIMPLib/Filtering/FilterManager.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+LazyFilterFactory::PluginLoad::PluginLoad(LoadFunction loadFunction)
+: m_LoadFunction(loadFunction)
+, m_Attempted(false)
+, m_Loaded(false)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool LazyFilterFactory::PluginLoad::load()
+{
+  QMutexLocker locker(&m_Mutex);
+  if(!m_Attempted)
+  {
+    m_Attempted = true;
+    m_Loaded = m_LoadFunction();
+  }
+  return m_Loaded;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool LazyFilterFactory::PluginLoad::isLoaded()
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Loaded;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+LazyFilterFactory::LazyFilterFactory(FilterManager* filterManager, const PluginManifestCache::FilterEntry& entry, PluginLoadPointer pluginLoad)
+: m_FilterManager(filterManager)
+, m_Entry(entry)
+, m_PluginLoad(pluginLoad)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+LazyFilterFactory::~LazyFilterFactory() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+LazyFilterFactory::Pointer LazyFilterFactory::New(FilterManager* filterManager, const PluginManifestCache::FilterEntry& entry, PluginLoadPointer pluginLoad)
+{
+  Pointer sharedPtr(new LazyFilterFactory(filterManager, entry, pluginLoad));
+  return sharedPtr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer LazyFilterFactory::create() const
+{
+  // Loading the plugin replaces this factory in the FilterManager, which may drop the last
+  // reference to it, so only use copies of the members from here on.
+  FilterManager* filterManager = m_FilterManager;
+  QString className = m_Entry.className;
+  PluginLoadPointer pluginLoad = m_PluginLoad;
+  if(!pluginLoad->load())
+  {
+    return AbstractFilter::NullPointer();
+  }
+
+  IFilterFactory::Pointer factory = filterManager->getFactoryFromClassName(className);
+  if(nullptr == factory.get() || nullptr != std::dynamic_pointer_cast<LazyFilterFactory>(factory))
+  {
+    // The plugin changed since the manifest was written and no longer provides this filter
+    return AbstractFilter::NullPointer();
+  }
+  return factory->create();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString LazyFilterFactory::getFilterClassName() const
+{
+  return m_Entry.className;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString LazyFilterFactory::getFilterGroup() const
+{
+  return m_Entry.groupName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString LazyFilterFactory::getFilterSubGroup() const
+{
+  return m_Entry.subGroupName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString LazyFilterFactory::getFilterHumanLabel() const
+{
+  return m_Entry.humanLabel;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString LazyFilterFactory::getBrandingString() const
+{
+  return m_Entry.brandingString;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString LazyFilterFactory::getCompiledLibraryName() const
+{
+  return m_Entry.compiledLibraryName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QUuid LazyFilterFactory::getUuid() const
+{
+  return m_Entry.uuid;
+}
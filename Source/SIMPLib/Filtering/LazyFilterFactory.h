@@ -0,0 +1,131 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _lazyfilterfactory_h_
+#define _lazyfilterfactory_h_
+
+#include <functional>
+#include <memory>
+
+#include <QtCore/QMutex>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Filtering/IFilterFactory.hpp"
+#include "SIMPLib/Plugin/PluginManifestCache.h"
+#include "SIMPLib/SIMPLib.h"
+
+class FilterManager;
+
+/**
+ * @brief The LazyFilterFactory class stands in for the factory of a filter that lives in a plugin
+ * that has not been loaded yet. It answers every query from the plugin manifest cache and only
+ * loads the plugin library the first time a filter is created. Loading the plugin registers the
+ * real factories with the FilterManager, replacing the lazy ones, and create() then forwards
+ * to the real factory.
+ */
+class SIMPLib_EXPORT LazyFilterFactory : public IFilterFactory
+{
+public:
+  SIMPL_SHARED_POINTERS(LazyFilterFactory)
+  SIMPL_TYPE_MACRO_SUPER(LazyFilterFactory, IFilterFactory)
+
+  /**
+   * @brief The PluginLoad class loads one plugin library at most once. It is shared by the lazy
+   * factories of every filter in that plugin.
+   */
+  class SIMPLib_EXPORT PluginLoad
+  {
+  public:
+    typedef std::function<bool()> LoadFunction;
+
+    PluginLoad(LoadFunction loadFunction);
+
+    /**
+     * @brief Loads the plugin unless an earlier call already tried
+     * @return true if the plugin is loaded
+     */
+    bool load();
+
+    /**
+     * @brief Returns true once the plugin was loaded successfully
+     */
+    bool isLoaded();
+
+  private:
+    QMutex m_Mutex;
+    LoadFunction m_LoadFunction;
+    bool m_Attempted;
+    bool m_Loaded;
+  };
+  typedef std::shared_ptr<PluginLoad> PluginLoadPointer;
+
+  /**
+   * @brief New
+   * @param filterManager The manager the real factory gets registered with
+   * @param entry The cached description of the filter
+   * @param pluginLoad Loads the plugin holding the filter
+   * @return
+   */
+  static Pointer New(FilterManager* filterManager, const PluginManifestCache::FilterEntry& entry, PluginLoadPointer pluginLoad);
+
+  virtual ~LazyFilterFactory();
+
+  /**
+   * @brief Loads the plugin if needed and creates the filter through the real factory
+   * @return The filter or a null pointer if the plugin failed to load or no longer has the filter
+   */
+  AbstractFilter::Pointer create() const override;
+
+  QString getFilterClassName() const override;
+  QString getFilterGroup() const override;
+  QString getFilterSubGroup() const override;
+  QString getFilterHumanLabel() const override;
+  QString getBrandingString() const override;
+  QString getCompiledLibraryName() const override;
+  QUuid getUuid() const override;
+
+protected:
+  LazyFilterFactory(FilterManager* filterManager, const PluginManifestCache::FilterEntry& entry, PluginLoadPointer pluginLoad);
+
+private:
+  FilterManager* m_FilterManager;
+  PluginManifestCache::FilterEntry m_Entry;
+  PluginLoadPointer m_PluginLoad;
+
+  LazyFilterFactory(const LazyFilterFactory&) = delete; // Copy Constructor Not Implemented
+  void operator=(const LazyFilterFactory&) = delete;    // Move assignment Not Implemented
+};
+
+#endif /* _LazyFilterFactory_H_ */
@@ -0,0 +1,422 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineMemoryPlanner.h"
+
+#include <algorithm>
+
+#include <QtCore/QMap>
+#include <QtCore/QObject>
+#include <QtCore/QSet>
+#include <QtCore/QVariant>
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/FilterParameters/AxisAngleInput.h"
+#include "SIMPLib/FilterParameters/DynamicTableData.h"
+#include "SIMPLib/FilterParameters/FileListInfoFilterParameter.h"
+#include "SIMPLib/FilterParameters/FilterParameter.h"
+#include "SIMPLib/FilterParameters/FloatVec2FilterParameter.h"
+#include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
+#include "SIMPLib/FilterParameters/FourthOrderPolynomialFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntVec3FilterParameter.h"
+#include "SIMPLib/FilterParameters/RangeFilterParameter.h"
+#include "SIMPLib/FilterParameters/SecondOrderPolynomialFilterParameter.h"
+#include "SIMPLib/FilterParameters/ThirdOrderPolynomialFilterParameter.h"
+
+namespace
+{
+/**
+ * @brief Returns true if the referenced path names the array itself, its
+ * AttributeMatrix or its DataContainer
+ */
+bool pathCovers(const DataArrayPath& ref, const DataArrayPath& path)
+{
+  if(ref.getDataContainerName().isEmpty() || ref.getDataContainerName() != path.getDataContainerName())
+  {
+    return false;
+  }
+  if(ref.getAttributeMatrixName().isEmpty())
+  {
+    return true;
+  }
+  if(ref.getAttributeMatrixName() != path.getAttributeMatrixName())
+  {
+    return false;
+  }
+  return ref.getDataArrayName().isEmpty() || ref.getDataArrayName() == path.getDataArrayName();
+}
+
+/**
+ * @brief Returns true if a filter parameter value of this type can not name an
+ * existing array. Array names held in a QString are resolved inside an
+ * AttributeMatrix or DataContainer that another parameter of the filter selects.
+ */
+bool isPlainValueType(int type)
+{
+  switch(type)
+  {
+  case QMetaType::UnknownType:
+  case QMetaType::Bool:
+  case QMetaType::Int:
+  case QMetaType::UInt:
+  case QMetaType::Long:
+  case QMetaType::ULong:
+  case QMetaType::LongLong:
+  case QMetaType::ULongLong:
+  case QMetaType::Short:
+  case QMetaType::UShort:
+  case QMetaType::Char:
+  case QMetaType::SChar:
+  case QMetaType::UChar:
+  case QMetaType::Float:
+  case QMetaType::Double:
+  case QMetaType::QString:
+    return true;
+  default:
+    break;
+  }
+  if((QMetaType::typeFlags(type) & QMetaType::IsEnumeration) != 0)
+  {
+    return true;
+  }
+  static const QSet<int> valueTypes = {qMetaTypeId<FloatVec2_t>(),         qMetaTypeId<FloatVec3_t>(),         qMetaTypeId<IntVec3_t>(),
+                                       qMetaTypeId<FPRangePair>(),         qMetaTypeId<DynamicTableData>(),    qMetaTypeId<AxisAngleInput_t>(),
+                                       qMetaTypeId<FileListInfo_t>(),      qMetaTypeId<Float2ndOrderPoly_t>(), qMetaTypeId<Float3rdOrderPoly_t>(),
+                                       qMetaTypeId<Float4thOrderPoly_t>()};
+  return valueTypes.contains(type);
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineMemoryPlanner::PipelineMemoryPlanner()
+: m_PeakBytes(0)
+, m_PlannedPeakBytes(0)
+, m_PlannedPeakFilterIndex(-1)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineMemoryPlanner::~PipelineMemoryPlanner() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineMemoryPlanner::plan(const QList<AbstractFilter::Pointer>& pipeline)
+{
+  m_Lifetimes.clear();
+  m_ReleaseAfter.clear();
+  m_ReleaseAfter.resize(pipeline.size());
+  m_PeakBytes = 0;
+  m_PlannedPeakBytes = 0;
+  m_PlannedPeakFilterIndex = -1;
+
+  // Serialized path -> index into m_Lifetimes for every array that currently exists
+  QMap<QString, int> live;
+  int lastEnabled = -1;
+
+  for(int i = 0; i < pipeline.size(); i++)
+  {
+    AbstractFilter::Pointer filter = pipeline[i];
+    if(!filter->getEnabled())
+    {
+      continue;
+    }
+    DataContainerArray::Pointer dca = filter->getDataContainerArray();
+    if(nullptr == dca.get())
+    {
+      return -1;
+    }
+    lastEnabled = i;
+
+    // Everything the filter references was in use while it executed, including arrays it removes
+    QVector<DataArrayPath> refs = GetReferencedPaths(filter);
+    bool writesAll = WritesAllData(filter);
+    bool usesAll = writesAll || HasUnknownReferences(filter);
+    for(QMap<QString, int>::iterator iter = live.begin(); iter != live.end(); ++iter)
+    {
+      ArrayLifetime& lifetime = m_Lifetimes[iter.value()];
+      bool used = usesAll;
+      for(int r = 0; r < refs.size() && !used; r++)
+      {
+        used = pathCovers(refs[r], lifetime.path);
+      }
+      if(used)
+      {
+        lifetime.lastUse = i;
+        lifetime.written = lifetime.written || writesAll;
+      }
+    }
+
+    // The filter's preflighted DataContainerArray shows which arrays exist after it ran
+    QSet<QString> current;
+    for(DataContainer::Pointer dc : dca->getDataContainers())
+    {
+      QVector<DataArrayPath> paths = dc->getAllDataArrayPaths();
+      for(const DataArrayPath& path : paths)
+      {
+        QString key = path.serialize();
+        current.insert(key);
+        if(!live.contains(key))
+        {
+          ArrayLifetime lifetime;
+          lifetime.path = path;
+          lifetime.bytes = EstimateBytes(dca->getAttributeMatrix(path)->getAttributeArray(path.getDataArrayName()));
+          lifetime.createdBy = i;
+          lifetime.lastUse = i;
+          live.insert(key, m_Lifetimes.size());
+          m_Lifetimes.push_back(lifetime);
+        }
+      }
+    }
+    QMap<QString, int>::iterator iter = live.begin();
+    while(iter != live.end())
+    {
+      if(!current.contains(iter.key()))
+      {
+        m_Lifetimes[iter.value()].removedBy = i;
+        iter = live.erase(iter);
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+  }
+
+  for(int l = 0; l < m_Lifetimes.size(); l++)
+  {
+    ArrayLifetime& lifetime = m_Lifetimes[l];
+    // Only intermediates that some later filter consumed, that nothing writes
+    // out, and that would otherwise stay alive past their last use
+    lifetime.releasable = lifetime.lastUse > lifetime.createdBy && !lifetime.written && lifetime.lastUse < lastEnabled &&
+                          (lifetime.removedBy < 0 || lifetime.removedBy > lifetime.lastUse + 1);
+    if(lifetime.releasable)
+    {
+      m_ReleaseAfter[lifetime.lastUse].push_back(l);
+    }
+  }
+
+  for(int i = 0; i < pipeline.size(); i++)
+  {
+    size_t keptBytes = 0;
+    size_t plannedBytes = 0;
+    for(const ArrayLifetime& lifetime : m_Lifetimes)
+    {
+      if(lifetime.createdBy > i || (lifetime.removedBy >= 0 && lifetime.removedBy < i))
+      {
+        continue;
+      }
+      keptBytes += lifetime.bytes;
+      if(!lifetime.releasable || lifetime.lastUse >= i)
+      {
+        plannedBytes += lifetime.bytes;
+      }
+    }
+    m_PeakBytes = std::max(m_PeakBytes, keptBytes);
+    if(plannedBytes > m_PlannedPeakBytes)
+    {
+      m_PlannedPeakBytes = plannedBytes;
+      m_PlannedPeakFilterIndex = i;
+    }
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QVector<PipelineMemoryPlanner::ArrayLifetime>& PipelineMemoryPlanner::getLifetimes() const
+{
+  return m_Lifetimes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath> PipelineMemoryPlanner::getArraysToReleaseAfter(int filterIndex) const
+{
+  QVector<DataArrayPath> paths;
+  if(filterIndex < 0 || filterIndex >= m_ReleaseAfter.size())
+  {
+    return paths;
+  }
+  for(int l : m_ReleaseAfter[filterIndex])
+  {
+    paths.push_back(m_Lifetimes[l].path);
+  }
+  return paths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PipelineMemoryPlanner::releaseDeadArrays(int filterIndex, DataContainerArray::Pointer dca) const
+{
+  size_t released = 0;
+  if(nullptr == dca.get() || filterIndex < 0 || filterIndex >= m_ReleaseAfter.size())
+  {
+    return released;
+  }
+  for(int l : m_ReleaseAfter[filterIndex])
+  {
+    const ArrayLifetime& lifetime = m_Lifetimes[l];
+    AttributeMatrix::Pointer am = dca->getAttributeMatrix(lifetime.path);
+    if(nullptr == am.get())
+    {
+      continue;
+    }
+    IDataArray::Pointer array = am->removeAttributeArray(lifetime.path.getDataArrayName());
+    if(nullptr != array.get())
+    {
+      released += EstimateBytes(array);
+    }
+  }
+  return released;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PipelineMemoryPlanner::getPeakBytes() const
+{
+  return m_PeakBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PipelineMemoryPlanner::getPlannedPeakBytes() const
+{
+  return m_PlannedPeakBytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineMemoryPlanner::getPlannedPeakFilterIndex() const
+{
+  return m_PlannedPeakFilterIndex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineMemoryPlanner::getSummary() const
+{
+  int releasable = 0;
+  for(const ArrayLifetime& lifetime : m_Lifetimes)
+  {
+    releasable += lifetime.releasable ? 1 : 0;
+  }
+  const double mb = 1024.0 * 1024.0;
+  return QObject::tr("Predicted peak memory %1 MB (%2 MB if every array is kept), %3 of %4 arrays can be released early")
+      .arg(static_cast<double>(m_PlannedPeakBytes) / mb, 0, 'f', 1)
+      .arg(static_cast<double>(m_PeakBytes) / mb, 0, 'f', 1)
+      .arg(releasable)
+      .arg(m_Lifetimes.size());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t PipelineMemoryPlanner::EstimateBytes(IDataArray::Pointer array)
+{
+  if(nullptr == array.get())
+  {
+    return 0;
+  }
+  return array->getNumberOfTuples() * static_cast<size_t>(array->getNumberOfComponents()) * array->getTypeSize();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath> PipelineMemoryPlanner::GetReferencedPaths(AbstractFilter::Pointer filter)
+{
+  QVector<DataArrayPath> paths;
+  QVector<FilterParameter::Pointer> parameters = filter->getFilterParameters();
+  for(FilterParameter::Pointer parameter : parameters)
+  {
+    QVariant value = filter->property(parameter->getPropertyName().toLatin1().constData());
+    if(value.userType() == qMetaTypeId<DataArrayPath>())
+    {
+      paths.push_back(value.value<DataArrayPath>());
+    }
+    else if(value.userType() == qMetaTypeId<QVector<DataArrayPath>>())
+    {
+      paths += value.value<QVector<DataArrayPath>>();
+    }
+    else if(parameter->getWidgetType() == "DataContainerSelectionWidget")
+    {
+      paths.push_back(DataArrayPath(value.toString(), "", ""));
+    }
+  }
+  return paths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineMemoryPlanner::HasUnknownReferences(AbstractFilter::Pointer filter)
+{
+  QVector<FilterParameter::Pointer> parameters = filter->getFilterParameters();
+  for(FilterParameter::Pointer parameter : parameters)
+  {
+    QVariant value = filter->property(parameter->getPropertyName().toLatin1().constData());
+    int type = value.userType();
+    if(type == qMetaTypeId<DataArrayPath>() || type == qMetaTypeId<QVector<DataArrayPath>>() || parameter->getWidgetType() == "DataContainerSelectionWidget")
+    {
+      continue;
+    }
+    if(!isPlainValueType(type))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineMemoryPlanner::WritesAllData(AbstractFilter::Pointer filter)
+{
+  return filter->getNameOfClass() == "DataContainerWriter";
+}
@@ -0,0 +1,179 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _pipelinememoryplanner_h_
+#define _pipelinememoryplanner_h_
+
+#include <QtCore/QList>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The PipelineMemoryPlanner class analyzes a preflighted pipeline to find
+ * out when each DataArray is created, when it is last referenced by a filter and
+ * how many bytes it will occupy. From that it predicts the peak memory use of the
+ * pipeline and lists the intermediate arrays that can be released as soon as the
+ * last filter that needs them has executed.
+ *
+ * An array is only considered an intermediate, and therefore releasable, if it
+ * was created by a filter in the pipeline and is referenced by at least one later
+ * filter. Arrays that are never read again are treated as results and kept, and
+ * arrays that are still alive when a DataContainerWriter runs are kept so the
+ * written file and the returned DataContainerArray stay complete.
+ *
+ * A filter references an array if one of its filter parameters holds the path of
+ * that array, of its AttributeMatrix or of its DataContainer. A filter with a
+ * parameter whose value type is not understood (ComparisonInputs, a
+ * DataContainerArrayProxy, ...) is assumed to reference every array that exists
+ * when it executes.
+ */
+class SIMPLib_EXPORT PipelineMemoryPlanner
+{
+  public:
+    SIMPL_SHARED_POINTERS(PipelineMemoryPlanner)
+    SIMPL_TYPE_MACRO(PipelineMemoryPlanner)
+    SIMPL_STATIC_NEW_MACRO(PipelineMemoryPlanner)
+
+    virtual ~PipelineMemoryPlanner();
+
+    /**
+     * @brief The ArrayLifetime struct describes one DataArray in the pipeline
+     */
+    struct ArrayLifetime
+    {
+      DataArrayPath path;
+      size_t bytes = 0;
+      int createdBy = -1;  //!< Index of the filter that created the array
+      int lastUse = -1;    //!< Index of the last filter that references the array
+      int removedBy = -1;  //!< Index of the filter that removed the array, -1 if it survives
+      bool written = false; //!< The array exists when a DataContainerWriter executes
+      bool releasable = false;
+    };
+
+    /**
+     * @brief plan Analyzes the pipeline. Every enabled filter must have been
+     * preflighted so that it holds the DataContainerArray it produced.
+     * @param pipeline The filters in execution order
+     * @return Zero on success, a negative value if a filter has not been preflighted
+     */
+    int plan(const QList<AbstractFilter::Pointer>& pipeline);
+
+    /**
+     * @brief getLifetimes Returns the lifetime of every array found by plan()
+     */
+    const QVector<ArrayLifetime>& getLifetimes() const;
+
+    /**
+     * @brief getArraysToReleaseAfter Returns the arrays that are no longer needed
+     * once the filter at the given index has executed
+     */
+    QVector<DataArrayPath> getArraysToReleaseAfter(int filterIndex) const;
+
+    /**
+     * @brief releaseDeadArrays Removes the arrays that are no longer needed once
+     * the filter at the given index has executed
+     * @return The estimated number of bytes that were released
+     */
+    size_t releaseDeadArrays(int filterIndex, DataContainerArray::Pointer dca) const;
+
+    /**
+     * @brief getPeakBytes Returns the predicted peak memory if every array is kept
+     * until the end of the pipeline, which is the default behavior
+     */
+    size_t getPeakBytes() const;
+
+    /**
+     * @brief getPlannedPeakBytes Returns the predicted peak memory if dead
+     * intermediate arrays are released
+     */
+    size_t getPlannedPeakBytes() const;
+
+    /**
+     * @brief getPlannedPeakFilterIndex Returns the index of the filter that
+     * executes while the planned peak is reached
+     */
+    int getPlannedPeakFilterIndex() const;
+
+    /**
+     * @brief getSummary Returns a one line human readable summary of the plan
+     */
+    QString getSummary() const;
+
+    /**
+     * @brief EstimateBytes Returns the number of bytes the array will occupy once
+     * allocated. This works on the unallocated arrays created during preflight.
+     */
+    static size_t EstimateBytes(IDataArray::Pointer array);
+
+    /**
+     * @brief GetReferencedPaths Returns every DataArrayPath held by the filter
+     * parameters of the filter. DataContainer selections are returned as paths
+     * with only the DataContainer name set.
+     */
+    static QVector<DataArrayPath> GetReferencedPaths(AbstractFilter::Pointer filter);
+
+    /**
+     * @brief HasUnknownReferences Returns true if the filter has a parameter that
+     * may name arrays in a way GetReferencedPaths() does not understand
+     */
+    static bool HasUnknownReferences(AbstractFilter::Pointer filter);
+
+    /**
+     * @brief WritesAllData Returns true for filters that write the whole
+     * DataContainerArray to disk
+     */
+    static bool WritesAllData(AbstractFilter::Pointer filter);
+
+  protected:
+    PipelineMemoryPlanner();
+
+  private:
+    QVector<ArrayLifetime> m_Lifetimes;
+    QVector<QVector<int>> m_ReleaseAfter;
+    size_t m_PeakBytes;
+    size_t m_PlannedPeakBytes;
+    int m_PlannedPeakFilterIndex;
+
+    PipelineMemoryPlanner(const PipelineMemoryPlanner&) = delete; // Copy Constructor Not Implemented
+    void operator=(const PipelineMemoryPlanner&) = delete;        // Move assignment Not Implemented
+};
+
+#endif /* _pipelinememoryplanner_h_ */
@@ -0,0 +1,218 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <iostream>
+
+#include "SIMPLib/CoreFilters/CreateAttributeMatrix.h"
+#include "SIMPLib/CoreFilters/CreateDataArray.h"
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/CoreFilters/MultiThresholdObjects.h"
+#include "SIMPLib/CoreFilters/ReplaceValueInArray.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Filtering/ComparisonInputs.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Filtering/PipelineMemoryPlanner.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class PipelineMemoryPlannerTest
+{
+public:
+  PipelineMemoryPlannerTest()
+  {
+  }
+  virtual ~PipelineMemoryPlannerTest()
+  {
+  }
+
+  const size_t k_NumTuples = 100;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  AbstractFilter::Pointer createArrayFilter(const QString& name, SIMPL::ScalarTypes::Type type, int numComps)
+  {
+    CreateDataArray::Pointer filter = CreateDataArray::New();
+    filter->setNewArray(DataArrayPath("DC", "AM", name));
+    filter->setScalarType(type);
+    filter->setNumberOfComponents(numComps);
+    filter->setInitializationValue("1");
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  // 0: create DC, 1: create AM, 2: create A, 3: create B, 4: read A, 5: create C
+  // -----------------------------------------------------------------------------
+  FilterPipeline::Pointer createPipeline()
+  {
+    FilterPipeline::Pointer pipeline = FilterPipeline::New();
+
+    CreateDataContainer::Pointer createDc = CreateDataContainer::New();
+    createDc->setDataContainerName("DC");
+    pipeline->pushBack(createDc);
+
+    CreateAttributeMatrix::Pointer createAm = CreateAttributeMatrix::New();
+    createAm->setCreatedAttributeMatrix(DataArrayPath("DC", "AM", ""));
+    createAm->setAttributeMatrixType(static_cast<int>(AttributeMatrix::Type::Cell));
+    std::vector<std::vector<double>> tupleDims(1, std::vector<double>(1, static_cast<double>(k_NumTuples)));
+    createAm->setTupleDimensions(DynamicTableData(tupleDims));
+    pipeline->pushBack(createAm);
+
+    pipeline->pushBack(createArrayFilter("A", SIMPL::ScalarTypes::Type::Int32, 1));
+    pipeline->pushBack(createArrayFilter("B", SIMPL::ScalarTypes::Type::Float, 3));
+
+    ReplaceValueInArray::Pointer replace = ReplaceValueInArray::New();
+    replace->setSelectedArray(DataArrayPath("DC", "AM", "A"));
+    replace->setRemoveValue(1.0);
+    replace->setReplaceValue(2.0);
+    pipeline->pushBack(replace);
+
+    pipeline->pushBack(createArrayFilter("C", SIMPL::ScalarTypes::Type::Int8, 1));
+    return pipeline;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLifetimes()
+  {
+    FilterPipeline::Pointer pipeline = createPipeline();
+    PipelineMemoryPlanner::Pointer plan = pipeline->createMemoryPlan();
+    DREAM3D_REQUIRE_VALID_POINTER(plan.get())
+
+    const QVector<PipelineMemoryPlanner::ArrayLifetime>& lifetimes = plan->getLifetimes();
+    DREAM3D_REQUIRE_EQUAL(lifetimes.size(), 3)
+
+    DREAM3D_REQUIRE_EQUAL(lifetimes[0].path.getDataArrayName(), QString("A"))
+    DREAM3D_REQUIRE_EQUAL(lifetimes[0].createdBy, 2)
+    DREAM3D_REQUIRE_EQUAL(lifetimes[0].lastUse, 4)
+    DREAM3D_REQUIRE_EQUAL(lifetimes[0].bytes, k_NumTuples * sizeof(int32_t))
+    DREAM3D_REQUIRE_EQUAL(lifetimes[0].releasable, true)
+
+    // Never read again, so it is a result and must be kept
+    DREAM3D_REQUIRE_EQUAL(lifetimes[1].path.getDataArrayName(), QString("B"))
+    DREAM3D_REQUIRE_EQUAL(lifetimes[1].bytes, k_NumTuples * 3 * sizeof(float))
+    DREAM3D_REQUIRE_EQUAL(lifetimes[1].releasable, false)
+    DREAM3D_REQUIRE_EQUAL(lifetimes[2].releasable, false)
+
+    QVector<DataArrayPath> release = plan->getArraysToReleaseAfter(4);
+    DREAM3D_REQUIRE_EQUAL(release.size(), 1)
+    DREAM3D_REQUIRE(release[0] == DataArrayPath("DC", "AM", "A"))
+
+    size_t a = k_NumTuples * sizeof(int32_t);
+    size_t b = k_NumTuples * 3 * sizeof(float);
+    size_t c = k_NumTuples * sizeof(int8_t);
+    DREAM3D_REQUIRE_EQUAL(plan->getPeakBytes(), a + b + c)
+    DREAM3D_REQUIRE_EQUAL(plan->getPlannedPeakBytes(), a + b)
+    DREAM3D_REQUIRE_EQUAL(plan->getPlannedPeakFilterIndex(), 3)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReleaseDuringExecute()
+  {
+    FilterPipeline::Pointer pipeline = createPipeline();
+    pipeline->setReleaseDeadArrays(true);
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE(pipeline->getErrorCondition() >= 0)
+
+    AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath("DC", "AM", ""));
+    DREAM3D_REQUIRE_VALID_POINTER(am.get())
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("A"), false)
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("B"), true)
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("C"), true)
+
+    // The default keeps every array
+    pipeline = createPipeline();
+    dca = pipeline->execute();
+    am = dca->getAttributeMatrix(DataArrayPath("DC", "AM", ""));
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("A"), true)
+  }
+
+  // -----------------------------------------------------------------------------
+  // MultiThresholdObjects names its input arrays inside ComparisonInputs, which
+  // the planner can not decode, so it has to keep every array alive for it
+  // -----------------------------------------------------------------------------
+  void TestUnknownParameterTypes()
+  {
+    FilterPipeline::Pointer pipeline = createPipeline();
+    ComparisonInputs thresholds;
+    thresholds.addInput("DC", "AM", "A", SIMPL::Comparison::Operator_GreaterThan, 0.0);
+    MultiThresholdObjects::Pointer threshold = MultiThresholdObjects::New();
+    threshold->setSelectedThresholds(thresholds);
+    threshold->setDestinationArrayName("Mask");
+    pipeline->insert(5, threshold);
+
+    DREAM3D_REQUIRE_EQUAL(PipelineMemoryPlanner::HasUnknownReferences(threshold), true)
+    DREAM3D_REQUIRE_EQUAL(PipelineMemoryPlanner::HasUnknownReferences(createArrayFilter("D", SIMPL::ScalarTypes::Type::Int32, 1)), false)
+
+    PipelineMemoryPlanner::Pointer plan = pipeline->createMemoryPlan();
+    DREAM3D_REQUIRE_VALID_POINTER(plan.get())
+    const QVector<PipelineMemoryPlanner::ArrayLifetime>& lifetimes = plan->getLifetimes();
+    DREAM3D_REQUIRE_EQUAL(lifetimes[0].path.getDataArrayName(), QString("A"))
+    DREAM3D_REQUIRE_EQUAL(lifetimes[0].lastUse, 5)
+    DREAM3D_REQUIRE_EQUAL(plan->getArraysToReleaseAfter(4).size(), 0)
+
+    pipeline->setReleaseDeadArrays(true);
+    DataContainerArray::Pointer dca = pipeline->execute();
+    DREAM3D_REQUIRE(pipeline->getErrorCondition() >= 0)
+    AttributeMatrix::Pointer am = dca->getAttributeMatrix(DataArrayPath("DC", "AM", ""));
+    DREAM3D_REQUIRE_VALID_POINTER(am.get())
+    DREAM3D_REQUIRE_EQUAL(am->doesAttributeArrayExist("Mask"), true)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### PipelineMemoryPlannerTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestLifetimes());
+    DREAM3D_REGISTER_TEST(TestReleaseDuringExecute());
+    DREAM3D_REGISTER_TEST(TestUnknownParameterTypes());
+  }
+
+private:
+  PipelineMemoryPlannerTest(const PipelineMemoryPlannerTest&); // Copy Constructor Not Implemented
+  void operator=(const PipelineMemoryPlannerTest&);            // Move assignment Not Implemented
+};
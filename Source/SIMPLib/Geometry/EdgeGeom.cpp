@@ -141,7 +141,6 @@ EdgeGeom::EdgeGeom()
   m_EdgeNeighbors = ElementDynamicList::NullPointer();
   m_EdgeCentroids = FloatArrayType::NullPointer();
   m_EdgeSizes = FloatArrayType::NullPointer();
-  m_ProgressCounter = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -433,13 +432,13 @@ void EdgeGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void EdgeGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
   int64_t numEdges = getNumberOfEdges();
 
   if(observable)
   {
     connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
   }
+  beginProgress(0, m_MessageTitle);
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   tbb::task_scheduler_init init;
@@ -457,6 +456,8 @@ void EdgeGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::
     FindEdgeDerivativesImpl serial(this, field, derivatives);
     serial.compute(0, numEdges);
   }
+
+  endProgress();
 }
 
 // -----------------------------------------------------------------------------
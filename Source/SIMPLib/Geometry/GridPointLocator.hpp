@@ -0,0 +1,423 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _gridpointlocator_hpp_
+#define _gridpointlocator_hpp_
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+
+/**
+ * @brief The UniformGridAxis class locates coordinates along one axis of a grid whose
+ * cells all have the same width, as in an ImageGeom. Lookups are branch free so the
+ * batched loops in GridPointLocator can be vectorized by the compiler.
+ */
+class UniformGridAxis
+{
+public:
+  UniformGridAxis(float origin, float spacing, size_t numCells)
+  : m_Origin(origin)
+  , m_InvSpacing(spacing > 0.0f ? 1.0f / spacing : 0.0f)
+  , m_NumCells(static_cast<float>(numCells))
+  , m_LastCell(numCells > 0 ? static_cast<float>(numCells - 1) : 0.0f)
+  , m_MaxLower(numCells > 1 ? static_cast<float>(numCells - 2) : 0.0f)
+  , m_HasUpper(numCells > 1 ? 1.0f : 0.0f)
+  {
+  }
+
+  /**
+   * @brief findCell Returns the cell containing x, or -1 if x is outside of the axis. A coordinate
+   * lying exactly on the upper bound belongs to the last cell.
+   */
+  inline int64_t findCell(float x) const
+  {
+    float u = (x - m_Origin) * m_InvSpacing;
+    int64_t cell = static_cast<int64_t>(std::min(m_LastCell, std::max(0.0f, u)));
+    return (u >= 0.0f && u <= m_NumCells) ? cell : -1;
+  }
+
+  /**
+   * @brief findCenterInterval Returns the cell whose center is the lower end of the interval
+   * between two neighboring cell centers that contains x, clamped to the border cells.
+   * @param t Fractional position of x between the two centers, in [0, 1]
+   */
+  inline int64_t findCenterInterval(float x, float& t) const
+  {
+    float u = (x - m_Origin) * m_InvSpacing - 0.5f;
+    float lower = std::min(m_MaxLower, std::floor(std::max(0.0f, u)));
+    t = std::min(1.0f, std::max(0.0f, u - lower)) * m_HasUpper;
+    return static_cast<int64_t>(lower);
+  }
+
+private:
+  float m_Origin;
+  float m_InvSpacing;
+  float m_NumCells;
+  float m_LastCell;
+  float m_MaxLower;
+  float m_HasUpper;
+};
+
+/**
+ * @brief The RectilinearGridAxis class locates coordinates along one axis of a RectGridGeom,
+ * where the cell bounds are arbitrary increasing values. The bounds are bucketed into a
+ * uniform lookup table up front, so each lookup costs a table read plus a short forward scan
+ * instead of a binary search.
+ */
+class RectilinearGridAxis
+{
+public:
+  RectilinearGridAxis(const float* bounds, size_t numCells)
+  : m_Bounds(bounds, bounds + (numCells > 0 ? numCells + 1 : 0))
+  , m_NumCells(numCells)
+  , m_Centers(numCells)
+  , m_Min(0.0f)
+  , m_Max(0.0f)
+  , m_InvBinWidth(0.0f)
+  {
+    if(numCells == 0)
+    {
+      return;
+    }
+    m_Min = m_Bounds.front();
+    m_Max = m_Bounds.back();
+    for(size_t i = 0; i < numCells; i++)
+    {
+      m_Centers[i] = 0.5f * (m_Bounds[i] + m_Bounds[i + 1]);
+    }
+
+    size_t numBins = 4 * numCells;
+    float binWidth = (m_Max - m_Min) / static_cast<float>(numBins);
+    m_InvBinWidth = binWidth > 0.0f ? 1.0f / binWidth : 0.0f;
+    m_FirstCellOfBin.resize(numBins);
+    for(size_t i = 0; i < numBins; i++)
+    {
+      float binStart = m_Min + static_cast<float>(i) * binWidth;
+      size_t cell = std::upper_bound(m_Bounds.begin(), m_Bounds.end(), binStart) - m_Bounds.begin();
+      m_FirstCellOfBin[i] = std::min(cell > 0 ? cell - 1 : 0, numCells - 1);
+    }
+  }
+
+  /**
+   * @brief findCell Returns the cell containing x, or -1 if x is outside of the axis. A coordinate
+   * lying exactly on the upper bound belongs to the last cell.
+   */
+  inline int64_t findCell(float x) const
+  {
+    if(!(x >= m_Min && x <= m_Max) || m_NumCells == 0)
+    {
+      return -1;
+    }
+    size_t bin = std::min(static_cast<size_t>((x - m_Min) * m_InvBinWidth), m_FirstCellOfBin.size() - 1);
+    size_t cell = m_FirstCellOfBin[bin];
+    while(cell + 1 < m_NumCells && m_Bounds[cell + 1] <= x)
+    {
+      cell++;
+    }
+    return static_cast<int64_t>(cell);
+  }
+
+  /**
+   * @brief findCenterInterval Returns the cell whose center is the lower end of the interval
+   * between two neighboring cell centers that contains x, clamped to the border cells.
+   * @param t Fractional position of x between the two centers, in [0, 1]
+   */
+  inline int64_t findCenterInterval(float x, float& t) const
+  {
+    t = 0.0f;
+    if(m_NumCells < 2)
+    {
+      return 0;
+    }
+    int64_t cell = findCell(std::min(m_Max, std::max(m_Min, x)));
+    int64_t lower = (x < m_Centers[cell]) ? cell - 1 : cell;
+    lower = std::min(std::max(lower, static_cast<int64_t>(0)), static_cast<int64_t>(m_NumCells - 2));
+    t = (x - m_Centers[lower]) / (m_Centers[lower + 1] - m_Centers[lower]);
+    t = std::min(1.0f, std::max(0.0f, t));
+    return lower;
+  }
+
+private:
+  std::vector<float> m_Bounds;
+  size_t m_NumCells;
+  std::vector<float> m_Centers;
+  std::vector<size_t> m_FirstCellOfBin;
+  float m_Min;
+  float m_Max;
+  float m_InvBinWidth;
+};
+
+/**
+ * @brief The FindGridCellIndicesImpl class maps a range of points to the indices of the grid
+ * cells that contain them.
+ */
+template <typename Axis> class FindGridCellIndicesImpl
+{
+public:
+  FindGridCellIndicesImpl(const Axis* axes, const size_t* dims, const float* coords, int64_t* cellIds)
+  : m_Axes(axes)
+  , m_Dims(dims)
+  , m_Coords(coords)
+  , m_CellIds(cellIds)
+  {
+  }
+  virtual ~FindGridCellIndicesImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    const int64_t dimX = static_cast<int64_t>(m_Dims[0]);
+    const int64_t dimY = static_cast<int64_t>(m_Dims[1]);
+    for(size_t i = start; i < end; i++)
+    {
+      int64_t x = m_Axes[0].findCell(m_Coords[3 * i]);
+      int64_t y = m_Axes[1].findCell(m_Coords[3 * i + 1]);
+      int64_t z = m_Axes[2].findCell(m_Coords[3 * i + 2]);
+      m_CellIds[i] = ((x | y | z) < 0) ? -1 : (dimX * dimY * z) + (dimX * y) + x;
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const Axis* m_Axes;
+  const size_t* m_Dims;
+  const float* m_Coords;
+  int64_t* m_CellIds;
+};
+
+/**
+ * @brief The FindGridInterpolationStencilsImpl class computes, for a range of points, the 8
+ * cells whose centers surround each point together with their trilinear weights.
+ */
+template <typename Axis> class FindGridInterpolationStencilsImpl
+{
+public:
+  FindGridInterpolationStencilsImpl(const Axis* axes, const size_t* dims, const float* coords, int64_t* cellIds, float* weights)
+  : m_Axes(axes)
+  , m_Dims(dims)
+  , m_Coords(coords)
+  , m_CellIds(cellIds)
+  , m_Weights(weights)
+  {
+  }
+  virtual ~FindGridInterpolationStencilsImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    const int64_t dimX = static_cast<int64_t>(m_Dims[0]);
+    const int64_t dimY = static_cast<int64_t>(m_Dims[1]);
+    int64_t lower[3] = {0, 0, 0};
+    int64_t upper[3] = {0, 0, 0};
+    float t[3] = {0.0f, 0.0f, 0.0f};
+    for(size_t i = start; i < end; i++)
+    {
+      const float* point = m_Coords + 3 * i;
+      int64_t* ids = m_CellIds + 8 * i;
+      float* weights = m_Weights + 8 * i;
+
+      bool inside = true;
+      for(size_t d = 0; d < 3; d++)
+      {
+        inside = inside && m_Axes[d].findCell(point[d]) >= 0;
+        lower[d] = m_Axes[d].findCenterInterval(point[d], t[d]);
+        upper[d] = std::min(lower[d] + 1, static_cast<int64_t>(m_Dims[d]) - 1);
+      }
+      if(!inside)
+      {
+        std::fill(ids, ids + 8, -1);
+        std::fill(weights, weights + 8, 0.0f);
+        continue;
+      }
+
+      // Corner c is offset by (c & 1, (c >> 1) & 1, (c >> 2) & 1) from the lower corner
+      for(size_t c = 0; c < 8; c++)
+      {
+        int64_t x = (c & 1) ? upper[0] : lower[0];
+        int64_t y = (c & 2) ? upper[1] : lower[1];
+        int64_t z = (c & 4) ? upper[2] : lower[2];
+        ids[c] = (dimX * dimY * z) + (dimX * y) + x;
+        weights[c] = ((c & 1) ? t[0] : 1.0f - t[0]) * ((c & 2) ? t[1] : 1.0f - t[1]) * ((c & 4) ? t[2] : 1.0f - t[2]);
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const Axis* m_Axes;
+  const size_t* m_Dims;
+  const float* m_Coords;
+  int64_t* m_CellIds;
+  float* m_Weights;
+};
+
+/**
+ * @brief The GridPointLocator class maps whole lists of points (for example a SharedVertexList)
+ * onto the cells of a structured grid in parallel. The Axis template parameter provides the
+ * per axis lookup, UniformGridAxis for an ImageGeom and RectilinearGridAxis for a RectGridGeom.
+ */
+template <typename Axis> class GridPointLocator
+{
+public:
+  GridPointLocator(const Axis& xAxis, const Axis& yAxis, const Axis& zAxis, size_t dims[3])
+  : m_Axes{xAxis, yAxis, zAxis}
+  , m_Dims{dims[0], dims[1], dims[2]}
+  {
+  }
+  virtual ~GridPointLocator() = default;
+
+  /**
+   * @brief findCellIndices Returns, for each point, the index of the containing cell or -1 if the
+   * point lies outside of the grid.
+   * @param coords Points to locate, 3 components per tuple
+   * @param name Name of the returned array
+   * @return Single component array with one cell index per point, or a null pointer if the
+   * coordinates do not have 3 components
+   */
+  Int64ArrayType::Pointer findCellIndices(FloatArrayType::Pointer coords, const QString& name) const
+  {
+    if(nullptr == coords.get() || coords->getNumberOfComponents() != 3)
+    {
+      return Int64ArrayType::NullPointer();
+    }
+    size_t numPoints = coords->getNumberOfTuples();
+    Int64ArrayType::Pointer cellIds = Int64ArrayType::CreateArray(numPoints, name, true);
+    if(numPoints == 0)
+    {
+      return cellIds;
+    }
+    if(isEmpty())
+    {
+      cellIds->initializeWithValue(-1);
+      return cellIds;
+    }
+
+    FindGridCellIndicesImpl<Axis> impl(m_Axes, m_Dims, coords->getConstPointer(0), cellIds->getPointer(0));
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::task_scheduler_init init;
+    bool doParallel = true;
+    if(doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numPoints), impl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      impl.compute(0, numPoints);
+    }
+    return cellIds;
+  }
+
+  /**
+   * @brief findInterpolationStencils Returns, for each point, the 8 cells whose centers surround
+   * the point and the trilinear weights of those cells. Points between the outermost cell centers
+   * and the grid boundary are clamped to the border cells; points outside of the grid get cell
+   * ids of -1 and weights of 0.
+   * @param coords Points to locate, 3 components per tuple
+   * @param cellIds Returned 8 component array of cell indices
+   * @param weights Returned 8 component array of weights, in the same order as cellIds
+   * @return False if the coordinates do not have 3 components
+   */
+  bool findInterpolationStencils(FloatArrayType::Pointer coords, Int64ArrayType::Pointer& cellIds, FloatArrayType::Pointer& weights) const
+  {
+    if(nullptr == coords.get() || coords->getNumberOfComponents() != 3)
+    {
+      return false;
+    }
+    size_t numPoints = coords->getNumberOfTuples();
+    QVector<size_t> cDims(1, 8);
+    cellIds = Int64ArrayType::CreateArray(numPoints, cDims, "StencilCellIds", true);
+    weights = FloatArrayType::CreateArray(numPoints, cDims, "StencilWeights", true);
+    if(numPoints == 0)
+    {
+      return true;
+    }
+    if(isEmpty())
+    {
+      cellIds->initializeWithValue(-1);
+      weights->initializeWithZeros();
+      return true;
+    }
+
+    FindGridInterpolationStencilsImpl<Axis> impl(m_Axes, m_Dims, coords->getConstPointer(0), cellIds->getPointer(0), weights->getPointer(0));
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::task_scheduler_init init;
+    bool doParallel = true;
+    if(doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numPoints), impl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      impl.compute(0, numPoints);
+    }
+    return true;
+  }
+
+protected:
+  bool isEmpty() const
+  {
+    return m_Dims[0] == 0 || m_Dims[1] == 0 || m_Dims[2] == 0;
+  }
+
+private:
+  Axis m_Axes[3];
+  size_t m_Dims[3];
+};
+
+#endif /* _gridpointlocator_hpp_ */
@@ -110,7 +110,6 @@ HexahedralGeom::HexahedralGeom()
   m_HexNeighbors = ElementDynamicList::NullPointer();
   m_HexCentroids = FloatArrayType::NullPointer();
   m_HexSizes = FloatArrayType::NullPointer();
-  m_ProgressCounter = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -558,13 +557,13 @@ void HexahedralGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void HexahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
   int64_t numHexas = getNumberOfHexas();
 
   if(observable)
   {
     connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
   }
+  beginProgress(0, m_MessageTitle);
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   tbb::task_scheduler_init init;
@@ -582,6 +581,8 @@ void HexahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArray
     FindHexDerivativesImpl serial(this, field, derivatives);
     serial.compute(0, numHexas);
   }
+
+  endProgress();
 }
 
 // -----------------------------------------------------------------------------
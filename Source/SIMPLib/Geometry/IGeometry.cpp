@@ -86,22 +86,21 @@ QString IGeometry::getGeometryTypeAsString()
 // -----------------------------------------------------------------------------
 void IGeometry::sendThreadSafeProgressMessage(int64_t counter, int64_t max)
 {
-  m_Mutex.lock();
-
-  m_ProgressCounter += counter;
-
-  int64_t progIncrement = max / 100;
-  int64_t prog = 1;
-
-  if(m_ProgressCounter > prog)
+  ProgressChannel& channel = getProgressChannel();
+  if(!channel.isOpen())
   {
-    int64_t progressInt = static_cast<int64_t>((static_cast<float>(m_ProgressCounter) / max) * 100.0f);
-    QString ss = m_MessageTitle + QObject::tr(" || %1% Complete").arg(progressInt);
-    notifyStatusMessage(m_MessagePrefix, m_MessageLabel, ss);
-    prog += progIncrement;
+    return;
   }
+  channel.setTotal(static_cast<uint64_t>(max));
+  channel.advance(static_cast<uint64_t>(counter));
+}
 
-  m_Mutex.unlock();
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IGeometry::publishProgress(int progress, const QString& message)
+{
+  notifyProgressMessage(m_MessagePrefix, m_MessageLabel, message, progress);
 }
 
 // -----------------------------------------------------------------------------
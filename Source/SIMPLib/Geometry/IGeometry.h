@@ -408,16 +408,22 @@ class SIMPLib_EXPORT IGeometry : public Observable
 
     AttributeMatrixMap_t m_AttributeMatrices;
 
-    QMutex m_Mutex;
-    int64_t m_ProgressCounter;
-
     /**
-     * @brief sendThreadSafeProgressMessage
+     * @brief sendThreadSafeProgressMessage Adds counter to the progress channel. This only touches
+     * atomics and may be called from inside parallel bodies; the messages themselves are published
+     * by the thread that called beginProgress().
      * @param counter
      * @param max
      */
     virtual void sendThreadSafeProgressMessage(int64_t counter, int64_t max) final;
 
+    /**
+     * @brief publishProgress Sends the sampled progress using the geometry's message prefix and label
+     * @param progress
+     * @param message
+     */
+    void publishProgress(int progress, const QString& message) override;
+
     /**
      * @brief setElementsContaingVert
      * @param elementsContaingVert
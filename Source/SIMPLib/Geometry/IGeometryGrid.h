@@ -89,6 +89,27 @@ class SIMPLib_EXPORT IGeometryGrid : public IGeometry
     virtual void getCoords(size_t x, size_t y, size_t z, double coords[3]) = 0;
     virtual void getCoords(size_t idx, double coords[3]) = 0;
 
+    /**
+     * @brief findCellIndices Finds, in parallel, the cell containing each point of a list of
+     * coordinates. Points lying on the upper boundary of the grid belong to the last cell and
+     * points outside of the grid get an index of -1.
+     * @param coords Points to locate, 3 components per tuple (a SharedVertexList for example)
+     * @param name Name of the returned array
+     * @return Single component array of cell indices, or a null pointer if coords does not have 3 components
+     */
+    virtual Int64ArrayType::Pointer findCellIndices(FloatArrayType::Pointer coords, const QString& name) = 0;
+
+    /**
+     * @brief findInterpolationStencils Finds, in parallel, the 8 cells whose centers surround each
+     * point of a list of coordinates along with the trilinear interpolation weights of those cells.
+     * Points outside of the grid get cell indices of -1 and weights of 0.
+     * @param coords Points to locate, 3 components per tuple (a SharedVertexList for example)
+     * @param cellIds Returned 8 component array of cell indices
+     * @param weights Returned 8 component array of weights, in the same order as cellIds
+     * @return False if coords does not have 3 components
+     */
+    virtual bool findInterpolationStencils(FloatArrayType::Pointer coords, Int64ArrayType::Pointer& cellIds, FloatArrayType::Pointer& weights) = 0;
+
   private:
     IGeometryGrid(const IGeometryGrid&) = delete;  // Copy Constructor Not Implemented
     void operator=(const IGeometryGrid&) = delete; // Move assignment Not Implemented
@@ -54,6 +54,7 @@
 
 #include "H5Support/H5Lite.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/GridPointLocator.hpp"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 
 /**
@@ -419,7 +420,6 @@ ImageGeom::ImageGeom()
   m_Origin[1] = 0.0f;
   m_Origin[2] = 0.0f;
   m_VoxelSizes = FloatArrayType::NullPointer();
-  m_ProgressCounter = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -880,7 +880,6 @@ void ImageGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void ImageGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
   size_t dims[3] = {0, 0, 0};
   std::tie(dims[0], dims[1], dims[2]) = getDimensions();
 
@@ -888,6 +887,7 @@ void ImageGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType:
   {
     connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
   }
+  beginProgress(0, m_MessageTitle);
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   tbb::task_scheduler_init init;
@@ -914,6 +914,8 @@ void ImageGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType:
     FindImageDerivativesImpl serial(this, field, derivatives);
     serial.compute(0, dims[2], 0, dims[1], 0, dims[0]);
   }
+
+  endProgress();
 }
 
 // -----------------------------------------------------------------------------
@@ -1168,3 +1170,23 @@ ImageGeom::ErrorType ImageGeom::computeCellIndex(float coords[3], size_t& index)
   }
   return err;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+Int64ArrayType::Pointer ImageGeom::findCellIndices(FloatArrayType::Pointer coords, const QString& name)
+{
+  GridPointLocator<UniformGridAxis> locator(UniformGridAxis(m_Origin[0], m_Resolution[0], m_Dimensions[0]), UniformGridAxis(m_Origin[1], m_Resolution[1], m_Dimensions[1]),
+                                            UniformGridAxis(m_Origin[2], m_Resolution[2], m_Dimensions[2]), m_Dimensions);
+  return locator.findCellIndices(coords, name);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ImageGeom::findInterpolationStencils(FloatArrayType::Pointer coords, Int64ArrayType::Pointer& cellIds, FloatArrayType::Pointer& weights)
+{
+  GridPointLocator<UniformGridAxis> locator(UniformGridAxis(m_Origin[0], m_Resolution[0], m_Dimensions[0]), UniformGridAxis(m_Origin[1], m_Resolution[1], m_Dimensions[1]),
+                                            UniformGridAxis(m_Origin[2], m_Resolution[2], m_Dimensions[2]), m_Dimensions);
+  return locator.findInterpolationStencils(coords, cellIds, weights);
+}
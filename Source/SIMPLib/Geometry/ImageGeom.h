@@ -345,6 +345,10 @@ class SIMPLib_EXPORT ImageGeom : public IGeometryGrid
     */
     ErrorType computeCellIndex(float coords[3], size_t& index);
 
+    Int64ArrayType::Pointer findCellIndices(FloatArrayType::Pointer coords, const QString& name) override;
+
+    bool findInterpolationStencils(FloatArrayType::Pointer coords, Int64ArrayType::Pointer& cellIds, FloatArrayType::Pointer& weights) override;
+
   protected:
 
     ImageGeom();
@@ -0,0 +1,468 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ImageGeomResampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range3d.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "SIMPLib/Common/TemplateHelpers.hpp"
+#include "SIMPLib/Geometry/GridPointLocator.hpp"
+
+namespace
+{
+/**
+ * @brief The IArrayResampler class is the type independent interface used by the resampling pass
+ * to fill one row segment of the target grid for one array.
+ */
+class IArrayResampler
+{
+public:
+  virtual ~IArrayResampler() = default;
+
+  /**
+   * @brief resample Fills count target tuples starting at targetStart
+   * @param nearestIds Containing source cell of each target cell, or -1
+   * @param stencilIds 8 surrounding source cells of each target cell, or -1
+   * @param weights Trilinear weights matching stencilIds
+   */
+  virtual void resample(size_t targetStart, size_t count, const int64_t* nearestIds, const int64_t* stencilIds, const float* weights) = 0;
+};
+
+/**
+ * @brief ConvertInterpolatedValue Rounds and clamps an interpolated value to the range of the array type
+ */
+template <typename T> T ConvertInterpolatedValue(double value)
+{
+  if(std::is_integral<T>::value)
+  {
+    value = std::round(value);
+    if(value <= static_cast<double>(std::numeric_limits<T>::lowest()))
+    {
+      return std::numeric_limits<T>::lowest();
+    }
+    if(value >= static_cast<double>(std::numeric_limits<T>::max()))
+    {
+      return std::numeric_limits<T>::max();
+    }
+  }
+  return static_cast<T>(value);
+}
+
+/**
+ * @brief The ArrayResampler class resamples a single DataArray<T>
+ */
+template <typename T> class ArrayResampler : public IArrayResampler
+{
+public:
+  ArrayResampler(typename DataArray<T>::Pointer source, typename DataArray<T>::Pointer destination, ImageGeomResampler::InterpolationType type, double fillValue)
+  : m_Type(type)
+  , m_NumComps(source->getNumberOfComponents())
+  , m_FillValue(ConvertInterpolatedValue<T>(fillValue))
+  {
+    // Grab the raw pointers once; the worker threads must not touch the arrays' bookkeeping
+    m_Source = source->getConstPointer(0);
+    m_Destination = destination->getPointer(0);
+  }
+  ~ArrayResampler() override = default;
+
+  void resample(size_t targetStart, size_t count, const int64_t* nearestIds, const int64_t* stencilIds, const float* weights) override
+  {
+    for(size_t i = 0; i < count; i++)
+    {
+      T* out = m_Destination + (targetStart + i) * m_NumComps;
+      int64_t nearest = nearestIds[i];
+      if(nearest < 0)
+      {
+        std::fill(out, out + m_NumComps, m_FillValue);
+        continue;
+      }
+      const T* nearestValues = m_Source + nearest * m_NumComps;
+      switch(m_Type)
+      {
+      case ImageGeomResampler::InterpolationType::Trilinear:
+        for(size_t c = 0; c < m_NumComps; c++)
+        {
+          double value = 0.0;
+          for(size_t corner = 0; corner < 8; corner++)
+          {
+            value += weights[8 * i + corner] * static_cast<double>(m_Source[stencilIds[8 * i + corner] * m_NumComps + c]);
+          }
+          out[c] = ConvertInterpolatedValue<T>(value);
+        }
+        break;
+      case ImageGeomResampler::InterpolationType::Mode:
+        for(size_t c = 0; c < m_NumComps; c++)
+        {
+          out[c] = findMode(nearestValues[c], stencilIds + 8 * i, weights + 8 * i, c);
+        }
+        break;
+      default:
+        std::copy(nearestValues, nearestValues + m_NumComps, out);
+        break;
+      }
+    }
+  }
+
+private:
+  ImageGeomResampler::InterpolationType m_Type;
+  size_t m_NumComps;
+  T m_FillValue;
+  const T* m_Source;
+  T* m_Destination;
+
+  /**
+   * @brief findMode Returns the value with the largest summed weight among the 8 stencil cells. The
+   * value of the containing cell is considered first so that it wins ties.
+   */
+  T findMode(T nearestValue, const int64_t* stencilIds, const float* weights, size_t comp) const
+  {
+    T values[9] = {nearestValue};
+    float totals[9] = {0.0f};
+    size_t numValues = 1;
+    for(size_t corner = 0; corner < 8; corner++)
+    {
+      T value = m_Source[stencilIds[corner] * m_NumComps + comp];
+      size_t v = 0;
+      while(v < numValues && values[v] != value)
+      {
+        v++;
+      }
+      if(v == numValues)
+      {
+        values[numValues] = value;
+        totals[numValues] = 0.0f;
+        numValues++;
+      }
+      totals[v] += weights[corner];
+    }
+    size_t best = 0;
+    for(size_t v = 1; v < numValues; v++)
+    {
+      if(totals[v] > totals[best])
+      {
+        best = v;
+      }
+    }
+    return values[best];
+  }
+};
+
+/**
+ * @brief CreateArrayResampler Creates the destination array for a source array and the matching resampler
+ */
+template <typename T>
+void CreateArrayResampler(IDataArray::Pointer source, IDataArray::Pointer destination, ImageGeomResampler::InterpolationType type, double fillValue,
+                          std::vector<std::shared_ptr<IArrayResampler>>& resamplers)
+{
+  typename DataArray<T>::Pointer typedSource = std::dynamic_pointer_cast<DataArray<T>>(source);
+  typename DataArray<T>::Pointer typedDestination = std::dynamic_pointer_cast<DataArray<T>>(destination);
+  resamplers.push_back(std::shared_ptr<IArrayResampler>(new ArrayResampler<T>(typedSource, typedDestination, type, fillValue)));
+}
+
+/**
+ * @brief The ResampleImageGeomImpl class walks tiles of the target grid, locates the source cells of
+ * each row segment once and hands them to every array resampler.
+ */
+class ResampleImageGeomImpl
+{
+public:
+  ResampleImageGeomImpl(const UniformGridAxis* sourceAxes, const size_t* sourceDims, const size_t* dims, const float* resolution, const float* origin, const float* rotation,
+                        bool needStencils, const std::vector<std::shared_ptr<IArrayResampler>>& resamplers)
+  : m_SourceAxes(sourceAxes)
+  , m_SourceDims(sourceDims)
+  , m_Dims(dims)
+  , m_Resolution(resolution)
+  , m_Origin(origin)
+  , m_Rotation(rotation)
+  , m_NeedStencils(needStencils)
+  , m_Resamplers(resamplers)
+  {
+  }
+  virtual ~ResampleImageGeomImpl() = default;
+
+  void compute(size_t zStart, size_t zEnd, size_t yStart, size_t yEnd, size_t xStart, size_t xEnd) const
+  {
+    size_t count = xEnd - xStart;
+    std::vector<float> coords(3 * count);
+    std::vector<int64_t> nearestIds(count);
+    std::vector<int64_t> stencilIds(m_NeedStencils ? 8 * count : 0);
+    std::vector<float> weights(m_NeedStencils ? 8 * count : 0);
+
+    FindGridCellIndicesImpl<UniformGridAxis> findCells(m_SourceAxes, m_SourceDims, coords.data(), nearestIds.data());
+    FindGridInterpolationStencilsImpl<UniformGridAxis> findStencils(m_SourceAxes, m_SourceDims, coords.data(), stencilIds.data(), weights.data());
+
+    for(size_t z = zStart; z < zEnd; z++)
+    {
+      for(size_t y = yStart; y < yEnd; y++)
+      {
+        for(size_t x = xStart; x < xEnd; x++)
+        {
+          float local[3] = {(x + 0.5f) * m_Resolution[0], (y + 0.5f) * m_Resolution[1], (z + 0.5f) * m_Resolution[2]};
+          float* point = coords.data() + 3 * (x - xStart);
+          for(size_t d = 0; d < 3; d++)
+          {
+            point[d] = m_Origin[d] + m_Rotation[3 * d] * local[0] + m_Rotation[3 * d + 1] * local[1] + m_Rotation[3 * d + 2] * local[2];
+          }
+        }
+
+        findCells.compute(0, count);
+        if(m_NeedStencils)
+        {
+          findStencils.compute(0, count);
+        }
+
+        size_t targetStart = (z * m_Dims[1] + y) * m_Dims[0] + xStart;
+        for(const std::shared_ptr<IArrayResampler>& resampler : m_Resamplers)
+        {
+          resampler->resample(targetStart, count, nearestIds.data(), stencilIds.data(), weights.data());
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range3d<size_t, size_t, size_t>& r) const
+  {
+    compute(r.pages().begin(), r.pages().end(), r.rows().begin(), r.rows().end(), r.cols().begin(), r.cols().end());
+  }
+#endif
+
+private:
+  const UniformGridAxis* m_SourceAxes;
+  const size_t* m_SourceDims;
+  const size_t* m_Dims;
+  const float* m_Resolution;
+  const float* m_Origin;
+  const float* m_Rotation;
+  bool m_NeedStencils;
+  const std::vector<std::shared_ptr<IArrayResampler>>& m_Resamplers;
+};
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageGeomResampler::ImageGeomResampler()
+: m_InterpolationType(InterpolationType::NearestNeighbor)
+, m_FillValue(0.0)
+{
+  m_Dimensions[0] = m_Dimensions[1] = m_Dimensions[2] = 0;
+  m_Resolution[0] = m_Resolution[1] = m_Resolution[2] = 1.0f;
+  m_Origin[0] = m_Origin[1] = m_Origin[2] = 0.0f;
+  for(size_t i = 0; i < 9; i++)
+  {
+    m_Rotation[i] = (i % 4 == 0) ? 1.0f : 0.0f;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageGeomResampler::~ImageGeomResampler() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeomResampler::setTargetGeometry(ImageGeom::Pointer geom)
+{
+  setDimensions(geom->getDimensions());
+  setResolution(geom->getResolution());
+  setOrigin(geom->getOrigin());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeomResampler::setRotation(const float rotation[9])
+{
+  std::copy(rotation, rotation + 9, m_Rotation);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeomResampler::getRotation(float rotation[9]) const
+{
+  std::copy(m_Rotation, m_Rotation + 9, rotation);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeomResampler::setArrayInterpolationType(const QString& arrayName, InterpolationType type)
+{
+  m_ArrayInterpolationTypes[arrayName] = type;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageGeomResampler::InterpolationType ImageGeomResampler::getArrayInterpolationType(const QString& arrayName) const
+{
+  return m_ArrayInterpolationTypes.value(arrayName, m_InterpolationType);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageGeom::Pointer ImageGeomResampler::createTargetGeometry(const QString& name)
+{
+  ImageGeom::Pointer geom = ImageGeom::CreateGeometry(name);
+  geom->setDimensions(m_Dimensions);
+  geom->setResolution(m_Resolution);
+  geom->setOrigin(m_Origin);
+  return geom;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ImageGeomResampler::notifyErrorMessage(const QString& humanLabel, const QString& ss, int code)
+{
+  m_ErrorCode = code;
+  m_ErrorMessage = QString("%1: %2").arg(humanLabel).arg(ss);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AttributeMatrix::Pointer ImageGeomResampler::resample(AttributeMatrix::Pointer cellData, const QVector<QString>& arrayNames, const QString& name)
+{
+  m_ErrorCode = 0;
+  m_ErrorMessage.clear();
+
+  if(nullptr == m_SourceGeometry.get() || nullptr == cellData.get())
+  {
+    notifyErrorMessage(getNameOfClass(), "A source geometry and its cell AttributeMatrix are required", -1);
+    return AttributeMatrix::NullPointer();
+  }
+  if(cellData->getNumberOfTuples() != m_SourceGeometry->getNumberOfElements())
+  {
+    notifyErrorMessage(getNameOfClass(), QString("AttributeMatrix '%1' has %2 tuples but the source geometry has %3 cells")
+                                             .arg(cellData->getName())
+                                             .arg(cellData->getNumberOfTuples())
+                                             .arg(m_SourceGeometry->getNumberOfElements()),
+                       -2);
+    return AttributeMatrix::NullPointer();
+  }
+  for(size_t d = 0; d < 3; d++)
+  {
+    if(m_Dimensions[d] == 0 || m_Resolution[d] <= 0.0f)
+    {
+      notifyErrorMessage(getNameOfClass(), "The target grid needs non zero dimensions and a positive resolution", -3);
+      return AttributeMatrix::NullPointer();
+    }
+  }
+
+  QVector<QString> names = arrayNames;
+  if(names.isEmpty())
+  {
+    names = cellData->getAttributeArrayNames().toVector();
+  }
+
+  size_t numTargetTuples = m_Dimensions[0] * m_Dimensions[1] * m_Dimensions[2];
+  QVector<size_t> tDims = {m_Dimensions[0], m_Dimensions[1], m_Dimensions[2]};
+  AttributeMatrix::Pointer resampled = AttributeMatrix::New(tDims, name, AttributeMatrix::Type::Cell);
+
+  std::vector<std::shared_ptr<IArrayResampler>> resamplers;
+  bool needStencils = false;
+  for(const QString& arrayName : names)
+  {
+    IDataArray::Pointer source = cellData->getAttributeArray(arrayName);
+    if(nullptr == source.get())
+    {
+      notifyErrorMessage(getNameOfClass(), QString("AttributeMatrix '%1' has no array named '%2'").arg(cellData->getName()).arg(arrayName), -4);
+      return AttributeMatrix::NullPointer();
+    }
+    IDataArray::Pointer destination = source->createNewArray(numTargetTuples, source->getComponentDimensions(), arrayName, true);
+    InterpolationType type = getArrayInterpolationType(arrayName);
+    needStencils = needStencils || type != InterpolationType::NearestNeighbor;
+
+    EXECUTE_FUNCTION_TEMPLATE(this, CreateArrayResampler, source, source, destination, type, m_FillValue, resamplers)
+    if(m_ErrorCode < 0)
+    {
+      return AttributeMatrix::NullPointer();
+    }
+    resampled->addAttributeArray(arrayName, destination);
+  }
+  if(resamplers.empty())
+  {
+    return resampled;
+  }
+
+  size_t sourceDims[3] = {0, 0, 0};
+  float sourceRes[3] = {0.0f, 0.0f, 0.0f};
+  float sourceOrigin[3] = {0.0f, 0.0f, 0.0f};
+  std::tie(sourceDims[0], sourceDims[1], sourceDims[2]) = m_SourceGeometry->getDimensions();
+  m_SourceGeometry->getResolution(sourceRes);
+  m_SourceGeometry->getOrigin(sourceOrigin);
+  std::vector<UniformGridAxis> sourceAxes;
+  for(size_t d = 0; d < 3; d++)
+  {
+    sourceAxes.push_back(UniformGridAxis(sourceOrigin[d], sourceRes[d], sourceDims[d]));
+  }
+
+  ResampleImageGeomImpl impl(sourceAxes.data(), sourceDims, m_Dimensions, m_Resolution, m_Origin, m_Rotation, needStencils, resamplers);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range3d<size_t, size_t, size_t>(0, m_Dimensions[2], 0, m_Dimensions[1], 0, m_Dimensions[0]), impl, tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    impl.compute(0, m_Dimensions[2], 0, m_Dimensions[1], 0, m_Dimensions[0]);
+  }
+
+  return resampled;
+}
@@ -0,0 +1,181 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _imagegeomresampler_h_
+#define _imagegeomresampler_h_
+
+#include <QtCore/QMap>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+/**
+ * @brief The ImageGeomResampler class resamples cell data of an ImageGeom onto a new grid. The target
+ * grid is given by its dimensions, resolution and origin plus an optional rotation about the target
+ * origin. Every selected array is resampled in a single tiled, parallel pass over the target cells:
+ * the source cells covering a tile are located once and then shared by all arrays.
+ *
+ * Arrays can be resampled with nearest neighbor, trilinear or mode (label preserving) interpolation.
+ * Trilinear interpolation works between source cell centers; mode picks the value with the largest
+ * total trilinear weight, so it never creates new labels. Target cells whose center lies outside of
+ * the source grid receive the fill value.
+ */
+class SIMPLib_EXPORT ImageGeomResampler
+{
+  public:
+    SIMPL_SHARED_POINTERS(ImageGeomResampler)
+    SIMPL_STATIC_NEW_MACRO(ImageGeomResampler)
+    SIMPL_TYPE_MACRO(ImageGeomResampler)
+
+    virtual ~ImageGeomResampler();
+
+    using EnumType = unsigned int;
+    enum class InterpolationType : EnumType
+    {
+      NearestNeighbor = 0,
+      Trilinear = 1,
+      Mode = 2
+    };
+
+    /**
+     * @brief Sets/Gets the geometry the resampled cell data belongs to
+     */
+    SIMPL_INSTANCE_PROPERTY(ImageGeom::Pointer, SourceGeometry)
+
+    /**
+     * @brief Sets/Gets the dimensions of the target grid
+     */
+    SIMPL_INSTANCE_VEC3_PROPERTY(size_t, Dimensions)
+
+    /**
+     * @brief Sets/Gets the resolution of the target grid
+     */
+    SIMPL_INSTANCE_VEC3_PROPERTY(float, Resolution)
+
+    /**
+     * @brief Sets/Gets the origin of the target grid
+     */
+    SIMPL_INSTANCE_VEC3_PROPERTY(float, Origin)
+
+    /**
+     * @brief Sets/Gets the interpolation used for arrays without an explicit interpolation type
+     */
+    SIMPL_INSTANCE_PROPERTY(InterpolationType, InterpolationType)
+
+    /**
+     * @brief Sets/Gets the value written to target cells that lie outside of the source grid
+     */
+    SIMPL_INSTANCE_PROPERTY(double, FillValue)
+
+    SIMPL_GET_PROPERTY(int, ErrorCode)
+    SIMPL_GET_PROPERTY(QString, ErrorMessage)
+
+    /**
+     * @brief setTargetGeometry Copies the dimensions, resolution and origin of an existing geometry
+     * @param geom
+     */
+    void setTargetGeometry(ImageGeom::Pointer geom);
+
+    /**
+     * @brief setRotation Sets the row major 3x3 rotation that maps the axes of the target grid into the
+     * frame of the source geometry. The rotation is applied about the target origin.
+     * @param rotation
+     */
+    void setRotation(const float rotation[9]);
+
+    /**
+     * @brief getRotation
+     * @param rotation
+     */
+    void getRotation(float rotation[9]) const;
+
+    /**
+     * @brief setArrayInterpolationType Overrides the interpolation used for a single array
+     * @param arrayName
+     * @param type
+     */
+    void setArrayInterpolationType(const QString& arrayName, InterpolationType type);
+
+    /**
+     * @brief getArrayInterpolationType
+     * @param arrayName
+     * @return The interpolation used for the given array
+     */
+    InterpolationType getArrayInterpolationType(const QString& arrayName) const;
+
+    /**
+     * @brief createTargetGeometry Creates an ImageGeom matching the target grid. The rotation is not part
+     * of an ImageGeom, so a rotated target grid is returned in its own, axis aligned frame.
+     * @param name
+     * @return
+     */
+    ImageGeom::Pointer createTargetGeometry(const QString& name);
+
+    /**
+     * @brief resample Resamples the given arrays of a cell AttributeMatrix of the source geometry
+     * @param cellData The cell AttributeMatrix of the source geometry
+     * @param arrayNames Arrays to resample; all arrays of cellData when empty
+     * @param name Name of the returned AttributeMatrix
+     * @return A cell AttributeMatrix sized to the target grid holding the resampled arrays, or a null
+     * pointer on error (see getErrorCode() and getErrorMessage())
+     */
+    AttributeMatrix::Pointer resample(AttributeMatrix::Pointer cellData, const QVector<QString>& arrayNames, const QString& name);
+
+    /**
+     * @brief notifyErrorMessage Records an error
+     * @param humanLabel
+     * @param ss
+     * @param code
+     */
+    void notifyErrorMessage(const QString& humanLabel, const QString& ss, int code);
+
+  protected:
+    ImageGeomResampler();
+
+  private:
+    float m_Rotation[9];
+    QMap<QString, InterpolationType> m_ArrayInterpolationTypes;
+    int m_ErrorCode = 0;
+    QString m_ErrorMessage;
+
+    ImageGeomResampler(const ImageGeomResampler&) = delete; // Copy Constructor Not Implemented
+    void operator=(const ImageGeomResampler&) = delete;     // Move assignment Not Implemented
+};
+
+#endif /* _imagegeomresampler_h_ */
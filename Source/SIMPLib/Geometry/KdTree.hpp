@@ -0,0 +1,467 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _kdtree_hpp_
+#define _kdtree_hpp_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "SIMPLib/SIMPLib.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+
+template <typename T> class KdTree;
+
+/**
+ * @brief The KdTreeQueryImpl class runs a batch of nearest neighbor or fixed radius queries
+ * against a KdTree, one list of point ids (and optionally distances) per query point.
+ */
+template <typename T> class KdTreeQueryImpl
+{
+public:
+  typedef std::vector<typename NeighborList<int64_t>::SharedVectorType> IdLists;
+  typedef std::vector<typename NeighborList<T>::SharedVectorType> DistanceLists;
+
+  KdTreeQueryImpl(const KdTree<T>* tree, const T* queries, bool queriesAreIndexed, size_t k, T radius, IdLists& ids, DistanceLists* distances)
+  : m_Tree(tree)
+  , m_Queries(queries)
+  , m_QueriesAreIndexed(queriesAreIndexed)
+  , m_K(k)
+  , m_Radius(radius)
+  , m_Ids(ids)
+  , m_Distances(distances)
+  {
+  }
+  virtual ~KdTreeQueryImpl() = default;
+
+  void compute(size_t start, size_t end) const
+  {
+    std::vector<std::pair<T, int64_t>> found;
+    for(size_t i = start; i < end; i++)
+    {
+      int64_t excludeId = m_QueriesAreIndexed ? static_cast<int64_t>(i) : -1;
+      if(m_K > 0)
+      {
+        m_Tree->findNearest(m_Queries + 3 * i, m_K, excludeId, found);
+      }
+      else
+      {
+        m_Tree->findWithinRadius(m_Queries + 3 * i, m_Radius, excludeId, found);
+      }
+
+      typename NeighborList<int64_t>::SharedVectorType ids(new std::vector<int64_t>(found.size()));
+      for(size_t j = 0; j < found.size(); j++)
+      {
+        (*ids)[j] = found[j].second;
+      }
+      m_Ids[i] = ids;
+      if(nullptr != m_Distances)
+      {
+        typename NeighborList<T>::SharedVectorType distances(new std::vector<T>(found.size()));
+        for(size_t j = 0; j < found.size(); j++)
+        {
+          (*distances)[j] = std::sqrt(found[j].first);
+        }
+        (*m_Distances)[i] = distances;
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const KdTree<T>* m_Tree;
+  const T* m_Queries;
+  bool m_QueriesAreIndexed;
+  size_t m_K;
+  T m_Radius;
+  IdLists& m_Ids;
+  DistanceLists* m_Distances;
+};
+
+/**
+ * @brief The KdTree class is a static 3D k-d tree over a point cloud for k nearest neighbor
+ * and fixed radius queries. Every node splits its points in half at the median of the widest
+ * axis of their bounding box, so the shape of the tree only depends on the number of points.
+ * That lets the nodes live in one implicit (heap ordered) array and the two halves of a node
+ * be built in parallel. The coordinates are copied into tree order, so the tree does not
+ * follow later changes to the source coordinates; owners such as VertexGeom rebuild it when
+ * the source changes.
+ */
+template <typename T> class KdTree
+{
+public:
+  SIMPL_SHARED_POINTERS(KdTree<T>)
+  SIMPL_TYPE_MACRO(KdTree<T>)
+
+  typedef std::pair<T, int64_t> Neighbor; // Squared distance, point id
+
+  virtual ~KdTree() = default;
+
+  /**
+   * @brief Builds a tree over a list of points
+   * @param coords The xyz coordinates of the points, 3 values per point
+   * @param numPoints
+   * @return
+   */
+  static Pointer New(const T* coords, size_t numPoints)
+  {
+    Pointer sharedPtr(new KdTree<T>(coords, numPoints));
+    return sharedPtr;
+  }
+
+  /**
+   * @brief Returns the number of points in the tree
+   */
+  size_t getNumberOfPoints() const
+  {
+    return m_Ids.size();
+  }
+
+  /**
+   * @brief Finds the k points closest to a point
+   * @param point
+   * @param k
+   * @param excludeId Id of a point to leave out (the query point itself), or -1
+   * @param neighbors Receives the neighbors sorted by increasing distance
+   */
+  void findNearest(const T point[3], size_t k, int64_t excludeId, std::vector<Neighbor>& neighbors) const
+  {
+    neighbors.clear();
+    if(k == 0 || m_Ids.empty())
+    {
+      return;
+    }
+    std::priority_queue<Neighbor> heap;
+    searchNearest(0, 0, m_Ids.size(), point, k, excludeId, heap);
+    neighbors.resize(heap.size());
+    for(size_t i = neighbors.size(); i > 0; i--)
+    {
+      neighbors[i - 1] = heap.top();
+      heap.pop();
+    }
+  }
+
+  /**
+   * @brief Finds all the points within a distance of a point
+   * @param point
+   * @param radius
+   * @param excludeId Id of a point to leave out (the query point itself), or -1
+   * @param neighbors Receives the neighbors sorted by increasing distance
+   */
+  void findWithinRadius(const T point[3], T radius, int64_t excludeId, std::vector<Neighbor>& neighbors) const
+  {
+    neighbors.clear();
+    if(radius < 0 || m_Ids.empty())
+    {
+      return;
+    }
+    searchRadius(0, 0, m_Ids.size(), point, radius * radius, excludeId, neighbors);
+    std::sort(neighbors.begin(), neighbors.end());
+  }
+
+  /**
+   * @brief Finds the k nearest points of every query point in parallel
+   * @param queries The xyz coordinates of the query points, 3 values per point
+   * @param numQueries
+   * @param k
+   * @param queriesAreIndexed True if the queries are the points the tree was built from, in
+   * which case every point is left out of its own list
+   * @param name Name of the returned list
+   * @param distances Optionally receives the matching distances
+   * @return One list of point ids per query, sorted by increasing distance
+   */
+  NeighborList<int64_t>::Pointer findNearestNeighbors(const T* queries, size_t numQueries, size_t k, bool queriesAreIndexed, const QString& name,
+                                             typename NeighborList<T>::Pointer* distances = nullptr) const
+  {
+    return runQueries(queries, numQueries, queriesAreIndexed, k, 0, name, distances);
+  }
+
+  /**
+   * @brief Finds the points within a distance of every query point in parallel
+   * @param queries The xyz coordinates of the query points, 3 values per point
+   * @param numQueries
+   * @param radius
+   * @param queriesAreIndexed True if the queries are the points the tree was built from, in
+   * which case every point is left out of its own list
+   * @param name Name of the returned list
+   * @param distances Optionally receives the matching distances
+   * @return One list of point ids per query, sorted by increasing distance
+   */
+  NeighborList<int64_t>::Pointer findNeighborsWithinRadius(const T* queries, size_t numQueries, T radius, bool queriesAreIndexed, const QString& name,
+                                                  typename NeighborList<T>::Pointer* distances = nullptr) const
+  {
+    return runQueries(queries, numQueries, queriesAreIndexed, 0, std::max(radius, static_cast<T>(0)), name, distances);
+  }
+
+protected:
+  KdTree(const T* coords, size_t numPoints)
+  : m_Depth(0)
+  {
+    // Children get half of the points (the right one the larger half) until a leaf is small enough
+    size_t count = numPoints;
+    while(count > k_LeafSize)
+    {
+      count -= count / 2;
+      m_Depth++;
+    }
+    m_Nodes.resize((static_cast<size_t>(1) << (m_Depth + 1)) - 1);
+
+    std::vector<int64_t> order(numPoints);
+    std::iota(order.begin(), order.end(), 0);
+    buildNode(coords, order.data(), 0, 0, numPoints, 0);
+
+    m_Ids.swap(order);
+    m_Coords.resize(3 * numPoints);
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      const T* src = coords + 3 * m_Ids[i];
+      m_Coords[3 * i] = src[0];
+      m_Coords[3 * i + 1] = src[1];
+      m_Coords[3 * i + 2] = src[2];
+    }
+  }
+
+private:
+  struct Node
+  {
+    T split = 0;
+    int axis = -1; // -1 for a leaf
+  };
+
+  static const size_t k_LeafSize = 16;
+  static const size_t k_ParallelBuildPoints = 64 * 1024;
+
+  std::vector<T> m_Coords; // Coordinates in tree order
+  std::vector<int64_t> m_Ids;
+  std::vector<Node> m_Nodes;
+  size_t m_Depth;
+
+  /**
+   * @brief Sorts the points of a node around the median of its widest axis, then builds the children
+   */
+  void buildNode(const T* coords, int64_t* order, size_t node, size_t begin, size_t end, size_t depth)
+  {
+    if(depth == m_Depth)
+    {
+      return;
+    }
+
+    T minCoord[3] = {std::numeric_limits<T>::max(), std::numeric_limits<T>::max(), std::numeric_limits<T>::max()};
+    T maxCoord[3] = {std::numeric_limits<T>::lowest(), std::numeric_limits<T>::lowest(), std::numeric_limits<T>::lowest()};
+    for(size_t i = begin; i < end; i++)
+    {
+      const T* p = coords + 3 * order[i];
+      for(int d = 0; d < 3; d++)
+      {
+        minCoord[d] = std::min(minCoord[d], p[d]);
+        maxCoord[d] = std::max(maxCoord[d], p[d]);
+      }
+    }
+    int axis = 0;
+    for(int d = 1; d < 3; d++)
+    {
+      if(maxCoord[d] - minCoord[d] > maxCoord[axis] - minCoord[axis])
+      {
+        axis = d;
+      }
+    }
+
+    size_t mid = begin + (end - begin) / 2;
+    std::nth_element(order + begin, order + mid, order + end, [coords, axis](int64_t a, int64_t b) { return coords[3 * a + axis] < coords[3 * b + axis]; });
+    m_Nodes[node].axis = axis;
+    m_Nodes[node].split = coords[3 * order[mid] + axis];
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(end - begin >= k_ParallelBuildPoints)
+    {
+      tbb::parallel_invoke([=] { buildNode(coords, order, 2 * node + 1, begin, mid, depth + 1); }, [=] { buildNode(coords, order, 2 * node + 2, mid, end, depth + 1); });
+      return;
+    }
+#endif
+    buildNode(coords, order, 2 * node + 1, begin, mid, depth + 1);
+    buildNode(coords, order, 2 * node + 2, mid, end, depth + 1);
+  }
+
+  /**
+   * @brief Squared distance between a query and the point at a position in tree order
+   */
+  T squaredDistance(const T point[3], size_t i) const
+  {
+    const T* p = m_Coords.data() + 3 * i;
+    T dx = p[0] - point[0];
+    T dy = p[1] - point[1];
+    T dz = p[2] - point[2];
+    return dx * dx + dy * dy + dz * dz;
+  }
+
+  void searchNearest(size_t node, size_t begin, size_t end, const T point[3], size_t k, int64_t excludeId, std::priority_queue<Neighbor>& heap) const
+  {
+    const Node& n = m_Nodes[node];
+    if(n.axis < 0)
+    {
+      for(size_t i = begin; i < end; i++)
+      {
+        if(m_Ids[i] == excludeId)
+        {
+          continue;
+        }
+        Neighbor candidate(squaredDistance(point, i), m_Ids[i]);
+        if(heap.size() < k)
+        {
+          heap.push(candidate);
+        }
+        else if(candidate < heap.top())
+        {
+          heap.pop();
+          heap.push(candidate);
+        }
+      }
+      return;
+    }
+
+    // Points left of the median are <= split and points right of it are >= split
+    size_t mid = begin + (end - begin) / 2;
+    T diff = point[n.axis] - n.split;
+    if(diff < 0)
+    {
+      searchNearest(2 * node + 1, begin, mid, point, k, excludeId, heap);
+      if(heap.size() < k || diff * diff < heap.top().first)
+      {
+        searchNearest(2 * node + 2, mid, end, point, k, excludeId, heap);
+      }
+    }
+    else
+    {
+      searchNearest(2 * node + 2, mid, end, point, k, excludeId, heap);
+      if(heap.size() < k || diff * diff < heap.top().first)
+      {
+        searchNearest(2 * node + 1, begin, mid, point, k, excludeId, heap);
+      }
+    }
+  }
+
+  void searchRadius(size_t node, size_t begin, size_t end, const T point[3], T radius2, int64_t excludeId, std::vector<Neighbor>& neighbors) const
+  {
+    const Node& n = m_Nodes[node];
+    if(n.axis < 0)
+    {
+      for(size_t i = begin; i < end; i++)
+      {
+        T dist2 = squaredDistance(point, i);
+        if(dist2 <= radius2 && m_Ids[i] != excludeId)
+        {
+          neighbors.push_back(Neighbor(dist2, m_Ids[i]));
+        }
+      }
+      return;
+    }
+
+    size_t mid = begin + (end - begin) / 2;
+    T diff = point[n.axis] - n.split;
+    if(diff <= 0 || diff * diff <= radius2)
+    {
+      searchRadius(2 * node + 1, begin, mid, point, radius2, excludeId, neighbors);
+    }
+    if(diff >= 0 || diff * diff <= radius2)
+    {
+      searchRadius(2 * node + 2, mid, end, point, radius2, excludeId, neighbors);
+    }
+  }
+
+  NeighborList<int64_t>::Pointer runQueries(const T* queries, size_t numQueries, bool queriesAreIndexed, size_t k, T radius, const QString& name,
+                                            typename NeighborList<T>::Pointer* distances) const
+  {
+    typename KdTreeQueryImpl<T>::IdLists idLists(numQueries);
+    typename KdTreeQueryImpl<T>::DistanceLists distanceLists(nullptr != distances ? numQueries : 0);
+    KdTreeQueryImpl<T> impl(this, queries, queriesAreIndexed, k, radius, idLists, (nullptr != distances) ? &distanceLists : nullptr);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::task_scheduler_init init;
+    bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numQueries), impl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      impl.compute(0, numQueries);
+    }
+
+    NeighborList<int64_t>::Pointer ids = NeighborList<int64_t>::CreateArray(numQueries, name, true);
+    for(size_t i = 0; i < numQueries; i++)
+    {
+      ids->setList(static_cast<int>(i), idLists[i]);
+    }
+    if(nullptr != distances)
+    {
+      *distances = NeighborList<T>::CreateArray(numQueries, name + "Distances", true);
+      for(size_t i = 0; i < numQueries; i++)
+      {
+        (*distances)->setList(static_cast<int>(i), distanceLists[i]);
+      }
+    }
+    return ids;
+  }
+
+  KdTree(const KdTree&) = delete;       // Copy Constructor Not Implemented
+  void operator=(const KdTree&) = delete; // Move assignment Not Implemented
+};
+
+#endif /* _kdtree_hpp_ */
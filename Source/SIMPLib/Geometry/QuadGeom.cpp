@@ -145,7 +145,6 @@ QuadGeom::QuadGeom()
   m_QuadNeighbors = ElementDynamicList::NullPointer();
   m_QuadCentroids = FloatArrayType::NullPointer();
   m_QuadSizes = FloatArrayType::NullPointer();
-  m_ProgressCounter = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -502,13 +501,13 @@ void QuadGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void QuadGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
   int64_t numQuads = getNumberOfQuads();
 
   if(observable)
   {
     connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
   }
+  beginProgress(0, m_MessageTitle);
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   tbb::task_scheduler_init init;
@@ -526,6 +525,8 @@ void QuadGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::
     FindQuadDerivativesImpl serial(this, field, derivatives);
     serial.compute(0, numQuads);
   }
+
+  endProgress();
 }
 
 // -----------------------------------------------------------------------------
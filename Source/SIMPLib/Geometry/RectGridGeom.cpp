@@ -54,6 +54,7 @@
 
 #include "H5Support/H5Lite.h"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/GridPointLocator.hpp"
 #include "SIMPLib/HDF5/VTKH5Constants.h"
 
 /**
@@ -417,7 +418,6 @@ RectGridGeom::RectGridGeom()
   m_yBounds = FloatArrayType::NullPointer();
   m_zBounds = FloatArrayType::NullPointer();
   m_VoxelSizes = FloatArrayType::NullPointer();
-  m_ProgressCounter = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -669,6 +669,34 @@ void RectGridGeom::getCoords(size_t idx, double coords[3])
   coords[2] = static_cast<double>(0.5f * (zBnds[plane] + zBnds[plane + 1]));
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+Int64ArrayType::Pointer RectGridGeom::findCellIndices(FloatArrayType::Pointer coords, const QString& name)
+{
+  if(nullptr == m_xBounds.get() || nullptr == m_yBounds.get() || nullptr == m_zBounds.get())
+  {
+    return Int64ArrayType::NullPointer();
+  }
+  GridPointLocator<RectilinearGridAxis> locator(RectilinearGridAxis(m_xBounds->getConstPointer(0), m_Dimensions[0]), RectilinearGridAxis(m_yBounds->getConstPointer(0), m_Dimensions[1]),
+                                                RectilinearGridAxis(m_zBounds->getConstPointer(0), m_Dimensions[2]), m_Dimensions);
+  return locator.findCellIndices(coords, name);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool RectGridGeom::findInterpolationStencils(FloatArrayType::Pointer coords, Int64ArrayType::Pointer& cellIds, FloatArrayType::Pointer& weights)
+{
+  if(nullptr == m_xBounds.get() || nullptr == m_yBounds.get() || nullptr == m_zBounds.get())
+  {
+    return false;
+  }
+  GridPointLocator<RectilinearGridAxis> locator(RectilinearGridAxis(m_xBounds->getConstPointer(0), m_Dimensions[0]), RectilinearGridAxis(m_yBounds->getConstPointer(0), m_Dimensions[1]),
+                                                RectilinearGridAxis(m_zBounds->getConstPointer(0), m_Dimensions[2]), m_Dimensions);
+  return locator.findInterpolationStencils(coords, cellIds, weights);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -928,7 +956,6 @@ void RectGridGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void RectGridGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
   size_t dims[3] = {0, 0, 0};
   std::tie(dims[0], dims[1], dims[2]) = getDimensions();
 
@@ -936,6 +963,7 @@ void RectGridGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayTy
   {
     connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
   }
+  beginProgress(0, m_MessageTitle);
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   tbb::task_scheduler_init init;
@@ -959,6 +987,8 @@ void RectGridGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayTy
     FindRectGridDerivativesImpl serial(this, field, derivatives);
     serial.compute(0, dims[2], 0, dims[1], 0, dims[0]);
   }
+
+  endProgress();
 }
 
 // -----------------------------------------------------------------------------
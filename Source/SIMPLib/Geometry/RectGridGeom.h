@@ -237,6 +237,25 @@ class SIMPLib_EXPORT RectGridGeom : public IGeometryGrid
     virtual void getCoords(size_t x, size_t y, size_t z, double coords[3]);
     virtual void getCoords(size_t idx, double coords[3]);
 
+    /**
+     * @brief findCellIndices Finds, in parallel, the cell containing each point of a list of
+     * coordinates using precomputed lookup tables over the x, y and z bounds.
+     * @param coords Points to locate, 3 components per tuple
+     * @param name Name of the returned array
+     * @return Single component array of cell indices (-1 outside of the grid)
+     */
+    virtual Int64ArrayType::Pointer findCellIndices(FloatArrayType::Pointer coords, const QString& name);
+
+    /**
+     * @brief findInterpolationStencils Finds, in parallel, the 8 surrounding cells and trilinear
+     * weights of each point of a list of coordinates.
+     * @param coords Points to locate, 3 components per tuple
+     * @param cellIds Returned 8 component array of cell indices
+     * @param weights Returned 8 component array of weights
+     * @return False if coords does not have 3 components
+     */
+    virtual bool findInterpolationStencils(FloatArrayType::Pointer coords, Int64ArrayType::Pointer& cellIds, FloatArrayType::Pointer& weights);
+
   protected:
 
     RectGridGeom();
@@ -44,57 +44,13 @@ float ShapeClass3Omega3[41][2] = {{0.787873524f, 0.0f},  {0.78793553f, 0.05f},
                                   {0.957466141f, 1.4f},  {0.950703099f, 1.45f}, {0.940991385f, 1.5f},  {0.92849772f, 1.55f},  {0.913552923f, 1.6f},  {0.89667764f, 1.65f},  {0.878608694f, 1.7f},
                                   {0.860322715f, 1.75f}, {0.843047317f, 1.8f},  {0.828232275f, 1.85f}, {0.81740437f, 1.9f},   {0.811701359f, 1.95f}, {0.810569469f, 2.0f}};
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-CubeOctohedronOps::CubeOctohedronOps()
-: Gvalue(0.0f)
+namespace
 {
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-CubeOctohedronOps::~CubeOctohedronOps() = default;
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-float CubeOctohedronOps::radcur1(QMap<ArgName, float> args)
-{
-  float radcur1 = 0.0f;
-  float Gvaluedist = 0.0f;
-  float bestGvaluedist = 1000000.0f;
-
-  float omega3 = args[Omega3];
-  float volcur = args[VolCur];
-
-  for(int i = 0; i < 41; i++)
-  {
-    Gvaluedist = fabsf(omega3 - ShapeClass3Omega3[i][0]);
-    if(Gvaluedist < bestGvaluedist)
-    {
-      bestGvaluedist = Gvaluedist;
-      Gvalue = ShapeClass3Omega3[i][1];
-    }
-  }
-  if(Gvalue >= 0 && Gvalue <= 1)
-  {
-    radcur1 = static_cast<float>((volcur * 6.0) / (6 - (Gvalue * Gvalue * Gvalue)));
-  }
-  if(Gvalue > 1 && Gvalue <= 2)
-  {
-    radcur1 = static_cast<float>((volcur * 6.0) / (3 + (9 * Gvalue) - (9 * Gvalue * Gvalue) + (2 * Gvalue * Gvalue * Gvalue)));
-  }
-  radcur1 = powf(radcur1, 0.333333333333f);
-  radcur1 = radcur1 * 0.5f;
-  return radcur1;
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-float CubeOctohedronOps::inside(float axis1comp, float axis2comp, float axis3comp)
+/**
+ * @brief cubeOctohedronInside Minimum over the cube faces and the eight truncating octahedron planes. All plane
+ * offsets depend only on gValue, so they are hoisted out of the batched loop once this is inlined.
+ */
+inline float cubeOctohedronInside(float axis1comp, float axis2comp, float axis3comp, float gValue)
 {
   float inside = 0;
   inside = 1 - fabs(axis1comp);
@@ -111,29 +67,29 @@ float CubeOctohedronOps::inside(float axis1comp, float axis2comp, float axis3com
   axis3comp = static_cast<float>(axis3comp + 1.0);
 
   // Above -1,-1,1 plane check
-  float plane1comp = ((-axis1comp) + (-axis2comp) + (axis3comp) - ((-0.5f * Gvalue) + (-0.5f * Gvalue) + 2.0f));
-  plane1comp = plane1comp / ((-1) + (-1) + (1) - ((-0.5f * Gvalue) + (-0.5f * Gvalue) + 2.0f));
+  float plane1comp = ((-axis1comp) + (-axis2comp) + (axis3comp) - ((-0.5f * gValue) + (-0.5f * gValue) + 2.0f));
+  plane1comp = plane1comp / ((-1) + (-1) + (1) - ((-0.5f * gValue) + (-0.5f * gValue) + 2.0f));
 
-  float plane2comp = ((axis1comp) + (-axis2comp) + (axis3comp) - ((2.0f - (0.5f * Gvalue)) + (-0.5f * Gvalue) + 2.0f));
-  plane2comp = plane2comp / ((1) + (-1) + (1) - ((2.0f - (0.5f * Gvalue)) + (-0.5f * Gvalue) + 2.0f));
+  float plane2comp = ((axis1comp) + (-axis2comp) + (axis3comp) - ((2.0f - (0.5f * gValue)) + (-0.5f * gValue) + 2.0f));
+  plane2comp = plane2comp / ((1) + (-1) + (1) - ((2.0f - (0.5f * gValue)) + (-0.5f * gValue) + 2.0f));
 
-  float plane3comp = ((axis1comp) + (axis2comp) + (axis3comp) - ((2.0f - (0.5f * Gvalue)) + (2.0f - (0.5f * Gvalue)) + 2.0f));
-  plane3comp = plane3comp / ((1) + (1) + (1) - ((2.0f - (0.5f * Gvalue)) + (2.0f - (0.5f * Gvalue)) + 2.0f));
+  float plane3comp = ((axis1comp) + (axis2comp) + (axis3comp) - ((2.0f - (0.5f * gValue)) + (2.0f - (0.5f * gValue)) + 2.0f));
+  plane3comp = plane3comp / ((1) + (1) + (1) - ((2.0f - (0.5f * gValue)) + (2.0f - (0.5f * gValue)) + 2.0f));
 
-  float plane4comp = static_cast<float>(((-axis1comp) + (axis2comp) + (axis3comp) - ((-0.5f * Gvalue) + (2.0f - (0.5 * Gvalue)) + 2.0f)));
-  plane4comp = plane4comp / ((-1) + (1) + (1) - ((-0.5f * Gvalue) + (2.0f - (0.5f * Gvalue)) + 2.0f));
+  float plane4comp = static_cast<float>(((-axis1comp) + (axis2comp) + (axis3comp) - ((-0.5f * gValue) + (2.0f - (0.5 * gValue)) + 2.0f)));
+  plane4comp = plane4comp / ((-1) + (1) + (1) - ((-0.5f * gValue) + (2.0f - (0.5f * gValue)) + 2.0f));
 
-  float plane5comp = ((-axis1comp) + (-axis2comp) + (-axis3comp) - ((-0.5f * Gvalue) + (-0.5f * Gvalue)));
-  plane5comp = plane5comp / ((-1) + (-1) + (-1) - ((-0.5f * Gvalue) + (-0.5f * Gvalue)));
+  float plane5comp = ((-axis1comp) + (-axis2comp) + (-axis3comp) - ((-0.5f * gValue) + (-0.5f * gValue)));
+  plane5comp = plane5comp / ((-1) + (-1) + (-1) - ((-0.5f * gValue) + (-0.5f * gValue)));
 
-  float plane6comp = ((axis1comp) + (-axis2comp) + (-axis3comp) - ((2.0f - (0.5f * Gvalue)) + (-0.5f * Gvalue)));
-  plane6comp = plane6comp / ((1) + (-1) + (-1) - ((2.0f - (0.5f * Gvalue)) + (-0.5f * Gvalue)));
+  float plane6comp = ((axis1comp) + (-axis2comp) + (-axis3comp) - ((2.0f - (0.5f * gValue)) + (-0.5f * gValue)));
+  plane6comp = plane6comp / ((1) + (-1) + (-1) - ((2.0f - (0.5f * gValue)) + (-0.5f * gValue)));
 
-  float plane7comp = ((axis1comp) + (axis2comp) + (-axis3comp) - ((2.0f - (0.5f * Gvalue)) + (2.0f - (0.5f * Gvalue))));
-  plane7comp = static_cast<float>(plane7comp / ((1) + (1) + (-1) - ((2.0f - (0.5f * Gvalue)) + (2.0f - (0.5 * Gvalue)))));
+  float plane7comp = ((axis1comp) + (axis2comp) + (-axis3comp) - ((2.0f - (0.5f * gValue)) + (2.0f - (0.5f * gValue))));
+  plane7comp = static_cast<float>(plane7comp / ((1) + (1) + (-1) - ((2.0f - (0.5f * gValue)) + (2.0f - (0.5 * gValue)))));
 
-  float plane8comp = ((-axis1comp) + (axis2comp) + (-axis3comp) - ((-0.5f * Gvalue) + (2.0f - (0.5f * Gvalue))));
-  plane8comp = plane8comp / ((-1) + (1) + (-1) - ((-0.5f * Gvalue) + (2 - (0.5f * Gvalue))));
+  float plane8comp = ((-axis1comp) + (axis2comp) + (-axis3comp) - ((-0.5f * gValue) + (2.0f - (0.5f * gValue))));
+  plane8comp = plane8comp / ((-1) + (1) + (-1) - ((-0.5f * gValue) + (2 - (0.5f * gValue))));
 
   if(plane1comp < inside)
   {
@@ -169,3 +125,70 @@ float CubeOctohedronOps::inside(float axis1comp, float axis2comp, float axis3com
   }
   return inside;
 }
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CubeOctohedronOps::CubeOctohedronOps()
+: Gvalue(0.0f)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+CubeOctohedronOps::~CubeOctohedronOps() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float CubeOctohedronOps::radcur1(const ShapeArgs& args)
+{
+  float radcur1 = 0.0f;
+  float Gvaluedist = 0.0f;
+  float bestGvaluedist = 1000000.0f;
+
+  float omega3 = args.omega3;
+  float volcur = args.volCur;
+
+  for(int i = 0; i < 41; i++)
+  {
+    Gvaluedist = fabsf(omega3 - ShapeClass3Omega3[i][0]);
+    if(Gvaluedist < bestGvaluedist)
+    {
+      bestGvaluedist = Gvaluedist;
+      Gvalue = ShapeClass3Omega3[i][1];
+    }
+  }
+  if(Gvalue >= 0 && Gvalue <= 1)
+  {
+    radcur1 = static_cast<float>((volcur * 6.0) / (6 - (Gvalue * Gvalue * Gvalue)));
+  }
+  if(Gvalue > 1 && Gvalue <= 2)
+  {
+    radcur1 = static_cast<float>((volcur * 6.0) / (3 + (9 * Gvalue) - (9 * Gvalue * Gvalue) + (2 * Gvalue * Gvalue * Gvalue)));
+  }
+  radcur1 = powf(radcur1, 0.333333333333f);
+  radcur1 = radcur1 * 0.5f;
+  return radcur1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float CubeOctohedronOps::inside(float axis1comp, float axis2comp, float axis3comp)
+{
+  return cubeOctohedronInside(axis1comp, axis2comp, axis3comp, Gvalue);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CubeOctohedronOps::insideBatch(const float* axis1comp, const float* axis2comp, const float* axis3comp, size_t count, float* values)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = cubeOctohedronInside(axis1comp[i], axis2comp[i], axis3comp[i], Gvalue);
+  }
+}
@@ -37,6 +37,26 @@
 
 #include "SIMPLib/Math/SIMPLibMath.h"
 
+namespace
+{
+/**
+ * @brief cylinderAInside Cylinder whose height runs along the first local axis
+ */
+inline float cylinderAInside(float axis1comp, float axis2comp, float axis3comp)
+{
+  float inside = -1.0;
+  if(fabs(axis1comp) <= 1.0)
+  {
+    axis2comp = fabsf(axis2comp);
+    axis3comp = fabsf(axis3comp);
+    axis2comp = axis2comp * axis2comp;
+    axis3comp = axis3comp * axis3comp;
+    inside = static_cast<float>(1.0 - axis2comp - axis3comp);
+  }
+  return inside;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -52,13 +72,13 @@ CylinderAOps::~CylinderAOps() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float CylinderAOps::radcur1(QMap<ArgName, float> args)
+float CylinderAOps::radcur1(const ShapeArgs& args)
 {
   float radcur1 = 0.0f;
 
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  float volcur = args.volCur;
+  float bovera = args.bOverA;
+  float covera = args.cOverA;
 
   // the equation for volume for an A cylinder is pi*b*c*h where b and c are semi axis lengths, but
   // h is a full axis length - meaning h = 2a. However, since our aspect ratios relate semi axis lengths, the 2.0
@@ -73,15 +93,16 @@ float CylinderAOps::radcur1(QMap<ArgName, float> args)
 // -----------------------------------------------------------------------------
 float CylinderAOps::inside(float axis1comp, float axis2comp, float axis3comp)
 {
-  float inside = -1.0;
-  if(fabs(axis1comp) <= 1.0)
+  return cylinderAInside(axis1comp, axis2comp, axis3comp);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CylinderAOps::insideBatch(const float* axis1comp, const float* axis2comp, const float* axis3comp, size_t count, float* values)
+{
+  for(size_t i = 0; i < count; i++)
   {
-    // inside = 1.0;
-    axis2comp = fabs(axis2comp);
-    axis3comp = fabs(axis3comp);
-    axis2comp = axis2comp * axis2comp;
-    axis3comp = axis3comp * axis3comp;
-    inside = static_cast<float>(1.0 - axis2comp - axis3comp);
+    values[i] = cylinderAInside(axis1comp[i], axis2comp[i], axis3comp[i]);
   }
-  return inside;
 }
@@ -37,6 +37,26 @@
 
 #include "SIMPLib/Math/SIMPLibMath.h"
 
+namespace
+{
+/**
+ * @brief cylinderBInside Cylinder whose height runs along the second local axis
+ */
+inline float cylinderBInside(float axis1comp, float axis2comp, float axis3comp)
+{
+  float inside = -1.0;
+  if(fabs(axis2comp) <= 1.0)
+  {
+    axis1comp = fabsf(axis1comp);
+    axis3comp = fabsf(axis3comp);
+    axis1comp = axis1comp * axis1comp;
+    axis3comp = axis3comp * axis3comp;
+    inside = static_cast<float>(1.0 - axis1comp - axis3comp);
+  }
+  return inside;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -52,13 +72,13 @@ CylinderBOps::~CylinderBOps() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float CylinderBOps::radcur1(QMap<ArgName, float> args)
+float CylinderBOps::radcur1(const ShapeArgs& args)
 {
   float radcur1 = 0.0f;
 
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  float volcur = args.volCur;
+  float bovera = args.bOverA;
+  float covera = args.cOverA;
 
   // the equation for volume for a B cylinder is pi*a*c*h where a and c are semi axis lengths, but
   // h is a full axis length - meaning h = 2b.  However, since our aspect ratios relate semi axis lengths, the 2.0
@@ -73,15 +93,16 @@ float CylinderBOps::radcur1(QMap<ArgName, float> args)
 // -----------------------------------------------------------------------------
 float CylinderBOps::inside(float axis1comp, float axis2comp, float axis3comp)
 {
-  float inside = -1.0;
-  if(fabs(axis2comp) <= 1.0)
+  return cylinderBInside(axis1comp, axis2comp, axis3comp);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CylinderBOps::insideBatch(const float* axis1comp, const float* axis2comp, const float* axis3comp, size_t count, float* values)
+{
+  for(size_t i = 0; i < count; i++)
   {
-    // inside = 1.0;
-    axis1comp = fabs(axis1comp);
-    axis3comp = fabs(axis3comp);
-    axis1comp = axis1comp * axis1comp;
-    axis3comp = axis3comp * axis3comp;
-    inside = static_cast<float>(1.0 - axis1comp - axis3comp);
+    values[i] = cylinderBInside(axis1comp[i], axis2comp[i], axis3comp[i]);
   }
-  return inside;
 }
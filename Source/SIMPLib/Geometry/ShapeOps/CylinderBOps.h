@@ -54,8 +54,10 @@ class SIMPLib_EXPORT CylinderBOps : public ShapeOps
 
     virtual ~CylinderBOps();
 
-    virtual float radcur1(QMap<ArgName, float> args);
-    virtual float inside(float axis1comp, float axis2comp, float axis3comp);
+    using ShapeOps::radcur1;
+    virtual float radcur1(const ShapeArgs& args) override;
+    virtual float inside(float axis1comp, float axis2comp, float axis3comp) override;
+    virtual void insideBatch(const float* axis1comp, const float* axis2comp, const float* axis3comp, size_t count, float* values) override;
     virtual void init() {  }
 
   protected:
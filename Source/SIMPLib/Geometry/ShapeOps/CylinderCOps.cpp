@@ -37,6 +37,26 @@
 
 #include "SIMPLib/Math/SIMPLibMath.h"
 
+namespace
+{
+/**
+ * @brief cylinderCInside Cylinder whose height runs along the third local axis
+ */
+inline float cylinderCInside(float axis1comp, float axis2comp, float axis3comp)
+{
+  float inside = -1.0;
+  if(fabs(axis3comp) <= 1.0)
+  {
+    axis1comp = fabsf(axis1comp);
+    axis2comp = fabsf(axis2comp);
+    axis1comp = axis1comp * axis1comp;
+    axis2comp = axis2comp * axis2comp;
+    inside = static_cast<float>(1.0 - axis1comp - axis2comp);
+  }
+  return inside;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -52,13 +72,13 @@ CylinderCOps::~CylinderCOps() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float CylinderCOps::radcur1(QMap<ArgName, float> args)
+float CylinderCOps::radcur1(const ShapeArgs& args)
 {
   float radcur1 = 0.0f;
 
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  float volcur = args.volCur;
+  float bovera = args.bOverA;
+  float covera = args.cOverA;
 
   // the equation for volume for a C cylinder is pi*a*b*h where a and b are semi axis lengths, but
   // h is a full axis length - meaning h = 2c.  However, since our aspect ratios relate semi axis lengths, the 2.0
@@ -73,15 +93,16 @@ float CylinderCOps::radcur1(QMap<ArgName, float> args)
 // -----------------------------------------------------------------------------
 float CylinderCOps::inside(float axis1comp, float axis2comp, float axis3comp)
 {
-  float inside = -1.0;
-  if(fabs(axis3comp) <= 1.0)
+  return cylinderCInside(axis1comp, axis2comp, axis3comp);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void CylinderCOps::insideBatch(const float* axis1comp, const float* axis2comp, const float* axis3comp, size_t count, float* values)
+{
+  for(size_t i = 0; i < count; i++)
   {
-    // inside = 1.0;
-    axis1comp = fabs(axis1comp);
-    axis2comp = fabs(axis2comp);
-    axis1comp = axis1comp * axis1comp;
-    axis2comp = axis2comp * axis2comp;
-    inside = static_cast<float>(1.0 - axis1comp - axis2comp);
+    values[i] = cylinderCInside(axis1comp[i], axis2comp[i], axis3comp[i]);
   }
-  return inside;
 }
@@ -37,6 +37,24 @@
 
 #include "SIMPLib/Math/SIMPLibMath.h"
 
+namespace
+{
+/**
+ * @brief ellipsoidInside is shared by inside() and insideBatch() so that the batched loop body is fully
+ * inlined and can be vectorized by the compiler
+ */
+inline float ellipsoidInside(float axis1comp, float axis2comp, float axis3comp)
+{
+  axis1comp = fabsf(axis1comp);
+  axis2comp = fabsf(axis2comp);
+  axis3comp = fabsf(axis3comp);
+  axis1comp = axis1comp * axis1comp;
+  axis2comp = axis2comp * axis2comp;
+  axis3comp = axis3comp * axis3comp;
+  return 1.0f - axis1comp - axis2comp - axis3comp;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -52,13 +70,13 @@ EllipsoidOps::~EllipsoidOps() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float EllipsoidOps::radcur1(QMap<ArgName, float> args)
+float EllipsoidOps::radcur1(const ShapeArgs& args)
 {
   float radcur1 = 0.0f;
 
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  float volcur = args.volCur;
+  float bovera = args.bOverA;
+  float covera = args.cOverA;
 
   radcur1 = (volcur * 0.75f * (SIMPLib::Constants::k_1OverPi) * (1.0f / bovera) * (1.0f / covera));
   radcur1 = powf(radcur1, 0.333333333333f);
@@ -70,13 +88,16 @@ float EllipsoidOps::radcur1(QMap<ArgName, float> args)
 // -----------------------------------------------------------------------------
 float EllipsoidOps::inside(float axis1comp, float axis2comp, float axis3comp)
 {
-  float inside = 1;
-  axis1comp = fabs(axis1comp);
-  axis2comp = fabs(axis2comp);
-  axis3comp = fabs(axis3comp);
-  axis1comp = axis1comp * axis1comp;
-  axis2comp = axis2comp * axis2comp;
-  axis3comp = axis3comp * axis3comp;
-  inside = 1.0f - axis1comp - axis2comp - axis3comp;
-  return inside;
+  return ellipsoidInside(axis1comp, axis2comp, axis3comp);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void EllipsoidOps::insideBatch(const float* axis1comp, const float* axis2comp, const float* axis3comp, size_t count, float* values)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = ellipsoidInside(axis1comp[i], axis2comp[i], axis3comp[i]);
+  }
 }
@@ -35,6 +35,16 @@
 
 #include "ShapeOps.h"
 
+#include <algorithm>
+#include <cmath>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 #include "SIMPLib/Math/SIMPLibMath.h"
 
 #include "SIMPLib/Geometry/ShapeOps/CubeOctohedronOps.h"
@@ -46,6 +56,95 @@
 
 static const float cube_root_of_one = powf(1.0f, 0.333333333f);
 
+/**
+ * @brief The RasterizeShapeImpl class evaluates a shape over a block of z slices of an image geometry
+ * bounding box. Each row is transformed into the shape's normalized local frame as separate component
+ * arrays and handed to ShapeOps::insideBatch in one call.
+ */
+class RasterizeShapeImpl
+{
+public:
+  RasterizeShapeImpl(ShapeOps* shape, const float center[3], const float axes[3][3], const float origin[3], const float res[3], const size_t dims[3],
+                     const int64_t bboxMin[3], const int64_t bboxMax[3], std::vector<std::vector<size_t>>& sliceCells)
+  : m_Shape(shape)
+  , m_SliceCells(sliceCells)
+  {
+    for(int i = 0; i < 3; i++)
+    {
+      m_Center[i] = center[i];
+      m_Origin[i] = origin[i];
+      m_Res[i] = res[i];
+      m_Dims[i] = dims[i];
+      m_BBoxMin[i] = bboxMin[i];
+      m_BBoxMax[i] = bboxMax[i];
+      for(int j = 0; j < 3; j++)
+      {
+        m_Axes[i][j] = axes[i][j];
+      }
+    }
+  }
+
+  void convert(size_t zStart, size_t zEnd) const
+  {
+    size_t rowLength = static_cast<size_t>(m_BBoxMax[0] - m_BBoxMin[0] + 1);
+    std::vector<float> axis1(rowLength);
+    std::vector<float> axis2(rowLength);
+    std::vector<float> axis3(rowLength);
+    std::vector<float> values(rowLength);
+
+    for(size_t zOffset = zStart; zOffset < zEnd; zOffset++)
+    {
+      int64_t z = m_BBoxMin[2] + static_cast<int64_t>(zOffset);
+      std::vector<size_t>& cells = m_SliceCells[zOffset];
+      float dz = z * m_Res[2] + m_Origin[2] + (0.5f * m_Res[2]) - m_Center[2];
+      for(int64_t y = m_BBoxMin[1]; y <= m_BBoxMax[1]; y++)
+      {
+        float dy = y * m_Res[1] + m_Origin[1] + (0.5f * m_Res[1]) - m_Center[1];
+        // The y and z contributions are constant along the row
+        float base1 = m_Axes[0][1] * dy + m_Axes[0][2] * dz;
+        float base2 = m_Axes[1][1] * dy + m_Axes[1][2] * dz;
+        float base3 = m_Axes[2][1] * dy + m_Axes[2][2] * dz;
+        for(size_t i = 0; i < rowLength; i++)
+        {
+          float dx = (m_BBoxMin[0] + static_cast<int64_t>(i)) * m_Res[0] + m_Origin[0] + (0.5f * m_Res[0]) - m_Center[0];
+          axis1[i] = m_Axes[0][0] * dx + base1;
+          axis2[i] = m_Axes[1][0] * dx + base2;
+          axis3[i] = m_Axes[2][0] * dx + base3;
+        }
+
+        m_Shape->insideBatch(axis1.data(), axis2.data(), axis3.data(), rowLength, values.data());
+
+        size_t rowOffset = (static_cast<size_t>(z) * m_Dims[1] + static_cast<size_t>(y)) * m_Dims[0] + static_cast<size_t>(m_BBoxMin[0]);
+        for(size_t i = 0; i < rowLength; i++)
+        {
+          if(values[i] >= 0.0f)
+          {
+            cells.push_back(rowOffset + i);
+          }
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  ShapeOps* m_Shape;
+  float m_Center[3];
+  float m_Axes[3][3];
+  float m_Origin[3];
+  float m_Res[3];
+  size_t m_Dims[3];
+  int64_t m_BBoxMin[3];
+  int64_t m_BBoxMax[3];
+  std::vector<std::vector<size_t>>& m_SliceCells;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -94,6 +193,19 @@ std::vector<ShapeOps::Pointer> ShapeOps::getShapeOpsVector()
 //
 // -----------------------------------------------------------------------------
 float ShapeOps::radcur1(QMap<ArgName, float> args)
+{
+  ShapeArgs shapeArgs;
+  shapeArgs.omega3 = args.value(Omega3, 0.0f);
+  shapeArgs.bOverA = args.value(B_OverA, 0.0f);
+  shapeArgs.cOverA = args.value(C_OverA, 0.0f);
+  shapeArgs.volCur = args.value(VolCur, 0.0f);
+  return radcur1(shapeArgs);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+float ShapeOps::radcur1(const ShapeArgs& args)
 {
   return cube_root_of_one;
 }
@@ -106,6 +218,95 @@ float ShapeOps::inside(float axis1comp, float axis2comp, float axis3comp)
   return -1.0;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ShapeOps::insideBatch(const float* axis1comp, const float* axis2comp, const float* axis3comp, size_t count, float* values)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = inside(axis1comp[i], axis2comp[i], axis3comp[i]);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> ShapeOps::rasterize(const ImageGeom::Pointer& geom, const float center[3], const float radii[3], const float ga[3][3])
+{
+  std::vector<size_t> cells;
+  if(nullptr == geom.get() || radii[0] <= 0.0f || radii[1] <= 0.0f || radii[2] <= 0.0f)
+  {
+    return cells;
+  }
+
+  size_t dims[3] = {0, 0, 0};
+  float res[3] = {0.0f, 0.0f, 0.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+  std::tie(dims[0], dims[1], dims[2]) = geom->getDimensions();
+  geom->getResolution(res);
+  geom->getOrigin(origin);
+
+  // Scale each rotation row by its semi axis so the transformed components are already normalized, and
+  // bound the oriented shape by the box that contains its local [-1, 1]^3 cube
+  float axes[3][3];
+  int64_t bboxMin[3];
+  int64_t bboxMax[3];
+  for(int i = 0; i < 3; i++)
+  {
+    float extent = 0.0f;
+    for(int j = 0; j < 3; j++)
+    {
+      axes[j][i] = ga[j][i] / radii[j];
+      extent += fabsf(ga[j][i]) * radii[j];
+    }
+    if(dims[i] == 0 || res[i] <= 0.0f)
+    {
+      return cells;
+    }
+    bboxMin[i] = static_cast<int64_t>(std::floor((center[i] - extent - origin[i]) / res[i]));
+    bboxMax[i] = static_cast<int64_t>(std::floor((center[i] + extent - origin[i]) / res[i]));
+    bboxMin[i] = std::max<int64_t>(bboxMin[i], 0);
+    bboxMax[i] = std::min<int64_t>(bboxMax[i], static_cast<int64_t>(dims[i]) - 1);
+    if(bboxMax[i] < bboxMin[i])
+    {
+      return cells;
+    }
+  }
+
+  size_t numSlices = static_cast<size_t>(bboxMax[2] - bboxMin[2] + 1);
+  std::vector<std::vector<size_t>> sliceCells(numSlices);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, numSlices), RasterizeShapeImpl(this, center, axes, origin, res, dims, bboxMin, bboxMax, sliceCells), tbb::auto_partitioner());
+  }
+  else
+#endif
+  {
+    RasterizeShapeImpl serial(this, center, axes, origin, res, dims, bboxMin, bboxMax, sliceCells);
+    serial.convert(0, numSlices);
+  }
+
+  size_t totalCells = 0;
+  for(const std::vector<size_t>& slice : sliceCells)
+  {
+    totalCells += slice.size();
+  }
+  cells.reserve(totalCells);
+  for(const std::vector<size_t>& slice : sliceCells)
+  {
+    cells.insert(cells.end(), slice.begin(), slice.end());
+  }
+  return cells;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -44,6 +44,7 @@
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
 
 /**
  * @brief The ShapeOps class
@@ -65,6 +66,18 @@ class SIMPLib_EXPORT ShapeOps
       VolCur = 3
     };
 
+    /**
+     * @brief The ShapeArgs struct carries the shape descriptors used by radcur1. It replaces building a
+     * QMap for every call.
+     */
+    struct ShapeArgs
+    {
+      float omega3 = 0.0f;
+      float bOverA = 0.0f;
+      float cOverA = 0.0f;
+      float volCur = 0.0f;
+    };
+
     float ShapeClass2Omega[41][2];
 
     /**
@@ -81,10 +94,34 @@ class SIMPLib_EXPORT ShapeOps
     */
     static std::vector<ShapeOps::Pointer> getShapeOpsVector();
 
-    virtual float radcur1(QMap<ArgName, float> args);
+    /**
+     * @brief radcur1 Convenience overload that converts the map into a ShapeArgs and forwards to radcur1(const ShapeArgs&).
+     * Keys missing from the map are treated as 0.
+     */
+    float radcur1(QMap<ArgName, float> args);
+
+    virtual float radcur1(const ShapeArgs& args);
 
     virtual float inside(float axis1comp, float axis2comp, float axis3comp);
 
+    /**
+     * @brief insideBatch Evaluates inside() for count points stored as separate arrays of the three normalized
+     * axis components and writes the results into values. Subclasses override this with a loop over their
+     * inline kernel, so there is one virtual call per block rather than one per point.
+     */
+    virtual void insideBatch(const float* axis1comp, const float* axis2comp, const float* axis3comp, size_t count, float* values);
+
+    /**
+     * @brief rasterize Finds the cells of an image geometry whose centers lie inside this shape (inside() >= 0).
+     * Only the bounding box of the oriented shape is visited, and z slices are evaluated in parallel.
+     * @param geom The image geometry to rasterize into
+     * @param center The shape centroid in geometry coordinates
+     * @param radii The three semi axis lengths of the shape
+     * @param ga The rotation matrix that takes geometry axes into the shape's local axes
+     * @return The linear cell indices covered by the shape, in ascending order
+     */
+    std::vector<size_t> rasterize(const ImageGeom::Pointer& geom, const float center[3], const float radii[3], const float ga[3][3]);
+
     virtual void init();
 
   protected:
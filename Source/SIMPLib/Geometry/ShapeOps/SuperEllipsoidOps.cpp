@@ -42,6 +42,23 @@ float ShapeClass2Omega3[41][2] = {{0.0f, 0.0f},  {0.0f, 0.25f}, {0.0f, 0.5f},  {
                                   {0.0f, 5.5f},  {0.0f, 5.75f}, {0.0f, 6.0f},  {0.0f, 6.25f}, {0.0f, 6.5f},  {0.0f, 6.75f}, {0.0f, 7.0f},  {0.0f, 7.25f}, {0.0f, 7.5f},  {0.0f, 7.75f}, {0.0f, 8.0f},
                                   {0.0f, 8.25f}, {0.0f, 8.5f},  {0.0f, 8.75f}, {0.0f, 9.0f},  {0.0f, 9.25f}, {0.0f, 9.5f},  {0.0f, 9.75f}, {0.0f, 10.0f}};
 
+namespace
+{
+/**
+ * @brief superEllipsoidInside Evaluates 1 - |a|^n - |b|^n - |c|^n for the current shape exponent
+ */
+inline float superEllipsoidInside(float axis1comp, float axis2comp, float axis3comp, float nValue)
+{
+  axis1comp = fabsf(axis1comp);
+  axis2comp = fabsf(axis2comp);
+  axis3comp = fabsf(axis3comp);
+  axis1comp = powf(axis1comp, nValue);
+  axis2comp = powf(axis2comp, nValue);
+  axis3comp = powf(axis3comp, nValue);
+  return 1.0f - axis1comp - axis2comp - axis3comp;
+}
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -66,16 +83,16 @@ void SuperEllipsoidOps::init()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-float SuperEllipsoidOps::radcur1(QMap<ArgName, float> args)
+float SuperEllipsoidOps::radcur1(const ShapeArgs& args)
 {
   float radcur1 = 0.0f;
   float Nvaluedist = 0.0f;
   float bestNvaluedist = 1000000.0f;
 
-  float omega3 = args[Omega3];
-  float volcur = args[VolCur];
-  float bovera = args[B_OverA];
-  float covera = args[C_OverA];
+  float omega3 = args.omega3;
+  float volcur = args.volCur;
+  float bovera = args.bOverA;
+  float covera = args.cOverA;
 
   for(int i = 0; i < 41; i++)
   {
@@ -103,13 +120,16 @@ float SuperEllipsoidOps::radcur1(QMap<ArgName, float> args)
 // -----------------------------------------------------------------------------
 float SuperEllipsoidOps::inside(float axis1comp, float axis2comp, float axis3comp)
 {
-  float inside = 1.0f;
-  axis1comp = fabs(axis1comp);
-  axis2comp = fabs(axis2comp);
-  axis3comp = fabs(axis3comp);
-  axis1comp = powf(axis1comp, Nvalue);
-  axis2comp = powf(axis2comp, Nvalue);
-  axis3comp = powf(axis3comp, Nvalue);
-  inside = 1.0f - axis1comp - axis2comp - axis3comp;
-  return inside;
+  return superEllipsoidInside(axis1comp, axis2comp, axis3comp, Nvalue);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SuperEllipsoidOps::insideBatch(const float* axis1comp, const float* axis2comp, const float* axis3comp, size_t count, float* values)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    values[i] = superEllipsoidInside(axis1comp[i], axis2comp[i], axis3comp[i], Nvalue);
+  }
 }
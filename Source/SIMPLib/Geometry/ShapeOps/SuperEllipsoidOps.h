@@ -52,9 +52,11 @@ class SIMPLib_EXPORT SuperEllipsoidOps : public ShapeOps
 
     virtual ~SuperEllipsoidOps();
 
-    virtual float radcur1(QMap<ArgName, float> args) override;
+    using ShapeOps::radcur1;
+    virtual float radcur1(const ShapeArgs& args) override;
 
     virtual float inside(float axis1comp, float axis2comp, float axis3comp) override;
+    virtual void insideBatch(const float* axis1comp, const float* axis2comp, const float* axis3comp, size_t count, float* values) override;
     virtual void init() override;
 
   protected:
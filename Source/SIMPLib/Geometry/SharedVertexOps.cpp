@@ -33,6 +33,14 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+// Geometries that cache data derived from the vertex coordinates define
+// GEOM_VERTICES_CHANGED() to drop that cache before the vertices are replaced,
+// resized or written here. Handing out the list or a vertex pointer does not
+// drop it; callers that write through those call the geometry's own reset.
+#ifndef GEOM_VERTICES_CHANGED
+#define GEOM_VERTICES_CHANGED()
+#endif
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -49,6 +57,7 @@ SharedVertexList::Pointer GEOM_CLASS_NAME::CreateSharedVertexList(int64_t numVer
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::resizeVertexList(int64_t newNumVertices)
 {
+  GEOM_VERTICES_CHANGED();
   m_VertexList->resize(newNumVertices);
 }
 
@@ -64,6 +73,7 @@ void GEOM_CLASS_NAME::setVertices(SharedVertexList::Pointer vertices)
       vertices->setName(SIMPL::Geometry::SharedVertexList);
     }
   }
+  GEOM_VERTICES_CHANGED();
   m_VertexList = vertices;
 }
 
@@ -80,6 +90,7 @@ SharedVertexList::Pointer GEOM_CLASS_NAME::getVertices()
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::setCoords(int64_t vertId, float coords[3])
 {
+  GEOM_VERTICES_CHANGED();
   float* Vert = m_VertexList->getTuplePointer(vertId);
   Vert[0] = coords[0];
   Vert[1] = coords[1];
@@ -91,7 +102,7 @@ void GEOM_CLASS_NAME::setCoords(int64_t vertId, float coords[3])
 // -----------------------------------------------------------------------------
 void GEOM_CLASS_NAME::getCoords(int64_t vertId, float coords[3])
 {
-  float* Vert = m_VertexList->getTuplePointer(vertId);
+  const float* Vert = m_VertexList->getConstTuplePointer(vertId);
   coords[0] = Vert[0];
   coords[1] = Vert[1];
   coords[2] = Vert[2];
@@ -112,3 +123,5 @@ int64_t GEOM_CLASS_NAME::getNumberOfVertices()
 {
   return m_VertexList->getNumberOfTuples();
 }
+
+#undef GEOM_VERTICES_CHANGED
@@ -5,12 +5,15 @@ set(SUBDIR_NAME Geometry)
 set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/Geometry/EdgeGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/GeometryHelpers.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/GridPointLocator.hpp
   ${SIMPLib_SOURCE_DIR}/Geometry/HexahedralGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometry.h
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometry2D.h
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometry3D.h
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometryGrid.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ImageGeom.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/ImageGeomResampler.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/KdTree.hpp
   ${SIMPLib_SOURCE_DIR}/Geometry/MeshStructs.h
   ${SIMPLib_SOURCE_DIR}/Geometry/QuadGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/RectGridGeom.h
@@ -21,6 +24,7 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/EllipsoidOps.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/ShapeOps.h
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/SuperEllipsoidOps.h
+  ${SIMPLib_SOURCE_DIR}/Geometry/SurfaceMeshExporter.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TetrahedralGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/TriangleGeom.h
   ${SIMPLib_SOURCE_DIR}/Geometry/VertexGeom.h
@@ -35,6 +39,7 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometry3D.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/IGeometryGrid.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ImageGeom.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/ImageGeomResampler.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/QuadGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/RectGridGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/CubeOctohedronOps.cpp
@@ -44,6 +49,7 @@ set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/EllipsoidOps.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/ShapeOps.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/ShapeOps/SuperEllipsoidOps.cpp
+  ${SIMPLib_SOURCE_DIR}/Geometry/SurfaceMeshExporter.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TetrahedralGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/TriangleGeom.cpp
   ${SIMPLib_SOURCE_DIR}/Geometry/VertexGeom.cpp
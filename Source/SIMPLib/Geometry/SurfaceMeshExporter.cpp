@@ -0,0 +1,678 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SurfaceMeshExporter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Utilities/SIMPLibEndian.h"
+
+namespace
+{
+const int64_t k_LinesPerBlock = 16384;
+const size_t k_BlocksPerBatch = 64;
+const size_t k_MaxLineLength = 512;
+
+/**
+ * @brief The BlockWriter class collects little endian binary values in memory and writes them to a file
+ * in large blocks
+ */
+class BlockWriter
+{
+public:
+  BlockWriter(FILE* file, size_t bufferSize)
+  : m_File(file)
+  , m_Buffer(std::max<size_t>(bufferSize, 1024))
+  , m_Size(0)
+  , m_Good(true)
+  {
+  }
+
+  template <typename T> void write(T value)
+  {
+    SIMPLib::Endian::FromSystemToLittle::convert(value);
+    append(&value, sizeof(T));
+  }
+
+  void write(uint8_t value)
+  {
+    append(&value, 1);
+  }
+
+  void write(int8_t value)
+  {
+    append(&value, 1);
+  }
+
+  void append(const void* data, size_t numBytes)
+  {
+    if(m_Size + numBytes > m_Buffer.size())
+    {
+      flush();
+    }
+    if(numBytes > m_Buffer.size())
+    {
+      m_Good = m_Good && fwrite(data, 1, numBytes, m_File) == numBytes;
+      return;
+    }
+    ::memcpy(m_Buffer.data() + m_Size, data, numBytes);
+    m_Size += numBytes;
+  }
+
+  bool flush()
+  {
+    if(m_Size > 0)
+    {
+      m_Good = m_Good && fwrite(m_Buffer.data(), 1, m_Size, m_File) == m_Size;
+      m_Size = 0;
+    }
+    return m_Good;
+  }
+
+private:
+  FILE* m_File;
+  std::vector<char> m_Buffer;
+  size_t m_Size;
+  bool m_Good;
+};
+
+/**
+ * @brief The IPropertyWriter class writes one tuple of an array as PLY properties
+ */
+class IPropertyWriter
+{
+public:
+  virtual ~IPropertyWriter() = default;
+  virtual void write(BlockWriter& writer, size_t tuple) const = 0;
+};
+
+template <typename T, typename PlyType> class PropertyWriter : public IPropertyWriter
+{
+public:
+  PropertyWriter(const T* data, size_t numComps)
+  : m_Data(data)
+  , m_NumComps(numComps)
+  {
+  }
+
+  void write(BlockWriter& writer, size_t tuple) const override
+  {
+    const T* value = m_Data + tuple * m_NumComps;
+    for(size_t c = 0; c < m_NumComps; c++)
+    {
+      writer.write(static_cast<PlyType>(value[c]));
+    }
+  }
+
+private:
+  const T* m_Data;
+  size_t m_NumComps;
+};
+
+template <typename T, typename PlyType> bool CreatePropertyWriter(IDataArray::Pointer array, const char* plyType, QString& typeName, std::unique_ptr<IPropertyWriter>& writer)
+{
+  typename DataArray<T>::Pointer typed = std::dynamic_pointer_cast<DataArray<T>>(array);
+  if(nullptr == typed.get())
+  {
+    return false;
+  }
+  typeName = plyType;
+  writer.reset(new PropertyWriter<T, PlyType>(typed->getConstPointer(0), typed->getNumberOfComponents()));
+  return true;
+}
+
+/**
+ * @brief CreatePropertyWriter Returns a writer for the PLY type matching the array. PLY has no 64 bit
+ * integer types, so those arrays get no writer.
+ */
+std::unique_ptr<IPropertyWriter> CreatePropertyWriter(IDataArray::Pointer array, QString& typeName)
+{
+  std::unique_ptr<IPropertyWriter> writer;
+  typeName.clear();
+  if(CreatePropertyWriter<int8_t, int8_t>(array, "char", typeName, writer) || CreatePropertyWriter<uint8_t, uint8_t>(array, "uchar", typeName, writer) ||
+     CreatePropertyWriter<int16_t, int16_t>(array, "short", typeName, writer) || CreatePropertyWriter<uint16_t, uint16_t>(array, "ushort", typeName, writer) ||
+     CreatePropertyWriter<int32_t, int32_t>(array, "int", typeName, writer) || CreatePropertyWriter<uint32_t, uint32_t>(array, "uint", typeName, writer) ||
+     CreatePropertyWriter<float, float>(array, "float", typeName, writer) || CreatePropertyWriter<double, double>(array, "double", typeName, writer) ||
+     CreatePropertyWriter<bool, uint8_t>(array, "uchar", typeName, writer))
+  {
+    return writer;
+  }
+  return std::unique_ptr<IPropertyWriter>();
+}
+
+/**
+ * @brief WritePropertyHeader Writes the PLY property lines of an array, one per component
+ */
+void WritePropertyHeader(QTextStream& out, IDataArray::Pointer array, const QString& typeName)
+{
+  QString name = array->getName().simplified().replace(' ', '_');
+  int numComps = array->getNumberOfComponents();
+  for(int c = 0; c < numComps; c++)
+  {
+    out << "property " << typeName << " " << name;
+    if(numComps > 1)
+    {
+      out << "_" << c;
+    }
+    out << "\n";
+  }
+}
+
+/**
+ * @brief The VertexLineFormatter class formats the legacy "x y z" vertex lines
+ */
+class VertexLineFormatter
+{
+public:
+  VertexLineFormatter(const float* coords)
+  : m_Coords(coords)
+  {
+  }
+
+  size_t operator()(int64_t i, char* line) const
+  {
+    const float* c = m_Coords + i * 3;
+    int n = snprintf(line, k_MaxLineLength, "%8.5f %8.5f %8.5f\n", c[0], c[1], c[2]);
+    return std::min(static_cast<size_t>(std::max(n, 0)), k_MaxLineLength - 1);
+  }
+
+private:
+  const float* m_Coords;
+};
+
+/**
+ * @brief The FaceLineFormatter class formats the legacy lines of space delimited vertex ids
+ */
+class FaceLineFormatter
+{
+public:
+  FaceLineFormatter(const int64_t* faces, size_t numVertsPerFace)
+  : m_Faces(faces)
+  , m_NumVertsPerFace(numVertsPerFace)
+  {
+  }
+
+  size_t operator()(int64_t i, char* line) const
+  {
+    const int64_t* face = m_Faces + i * m_NumVertsPerFace;
+    size_t n = 0;
+    for(size_t v = 0; v < m_NumVertsPerFace && n < k_MaxLineLength - 1; v++)
+    {
+      int count = snprintf(line + n, k_MaxLineLength - n, v == 0 ? "%lld" : " %lld", static_cast<long long int>(face[v]));
+      n = std::min(n + static_cast<size_t>(std::max(count, 0)), k_MaxLineLength - 2);
+    }
+    line[n++] = '\n';
+    return n;
+  }
+
+private:
+  const int64_t* m_Faces;
+  size_t m_NumVertsPerFace;
+};
+
+/**
+ * @brief The FormatTextLinesImpl class formats blocks of text lines into separate strings so that the
+ * blocks can be formatted in parallel and written in order afterwards
+ */
+template <typename Formatter> class FormatTextLinesImpl
+{
+public:
+  FormatTextLinesImpl(const Formatter& formatter, int64_t firstLine, int64_t numLines, std::vector<std::string>& blocks)
+  : m_Formatter(formatter)
+  , m_FirstLine(firstLine)
+  , m_NumLines(numLines)
+  , m_Blocks(blocks)
+  {
+  }
+
+  void compute(size_t start, size_t end) const
+  {
+    char line[k_MaxLineLength];
+    for(size_t b = start; b < end; b++)
+    {
+      std::string& block = m_Blocks[b];
+      block.clear();
+      int64_t begin = m_FirstLine + static_cast<int64_t>(b) * k_LinesPerBlock;
+      int64_t last = std::min(begin + k_LinesPerBlock, m_FirstLine + m_NumLines);
+      for(int64_t i = begin; i < last; i++)
+      {
+        block.append(line, m_Formatter(i, line));
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+private:
+  Formatter m_Formatter;
+  int64_t m_FirstLine;
+  int64_t m_NumLines;
+  std::vector<std::string>& m_Blocks;
+};
+
+/**
+ * @brief WriteTextLines Formats numLines lines batch by batch and writes them to the file in order
+ * @return false if the file could not be written
+ */
+template <typename Formatter> bool WriteTextLines(FILE* file, const Formatter& formatter, int64_t numLines)
+{
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+  std::vector<std::string> blocks(k_BlocksPerBatch);
+  const int64_t batchLines = k_LinesPerBlock * static_cast<int64_t>(k_BlocksPerBatch);
+  for(int64_t firstLine = 0; firstLine < numLines; firstLine += batchLines)
+  {
+    int64_t count = std::min(batchLines, numLines - firstLine);
+    size_t numBlocks = static_cast<size_t>((count + k_LinesPerBlock - 1) / k_LinesPerBlock);
+    FormatTextLinesImpl<Formatter> impl(formatter, firstLine, count, blocks);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numBlocks), impl, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      impl.compute(0, numBlocks);
+    }
+
+    for(size_t b = 0; b < numBlocks; b++)
+    {
+      if(fwrite(blocks[b].data(), 1, blocks[b].size(), file) != blocks[b].size())
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SurfaceMeshExporter::SurfaceMeshExporter()
+: m_BufferSize(4 * 1024 * 1024)
+, m_ErrorCode(0)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SurfaceMeshExporter::~SurfaceMeshExporter() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SurfaceMeshExporter::addVertexArray(IDataArray::Pointer array)
+{
+  m_VertexArrays.push_back(array);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SurfaceMeshExporter::addFaceArray(IDataArray::Pointer array)
+{
+  m_FaceArrays.push_back(array);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SurfaceMeshExporter::clearArrays()
+{
+  m_VertexArrays.clear();
+  m_FaceArrays.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString SurfaceMeshExporter::PLYPropertyType(IDataArray::Pointer array)
+{
+  QString typeName;
+  if(nullptr != array.get())
+  {
+    CreatePropertyWriter(array, typeName);
+  }
+  return typeName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SurfaceMeshExporter::setError(int code, const QString& message)
+{
+  m_ErrorCode = code;
+  m_ErrorMessage = message;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+Int64ArrayType::Pointer SurfaceMeshExporter::getFaces()
+{
+  m_ErrorCode = 0;
+  m_ErrorMessage.clear();
+  if(nullptr == m_Geometry.get() || nullptr == m_Geometry->getVertices().get())
+  {
+    setError(-1, "The geometry or its vertices are not set");
+    return Int64ArrayType::NullPointer();
+  }
+
+  Int64ArrayType::Pointer faces;
+  if(TriangleGeom::Pointer triangleGeom = std::dynamic_pointer_cast<TriangleGeom>(m_Geometry))
+  {
+    faces = triangleGeom->getTriangles();
+  }
+  else if(QuadGeom::Pointer quadGeom = std::dynamic_pointer_cast<QuadGeom>(m_Geometry))
+  {
+    faces = quadGeom->getQuads();
+  }
+  if(nullptr == faces.get())
+  {
+    setError(-1, "Only Triangle and Quadrilateral geometries with a face list can be exported");
+  }
+  return faces;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SurfaceMeshExporter::writeBinarySTL(const QString& filePath, const QString& header)
+{
+  Int64ArrayType::Pointer faces = getFaces();
+  if(nullptr == faces.get())
+  {
+    return m_ErrorCode;
+  }
+
+  size_t numVertsPerFace = faces->getNumberOfComponents();
+  size_t numFaces = faces->getNumberOfTuples();
+  size_t numTris = numFaces * (numVertsPerFace - 2);
+  if(numTris > std::numeric_limits<uint32_t>::max())
+  {
+    setError(-6, QString("The mesh has %1 triangles, more than a binary STL file can hold").arg(numTris));
+    return m_ErrorCode;
+  }
+
+  FILE* file = fopen(filePath.toLocal8Bit().data(), "wb");
+  if(nullptr == file)
+  {
+    setError(-2, QString("Error opening '%1' for writing").arg(filePath));
+    return m_ErrorCode;
+  }
+
+  BlockWriter writer(file, m_BufferSize);
+  // Readers treat files starting with "solid" as ASCII STL
+  QByteArray headerText = header.isEmpty() ? QByteArray("DREAM.3D Binary STL") : header.toLatin1();
+  if(headerText.startsWith("solid"))
+  {
+    headerText[0] = 'S';
+  }
+  char headerBytes[80];
+  ::memset(headerBytes, 0, 80);
+  ::memcpy(headerBytes, headerText.constData(), std::min(headerText.size(), 80));
+  writer.append(headerBytes, 80);
+  writer.write(static_cast<uint32_t>(numTris));
+
+  const float* coords = m_Geometry->getVertices()->getConstPointer(0);
+  const int64_t* faceIds = faces->getConstPointer(0);
+  int64_t numVerts = m_Geometry->getNumberOfVertices();
+  for(size_t f = 0; f < numFaces; f++)
+  {
+    const int64_t* face = faceIds + f * numVertsPerFace;
+    for(size_t v = 0; v < numVertsPerFace; v++)
+    {
+      if(face[v] < 0 || face[v] >= numVerts)
+      {
+        fclose(file);
+        setError(-4, QString("Face %1 references vertex %2, but the mesh only has %3 vertices").arg(f).arg(face[v]).arg(numVerts));
+        return m_ErrorCode;
+      }
+    }
+    // Quads are fanned into two triangles around their first vertex
+    for(size_t t = 0; t < numVertsPerFace - 2; t++)
+    {
+      const float* p0 = coords + face[0] * 3;
+      const float* p1 = coords + face[t + 1] * 3;
+      const float* p2 = coords + face[t + 2] * 3;
+      float a[3] = {p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2]};
+      float b[3] = {p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2]};
+      float normal[3] = {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+      float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+      for(size_t c = 0; c < 3; c++)
+      {
+        writer.write(length > 0.0f ? normal[c] / length : 0.0f);
+      }
+      for(const float* p : {p0, p1, p2})
+      {
+        writer.write(p[0]);
+        writer.write(p[1]);
+        writer.write(p[2]);
+      }
+      writer.write(static_cast<uint16_t>(0));
+    }
+  }
+
+  bool good = writer.flush();
+  good = (fclose(file) == 0) && good;
+  if(!good)
+  {
+    setError(-5, QString("Error writing to '%1'").arg(filePath));
+  }
+  return m_ErrorCode;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SurfaceMeshExporter::writeBinaryPLY(const QString& filePath, const QString& comment)
+{
+  Int64ArrayType::Pointer faces = getFaces();
+  if(nullptr == faces.get())
+  {
+    return m_ErrorCode;
+  }
+
+  size_t numVertsPerFace = faces->getNumberOfComponents();
+  size_t numFaces = faces->getNumberOfTuples();
+  int64_t numVerts = m_Geometry->getNumberOfVertices();
+  if(numVerts > std::numeric_limits<int32_t>::max())
+  {
+    setError(-6, QString("The mesh has %1 vertices, more than the int vertex indices of a PLY file can address").arg(numVerts));
+    return m_ErrorCode;
+  }
+
+  QString header;
+  QTextStream out(&header);
+  out << "ply\n";
+  out << "format binary_little_endian 1.0\n";
+  if(!comment.isEmpty())
+  {
+    out << "comment " << comment.simplified() << "\n";
+  }
+  out << "element vertex " << static_cast<qlonglong>(numVerts) << "\n";
+  out << "property float x\nproperty float y\nproperty float z\n";
+
+  std::vector<std::unique_ptr<IPropertyWriter>> vertexWriters;
+  std::vector<std::unique_ptr<IPropertyWriter>> faceWriters;
+  for(int pass = 0; pass < 2; pass++)
+  {
+    const QVector<IDataArray::Pointer>& arrays = (pass == 0) ? m_VertexArrays : m_FaceArrays;
+    std::vector<std::unique_ptr<IPropertyWriter>>& writers = (pass == 0) ? vertexWriters : faceWriters;
+    size_t numTuples = (pass == 0) ? static_cast<size_t>(numVerts) : numFaces;
+    if(pass == 1)
+    {
+      out << "element face " << static_cast<qulonglong>(numFaces) << "\n";
+      out << "property list uchar int vertex_indices\n";
+    }
+    for(const IDataArray::Pointer& array : arrays)
+    {
+      if(array->getNumberOfTuples() != numTuples)
+      {
+        setError(-4, QString("Array '%1' has %2 tuples but the mesh has %3 %4").arg(array->getName()).arg(array->getNumberOfTuples()).arg(numTuples).arg(pass == 0 ? "vertices" : "faces"));
+        return m_ErrorCode;
+      }
+      QString typeName;
+      std::unique_ptr<IPropertyWriter> propertyWriter = CreatePropertyWriter(array, typeName);
+      if(nullptr == propertyWriter)
+      {
+        setError(-3, QString("Array '%1' of type %2 can not be written to a PLY file").arg(array->getName()).arg(array->getTypeAsString()));
+        return m_ErrorCode;
+      }
+      WritePropertyHeader(out, array, typeName);
+      writers.push_back(std::move(propertyWriter));
+    }
+  }
+  out << "end_header\n";
+  out.flush();
+
+  FILE* file = fopen(filePath.toLocal8Bit().data(), "wb");
+  if(nullptr == file)
+  {
+    setError(-2, QString("Error opening '%1' for writing").arg(filePath));
+    return m_ErrorCode;
+  }
+
+  BlockWriter writer(file, m_BufferSize);
+  QByteArray headerBytes = header.toLatin1();
+  writer.append(headerBytes.constData(), headerBytes.size());
+
+  const float* coords = m_Geometry->getVertices()->getConstPointer(0);
+  for(int64_t v = 0; v < numVerts; v++)
+  {
+    writer.write(coords[v * 3]);
+    writer.write(coords[v * 3 + 1]);
+    writer.write(coords[v * 3 + 2]);
+    for(const std::unique_ptr<IPropertyWriter>& propertyWriter : vertexWriters)
+    {
+      propertyWriter->write(writer, static_cast<size_t>(v));
+    }
+  }
+
+  const int64_t* faceIds = faces->getConstPointer(0);
+  for(size_t f = 0; f < numFaces; f++)
+  {
+    const int64_t* face = faceIds + f * numVertsPerFace;
+    writer.write(static_cast<uint8_t>(numVertsPerFace));
+    for(size_t v = 0; v < numVertsPerFace; v++)
+    {
+      if(face[v] < 0 || face[v] >= numVerts)
+      {
+        fclose(file);
+        setError(-4, QString("Face %1 references vertex %2, but the mesh only has %3 vertices").arg(f).arg(face[v]).arg(numVerts));
+        return m_ErrorCode;
+      }
+      writer.write(static_cast<int32_t>(face[v]));
+    }
+    for(const std::unique_ptr<IPropertyWriter>& propertyWriter : faceWriters)
+    {
+      propertyWriter->write(writer, f);
+    }
+  }
+
+  bool good = writer.flush();
+  good = (fclose(file) == 0) && good;
+  if(!good)
+  {
+    setError(-5, QString("Error writing to '%1'").arg(filePath));
+  }
+  return m_ErrorCode;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SurfaceMeshExporter::writeVertexText(FILE* file)
+{
+  Int64ArrayType::Pointer faces = getFaces();
+  if(nullptr == faces.get())
+  {
+    return m_ErrorCode;
+  }
+  VertexLineFormatter formatter(m_Geometry->getVertices()->getConstPointer(0));
+  if(!WriteTextLines(file, formatter, m_Geometry->getNumberOfVertices()))
+  {
+    setError(-5, "Error writing the vertex lines");
+  }
+  return m_ErrorCode;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SurfaceMeshExporter::writeFaceText(FILE* file)
+{
+  Int64ArrayType::Pointer faces = getFaces();
+  if(nullptr == faces.get())
+  {
+    return m_ErrorCode;
+  }
+  FaceLineFormatter formatter(faces->getConstPointer(0), faces->getNumberOfComponents());
+  if(!WriteTextLines(file, formatter, static_cast<int64_t>(faces->getNumberOfTuples())))
+  {
+    setError(-5, "Error writing the face lines");
+  }
+  return m_ErrorCode;
+}
@@ -0,0 +1,164 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _surfacemeshexporter_h_
+#define _surfacemeshexporter_h_
+
+#include <cstdio>
+
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/Geometry/IGeometry2D.h"
+
+/**
+ * @brief The SurfaceMeshExporter class writes the vertices and faces of a TriangleGeom or QuadGeom to
+ * disk. It supports binary STL, binary little endian PLY with any number of vertex and face attribute
+ * arrays, and the space delimited text lines used by the DREAM.3D Nodes/Triangles files.
+ *
+ * Binary output is assembled in memory and handed to the operating system in blocks of BufferSize bytes.
+ * Text output is formatted in parallel, one block of lines per task, and the blocks are then written in
+ * order, so the result is identical to formatting the lines one after the other.
+ */
+class SIMPLib_EXPORT SurfaceMeshExporter
+{
+  public:
+    SIMPL_SHARED_POINTERS(SurfaceMeshExporter)
+    SIMPL_STATIC_NEW_MACRO(SurfaceMeshExporter)
+    SIMPL_TYPE_MACRO(SurfaceMeshExporter)
+
+    virtual ~SurfaceMeshExporter();
+
+    /**
+     * @brief Sets/Gets the TriangleGeom or QuadGeom to export
+     */
+    SIMPL_INSTANCE_PROPERTY(IGeometry2D::Pointer, Geometry)
+
+    /**
+     * @brief Sets/Gets the number of bytes collected before each write to the file
+     */
+    SIMPL_INSTANCE_PROPERTY(size_t, BufferSize)
+
+    SIMPL_GET_PROPERTY(int, ErrorCode)
+    SIMPL_GET_PROPERTY(QString, ErrorMessage)
+
+    /**
+     * @brief addVertexArray Adds an array with one tuple per vertex that is written as PLY vertex properties
+     * @param array
+     */
+    void addVertexArray(IDataArray::Pointer array);
+
+    /**
+     * @brief addFaceArray Adds an array with one tuple per face that is written as PLY face properties
+     * @param array
+     */
+    void addFaceArray(IDataArray::Pointer array);
+
+    /**
+     * @brief clearArrays Removes all vertex and face arrays
+     */
+    void clearArrays();
+
+    /**
+     * @brief writeBinarySTL Writes the mesh as a binary STL file. Quads are split into two triangles.
+     * STL files only store the geometry, so the vertex and face arrays are not written.
+     * @param filePath
+     * @param header Text placed in the 80 byte header; it is truncated to fit
+     * @return 0 on success, a negative value on error
+     */
+    int writeBinarySTL(const QString& filePath, const QString& header = QString());
+
+    /**
+     * @brief writeBinaryPLY Writes the mesh and its vertex and face arrays as a binary little endian PLY file.
+     * Each component of an array becomes one property named after the array, with the component index
+     * appended for arrays with more than one component. Boolean arrays are written as uchar.
+     * @param filePath
+     * @param comment Optional comment line for the header
+     * @return 0 on success, a negative value on error
+     */
+    int writeBinaryPLY(const QString& filePath, const QString& comment = QString());
+
+    /**
+     * @brief writeVertexText Writes one "x y z" line per vertex with 5 decimals to an open file
+     * @param file
+     * @return 0 on success, a negative value on error
+     */
+    int writeVertexText(FILE* file);
+
+    /**
+     * @brief writeFaceText Writes one line of space delimited vertex ids per face to an open file
+     * @param file
+     * @return 0 on success, a negative value on error
+     */
+    int writeFaceText(FILE* file);
+
+    /**
+     * @brief PLYPropertyType Returns the PLY type an array is written as, or an empty string if the
+     * array can not be written to a PLY file
+     * @param array
+     * @return
+     */
+    static QString PLYPropertyType(IDataArray::Pointer array);
+
+  protected:
+    SurfaceMeshExporter();
+
+    /**
+     * @brief getFaces Returns the triangle or quad list of the geometry and sets an error if there is none
+     */
+    Int64ArrayType::Pointer getFaces();
+
+    /**
+     * @brief setError
+     */
+    void setError(int code, const QString& message);
+
+  private:
+    int m_ErrorCode;
+    QString m_ErrorMessage;
+    QVector<IDataArray::Pointer> m_VertexArrays;
+    QVector<IDataArray::Pointer> m_FaceArrays;
+
+  public:
+    SurfaceMeshExporter(const SurfaceMeshExporter&) = delete; // Copy Constructor Not Implemented
+    SurfaceMeshExporter(SurfaceMeshExporter&&) = delete;      // Move Constructor
+    SurfaceMeshExporter& operator=(const SurfaceMeshExporter&) = delete; // Copy Assignment Not Implemented
+    SurfaceMeshExporter& operator=(SurfaceMeshExporter&&) = delete;      // Move Assignment
+};
+
+#endif /* _surfacemeshexporter_h_ */
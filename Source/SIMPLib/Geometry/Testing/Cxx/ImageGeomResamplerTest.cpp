@@ -0,0 +1,177 @@
+#include <stdlib.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/ImageGeomResampler.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class ImageGeomResamplerTest
+{
+public:
+  ImageGeomResamplerTest() = default;
+
+  virtual ~ImageGeomResamplerTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // A 4 x 4 x 2 unit grid holding a linear field and a two label array split at x = 2
+  // -----------------------------------------------------------------------------
+  void createSource(ImageGeom::Pointer& geom, AttributeMatrix::Pointer& cellData)
+  {
+    geom = ImageGeom::CreateGeometry("Source");
+    geom->setDimensions(4, 4, 2);
+    geom->setResolution(1.0f, 1.0f, 1.0f);
+    geom->setOrigin(0.0f, 0.0f, 0.0f);
+
+    QVector<size_t> tDims = {4, 4, 2};
+    cellData = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    FloatArrayType::Pointer field = FloatArrayType::CreateArray(32, "Field", true);
+    Int32ArrayType::Pointer labels = Int32ArrayType::CreateArray(32, "Labels", true);
+    for(size_t z = 0; z < 2; z++)
+    {
+      for(size_t y = 0; y < 4; y++)
+      {
+        for(size_t x = 0; x < 4; x++)
+        {
+          size_t index = (z * 4 + y) * 4 + x;
+          field->setValue(index, (x + 0.5f) + 10.0f * (y + 0.5f));
+          labels->setValue(index, x < 2 ? 7 : 9);
+        }
+      }
+    }
+    cellData->addAttributeArray("Field", field);
+    cellData->addAttributeArray("Labels", labels);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestUpsampling()
+  {
+    ImageGeom::Pointer geom;
+    AttributeMatrix::Pointer cellData;
+    createSource(geom, cellData);
+
+    ImageGeomResampler::Pointer resampler = ImageGeomResampler::New();
+    resampler->setSourceGeometry(geom);
+    resampler->setDimensions(8, 8, 4);
+    resampler->setResolution(0.5f, 0.5f, 0.5f);
+    resampler->setOrigin(0.0f, 0.0f, 0.0f);
+    resampler->setInterpolationType(ImageGeomResampler::InterpolationType::Trilinear);
+    resampler->setArrayInterpolationType("Labels", ImageGeomResampler::InterpolationType::Mode);
+
+    AttributeMatrix::Pointer resampled = resampler->resample(cellData, QVector<QString>(), "Resampled");
+    DREAM3D_REQUIRE_VALID_POINTER(resampled.get())
+    DREAM3D_REQUIRE_EQUAL(resampled->getNumberOfTuples(), 256)
+
+    FloatArrayType::Pointer field = std::dynamic_pointer_cast<FloatArrayType>(resampled->getAttributeArray("Field"));
+    Int32ArrayType::Pointer labels = std::dynamic_pointer_cast<Int32ArrayType>(resampled->getAttributeArray("Labels"));
+    DREAM3D_REQUIRE_VALID_POINTER(field.get())
+    DREAM3D_REQUIRE_VALID_POINTER(labels.get())
+
+    for(size_t z = 0; z < 4; z++)
+    {
+      for(size_t y = 0; y < 8; y++)
+      {
+        for(size_t x = 0; x < 8; x++)
+        {
+          size_t index = (z * 8 + y) * 8 + x;
+          float px = (x + 0.5f) * 0.5f;
+          float py = (y + 0.5f) * 0.5f;
+          // The linear field is reproduced exactly between the outermost source cell centers
+          float expected = std::min(3.5f, std::max(0.5f, px)) + 10.0f * std::min(3.5f, std::max(0.5f, py));
+          DREAM3D_REQUIRE(std::abs(field->getValue(index) - expected) < 1.0E-4f)
+          // Mode interpolation never blends labels
+          DREAM3D_REQUIRE_EQUAL(labels->getValue(index), (px < 2.0f ? 7 : 9))
+        }
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRotatedNearestNeighbor()
+  {
+    ImageGeom::Pointer geom;
+    AttributeMatrix::Pointer cellData;
+    createSource(geom, cellData);
+
+    // Target x runs along source y and target y runs along source -x
+    float rotation[9] = {0.0f, -1.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+    ImageGeomResampler::Pointer resampler = ImageGeomResampler::New();
+    resampler->setSourceGeometry(geom);
+    resampler->setDimensions(4, 5, 2);
+    resampler->setResolution(1.0f, 1.0f, 1.0f);
+    resampler->setOrigin(4.0f, 0.0f, 0.0f);
+    resampler->setRotation(rotation);
+    resampler->setFillValue(-3.0);
+
+    QVector<QString> arrayNames(1, "Labels");
+    AttributeMatrix::Pointer resampled = resampler->resample(cellData, arrayNames, "Resampled");
+    DREAM3D_REQUIRE_VALID_POINTER(resampled.get())
+    DREAM3D_REQUIRE_NULL_POINTER(resampled->getAttributeArray("Field").get())
+
+    Int32ArrayType::Pointer labels = std::dynamic_pointer_cast<Int32ArrayType>(resampled->getAttributeArray("Labels"));
+    for(size_t z = 0; z < 2; z++)
+    {
+      for(size_t y = 0; y < 5; y++)
+      {
+        for(size_t x = 0; x < 4; x++)
+        {
+          float sourceX = 4.0f - (y + 0.5f);
+          int32_t expected = sourceX < 0.0f ? -3 : (sourceX < 2.0f ? 7 : 9);
+          DREAM3D_REQUIRE_EQUAL(labels->getValue((z * 5 + y) * 4 + x), expected)
+        }
+      }
+    }
+
+    ImageGeom::Pointer target = resampler->createTargetGeometry("Target");
+    DREAM3D_REQUIRE_EQUAL(target->getNumberOfElements(), 40)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestErrors()
+  {
+    ImageGeom::Pointer geom;
+    AttributeMatrix::Pointer cellData;
+    createSource(geom, cellData);
+
+    ImageGeomResampler::Pointer resampler = ImageGeomResampler::New();
+    resampler->setSourceGeometry(geom);
+    DREAM3D_REQUIRE_NULL_POINTER(resampler->resample(cellData, QVector<QString>(), "Resampled").get())
+    DREAM3D_REQUIRE_EQUAL(resampler->getErrorCode(), -3)
+
+    resampler->setTargetGeometry(geom);
+    QVector<QString> arrayNames(1, "Missing");
+    DREAM3D_REQUIRE_NULL_POINTER(resampler->resample(cellData, arrayNames, "Resampled").get())
+    DREAM3D_REQUIRE_EQUAL(resampler->getErrorCode(), -4)
+
+    DREAM3D_REQUIRE_VALID_POINTER(resampler->resample(cellData, QVector<QString>(), "Resampled").get())
+    DREAM3D_REQUIRE_EQUAL(resampler->getErrorCode(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ImageGeomResamplerTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestUpsampling());
+    DREAM3D_REGISTER_TEST(TestRotatedNearestNeighbor());
+    DREAM3D_REGISTER_TEST(TestErrors());
+  }
+
+private:
+  ImageGeomResamplerTest(const ImageGeomResamplerTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const ImageGeomResamplerTest&) = delete;         // Move assignment Not Implemented
+};
@@ -1,11 +1,14 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 #include <QtCore/QFile>
 
 #include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/RectGridGeom.h"
 
 #include "SIMPLib/Testing/SIMPLTestFileLocations.h"
 #include "SIMPLib/Testing/UnitTestSupport.hpp"
@@ -91,6 +94,129 @@ public:
     DREAM3D_REQUIRE(err == ImageGeom::ErrorType::ZOutOfBoundsHigh)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  FloatArrayType::Pointer CreatePoints(const float* values, size_t numPoints)
+  {
+    QVector<size_t> cDims(1, 3);
+    FloatArrayType::Pointer points = FloatArrayType::CreateArray(numPoints, cDims, "Points", true);
+    std::copy(values, values + 3 * numPoints, points->getPointer(0));
+    return points;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBatchedCellIndices()
+  {
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry("Test Geometry");
+    image->setDimensions(10, 20, 30);
+    image->setResolution(0.5f, 2.0f, 5.0f);
+    image->setOrigin(-1.0f, 6.0f, 10.0f);
+
+    // Inside, on the lower bound, on the upper bound, below and above the grid
+    const float values[15] = {3.6f, 9.3f, 12.8f, -1.0f, 6.0f, 10.0f, 4.0f, 46.0f, 160.0f, -5.0f, 9.3f, 12.8f, 3.6f, 9.3f, 2000.0f};
+    FloatArrayType::Pointer points = CreatePoints(values, 5);
+
+    Int64ArrayType::Pointer cellIds = image->findCellIndices(points, "CellIds");
+    DREAM3D_REQUIRE_VALID_POINTER(cellIds.get())
+    DREAM3D_REQUIRE_EQUAL(cellIds->getNumberOfTuples(), 5)
+    size_t index = 0;
+    image->computeCellIndex(points->getPointer(0), index);
+    DREAM3D_REQUIRE_EQUAL(cellIds->getValue(0), static_cast<int64_t>(index))
+    DREAM3D_REQUIRE_EQUAL(cellIds->getValue(1), 0)
+    DREAM3D_REQUIRE_EQUAL(cellIds->getValue(2), 10 * 20 * 30 - 1)
+    DREAM3D_REQUIRE_EQUAL(cellIds->getValue(3), -1)
+    DREAM3D_REQUIRE_EQUAL(cellIds->getValue(4), -1)
+
+    // The same grid described by explicit bounds has to give the same answers
+    RectGridGeom::Pointer rectGrid = RectGridGeom::CreateGeometry("Test Geometry");
+    rectGrid->setDimensions(10, 20, 30);
+    FloatArrayType::Pointer xBounds = FloatArrayType::CreateArray(11, SIMPL::Geometry::xBoundsList, true);
+    FloatArrayType::Pointer yBounds = FloatArrayType::CreateArray(21, SIMPL::Geometry::yBoundsList, true);
+    FloatArrayType::Pointer zBounds = FloatArrayType::CreateArray(31, SIMPL::Geometry::zBoundsList, true);
+    for(size_t i = 0; i < 11; i++)
+    {
+      xBounds->setValue(i, -1.0f + 0.5f * i);
+    }
+    for(size_t i = 0; i < 21; i++)
+    {
+      yBounds->setValue(i, 6.0f + 2.0f * i);
+    }
+    for(size_t i = 0; i < 31; i++)
+    {
+      zBounds->setValue(i, 10.0f + 5.0f * i);
+    }
+    rectGrid->setXBounds(xBounds);
+    rectGrid->setYBounds(yBounds);
+    rectGrid->setZBounds(zBounds);
+
+    Int64ArrayType::Pointer rectCellIds = rectGrid->findCellIndices(points, "CellIds");
+    DREAM3D_REQUIRE_VALID_POINTER(rectCellIds.get())
+    for(size_t i = 0; i < 5; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(rectCellIds->getValue(i), cellIds->getValue(i))
+    }
+
+    // Uneven bounds along X
+    xBounds->setValue(1, -0.9f);
+    const float unevenValues[6] = {-0.95f, 6.5f, 10.5f, -0.5f, 6.5f, 10.5f};
+    rectCellIds = rectGrid->findCellIndices(CreatePoints(unevenValues, 2), "CellIds");
+    DREAM3D_REQUIRE_EQUAL(rectCellIds->getValue(0), 0)
+    DREAM3D_REQUIRE_EQUAL(rectCellIds->getValue(1), 1)
+
+    // Coordinates need 3 components
+    FloatArrayType::Pointer badPoints = FloatArrayType::CreateArray(5, "Points", true);
+    DREAM3D_REQUIRE_NULL_POINTER(image->findCellIndices(badPoints, "CellIds").get())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestInterpolationStencils()
+  {
+    ImageGeom::Pointer image = ImageGeom::CreateGeometry("Test Geometry");
+    image->setDimensions(4, 4, 1);
+    image->setResolution(1.0f, 1.0f, 1.0f);
+    image->setOrigin(0.0f, 0.0f, 0.0f);
+
+    // Halfway between 4 cell centers, on a cell center, in the border region and outside
+    const float values[12] = {1.5f, 2.0f, 0.5f, 2.5f, 1.5f, 0.5f, 0.1f, 3.9f, 0.5f, 5.0f, 1.0f, 0.5f};
+    Int64ArrayType::Pointer cellIds;
+    FloatArrayType::Pointer weights;
+    DREAM3D_REQUIRE(image->findInterpolationStencils(CreatePoints(values, 4), cellIds, weights))
+    DREAM3D_REQUIRE_EQUAL(cellIds->getNumberOfComponents(), 8)
+    DREAM3D_REQUIRE_EQUAL(weights->getNumberOfComponents(), 8)
+
+    for(size_t i = 0; i < 3; i++)
+    {
+      float sum = 0.0f;
+      float position[2] = {0.0f, 0.0f};
+      for(size_t c = 0; c < 8; c++)
+      {
+        int64_t cellId = cellIds->getComponent(i, c);
+        float weight = weights->getComponent(i, c);
+        DREAM3D_REQUIRE(cellId >= 0 && cellId < 16)
+        sum += weight;
+        position[0] += weight * (cellId % 4 + 0.5f);
+        position[1] += weight * (cellId / 4 + 0.5f);
+      }
+      DREAM3D_REQUIRE(std::abs(sum - 1.0f) < 1.0E-5f)
+      // Linear fields are reproduced exactly between the outermost cell centers
+      float expected[2] = {std::min(3.5f, std::max(0.5f, values[3 * i])), std::min(3.5f, std::max(0.5f, values[3 * i + 1]))};
+      DREAM3D_REQUIRE(std::abs(position[0] - expected[0]) < 1.0E-5f)
+      DREAM3D_REQUIRE(std::abs(position[1] - expected[1]) < 1.0E-5f)
+    }
+    DREAM3D_REQUIRE(std::abs(weights->getComponent(1, 0) - 1.0f) < 1.0E-5f)
+
+    for(size_t c = 0; c < 8; c++)
+    {
+      DREAM3D_REQUIRE_EQUAL(cellIds->getComponent(3, c), -1)
+      DREAM3D_REQUIRE_EQUAL(weights->getComponent(3, c), 0.0f)
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -101,6 +227,8 @@ public:
 
     // Use this to register a specific function that will run a test
     DREAM3D_REGISTER_TEST(TestIndexCalculation());
+    DREAM3D_REGISTER_TEST(TestBatchedCellIndices());
+    DREAM3D_REGISTER_TEST(TestInterpolationStencils());
     DREAM3D_REGISTER_TEST(RemoveTestFiles());
   }
 
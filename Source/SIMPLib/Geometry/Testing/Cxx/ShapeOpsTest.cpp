@@ -0,0 +1,187 @@
+#include <stdlib.h>
+
+#include <cmath>
+#include <iostream>
+#include <set>
+
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/Geometry/ShapeOps/ShapeOps.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class ShapeOpsTest
+{
+public:
+  ShapeOpsTest() = default;
+
+  virtual ~ShapeOpsTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBatchMatchesScalar()
+  {
+    std::vector<ShapeOps::Pointer> shapeOps = ShapeOps::getShapeOpsVector();
+
+    QMap<ShapeOps::ArgName, float> shapeArgMap;
+    shapeArgMap[ShapeOps::Omega3] = 0.8f;
+    shapeArgMap[ShapeOps::VolCur] = 10.0f;
+    shapeArgMap[ShapeOps::B_OverA] = 0.7f;
+    shapeArgMap[ShapeOps::C_OverA] = 0.5f;
+
+    ShapeOps::ShapeArgs shapeArgs;
+    shapeArgs.omega3 = 0.8f;
+    shapeArgs.volCur = 10.0f;
+    shapeArgs.bOverA = 0.7f;
+    shapeArgs.cOverA = 0.5f;
+
+    const size_t numPoints = 17 * 17 * 17;
+    std::vector<float> axis1(numPoints);
+    std::vector<float> axis2(numPoints);
+    std::vector<float> axis3(numPoints);
+    size_t idx = 0;
+    for(int k = 0; k < 17; k++)
+    {
+      for(int j = 0; j < 17; j++)
+      {
+        for(int i = 0; i < 17; i++)
+        {
+          axis1[idx] = -1.6f + 0.2f * i;
+          axis2[idx] = -1.6f + 0.2f * j;
+          axis3[idx] = -1.6f + 0.2f * k;
+          idx++;
+        }
+      }
+    }
+
+    for(const ShapeOps::Pointer& shape : shapeOps)
+    {
+      shape->init();
+      float fromMap = shape->radcur1(shapeArgMap);
+      float fromStruct = shape->radcur1(shapeArgs);
+      DREAM3D_REQUIRE_EQUAL(fromMap, fromStruct)
+
+      std::vector<float> values(numPoints, 0.0f);
+      shape->insideBatch(axis1.data(), axis2.data(), axis3.data(), numPoints, values.data());
+      for(size_t i = 0; i < numPoints; i++)
+      {
+        float scalar = shape->inside(axis1[i], axis2[i], axis3[i]);
+        DREAM3D_REQUIRE(std::fabs(values[i] - scalar) <= 1.0E-5f)
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void CheckRasterizeAgainstScan(ShapeOps::Pointer shape, const float center[3], const float radii[3], const float ga[3][3])
+  {
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry("Test Geometry");
+    geom->setDimensions(48, 40, 36);
+    geom->setResolution(0.5f, 0.5f, 0.5f);
+    geom->setOrigin(-2.0f, 1.0f, 0.0f);
+
+    std::vector<size_t> cells = shape->rasterize(geom, center, radii, ga);
+    for(size_t i = 1; i < cells.size(); i++)
+    {
+      DREAM3D_REQUIRE(cells[i - 1] < cells[i])
+    }
+    std::set<size_t> rasterized(cells.begin(), cells.end());
+
+    // Brute force over every cell of the geometry. The two may only disagree for cells sitting on the shape
+    // surface, which is checked by nudging the point slightly towards and away from the shape center.
+    size_t count = 0;
+    size_t dims[3] = {48, 40, 36};
+    for(size_t z = 0; z < dims[2]; z++)
+    {
+      for(size_t y = 0; y < dims[1]; y++)
+      {
+        for(size_t x = 0; x < dims[0]; x++)
+        {
+          float coords[3] = {0.0f, 0.0f, 0.0f};
+          geom->getCoords(x, y, z, coords);
+          float local[3] = {0.0f, 0.0f, 0.0f};
+          for(int j = 0; j < 3; j++)
+          {
+            local[j] = (ga[j][0] * (coords[0] - center[0]) + ga[j][1] * (coords[1] - center[1]) + ga[j][2] * (coords[2] - center[2])) / radii[j];
+          }
+          float value = shape->inside(local[0], local[1], local[2]);
+          size_t index = (z * dims[1] + y) * dims[0] + x;
+          bool expected = value >= 0.0f;
+          bool found = rasterized.find(index) != rasterized.end();
+          if(expected != found)
+          {
+            float shrunk = shape->inside(local[0] * 0.999f, local[1] * 0.999f, local[2] * 0.999f);
+            float grown = shape->inside(local[0] * 1.001f, local[1] * 1.001f, local[2] * 1.001f);
+            DREAM3D_REQUIRE((shrunk >= 0.0f) != (grown >= 0.0f))
+          }
+          if(expected)
+          {
+            count++;
+          }
+        }
+      }
+    }
+    DREAM3D_REQUIRE(count > 0)
+    DREAM3D_REQUIRE(cells.size() > 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRasterize()
+  {
+    std::vector<ShapeOps::Pointer> shapeOps = ShapeOps::getShapeOpsVector();
+    ShapeOps::ShapeArgs shapeArgs;
+    shapeArgs.omega3 = 0.8f;
+    shapeArgs.volCur = 10.0f;
+    shapeArgs.bOverA = 0.7f;
+    shapeArgs.cOverA = 0.5f;
+
+    float identity[3][3] = {{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}};
+    // 30 degree rotation about z followed by 45 degrees about x
+    float c1 = std::cos(0.5235988f), s1 = std::sin(0.5235988f);
+    float c2 = std::cos(0.7853982f), s2 = std::sin(0.7853982f);
+    float rotated[3][3] = {{c1, s1, 0.0f}, {-s1 * c2, c1 * c2, s2}, {s1 * s2, -c1 * s2, c2}};
+
+    // The second center places part of the shape outside the geometry to exercise the clipping
+    float centers[2][3] = {{10.0f, 11.0f, 9.0f}, {-1.0f, 2.5f, 16.5f}};
+    float radii[3] = {6.0f, 4.2f, 3.0f};
+
+    for(const ShapeOps::Pointer& shape : shapeOps)
+    {
+      shape->init();
+      shape->radcur1(shapeArgs);
+      for(int c = 0; c < 2; c++)
+      {
+        CheckRasterizeAgainstScan(shape, centers[c], radii, identity);
+        CheckRasterizeAgainstScan(shape, centers[c], radii, rotated);
+      }
+    }
+
+    // A shape entirely outside of the geometry covers no cells
+    float outside[3] = {-100.0f, 0.0f, 0.0f};
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry("Test Geometry");
+    geom->setDimensions(8, 8, 8);
+    geom->setResolution(1.0f, 1.0f, 1.0f);
+    geom->setOrigin(0.0f, 0.0f, 0.0f);
+    DREAM3D_REQUIRE_EQUAL(shapeOps[0]->rasterize(geom, outside, radii, identity).size(), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ShapeOpsTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestBatchMatchesScalar());
+    DREAM3D_REGISTER_TEST(TestRasterize());
+  }
+
+private:
+  ShapeOpsTest(const ShapeOpsTest&) = delete;   // Copy Constructor Not Implemented
+  void operator=(const ShapeOpsTest&) = delete; // Move assignment Not Implemented
+};
@@ -1,6 +1,10 @@
 
 set(TEST_${SUBDIR_NAME}_NAMES
+  ImageGeomResamplerTest
   ImageGeomTest
+  ShapeOpsTest
+  SurfaceMeshExporterTest
+  VertexGeomTest
 )
 
 SIMPL_ADD_UNIT_TEST("${TEST_${SUBDIR_NAME}_NAMES}" "${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/Testing/Cxx")
@@ -0,0 +1,213 @@
+#include <stdlib.h>
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/SurfaceMeshExporter.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+namespace SurfaceMeshExporterTestConsts
+{
+const QString StlFile = UnitTest::TestTempDir + "/SurfaceMeshExporterTest.stl";
+const QString PlyFile = UnitTest::TestTempDir + "/SurfaceMeshExporterTest.ply";
+const QString TextFile = UnitTest::TestTempDir + "/SurfaceMeshExporterTest.txt";
+}
+
+class SurfaceMeshExporterTest
+{
+public:
+  SurfaceMeshExporterTest() = default;
+
+  virtual ~SurfaceMeshExporterTest() = default;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(SurfaceMeshExporterTestConsts::StlFile);
+    QFile::remove(SurfaceMeshExporterTestConsts::PlyFile);
+    QFile::remove(SurfaceMeshExporterTestConsts::TextFile);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  // The unit square in the z = 0 plane
+  // -----------------------------------------------------------------------------
+  SharedVertexList::Pointer createVertices()
+  {
+    SharedVertexList::Pointer vertices = TriangleGeom::CreateSharedVertexList(4);
+    float coords[12] = {0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f};
+    ::memcpy(vertices->getPointer(0), coords, sizeof(coords));
+    return vertices;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  TriangleGeom::Pointer createTriangles()
+  {
+    TriangleGeom::Pointer triangleGeom = TriangleGeom::CreateGeometry(2, createVertices(), "Triangles");
+    int64_t tris[6] = {0, 1, 2, 0, 2, 3};
+    ::memcpy(triangleGeom->getTriangles()->getPointer(0), tris, sizeof(tris));
+    return triangleGeom;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QByteArray readFile(const QString& filePath)
+  {
+    QFile file(filePath);
+    if(!file.open(QIODevice::ReadOnly))
+    {
+      return QByteArray();
+    }
+    return file.readAll();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBinarySTL()
+  {
+    SurfaceMeshExporter::Pointer exporter = SurfaceMeshExporter::New();
+    exporter->setGeometry(createTriangles());
+    int err = exporter->writeBinarySTL(SurfaceMeshExporterTestConsts::StlFile, "solid header");
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+
+    QByteArray contents = readFile(SurfaceMeshExporterTestConsts::StlFile);
+    DREAM3D_REQUIRE_EQUAL(contents.size(), 84 + 2 * 50)
+    // A header starting with "solid" would mark the file as ASCII STL
+    DREAM3D_REQUIRE(contents.startsWith("solid") == false)
+
+    uint32_t numTris = 0;
+    ::memcpy(&numTris, contents.constData() + 80, 4);
+    DREAM3D_REQUIRE_EQUAL(numTris, 2)
+
+    // Normal then the three vertices of the second triangle
+    float values[12];
+    ::memcpy(values, contents.constData() + 84 + 50, sizeof(values));
+    DREAM3D_REQUIRE_EQUAL(values[2], 1.0f)
+    DREAM3D_REQUIRE_EQUAL(values[6], 1.0f)
+    DREAM3D_REQUIRE_EQUAL(values[7], 1.0f)
+    DREAM3D_REQUIRE_EQUAL(values[10], 1.0f)
+
+    // Quads are split into two triangles
+    SharedQuadList::Pointer quads = QuadGeom::CreateSharedQuadList(1);
+    int64_t quad[4] = {0, 1, 2, 3};
+    ::memcpy(quads->getPointer(0), quad, sizeof(quad));
+    exporter->setGeometry(QuadGeom::CreateGeometry(quads, createVertices(), "Quads"));
+    err = exporter->writeBinarySTL(SurfaceMeshExporterTestConsts::StlFile);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+    DREAM3D_REQUIRE(readFile(SurfaceMeshExporterTestConsts::StlFile).mid(80) == contents.mid(80))
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBinaryPLY()
+  {
+    SurfaceMeshExporter::Pointer exporter = SurfaceMeshExporter::New();
+    exporter->setGeometry(createTriangles());
+
+    FloatArrayType::Pointer curvature = FloatArrayType::CreateArray(4, "Mean Curvature", true);
+    curvature->initializeWithValue(0.5f);
+    QVector<size_t> cDims(1, 2);
+    Int32ArrayType::Pointer labels = Int32ArrayType::CreateArray(2, cDims, "FaceLabels", true);
+    for(size_t i = 0; i < 4; i++)
+    {
+      labels->setValue(i, static_cast<int32_t>(i) - 1);
+    }
+    exporter->addVertexArray(curvature);
+    exporter->addFaceArray(labels);
+    int err = exporter->writeBinaryPLY(SurfaceMeshExporterTestConsts::PlyFile);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+
+    QByteArray contents = readFile(SurfaceMeshExporterTestConsts::PlyFile);
+    QByteArray header("ply\n"
+                      "format binary_little_endian 1.0\n"
+                      "element vertex 4\n"
+                      "property float x\n"
+                      "property float y\n"
+                      "property float z\n"
+                      "property float Mean_Curvature\n"
+                      "element face 2\n"
+                      "property list uchar int vertex_indices\n"
+                      "property int FaceLabels_0\n"
+                      "property int FaceLabels_1\n"
+                      "end_header\n");
+    DREAM3D_REQUIRE(contents.startsWith(header))
+    DREAM3D_REQUIRE_EQUAL(contents.size(), header.size() + 4 * 16 + 2 * (1 + 12 + 8))
+
+    const char* face = contents.constData() + header.size() + 4 * 16 + (1 + 12 + 8);
+    DREAM3D_REQUIRE_EQUAL(static_cast<int>(face[0]), 3)
+    int32_t values[5];
+    ::memcpy(values, face + 1, sizeof(values));
+    DREAM3D_REQUIRE_EQUAL(values[0], 0)
+    DREAM3D_REQUIRE_EQUAL(values[1], 2)
+    DREAM3D_REQUIRE_EQUAL(values[2], 3)
+    DREAM3D_REQUIRE_EQUAL(values[3], 1)
+    DREAM3D_REQUIRE_EQUAL(values[4], 2)
+
+    // 64 bit integers have no PLY type and arrays must match the mesh
+    exporter->clearArrays();
+    exporter->addVertexArray(Int64ArrayType::CreateArray(4, "Ids", true));
+    DREAM3D_REQUIRE(SurfaceMeshExporter::PLYPropertyType(Int64ArrayType::CreateArray(4, "Ids", true)).isEmpty())
+    DREAM3D_REQUIRE_EQUAL(exporter->writeBinaryPLY(SurfaceMeshExporterTestConsts::PlyFile), -3)
+    exporter->clearArrays();
+    exporter->addFaceArray(curvature);
+    DREAM3D_REQUIRE_EQUAL(exporter->writeBinaryPLY(SurfaceMeshExporterTestConsts::PlyFile), -4)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestText()
+  {
+    SurfaceMeshExporter::Pointer exporter = SurfaceMeshExporter::New();
+    exporter->setGeometry(createTriangles());
+
+    FILE* file = fopen(SurfaceMeshExporterTestConsts::TextFile.toLatin1().data(), "wb");
+    DREAM3D_REQUIRE_VALID_POINTER(file)
+    int err = exporter->writeVertexText(file);
+    err |= exporter->writeFaceText(file);
+    fclose(file);
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+
+    QByteArray expected(" 0.00000  0.00000  0.00000\n"
+                        " 1.00000  0.00000  0.00000\n"
+                        " 1.00000  1.00000  0.00000\n"
+                        " 0.00000  1.00000  0.00000\n"
+                        "0 1 2\n"
+                        "0 2 3\n");
+    DREAM3D_REQUIRE(readFile(SurfaceMeshExporterTestConsts::TextFile) == expected)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### SurfaceMeshExporterTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestBinarySTL());
+    DREAM3D_REGISTER_TEST(TestBinaryPLY());
+    DREAM3D_REGISTER_TEST(TestText());
+    DREAM3D_REGISTER_TEST(RemoveTestFiles());
+  }
+
+private:
+  SurfaceMeshExporterTest(const SurfaceMeshExporterTest&) = delete; // Copy Constructor Not Implemented
+  void operator=(const SurfaceMeshExporterTest&) = delete;          // Move assignment Not Implemented
+};
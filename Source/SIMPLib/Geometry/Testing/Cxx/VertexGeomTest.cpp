@@ -0,0 +1,217 @@
+#include <stdlib.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+
+#include "SIMPLib/Geometry/KdTree.hpp"
+#include "SIMPLib/Geometry/VertexGeom.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class VertexGeomTest
+{
+public:
+  VertexGeomTest() = default;
+
+  virtual ~VertexGeomTest() = default;
+
+  // -----------------------------------------------------------------------------
+  // Vertices on a 10 x 10 x 10 lattice with unit spacing
+  // -----------------------------------------------------------------------------
+  VertexGeom::Pointer createLattice()
+  {
+    VertexGeom::Pointer geom = VertexGeom::CreateGeometry(1000, "Lattice");
+    for(int64_t z = 0; z < 10; z++)
+    {
+      for(int64_t y = 0; y < 10; y++)
+      {
+        for(int64_t x = 0; x < 10; x++)
+        {
+          float coords[3] = {static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)};
+          geom->setCoords(z * 100 + y * 10 + x, coords);
+        }
+      }
+    }
+    return geom;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLatticeNeighbors()
+  {
+    VertexGeom::Pointer geom = createLattice();
+
+    // Interior vertex (5, 5, 5) has 6 face neighbors at distance 1
+    int64_t center = 555;
+    NeighborList<int64_t>::Pointer nearest = geom->findNearestVertices(6, "Nearest");
+    DREAM3D_REQUIRE_VALID_POINTER(nearest.get())
+    DREAM3D_REQUIRE_EQUAL(nearest->getNumberOfTuples(), 1000)
+    std::vector<int64_t> ids = *(nearest->getList(static_cast<int>(center)));
+    std::sort(ids.begin(), ids.end());
+    std::vector<int64_t> expected = {455, 545, 554, 556, 565, 655};
+    DREAM3D_REQUIRE(ids == expected)
+
+    NeighborList<int64_t>::Pointer within = geom->findVerticesWithinRadius(1.0f, "Within");
+    DREAM3D_REQUIRE_EQUAL(within->getListSize(static_cast<int>(center)), 6)
+    // Corner vertex only has 3 face neighbors
+    DREAM3D_REQUIRE_EQUAL(within->getListSize(0), 3)
+    // Nobody lists itself
+    for(int i = 0; i < 1000; i++)
+    {
+      NeighborList<int64_t>::SharedVectorType list = within->getList(i);
+      DREAM3D_REQUIRE(std::find(list->begin(), list->end(), static_cast<int64_t>(i)) == list->end())
+    }
+
+    within = geom->findVerticesWithinRadius(1.5f, "Within");
+    DREAM3D_REQUIRE_EQUAL(within->getListSize(static_cast<int>(center)), 18)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestIndexInvalidation()
+  {
+    VertexGeom::Pointer geom = createLattice();
+    KdTree<float>::Pointer index = geom->getVertexIndex();
+    DREAM3D_REQUIRE_VALID_POINTER(index.get())
+    DREAM3D_REQUIRE_EQUAL(index->getNumberOfPoints(), 1000)
+
+    // Reading coordinates keeps the index
+    float coords[3] = {0.0f, 0.0f, 0.0f};
+    geom->getCoords(10, coords);
+    DREAM3D_REQUIRE(geom->getVertexIndex() == index)
+
+    // Moving vertex 0 next to vertex 999 must show up in the next query
+    coords[0] = 9.0f;
+    coords[1] = 9.0f;
+    coords[2] = 9.1f;
+    geom->setCoords(0, coords);
+    DREAM3D_REQUIRE(geom->getVertexIndex() != index)
+    NeighborList<int64_t>::Pointer nearest = geom->findNearestVertices(1, "Nearest");
+    bool ok = true;
+    int64_t nearestId = nearest->getValue(999, 0, ok);
+    DREAM3D_REQUIRE_EQUAL(nearestId, 0)
+
+    // Handing out the vertices for writing keeps the index
+    index = geom->getVertexIndex();
+    float* vert = geom->getVertexPointer(1);
+    DREAM3D_REQUIRE(geom->getVertexIndex() == index)
+    DREAM3D_REQUIRE(geom->getVertices().get() != nullptr)
+    DREAM3D_REQUIRE(geom->getVertexIndex() == index)
+
+    // Raw writes need an explicit deleteVertexIndex()
+    vert[0] = 9.0f;
+    vert[1] = 9.0f;
+    vert[2] = 9.15f;
+    DREAM3D_REQUIRE(geom->getVertexIndex() == index)
+    geom->deleteVertexIndex();
+    DREAM3D_REQUIRE(geom->getVertexIndex() != index)
+    nearest = geom->findNearestVertices(1, "Nearest");
+    DREAM3D_REQUIRE_EQUAL(nearest->getValue(1, 0, ok), 0)
+
+    // Replacing the vertex list with one of the same size drops the index
+    index = geom->getVertexIndex();
+    geom->setVertices(VertexGeom::CreateSharedVertexList(1000));
+    DREAM3D_REQUIRE(geom->getVertexIndex() != index)
+
+    geom->resizeVertexList(500);
+    DREAM3D_REQUIRE_EQUAL(geom->getVertexIndex()->getNumberOfPoints(), 500)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> void TestKdTreeForType()
+  {
+    const size_t numPoints = 5000;
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<T> distribution(0, 10);
+    std::vector<T> coords(3 * numPoints);
+    for(size_t i = 0; i < coords.size(); i++)
+    {
+      coords[i] = distribution(generator);
+    }
+
+    typename KdTree<T>::Pointer tree = KdTree<T>::New(coords.data(), numPoints);
+    const size_t k = 8;
+    const T radius = static_cast<T>(0.75);
+    typename NeighborList<T>::Pointer distances;
+    NeighborList<int64_t>::Pointer nearest = tree->findNearestNeighbors(coords.data(), numPoints, k, true, "Nearest", &distances);
+    NeighborList<int64_t>::Pointer within = tree->findNeighborsWithinRadius(coords.data(), numPoints, radius, true, "Within");
+
+    // Compare a sample of the queries against brute force
+    for(size_t i = 0; i < numPoints; i += 97)
+    {
+      std::vector<T> bruteForce;
+      size_t withinCount = 0;
+      for(size_t j = 0; j < numPoints; j++)
+      {
+        if(i == j)
+        {
+          continue;
+        }
+        T dx = coords[3 * j] - coords[3 * i];
+        T dy = coords[3 * j + 1] - coords[3 * i + 1];
+        T dz = coords[3 * j + 2] - coords[3 * i + 2];
+        T dist = std::sqrt(dx * dx + dy * dy + dz * dz);
+        bruteForce.push_back(dist);
+        if(dist <= radius)
+        {
+          withinCount++;
+        }
+      }
+      std::sort(bruteForce.begin(), bruteForce.end());
+
+      typename NeighborList<T>::SharedVectorType found = distances->getList(static_cast<int>(i));
+      DREAM3D_REQUIRE_EQUAL(found->size(), k)
+      DREAM3D_REQUIRE_EQUAL(nearest->getListSize(static_cast<int>(i)), k)
+      for(size_t n = 0; n < k; n++)
+      {
+        DREAM3D_REQUIRE(std::abs(bruteForce[n] - (*found)[n]) < static_cast<T>(1.0E-5))
+      }
+      DREAM3D_REQUIRE_EQUAL(within->getListSize(static_cast<int>(i)), static_cast<int>(withinCount))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestKdTree()
+  {
+    TestKdTreeForType<float>();
+    TestKdTreeForType<double>();
+
+    // Degenerate trees
+    KdTree<float>::Pointer empty = KdTree<float>::New(nullptr, 0);
+    NeighborList<int64_t>::Pointer nearest = empty->findNearestNeighbors(nullptr, 0, 3, false, "Nearest");
+    DREAM3D_REQUIRE_EQUAL(nearest->getNumberOfTuples(), 0)
+
+    float point[3] = {1.0f, 2.0f, 3.0f};
+    KdTree<float>::Pointer single = KdTree<float>::New(point, 1);
+    nearest = single->findNearestNeighbors(point, 1, 3, false, "Nearest");
+    DREAM3D_REQUIRE_EQUAL(nearest->getListSize(0), 1)
+    nearest = single->findNearestNeighbors(point, 1, 3, true, "Nearest");
+    DREAM3D_REQUIRE_EQUAL(nearest->getListSize(0), 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### VertexGeomTest Starting ####" << std::endl;
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestLatticeNeighbors());
+    DREAM3D_REGISTER_TEST(TestIndexInvalidation());
+    DREAM3D_REGISTER_TEST(TestKdTree());
+  }
+
+private:
+  VertexGeomTest(const VertexGeomTest&) = delete;  // Copy Constructor Not Implemented
+  void operator=(const VertexGeomTest&) = delete; // Move assignment Not Implemented
+};
@@ -145,7 +145,6 @@ TetrahedralGeom::TetrahedralGeom()
   m_TetNeighbors = ElementDynamicList::NullPointer();
   m_TetCentroids = FloatArrayType::NullPointer();
   m_TetSizes = FloatArrayType::NullPointer();
-  m_ProgressCounter = 0;
 }
 
 // -----------------------------------------------------------------------------
@@ -575,13 +574,13 @@ void TetrahedralGeom::getShapeFunctions(double pCoords[3], double* shape)
 // -----------------------------------------------------------------------------
 void TetrahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArrayType::Pointer derivatives, Observable* observable)
 {
-  m_ProgressCounter = 0;
   int64_t numTets = getNumberOfTets();
 
   if(observable)
   {
     connect(this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), observable, SLOT(broadcastPipelineMessage(const PipelineMessage&)));
   }
+  beginProgress(0, m_MessageTitle);
 
 #ifdef SIMPL_USE_PARALLEL_ALGORITHMS
   tbb::task_scheduler_init init;
@@ -599,6 +598,8 @@ void TetrahedralGeom::findDerivatives(DoubleArrayType::Pointer field, DoubleArra
     FindTetDerivativesImpl serial(this, field, derivatives);
     serial.compute(0, numTets);
   }
+
+  endProgress();
 }
 
 // -----------------------------------------------------------------------------
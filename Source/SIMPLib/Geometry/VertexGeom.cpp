@@ -59,7 +59,7 @@ VertexGeom::VertexGeom()
   m_SpatialDimensionality = 3;
   m_VertexList = VertexGeom::CreateSharedVertexList(0);
   m_VertexSizes = FloatArrayType::NullPointer();
-  m_ProgressCounter = 0;
+  m_VertexIndex = KdTree<float>::NullPointer();
 }
 
 // -----------------------------------------------------------------------------
@@ -109,6 +109,7 @@ VertexGeom::Pointer VertexGeom::CreateGeometry(SharedVertexList::Pointer vertice
 // -----------------------------------------------------------------------------
 void VertexGeom::initializeWithZeros()
 {
+  deleteVertexIndex();
   m_VertexList->initializeWithZeros();
 }
 
@@ -450,6 +451,58 @@ int VertexGeom::readGeometryFromHDF5(hid_t parentId, bool preflight)
   return 1;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+KdTree<float>::Pointer VertexGeom::getVertexIndex()
+{
+  if(nullptr == m_VertexList.get())
+  {
+    return KdTree<float>::NullPointer();
+  }
+  // Accessors that change the vertices drop the index, see GEOM_VERTICES_CHANGED(); raw
+  // writes are reported through deleteVertexIndex()
+  if(nullptr == m_VertexIndex.get())
+  {
+    m_VertexIndex = KdTree<float>::New(m_VertexList->getConstPointer(0), m_VertexList->getNumberOfTuples());
+  }
+  return m_VertexIndex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void VertexGeom::deleteVertexIndex()
+{
+  m_VertexIndex = KdTree<float>::NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+NeighborList<int64_t>::Pointer VertexGeom::findNearestVertices(size_t k, const QString& name)
+{
+  KdTree<float>::Pointer index = getVertexIndex();
+  if(nullptr == index.get())
+  {
+    return NeighborList<int64_t>::NullPointer();
+  }
+  return index->findNearestNeighbors(m_VertexList->getConstPointer(0), m_VertexList->getNumberOfTuples(), k, true, name);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+NeighborList<int64_t>::Pointer VertexGeom::findVerticesWithinRadius(float radius, const QString& name)
+{
+  KdTree<float>::Pointer index = getVertexIndex();
+  if(nullptr == index.get())
+  {
+    return NeighborList<int64_t>::NullPointer();
+  }
+  return index->findNeighborsWithinRadius(m_VertexList->getConstPointer(0), m_VertexList->getNumberOfTuples(), radius, true, name);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -475,4 +528,5 @@ IGeometry::Pointer VertexGeom::deepCopy(bool forceNoAllocate)
 #endif
 
 #define GEOM_CLASS_NAME VertexGeom
+#define GEOM_VERTICES_CHANGED() deleteVertexIndex()
 #include "SIMPLib/Geometry/SharedVertexOps.cpp"
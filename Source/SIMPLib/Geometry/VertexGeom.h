@@ -40,7 +40,9 @@
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Geometry/IGeometry.h"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
 #include "SIMPLib/Geometry/GeometryHelpers.h"
+#include "SIMPLib/Geometry/KdTree.hpp"
 
 /**
  * @brief The VertexGeom class represents a point cloud
@@ -127,6 +129,36 @@ class SIMPLib_EXPORT VertexGeom : public IGeometry
      */
     int64_t getNumberOfVertices();
 
+    /**
+     * @brief getVertexIndex Returns a k-d tree over the vertices, building it on first use. The
+     * tree is dropped by setVertices, resizeVertexList, setCoords and initializeWithZeros. Writes
+     * through getVertices() or getVertexPointer() are not seen; call deleteVertexIndex() after
+     * such writes.
+     * @return
+     */
+    KdTree<float>::Pointer getVertexIndex();
+
+    /**
+     * @brief deleteVertexIndex Frees the k-d tree over the vertices
+     */
+    void deleteVertexIndex();
+
+    /**
+     * @brief findNearestVertices Finds the k nearest other vertices of every vertex in parallel
+     * @param k
+     * @param name Name of the returned list
+     * @return One list of vertex ids per vertex, sorted by increasing distance
+     */
+    NeighborList<int64_t>::Pointer findNearestVertices(size_t k, const QString& name);
+
+    /**
+     * @brief findVerticesWithinRadius Finds the other vertices within a distance of every vertex in parallel
+     * @param radius
+     * @param name Name of the returned list
+     * @return One list of vertex ids per vertex, sorted by increasing distance
+     */
+    NeighborList<int64_t>::Pointer findVerticesWithinRadius(float radius, const QString& name);
+
 // -----------------------------------------------------------------------------
 // Inherited from IGeometry
 // -----------------------------------------------------------------------------
@@ -304,6 +336,7 @@ class SIMPLib_EXPORT VertexGeom : public IGeometry
   private:
     SharedVertexList::Pointer m_VertexList;
     FloatArrayType::Pointer m_VertexSizes;
+    KdTree<float>::Pointer m_VertexIndex;
 
     VertexGeom(const VertexGeom&) = delete;     // Copy Constructor Not Implemented
     void operator=(const VertexGeom&) = delete; // Move assignment Not Implemented
@@ -166,7 +166,7 @@ class H5DataArrayWriter
 #endif
       if (QH5Lite::datasetExists(gid, dataArray->getName()) == false)
       {
-        err = QH5Lite::writePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getPointer(0));
+        err = QH5Lite::writePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getConstPointer(0));
         if(err < 0)
         {
           return err;
@@ -174,7 +174,7 @@ class H5DataArrayWriter
       }
       else
       {
-        err = QH5Lite::replacePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getPointer(0));
+        err = QH5Lite::replacePointerDataset(gid, dataArray->getName(), h5Rank, h5Dims.data(), dataArray->getConstPointer(0));
         if(err < 0)
         {
           return err;
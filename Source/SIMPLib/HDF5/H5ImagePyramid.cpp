@@ -0,0 +1,276 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "H5ImagePyramid.h"
+
+#include "H5Support/H5Macros.h"
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Lite.h"
+#include "H5Support/QH5Utilities.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/Geometry/ImageGeomResampler.h"
+#include "SIMPLib/HDF5/VTKH5Constants.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5ImagePyramid::H5ImagePyramid() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5ImagePyramid::~H5ImagePyramid() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString H5ImagePyramid::LevelGroupPath(const QString& dcName, const QString& amName, int level)
+{
+  return QString("%1/%2/%3/Level_%4").arg(SIMPL::StringConstants::DataContainerPyramidGroupName).arg(dcName).arg(amName).arg(level);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AttributeMatrix::Pointer H5ImagePyramid::CreateNextLevel(ImageGeom::Pointer geom, AttributeMatrix::Pointer cellData, ImageGeom::Pointer& levelGeom)
+{
+  size_t dims[3] = {0, 0, 0};
+  float res[3] = {0.0f, 0.0f, 0.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+  std::tie(dims[0], dims[1], dims[2]) = geom->getDimensions();
+  geom->getResolution(res);
+  geom->getOrigin(origin);
+
+  // Each level cell is centered on the corner shared by the 2x2x2 block it replaces, so trilinear
+  // interpolation yields the block mean and mode interpolation the most frequent value of the block
+  size_t levelDims[3] = {0, 0, 0};
+  float levelRes[3] = {0.0f, 0.0f, 0.0f};
+  for(size_t d = 0; d < 3; d++)
+  {
+    levelDims[d] = (dims[d] + 1) / 2;
+    levelRes[d] = dims[d] > 1 ? 2.0f * res[d] : res[d];
+  }
+
+  ImageGeomResampler::Pointer resampler = ImageGeomResampler::New();
+  resampler->setSourceGeometry(geom);
+  resampler->setDimensions(levelDims);
+  resampler->setResolution(levelRes);
+  resampler->setOrigin(origin);
+
+  QVector<QString> arrayNames;
+  QList<QString> names = cellData->getAttributeArrayNames();
+  for(const QString& name : names)
+  {
+    IDataArray::Pointer array = cellData->getAttributeArray(name);
+    if(!array->getNameOfClass().startsWith("DataArray"))
+    {
+      continue;
+    }
+    QString type = array->getTypeAsString();
+    bool isFloatingPoint = (type.compare("float") == 0 || type.compare("double") == 0);
+    resampler->setArrayInterpolationType(name, isFloatingPoint ? ImageGeomResampler::InterpolationType::Trilinear : ImageGeomResampler::InterpolationType::Mode);
+    arrayNames.push_back(name);
+  }
+  if(arrayNames.isEmpty())
+  {
+    return AttributeMatrix::NullPointer();
+  }
+
+  AttributeMatrix::Pointer level = resampler->resample(cellData, arrayNames, cellData->getName());
+  if(nullptr != level.get())
+  {
+    levelGeom = resampler->createTargetGeometry(geom->getName());
+  }
+  return level;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5ImagePyramid::WriteLevels(hid_t fileId, hid_t dcGid, const QString& dcGroupName, ImageGeom::Pointer geom, AttributeMatrix::Pointer cellData, int maxLevels)
+{
+  QString amName = cellData->getName();
+  QString dcPyramidPath = QString("%1/%2").arg(SIMPL::StringConstants::DataContainerPyramidGroupName).arg(dcGroupName);
+  herr_t err = QH5Utilities::createGroupsFromPath(dcPyramidPath, fileId);
+  if(err < 0)
+  {
+    return -1;
+  }
+  hid_t dcPyramidGid = H5Gopen(fileId, dcPyramidPath.toLatin1().data(), H5P_DEFAULT);
+  if(dcPyramidGid < 0)
+  {
+    return -1;
+  }
+  H5ScopedGroupSentinel dcSentinel(&dcPyramidGid, false);
+
+  // Replace whatever an earlier write left behind
+  if(H5Lexists(dcPyramidGid, amName.toLatin1().data(), H5P_DEFAULT) > 0)
+  {
+    H5Ldelete(dcPyramidGid, amName.toLatin1().data(), H5P_DEFAULT);
+  }
+  err = QH5Utilities::createGroupsFromPath(amName, dcPyramidGid);
+  if(err < 0)
+  {
+    return -1;
+  }
+  hid_t amGid = H5Gopen(dcPyramidGid, amName.toLatin1().data(), H5P_DEFAULT);
+  H5ScopedGroupSentinel amSentinel(&amGid, false);
+
+  ImageGeom::Pointer levelGeom = geom;
+  AttributeMatrix::Pointer levelData = cellData;
+  int numLevels = 0;
+  while(numLevels < maxLevels && levelGeom->getNumberOfElements() > 1)
+  {
+    ImageGeom::Pointer nextGeom;
+    levelData = CreateNextLevel(levelGeom, levelData, nextGeom);
+    if(nullptr == levelData.get())
+    {
+      break;
+    }
+    levelGeom = nextGeom;
+    numLevels++;
+
+    QString levelName = QString("Level_%1").arg(numLevels);
+    err = QH5Utilities::createGroupsFromPath(levelName, amGid);
+    if(err < 0)
+    {
+      return -1;
+    }
+    hid_t levelGid = H5Gopen(amGid, levelName.toLatin1().data(), H5P_DEFAULT);
+    H5ScopedGroupSentinel levelSentinel(&levelGid, false);
+
+    size_t dims[3] = {0, 0, 0};
+    float res[3] = {0.0f, 0.0f, 0.0f};
+    float origin[3] = {0.0f, 0.0f, 0.0f};
+    std::tie(dims[0], dims[1], dims[2]) = levelGeom->getDimensions();
+    levelGeom->getResolution(res);
+    levelGeom->getOrigin(origin);
+    hsize_t size = 3;
+    err = QH5Lite::writePointerAttribute(amGid, levelName, H5_DIMENSIONS, 1, &size, dims);
+    err |= QH5Lite::writePointerAttribute(amGid, levelName, H5_SPACING, 1, &size, res);
+    err |= QH5Lite::writePointerAttribute(amGid, levelName, H5_ORIGIN, 1, &size, origin);
+    if(err < 0)
+    {
+      return -1;
+    }
+    err = levelData->writeAttributeArraysToHDF5(levelGid);
+    if(err < 0)
+    {
+      return -1;
+    }
+  }
+
+  err = QH5Lite::writeScalarAttribute(dcGid, amName, SIMPL::HDF5::PyramidLevels, numLevels);
+  if(err < 0)
+  {
+    return -1;
+  }
+  return numLevels;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5ImagePyramid::ReadLevelCount(hid_t dcGid, const QString& amName)
+{
+  int numLevels = 0;
+  // Files written without pyramids do not have the attribute
+  HDF_ERROR_HANDLER_OFF
+  herr_t err = QH5Lite::readScalarAttribute(dcGid, amName, SIMPL::HDF5::PyramidLevels, numLevels);
+  HDF_ERROR_HANDLER_ON
+  return err < 0 ? 0 : numLevels;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AttributeMatrix::Pointer H5ImagePyramid::ReadLevel(hid_t fileId, const QString& dcName, const QString& amName, int level, const QVector<QString>& arrayNames, bool preflight, ImageGeom::Pointer geom)
+{
+  QString amPath = QString("%1/%2/%3").arg(SIMPL::StringConstants::DataContainerPyramidGroupName).arg(dcName).arg(amName);
+  QString levelName = QString("Level_%1").arg(level);
+
+  HDF_ERROR_HANDLER_OFF
+  hid_t amGid = H5Gopen(fileId, amPath.toLatin1().data(), H5P_DEFAULT);
+  HDF_ERROR_HANDLER_ON
+  if(amGid < 0)
+  {
+    return AttributeMatrix::NullPointer();
+  }
+  H5ScopedGroupSentinel amSentinel(&amGid, false);
+
+  QVector<size_t> dims;
+  QVector<float> res;
+  QVector<float> origin;
+  herr_t err = QH5Lite::readVectorAttribute(amGid, levelName, H5_DIMENSIONS, dims);
+  err |= QH5Lite::readVectorAttribute(amGid, levelName, H5_SPACING, res);
+  err |= QH5Lite::readVectorAttribute(amGid, levelName, H5_ORIGIN, origin);
+  if(err < 0 || dims.size() != 3 || res.size() != 3 || origin.size() != 3)
+  {
+    return AttributeMatrix::NullPointer();
+  }
+
+  hid_t levelGid = H5Gopen(amGid, levelName.toLatin1().data(), H5P_DEFAULT);
+  if(levelGid < 0)
+  {
+    return AttributeMatrix::NullPointer();
+  }
+  H5ScopedGroupSentinel levelSentinel(&levelGid, false);
+
+  QList<QString> storedNames;
+  QH5Utilities::getGroupObjects(levelGid, H5Utilities::H5Support_DATASET | H5Utilities::H5Support_GROUP, storedNames);
+
+  AttributeMatrix::Pointer cellData = AttributeMatrix::New(dims, amName, AttributeMatrix::Type::Cell);
+  for(const QString& name : storedNames)
+  {
+    if(!arrayNames.contains(name))
+    {
+      continue;
+    }
+    err = cellData->addAttributeArrayFromHDF5Path(levelGid, name, preflight);
+    if(err < 0)
+    {
+      return AttributeMatrix::NullPointer();
+    }
+  }
+
+  if(nullptr != geom.get())
+  {
+    geom->setDimensions(dims[0], dims[1], dims[2]);
+    geom->setResolution(res[0], res[1], res[2]);
+    geom->setOrigin(origin[0], origin[1], origin[2]);
+  }
+  return cellData;
+}
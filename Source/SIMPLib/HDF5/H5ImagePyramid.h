@@ -0,0 +1,122 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _h5imagepyramid_h_
+#define _h5imagepyramid_h_
+
+#include <hdf5.h>
+
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+/**
+ * @brief The H5ImagePyramid class stores and reads downsampled copies of the cell AttributeMatrices of an
+ * ImageGeom so that previews and coarse parameter sweeps do not have to load the full resolution data.
+ *
+ * Level n is downsampled by 2^n along every axis with more than one cell. The levels of an AttributeMatrix
+ * are written below /DataContainerPyramids/<DataContainer>/<AttributeMatrix>/Level_<n>, outside of the
+ * DataContainers group so that readers without pyramid support never see them. The number of levels is
+ * stored as the PyramidLevels attribute of the full resolution AttributeMatrix group.
+ */
+class SIMPLib_EXPORT H5ImagePyramid
+{
+  public:
+    virtual ~H5ImagePyramid();
+
+    /**
+     * @brief CreateNextLevel Downsamples a cell AttributeMatrix by 2 along every axis with more than one cell.
+     * Floating point arrays are averaged over each 2x2x2 block; integer and boolean arrays take the most
+     * frequent value of the block so that labels are preserved. Arrays that are not primitive DataArrays
+     * are left out.
+     * @param geom Geometry of cellData
+     * @param cellData Cell AttributeMatrix to downsample
+     * @param levelGeom Returns the geometry of the downsampled level
+     * @return The downsampled AttributeMatrix or a null pointer on error
+     */
+    static AttributeMatrix::Pointer CreateNextLevel(ImageGeom::Pointer geom, AttributeMatrix::Pointer cellData, ImageGeom::Pointer& levelGeom);
+
+    /**
+     * @brief WriteLevels Writes up to maxLevels downsampled levels of a cell AttributeMatrix. Any pyramid
+     * previously stored for the AttributeMatrix is replaced.
+     * @param fileId The open .dream3d file
+     * @param dcGid The group the full resolution AttributeMatrix was written to
+     * @param dcGroupName Name of that group inside the DataContainers group
+     * @param geom Geometry of cellData
+     * @param cellData Cell AttributeMatrix to write levels for
+     * @param maxLevels Maximum number of levels to write
+     * @return Number of levels written or a negative value on error
+     */
+    static int WriteLevels(hid_t fileId, hid_t dcGid, const QString& dcGroupName, ImageGeom::Pointer geom, AttributeMatrix::Pointer cellData, int maxLevels);
+
+    /**
+     * @brief ReadLevelCount Returns the number of downsampled levels stored for an AttributeMatrix, 0 if there are none
+     * @param dcGid The DataContainer group holding the full resolution AttributeMatrix
+     * @param amName
+     * @return
+     */
+    static int ReadLevelCount(hid_t dcGid, const QString& amName);
+
+    /**
+     * @brief ReadLevel Reads one downsampled level of an AttributeMatrix and updates geom to the level's
+     * dimensions, resolution and origin.
+     * @param fileId The open .dream3d file
+     * @param dcName Name of the DataContainer group
+     * @param amName Name of the AttributeMatrix
+     * @param level Level to read, starting at 1
+     * @param arrayNames Arrays to read. Names not stored at this level are skipped.
+     * @param preflight Only the structure is read when true
+     * @param geom Geometry to update, may be a null pointer
+     * @return The AttributeMatrix of the level or a null pointer on error
+     */
+    static AttributeMatrix::Pointer ReadLevel(hid_t fileId, const QString& dcName, const QString& amName, int level, const QVector<QString>& arrayNames, bool preflight, ImageGeom::Pointer geom);
+
+    /**
+     * @brief LevelGroupPath Returns the path of a level group relative to the file root
+     */
+    static QString LevelGroupPath(const QString& dcName, const QString& amName, int level);
+
+  protected:
+    H5ImagePyramid();
+
+  private:
+    H5ImagePyramid(const H5ImagePyramid&) = delete; // Copy Constructor Not Implemented
+    void operator=(const H5ImagePyramid&) = delete; // Move assignment Not Implemented
+};
+
+#endif /* _h5imagepyramid_h_ */
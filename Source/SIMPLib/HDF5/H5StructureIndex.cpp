@@ -0,0 +1,307 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "H5StructureIndex.h"
+
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include "H5Support/H5ScopedSentinel.h"
+#include "H5Support/QH5Lite.h"
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
+
+namespace
+{
+const QString k_Version("Version");
+const QString k_PyramidLevels("Pyramid Levels");
+const QString k_WriteStamp("WriteStamp");
+const QString k_LinkCounts("Link Counts");
+const int k_IndexVersion = 3;
+
+/**
+ * @brief readWriteStamp Returns the write stamp of the DataContainers group, zero if it was never stamped
+ */
+uint64_t readWriteStamp(hid_t dcArrayGroupId)
+{
+  uint64_t stamp = 0;
+  if(H5Aexists(dcArrayGroupId, k_WriteStamp.toLatin1().constData()) > 0)
+  {
+    QH5Lite::readScalarAttribute(dcArrayGroupId, ".", k_WriteStamp, stamp);
+  }
+  return stamp;
+}
+
+/**
+ * @brief linkCount Returns the number of links in a group, -1 if it can not be read
+ */
+qint64 linkCount(hid_t groupId)
+{
+  H5G_info_t info;
+  if(H5Gget_info(groupId, &info) < 0)
+  {
+    return -1;
+  }
+  return static_cast<qint64>(info.nlinks);
+}
+
+/**
+ * @brief linkCount Returns the number of links in a child group, -1 if the group can not be opened
+ */
+qint64 linkCount(hid_t parentId, const QString& name)
+{
+  hid_t groupId = H5Gopen(parentId, name.toLatin1().constData(), H5P_DEFAULT);
+  if(groupId < 0)
+  {
+    return -1;
+  }
+  H5ScopedGroupSentinel sentinel(&groupId, false);
+  return linkCount(groupId);
+}
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5StructureIndex::H5StructureIndex() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+H5StructureIndex::~H5StructureIndex() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5StructureIndex::MarkModified(hid_t dcArrayGroupId)
+{
+  uint64_t stamp = readWriteStamp(dcArrayGroupId) + 1;
+  herr_t err = QH5Lite::writeScalarAttribute(dcArrayGroupId, ".", k_WriteStamp, stamp);
+  if(err < 0)
+  {
+    return -1;
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int H5StructureIndex::Write(hid_t fileId)
+{
+  hid_t dcArrayGroupId = H5Gopen(fileId, SIMPL::StringConstants::DataContainerGroupName.toLatin1().constData(), H5P_DEFAULT);
+  if(dcArrayGroupId < 0)
+  {
+    return -1;
+  }
+  H5ScopedGroupSentinel sentinel(&dcArrayGroupId, false);
+
+  // Walking the file instead of the DataContainerArray in memory keeps appended DataContainers and time steps
+  // in the index. Requirements that accept everything leave each flag set only where the walk could read the
+  // geometry or AttributeMatrix type, which is what Read() needs to check the entries again later.
+  SIMPLH5DataReaderRequirements req;
+  DataContainerArrayProxy proxy;
+  DataContainer::ReadDataContainerStructure(dcArrayGroupId, proxy, &req, QString("/") + SIMPL::StringConstants::DataContainerGroupName);
+
+  QJsonObject root;
+  proxy.writeJson(root);
+  root[k_Version] = k_IndexVersion;
+  // Stored as a string because a JSON number can not hold every 64 bit value
+  root[k_WriteStamp] = QString::number(readWriteStamp(dcArrayGroupId));
+
+  QJsonObject levels;
+  for(QMap<QString, DataContainerProxy>::iterator dcIter = proxy.dataContainers.begin(); dcIter != proxy.dataContainers.end(); ++dcIter)
+  {
+    QMap<QString, AttributeMatrixProxy>& attrMats = dcIter.value().attributeMatricies;
+    for(QMap<QString, AttributeMatrixProxy>::iterator amIter = attrMats.begin(); amIter != attrMats.end(); ++amIter)
+    {
+      if(amIter.value().pyramidLevels > 0)
+      {
+        levels[dcIter.key() + "/" + amIter.key()] = amIter.value().pyramidLevels;
+      }
+    }
+  }
+  root[k_PyramidLevels] = levels;
+  root[k_LinkCounts] = CountLinks(dcArrayGroupId, proxy);
+
+  QString json = QString::fromUtf8(QJsonDocument(root).toJson(QJsonDocument::Compact));
+  QByteArray indexName = SIMPL::StringConstants::DataStructureIndexName.toLatin1();
+  if(QH5Lite::datasetExists(fileId, SIMPL::StringConstants::DataStructureIndexName))
+  {
+    H5Ldelete(fileId, indexName.constData(), H5P_DEFAULT);
+  }
+  herr_t err = QH5Lite::writeStringDataset(fileId, SIMPL::StringConstants::DataStructureIndexName, json);
+  if(err < 0)
+  {
+    return -2;
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5StructureIndex::Read(hid_t fileId, hid_t dcArrayGroupId, SIMPLH5DataReaderRequirements* req, DataContainerArrayProxy& proxy)
+{
+  if(!QH5Lite::datasetExists(fileId, SIMPL::StringConstants::DataStructureIndexName))
+  {
+    return false;
+  }
+  QString json;
+  herr_t err = QH5Lite::readStringDataset(fileId, SIMPL::StringConstants::DataStructureIndexName, json);
+  if(err < 0)
+  {
+    return false;
+  }
+
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(json.toUtf8(), &parseError);
+  if(parseError.error != QJsonParseError::NoError || !doc.isObject())
+  {
+    return false;
+  }
+  QJsonObject root = doc.object();
+  if(root.value(k_Version).toInt() != k_IndexVersion)
+  {
+    return false;
+  }
+
+  // A writer that changed the file since the index was written has bumped the stamp
+  if(root.value(k_WriteStamp).toString() != QString::number(readWriteStamp(dcArrayGroupId)))
+  {
+    return false;
+  }
+
+  DataContainerArrayProxy indexProxy;
+  if(!indexProxy.readJson(root) || !MatchesFile(dcArrayGroupId, indexProxy, root.value(k_LinkCounts).toObject()))
+  {
+    return false;
+  }
+
+  QJsonObject levels = root.value(k_PyramidLevels).toObject();
+  for(QMap<QString, DataContainerProxy>::iterator dcIter = indexProxy.dataContainers.begin(); dcIter != indexProxy.dataContainers.end(); ++dcIter)
+  {
+    DataContainerProxy& dcProxy = dcIter.value();
+    bool geometryRead = (dcProxy.flag == Qt::Checked);
+    dcProxy.flag = (req != nullptr && geometryRead) ? Qt::Checked : Qt::Unchecked;
+
+    for(QMap<QString, AttributeMatrixProxy>::iterator amIter = dcProxy.attributeMatricies.begin(); amIter != dcProxy.attributeMatricies.end(); ++amIter)
+    {
+      AttributeMatrixProxy& amProxy = amIter.value();
+      bool typeRead = (amProxy.flag == Qt::Checked);
+      amProxy.flag = Qt::Unchecked;
+      if(req != nullptr && typeRead)
+      {
+        AttributeMatrix::Types amTypes = req->getAMTypes();
+        if(amTypes.size() <= 0 || amTypes.contains(amProxy.amType))
+        {
+          amProxy.flag = Qt::Checked;
+        }
+      }
+      amProxy.pyramidLevels = levels.value(dcIter.key() + "/" + amIter.key()).toInt();
+
+      for(QMap<QString, DataArrayProxy>::iterator daIter = amProxy.dataArrays.begin(); daIter != amProxy.dataArrays.end(); ++daIter)
+      {
+        DataArrayProxy& daProxy = daIter.value();
+        daProxy.flag = SIMPL::Unchecked;
+        if(req != nullptr)
+        {
+          QVector<QVector<size_t>> cDims = req->getComponentDimensions();
+          QVector<QString> daTypes = req->getDATypes();
+          if((cDims.size() <= 0 || cDims.contains(daProxy.compDims)) && (daTypes.size() <= 0 || daTypes.contains(daProxy.objectType)))
+          {
+            daProxy.flag = Qt::Checked;
+          }
+        }
+      }
+    }
+  }
+
+  proxy = indexProxy;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject H5StructureIndex::CountLinks(hid_t dcArrayGroupId, const DataContainerArrayProxy& proxy)
+{
+  QJsonObject counts;
+  counts[""] = linkCount(dcArrayGroupId);
+  for(QMap<QString, DataContainerProxy>::const_iterator dcIter = proxy.dataContainers.constBegin(); dcIter != proxy.dataContainers.constEnd(); ++dcIter)
+  {
+    hid_t containerGid = H5Gopen(dcArrayGroupId, dcIter.key().toLatin1().constData(), H5P_DEFAULT);
+    if(containerGid < 0)
+    {
+      counts[dcIter.key()] = -1;
+      continue;
+    }
+    H5ScopedGroupSentinel sentinel(&containerGid, false);
+    counts[dcIter.key()] = linkCount(containerGid);
+
+    const QMap<QString, AttributeMatrixProxy>& attrMats = dcIter.value().attributeMatricies;
+    for(QMap<QString, AttributeMatrixProxy>::const_iterator amIter = attrMats.constBegin(); amIter != attrMats.constEnd(); ++amIter)
+    {
+      counts[dcIter.key() + "/" + amIter.key()] = linkCount(containerGid, amIter.key());
+    }
+  }
+  return counts;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool H5StructureIndex::MatchesFile(hid_t dcArrayGroupId, const DataContainerArrayProxy& proxy, const QJsonObject& linkCounts)
+{
+  // Opening each listed group and comparing its link count with the one recorded by Write() catches
+  // groups and arrays that were added or removed by a writer that did not bump the stamp. It costs one
+  // open per DataContainer and AttributeMatrix instead of a listing of every array.
+  QJsonObject counts = CountLinks(dcArrayGroupId, proxy);
+  if(counts.size() != linkCounts.size())
+  {
+    return false;
+  }
+  for(QJsonObject::const_iterator iter = counts.constBegin(); iter != counts.constEnd(); ++iter)
+  {
+    qint64 count = static_cast<qint64>(iter.value().toDouble());
+    if(count < 0 || !linkCounts.contains(iter.key()) || static_cast<qint64>(linkCounts.value(iter.key()).toDouble(-1.0)) != count)
+    {
+      return false;
+    }
+  }
+  return true;
+}
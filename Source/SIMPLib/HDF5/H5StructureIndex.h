@@ -0,0 +1,118 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _h5structureindex_h_
+#define _h5structureindex_h_
+
+#include <hdf5.h>
+
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
+
+class SIMPLH5DataReaderRequirements;
+
+/**
+ * @brief The H5StructureIndex class stores a compact description of every DataContainer, AttributeMatrix and
+ * DataArray of a .dream3d file so that the structure can be read without opening each array to read its
+ * attributes.
+ *
+ * The index is a single JSON string dataset at /DataStructureIndex holding the DataContainerArrayProxy of the
+ * file together with the number of preview levels of each AttributeMatrix and the number of links in each
+ * indexed group. Files without an index, or with an index that no longer matches the file, are read by walking
+ * the DataContainers group as before.
+ *
+ * Every writer of the DataContainers group must call MarkModified() before it changes the group. The index
+ * records the write stamp that MarkModified() bumps, so an index written before the last change is ignored.
+ * The link counts only catch writers that add or remove groups or arrays without bumping the stamp; a rename
+ * keeps every count and must bump the stamp.
+ */
+class SIMPLib_EXPORT H5StructureIndex
+{
+  public:
+    virtual ~H5StructureIndex();
+
+    /**
+     * @brief MarkModified Bumps the write stamp of the DataContainers group, which invalidates any index
+     * already in the file until Write() is called again.
+     * @param dcArrayGroupId The DataContainers group of the file
+     * @return Zero on success or a negative value on error
+     */
+    static int MarkModified(hid_t dcArrayGroupId);
+
+    /**
+     * @brief Write Walks the DataContainers group of the file and stores the result as the structure index,
+     * replacing any index already in the file. Call this after all DataContainers have been written.
+     * @param fileId The open .dream3d file
+     * @return Zero on success or a negative value on error
+     */
+    static int Write(hid_t fileId);
+
+    /**
+     * @brief Read Reads the structure index and applies the requirements the same way the full walk does.
+     * The index is only used when its write stamp matches the file, every DataContainer and AttributeMatrix
+     * group it lists is still in the file and every one of those groups has as many links as when the index
+     * was written.
+     * @param fileId The open .dream3d file
+     * @param dcArrayGroupId The DataContainers group of the file
+     * @param req Requirements used to check the entries of the proxy, may be a null pointer
+     * @param proxy Receives the structure of the file
+     * @return False if the file has no usable index and must be walked instead
+     */
+    static bool Read(hid_t fileId, hid_t dcArrayGroupId, SIMPLH5DataReaderRequirements* req, DataContainerArrayProxy& proxy);
+
+  protected:
+    H5StructureIndex();
+
+    /**
+     * @brief CountLinks Returns the number of links in the DataContainers group, keyed by an empty string,
+     * and in each DataContainer and AttributeMatrix group listed in proxy, keyed by its relative path. A
+     * group that can not be opened counts -1.
+     */
+    static QJsonObject CountLinks(hid_t dcArrayGroupId, const DataContainerArrayProxy& proxy);
+
+    /**
+     * @brief MatchesFile Compares the link counts of the groups listed in proxy with the counts that
+     * CountLinks() returned when the index was written.
+     */
+    static bool MatchesFile(hid_t dcArrayGroupId, const DataContainerArrayProxy& proxy, const QJsonObject& linkCounts);
+
+  private:
+    H5StructureIndex(const H5StructureIndex&) = delete; // Copy Constructor Not Implemented
+    void operator=(const H5StructureIndex&) = delete;   // Move assignment Not Implemented
+};
+
+#endif /* _h5structureindex_h_ */
@@ -5,11 +5,13 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
   ${SIMPLib_SOURCE_DIR}/HDF5/H5BoundaryStatsDataDelegate.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5DataArrayReader.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5DataArrayWriter.hpp
+  ${SIMPLib_SOURCE_DIR}/HDF5/H5ImagePyramid.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5Macros.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5MatrixStatsDataDelegate.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5PrecipitateStatsDataDelegate.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5PrimaryStatsDataDelegate.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5StatsDataDelegate.h
+  ${SIMPLib_SOURCE_DIR}/HDF5/H5StructureIndex.h
   ${SIMPLib_SOURCE_DIR}/HDF5/H5TransformationStatsDataDelegate.h
   ${SIMPLib_SOURCE_DIR}/HDF5/VTKH5Constants.h
 
@@ -18,10 +20,12 @@ set(SIMPLib_${SUBDIR_NAME}_HDRS
 set(SIMPLib_${SUBDIR_NAME}_SRCS
   ${SIMPLib_SOURCE_DIR}/HDF5/H5BoundaryStatsDataDelegate.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5DataArrayReader.cpp
+  ${SIMPLib_SOURCE_DIR}/HDF5/H5ImagePyramid.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5MatrixStatsDataDelegate.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5PrecipitateStatsDataDelegate.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5PrimaryStatsDataDelegate.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5StatsDataDelegate.cpp
+  ${SIMPLib_SOURCE_DIR}/HDF5/H5StructureIndex.cpp
   ${SIMPLib_SOURCE_DIR}/HDF5/H5TransformationStatsDataDelegate.cpp
 
 )
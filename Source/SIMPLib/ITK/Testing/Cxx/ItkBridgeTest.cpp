@@ -0,0 +1,195 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <iostream>
+
+#include <QtCore/QCoreApplication>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+#include "SIMPLib/ITK/itkInPlaceDream3DDataToImageFilter.h"
+
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+/**
+ * @brief The ItkBridgeTest class covers the way DREAM3D arrays are handed to ITK images
+ */
+class ItkBridgeTest
+{
+public:
+  ItkBridgeTest()
+  {
+  }
+  virtual ~ItkBridgeTest()
+  {
+  }
+
+  typedef itk::InPlaceDream3DDataToImageFilter<float, 3> ToImageFilterType;
+  typedef ToImageFilterType::ImageType ImageType;
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainer::Pointer CreateDataContainer()
+  {
+    DataContainer::Pointer dc = DataContainer::New("ImageDataContainer");
+    ImageGeom::Pointer geom = ImageGeom::CreateGeometry("ImageGeometry");
+    geom->setDimensions(4, 3, 2);
+    geom->setResolution(1.0f, 1.0f, 1.0f);
+    geom->setOrigin(0.0f, 0.0f, 0.0f);
+    dc->setGeometry(geom);
+
+    QVector<size_t> tDims = {4, 3, 2};
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, "CellData", AttributeMatrix::Type::Cell);
+    FloatArrayType::Pointer values = FloatArrayType::CreateArray(tDims[0] * tDims[1] * tDims[2], "Values");
+    for(size_t i = 0; i < values->getNumberOfTuples(); i++)
+    {
+      values->setValue(i, static_cast<float>(i) * 0.5f);
+    }
+    am->addAttributeArray("Values", values);
+    dc->addAttributeMatrix("CellData", am);
+    return dc;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  ImageType::Pointer ConvertToImage(DataContainer::Pointer dc, bool inPlace, bool containerOwnsBuffer)
+  {
+    ToImageFilterType::Pointer filter = ToImageFilterType::New();
+    filter->SetInput(dc);
+    filter->SetDataArrayName("Values");
+    filter->SetAttributeMatrixArrayName("CellData");
+    filter->SetInPlace(inPlace);
+    filter->SetPixelContainerWillOwnTheBuffer(containerOwnsBuffer);
+    filter->Update();
+    ImageType::Pointer image = filter->GetOutput();
+    image->DisconnectPipeline();
+    return image;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestInPlaceIsZeroCopy()
+  {
+    // Whether or not the container is said to own the buffer, an in place image uses the
+    // array's own memory and keeps the array alive
+    for(int owns = 0; owns < 2; owns++)
+    {
+      DataContainer::Pointer dc = CreateDataContainer();
+      FloatArrayType::Pointer values = std::dynamic_pointer_cast<FloatArrayType>(dc->getAttributeMatrix("CellData")->getAttributeArray("Values"));
+      float* buffer = values->getPointer(0);
+
+      ImageType::Pointer image = ConvertToImage(dc, true, owns == 1);
+      DREAM3D_REQUIRE_EQUAL(image->GetBufferPointer(), buffer)
+      DREAM3D_REQUIRE_EQUAL(image->GetPixelContainer()->Size(), values->getNumberOfTuples())
+
+      // The container's reference is what keeps the memory valid once DREAM3D lets go
+      std::weak_ptr<FloatArrayType> weakValues = values;
+      values.reset();
+      dc = DataContainer::NullPointer();
+      DREAM3D_REQUIRE_EQUAL(weakValues.expired(), false)
+      ImageType::IndexType index;
+      index[0] = 3;
+      index[1] = 2;
+      index[2] = 1;
+      DREAM3D_REQUIRE_EQUAL(image->GetPixel(index), 11.5f)
+
+      image = nullptr;
+      DREAM3D_REQUIRE_EQUAL(weakValues.expired(), true)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestCopyIsIndependent()
+  {
+    DataContainer::Pointer dc = CreateDataContainer();
+    FloatArrayType::Pointer values = std::dynamic_pointer_cast<FloatArrayType>(dc->getAttributeMatrix("CellData")->getAttributeArray("Values"));
+
+    ImageType::Pointer image = ConvertToImage(dc, false, false);
+    DREAM3D_REQUIRE(image->GetBufferPointer() != values->getPointer(0))
+    for(size_t i = 0; i < values->getNumberOfTuples(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(image->GetBufferPointer()[i], values->getValue(i))
+    }
+
+    // The copy was allocated by the container and is released by it alone
+    values->setValue(0, -1.0f);
+    DREAM3D_REQUIRE_EQUAL(image->GetBufferPointer()[0], 0.0f)
+    image = nullptr;
+    DREAM3D_REQUIRE_EQUAL(values->getValue(0), -1.0f)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### ItkBridgeTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestInPlaceIsZeroCopy())
+    DREAM3D_REGISTER_TEST(TestCopyIsIndependent())
+  }
+
+private:
+  ItkBridgeTest(const ItkBridgeTest&); // Copy Constructor Not Implemented
+  void operator=(const ItkBridgeTest&); // Move assignment Not Implemented
+};
+
+// -----------------------------------------------------------------------------
+//  Use test framework
+// -----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  int err = EXIT_SUCCESS;
+
+  QCoreApplication app(argc, argv);
+
+  ItkBridgeTest()();
+
+  PRINT_TEST_SUMMARY();
+
+  return err;
+}
@@ -38,9 +38,13 @@
 
 // ITK Includes first
 #include "itkExtractImageFilter.h"
+#include "itkImageRegionConstIterator.h"
+#include "itkImageRegionSplitterSlowDimension.h"
 #include "itkRGBAPixel.h"
 #include "itkRGBPixel.h"
 
+#include <memory>
+
 // DREAM3D Includes next
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
@@ -504,6 +508,76 @@ public:
     }
   }
 
+  /**
+   * @brief AdoptITKImage wraps the pixel buffer of an itk image in a dream3d array without copying.
+   * The array holds a reference on the image pixel container, which stays in charge of the memory,
+   * so the image itself may go away before the array does. Releasing ownership of the array hands
+   * out a malloc()'ed copy, never the pixel buffer itself.
+   * @param image
+   * @param name
+   * @return
+   */
+  static DataArrayPointerType AdoptITKImage(typename ScalarImageType::Pointer image, const QString& name)
+  {
+    typename ScalarImageType::PixelContainerPointer container = image->GetPixelContainer();
+    std::shared_ptr<void> owner(container->GetBufferPointer(), [container](void*) {});
+    QVector<size_t> cDims(1, 1);
+    return DataArrayType::WrapExternalBuffer(container->GetBufferPointer(), container->Size(), cDims, name, owner);
+  }
+
+  /**
+   * @brief StreamITKFilterToDream3D runs an itk filter piece by piece over its requested region and
+   * writes each piece straight into a dream3d array, so the filter only ever buffers one piece of
+   * its output. Combined with a zero-copy input (see CreateItkWrapperForDataPointer) the peak memory
+   * is the two dream3d arrays plus one piece. Filters that always need their whole output still give
+   * the right answer, they just do not save any memory.
+   * @param filter last filter of the pipeline, producing a scalar image
+   * @param output array receiving the result, with one component and one tuple per output pixel
+   * @param numberOfDivisions number of pieces the output is split into along its slowest dimension
+   * @return false if the array does not match the filter output
+   */
+  template <typename TFilter> static bool StreamITKFilterToDream3D(TFilter* filter, DataArrayPointerType output, unsigned int numberOfDivisions)
+  {
+    typedef typename TFilter::OutputImageType OutputImageType;
+    typedef typename OutputImageType::RegionType RegionType;
+
+    filter->UpdateOutputInformation();
+    OutputImageType* image = filter->GetOutput();
+    const RegionType largest = image->GetLargestPossibleRegion();
+    if(output->getNumberOfComponents() != 1 || output->getNumberOfTuples() != largest.GetNumberOfPixels())
+    {
+      return false;
+    }
+
+    ComponentType* buffer = output->getPointer(0);
+    itk::ImageRegionSplitterSlowDimension::Pointer splitter = itk::ImageRegionSplitterSlowDimension::New();
+    const unsigned int numberOfPieces = splitter->GetNumberOfSplits(largest, numberOfDivisions);
+    for(unsigned int piece = 0; piece < numberOfPieces; piece++)
+    {
+      RegionType region = largest;
+      splitter->GetSplit(piece, numberOfPieces, region);
+      image->SetRequestedRegion(region);
+      image->PropagateRequestedRegion();
+      image->UpdateOutputData();
+
+      // Pieces only split the slowest dimension so each one is a contiguous run of tuples
+      size_t index = 0;
+      size_t stride = 1;
+      for(unsigned int d = 0; d < OutputImageType::ImageDimension; d++)
+      {
+        index += static_cast<size_t>(region.GetIndex()[d] - largest.GetIndex()[d]) * stride;
+        stride *= largest.GetSize()[d];
+      }
+      itk::ImageRegionConstIterator<OutputImageType> it(image, region);
+      for(it.GoToBegin(); !it.IsAtEnd(); ++it)
+      {
+        buffer[index++] = static_cast<ComponentType>(it.Get());
+      }
+    }
+    image->ReleaseData();
+    return true;
+  }
+
   /**
    * @brief ExtractSlice extract a slice
    * @param image
@@ -20,6 +20,8 @@
 
 #include "itkImportImageContainer.h"
 
+#include "SIMPLib/DataArrays/IDataArray.h"
+
 namespace itk
 {
 /** \class ImportDream3DImageContainer
@@ -34,6 +36,9 @@ namespace itk
  * and free. The behavior of mixing malloc/free and new/delete is undefined
  * and should be avoided.
  *
+ * The container can also use the values of a DREAM3D array in place, see
+ * SetImportDataArray().
+ *
  * \tparam TElementIdentifier An INTEGRAL type for use in indexing the
  * imported buffer.
  *
@@ -63,6 +68,18 @@ public:
   /** Standard part of every itk Object. */
   itkTypeMacro(ImportDream3DImageContainer, ImportImageContainer);
 
+  /**
+   * Uses the values of a DREAM3D array as the buffer, one element per tuple,
+   * without copying them. The container holds a reference to the array for as long
+   * as it uses the buffer, so the array outlives any image built on it, and it never
+   * frees the buffer itself. The array must not be resized while the container
+   * uses it.
+   */
+  void SetImportDataArray(const IDataArray::Pointer& array);
+
+  /** The array set with SetImportDataArray(), null if the buffer is not an array */
+  IDataArray::Pointer GetImportDataArray() const;
+
 protected:
   ImportDream3DImageContainer();
   virtual ~ImportDream3DImageContainer();
@@ -84,6 +101,8 @@ protected:
 private:
   ImportDream3DImageContainer(const Self&) ITK_DELETE_FUNCTION;
   void operator=(const Self&) ITK_DELETE_FUNCTION;
+
+  IDataArray::Pointer m_ImportDataArray;
 };
 } // end namespace itk
 
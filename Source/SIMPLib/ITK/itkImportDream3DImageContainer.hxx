@@ -78,6 +78,25 @@ namespace itk
   return data;
   }
 
+  template< typename TElementIdentifier, typename TElement >
+  void
+  ImportDream3DImageContainer< TElementIdentifier, TElement >
+    ::SetImportDataArray( const IDataArray::Pointer & array )
+  {
+    // getVoidPointer() makes the array the only owner of its values before they are shared
+    Element *data = static_cast< Element * >( array->getVoidPointer( 0 ) );
+    this->SetImportPointer( data, static_cast< ElementIdentifier >( array->getNumberOfTuples() ), false );
+    m_ImportDataArray = array;
+  }
+
+  template< typename TElementIdentifier, typename TElement >
+  IDataArray::Pointer
+  ImportDream3DImageContainer< TElementIdentifier, TElement >
+    ::GetImportDataArray() const
+  {
+    return m_ImportDataArray;
+  }
+
   template< typename TElementIdentifier, typename TElement >
   void
   ImportDream3DImageContainer< TElementIdentifier, TElement >
@@ -86,11 +105,16 @@ namespace itk
     // Encapsulate all image memory deallocation here
     if( this->GetContainerManageMemory() )
     {
-      Element *data = this->GetBufferPointer();
-      data->~Element();
-      free( data );
-      this->SetImportPointer( ITK_NULLPTR );
+      Element *data = this->GetImportPointer();
+      // The superclass would delete[] the buffer, which came from malloc()
+      this->SetContainerManageMemory( false );
+      if( data )
+      {
+        data->~Element();
+        free( data );
+      }
     }
+    m_ImportDataArray = IDataArray::NullPointer();
     Superclass::DeallocateManagedMemory();
   }
 
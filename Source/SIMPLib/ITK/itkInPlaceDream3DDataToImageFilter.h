@@ -62,7 +62,7 @@ private:
   std::string m_AttributeMatrixArrayName;
   typename ImportImageContainerType::Pointer m_ImportImageContainer;
   bool m_InPlace;                        // enable the possibility of in-place
-  bool m_PixelContainerWillOwnTheBuffer; // By default, this filter does not take data ownership
+  bool m_PixelContainerWillOwnTheBuffer; // Kept for compatibility: an in place container always holds a reference to the array
 };
 } // namespace itk
 
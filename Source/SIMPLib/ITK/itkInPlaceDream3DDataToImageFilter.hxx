@@ -117,27 +117,25 @@ InPlaceDream3DDataToImageFilter< PixelType, VDimension >
   // Get data pointer
   AttributeMatrix::Pointer ma = m_DataContainer->getAttributeMatrix(m_AttributeMatrixArrayName.c_str());
   IDataArray::Pointer dataArray = ma->getAttributeArray(m_DataArrayName.c_str());
-  size_t size = dataArray->getSize();
-  PixelType *buffer;
+  // One pixel per tuple: multi-component arrays map onto RGB/RGBA/vector pixels
+  size_t size = dataArray->getNumberOfTuples();
   if(m_InPlace)
   {
-    if (m_PixelContainerWillOwnTheBuffer)
+    // The container references the array, which keeps its memory alive for as long as the
+    // image uses it. Nothing is copied, and the container never frees memory it does not own.
+    if(!m_ImportImageContainer || m_ImportImageContainer->GetImportDataArray() != dataArray ||
+       m_ImportImageContainer->GetImportPointer() != static_cast<PixelType*>(dataArray->getVoidPointer(0)))
     {
-      dataArray->releaseOwnership();
+      m_ImportImageContainer = ImportImageContainerType::New();
+      m_ImportImageContainer->SetImportDataArray(dataArray);
     }
-    buffer = static_cast<PixelType*>(dataArray->getVoidPointer( 0 ));
   }
   else
   {
-    m_PixelContainerWillOwnTheBuffer = true;
-    buffer = new PixelType[size];
-    ::memcpy( buffer, static_cast<PixelType*>(dataArray->getVoidPointer( 0 )), size * sizeof( PixelType ) );
-  }
-  if( !m_ImportImageContainer || buffer != m_ImportImageContainer->GetImportPointer() )
-  {
+    // The container allocates the copy itself so that it is released the same way
     m_ImportImageContainer = ImportImageContainerType::New();
-    m_ImportImageContainer->SetImportPointer( buffer,
-        size, m_PixelContainerWillOwnTheBuffer);
+    m_ImportImageContainer->Reserve(size);
+    ::memcpy(m_ImportImageContainer->GetBufferPointer(), dataArray->getConstVoidPointer(0), size * sizeof(PixelType));
   }
   // get pointer to the output
   ImagePointer outputPtr = this->GetOutput();
@@ -6,6 +6,8 @@
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include <QString>
 
+#include <memory>
+
 namespace itk
 {
 
@@ -165,9 +167,14 @@ InPlaceImageToDream3DDataFilter<PixelType, VDimension>
   inputPtr->SetBufferedRegion( inputPtr->GetLargestPossibleRegion() );
   if( m_InPlace )
   {
-    inputPtr->GetPixelContainer()->SetContainerManageMemory( false );
-    data = DataArrayPixelType::WrapPointer( reinterpret_cast<ValueType*>(inputPtr->GetBufferPointer()),
-              imageGeom->getNumberOfElements(), cDims, this->GetDataArrayName().c_str(), true );
+    // Adopt the pixel container as the storage of the data array. The array holds a reference
+    // on the container, which keeps managing its own memory, so nothing is copied and nothing
+    // is assumed about how the buffer was allocated.
+    typedef typename ImageType::PixelContainerType PixelContainerType;
+    typename PixelContainerType::Pointer container = inputPtr->GetPixelContainer();
+    std::shared_ptr<void> owner(container->GetBufferPointer(), [container](void*) {});
+    data = DataArrayPixelType::WrapExternalBuffer( reinterpret_cast<ValueType*>(container->GetBufferPointer()),
+              imageGeom->getNumberOfElements(), cDims, this->GetDataArrayName().c_str(), owner );
   }
   else
   {
@@ -42,7 +42,7 @@
 #include "SIMPLib/Geometry/VertexGeom.h"
 #include "SIMPLib/Math/MatrixMath.h"
 #include "SIMPLib/Math/SIMPLibMath.h"
-//#include "SIMPLib/Math/SIMPLibRandom.h"
+#include "SIMPLib/Math/SIMPLibRandomStream.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -299,6 +299,23 @@ void GeometryMath::GenerateRandomRay(float length, float ray[3])
   ray[2] *= length;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void GeometryMath::GenerateRandomRay(SIMPLibRandomStream& rng, float length, float ray[3])
+{
+  float w, t;
+
+  ray[2] = static_cast<float>(2.0 * rng.nextUniform() - 1.0);
+  t = static_cast<float>(SIMPLib::Constants::k_2Pi * rng.nextUniform());
+  w = sqrtf(1.0f - (ray[2] * ray[2]));
+  ray[0] = w * cosf(t);
+  ray[1] = w * sinf(t);
+  ray[0] *= length;
+  ray[1] *= length;
+  ray[2] *= length;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
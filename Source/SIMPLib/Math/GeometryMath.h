@@ -44,6 +44,7 @@
 
 class VertexGeom;
 class TriangleGeom;
+class SIMPLibRandomStream;
 
 /*
  * @class GeometryMath GeometryMath.h DREAM3DLib/Common/GeometryMath.h
@@ -261,6 +262,15 @@ class SIMPLib_EXPORT GeometryMath
      */
     static void GenerateRandomRay(float length, float ray[3]);
 
+    /**
+     * @brief Creates a randomly oriented ray of given length drawing from the given stream, which makes the
+     * result reproducible and safe to use from parallel tasks that each own a stream
+     * @param rng Random stream
+     * @param length float
+     * @param ray 1x3 Vector
+     */
+    static void GenerateRandomRay(SIMPLibRandomStream& rng, float length, float ray[3]);
+
     /**
      * @brief Determines the bounding box defined by the lower left and upper right corners of a set of vertices
      * @param verts pointer to vertex array
@@ -37,12 +37,199 @@
 
 #include "math.h"
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iostream>
 
-#include "SIMPLib/Math/SIMPLibRandom.h"
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "SIMPLib/Math/SIMPLibRandomStream.h"
 #include "SIMPLib/StatsData/StatsData.h"
 
+namespace
+{
+/**
+ * @brief The PairGrid struct holds the points sorted by the uniform grid cell that contains them
+ */
+struct PairGrid
+{
+  size_t numCells[3] = {1, 1, 1};
+  std::vector<size_t> cellStart;
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<float> z;
+  std::vector<int> offsets[3];
+  bool periodic = false;
+  float boxDims[3] = {0.0f, 0.0f, 0.0f};
+};
+
+/**
+ * @brief The PairHistogramImpl class counts the pairs whose first point lies in a range of grid cells. Each
+ * instance owns its histogram so the threads of a parallel_reduce never share counters.
+ */
+class PairHistogramImpl
+{
+public:
+  PairHistogramImpl(const PairGrid& grid, float minDistance, float maxDistance, int numBins)
+  : m_Grid(grid)
+  , m_MinDistance(minDistance)
+  , m_MaxDistanceSquared(maxDistance * maxDistance)
+  , m_StepSize((maxDistance - minDistance) / numBins)
+  , m_NumBins(static_cast<size_t>(numBins))
+  , m_Counts(static_cast<size_t>(numBins) + 1, 0)
+  {
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  PairHistogramImpl(PairHistogramImpl& other, tbb::split)
+  : m_Grid(other.m_Grid)
+  , m_MinDistance(other.m_MinDistance)
+  , m_MaxDistanceSquared(other.m_MaxDistanceSquared)
+  , m_StepSize(other.m_StepSize)
+  , m_NumBins(other.m_NumBins)
+  , m_Counts(other.m_Counts.size(), 0)
+  {
+  }
+#endif
+
+  void compute(size_t cellStart, size_t cellEnd)
+  {
+    const size_t nx = m_Grid.numCells[0];
+    const size_t ny = m_Grid.numCells[1];
+    const size_t nz = m_Grid.numCells[2];
+    for(size_t cell = cellStart; cell < cellEnd; cell++)
+    {
+      size_t cx = cell % nx;
+      size_t cy = (cell / nx) % ny;
+      size_t cz = cell / (nx * ny);
+      for(int oz : m_Grid.offsets[2])
+      {
+        int64_t nbz = static_cast<int64_t>(cz) + oz;
+        if(!wrap(nbz, nz))
+        {
+          continue;
+        }
+        for(int oy : m_Grid.offsets[1])
+        {
+          int64_t nby = static_cast<int64_t>(cy) + oy;
+          if(!wrap(nby, ny))
+          {
+            continue;
+          }
+          for(int ox : m_Grid.offsets[0])
+          {
+            int64_t nbx = static_cast<int64_t>(cx) + ox;
+            if(!wrap(nbx, nx))
+            {
+              continue;
+            }
+            size_t neighbor = (static_cast<size_t>(nbz) * ny + static_cast<size_t>(nby)) * nx + static_cast<size_t>(nbx);
+            countPairs(cell, neighbor);
+          }
+        }
+      }
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r)
+  {
+    compute(r.begin(), r.end());
+  }
+#endif
+
+  void join(const PairHistogramImpl& rhs)
+  {
+    for(size_t i = 0; i < m_Counts.size(); i++)
+    {
+      m_Counts[i] += rhs.m_Counts[i];
+    }
+  }
+
+  const std::vector<uint64_t>& getCounts() const
+  {
+    return m_Counts;
+  }
+
+private:
+  const PairGrid& m_Grid;
+  float m_MinDistance;
+  float m_MaxDistanceSquared;
+  float m_StepSize;
+  size_t m_NumBins;
+  std::vector<uint64_t> m_Counts;
+
+  /**
+   * @brief Wraps or rejects a neighbor cell coordinate depending on whether the grid is periodic
+   */
+  bool wrap(int64_t& coord, size_t numCells) const
+  {
+    if(coord >= 0 && coord < static_cast<int64_t>(numCells))
+    {
+      return true;
+    }
+    if(!m_Grid.periodic)
+    {
+      return false;
+    }
+    coord = (coord + static_cast<int64_t>(numCells)) % static_cast<int64_t>(numCells);
+    return true;
+  }
+
+  float minimumImage(float delta, float boxDim) const
+  {
+    if(m_Grid.periodic)
+    {
+      delta -= boxDim * std::floor(delta / boxDim + 0.5f);
+    }
+    return delta;
+  }
+
+  /**
+   * @brief Counts each pair between the two cells once by only pairing a point with later points in the sorted order
+   */
+  void countPairs(size_t cell, size_t neighbor)
+  {
+    const size_t neighborStart = m_Grid.cellStart[neighbor];
+    const size_t neighborEnd = m_Grid.cellStart[neighbor + 1];
+    for(size_t p = m_Grid.cellStart[cell]; p < m_Grid.cellStart[cell + 1]; p++)
+    {
+      const float px = m_Grid.x[p];
+      const float py = m_Grid.y[p];
+      const float pz = m_Grid.z[p];
+      for(size_t q = std::max(neighborStart, p + 1); q < neighborEnd; q++)
+      {
+        float dx = minimumImage(m_Grid.x[q] - px, m_Grid.boxDims[0]);
+        float dy = minimumImage(m_Grid.y[q] - py, m_Grid.boxDims[1]);
+        float dz = minimumImage(m_Grid.z[q] - pz, m_Grid.boxDims[2]);
+        float distanceSquared = dx * dx + dy * dy + dz * dz;
+        if(distanceSquared >= m_MaxDistanceSquared)
+        {
+          continue;
+        }
+        float distance = sqrtf(distanceSquared);
+        if(distance < m_MinDistance)
+        {
+          m_Counts[0]++;
+          continue;
+        }
+        size_t bin = static_cast<size_t>((distance - m_MinDistance) / m_StepSize);
+        if(bin < m_NumBins)
+        {
+          m_Counts[bin + 1]++;
+        }
+      }
+    }
+  }
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -187,13 +374,11 @@ RadialDistributionFunction::~RadialDistributionFunction() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::vector<float> boxdims, std::vector<float> boxres)
+std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::vector<float> boxdims, std::vector<float> boxres, size_t numPoints,
+                                                                          bool periodic, uint64_t seed)
 {
   std::vector<float> freq(numBins, 0);
   std::vector<float> randomCentroids;
-  std::vector<std::vector<float>> distancelist;
-  size_t largeNumber = 1000;
-  size_t numDistances = largeNumber * (largeNumber - 1);
 
   // boxdims are the dimensions of the box in microns
   // boxres is the resoultion of the box in microns
@@ -203,10 +388,7 @@ std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float
 
   size_t totalpoints = xpoints * ypoints * zpoints;
 
-  float x, y, z;
-  float xn, yn, zn;
   float xc, yc, zc;
-  float r;
 
   size_t featureOwnerIdx = 0;
   size_t column, row, plane;
@@ -217,14 +399,14 @@ std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float
 
   freq.resize(static_cast<size_t>(current_num_bins + 1));
 
-  SIMPL_RANDOMNG_NEW();
+  SIMPLibRandomStream rng(seed);
 
-  randomCentroids.resize(largeNumber * 3);
+  randomCentroids.resize(numPoints * 3);
 
   // Generating all of the random points and storing their coordinates in randomCentroids
-  for(size_t i = 0; i < largeNumber; i++)
+  for(size_t i = 0; i < numPoints; i++)
   {
-    featureOwnerIdx = static_cast<size_t>(rg.genrand_res53() * totalpoints);
+    featureOwnerIdx = static_cast<size_t>(rng.nextUniform() * totalpoints);
 
     column = featureOwnerIdx % xpoints;
     row = (featureOwnerIdx / xpoints) % ypoints;
@@ -239,53 +421,174 @@ std::vector<float> RadialDistributionFunction::GenerateRandomDistribution(float
     randomCentroids[3 * i + 2] = zc;
   }
 
-  distancelist.resize(largeNumber);
+  // Only pairs up to maxDistance are binned so the grid can skip every pair farther apart. The
+  // frequencies are normalized by the total number of pairs, so the bins in range are the same as
+  // binning every pair; the remaining bins out to the box diagonal are kept, at zero, for callers
+  // that index them.
+  std::vector<float> inRange = ComputePairHistogram(randomCentroids, minDistance, minDistance + numBins * stepsize, numBins, boxdims, periodic);
+  std::fill(freq.begin(), freq.end(), 0.0f);
+  std::copy(inRange.begin(), inRange.begin() + std::min(inRange.size(), freq.size()), freq.begin());
 
-  // Calculating all of the distances and storing them in the distance list
-  for(size_t i = 1; i < largeNumber; i++)
+  return freq;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<float> RadialDistributionFunction::ComputePairHistogram(const std::vector<float>& centroids, float minDistance, float maxDistance, int numBins, const std::vector<float>& boxDims,
+                                                                    bool periodic)
+{
+  std::vector<float> freq(static_cast<size_t>(std::max(numBins, 0)) + 1, 0.0f);
+  size_t numPoints = centroids.size() / 3;
+  if(numPoints < 2 || numBins <= 0 || maxDistance <= minDistance || maxDistance <= 0.0f)
+  {
+    return freq;
+  }
+  if(periodic && (boxDims.size() < 3 || boxDims[0] <= 0.0f || boxDims[1] <= 0.0f || boxDims[2] <= 0.0f))
   {
+    return freq;
+  }
 
-    x = randomCentroids[3 * i];
-    y = randomCentroids[3 * i + 1];
-    z = randomCentroids[3 * i + 2];
+  PairGrid grid;
+  grid.periodic = periodic;
 
-    for(size_t j = i + 1; j < largeNumber; j++)
+  // Periodic points are wrapped into the box, otherwise the grid spans the bounding box of the points
+  std::vector<float> wrapped;
+  const std::vector<float>* points = &centroids;
+  float lower[3] = {0.0f, 0.0f, 0.0f};
+  float extent[3] = {0.0f, 0.0f, 0.0f};
+  if(periodic)
+  {
+    wrapped.resize(centroids.size());
+    for(size_t i = 0; i < numPoints; i++)
     {
+      for(int d = 0; d < 3; d++)
+      {
+        float value = centroids[3 * i + d];
+        value -= boxDims[d] * std::floor(value / boxDims[d]);
+        wrapped[3 * i + d] = (value >= boxDims[d]) ? 0.0f : value;
+      }
+    }
+    points = &wrapped;
+    for(int d = 0; d < 3; d++)
+    {
+      grid.boxDims[d] = boxDims[d];
+      extent[d] = boxDims[d];
+    }
+  }
+  else
+  {
+    float upper[3] = {centroids[0], centroids[1], centroids[2]};
+    lower[0] = centroids[0];
+    lower[1] = centroids[1];
+    lower[2] = centroids[2];
+    for(size_t i = 1; i < numPoints; i++)
+    {
+      for(int d = 0; d < 3; d++)
+      {
+        lower[d] = std::min(lower[d], centroids[3 * i + d]);
+        upper[d] = std::max(upper[d], centroids[3 * i + d]);
+      }
+    }
+    for(int d = 0; d < 3; d++)
+    {
+      extent[d] = upper[d] - lower[d];
+    }
+  }
 
-      xn = randomCentroids[3 * j];
-      yn = randomCentroids[3 * j + 1];
-      zn = randomCentroids[3 * j + 2];
-
-      r = sqrtf((x - xn) * (x - xn) + (y - yn) * (y - yn) + (z - zn) * (z - zn));
-
-      distancelist[i].push_back(r);
-      distancelist[j].push_back(r);
+  // Cells are at least maxDistance wide, and grown further if needed so there are not many more cells than points
+  float cellSize = maxDistance;
+  const size_t maxCells = std::max<size_t>(numPoints, 1);
+  size_t totalCells = 0;
+  while(true)
+  {
+    totalCells = 1;
+    for(int d = 0; d < 3; d++)
+    {
+      grid.numCells[d] = std::max<size_t>(1, static_cast<size_t>(extent[d] / cellSize));
+      totalCells *= grid.numCells[d];
+    }
+    if(totalCells <= maxCells)
+    {
+      break;
     }
+    cellSize *= 1.25f;
   }
 
-  // bin up the distance list
-  for(size_t i = 0; i < largeNumber; i++)
+  for(int d = 0; d < 3; d++)
   {
-    for(size_t j = 0; j < distancelist[i].size(); j++)
+    if(!periodic || grid.numCells[d] >= 3)
     {
-      float distance = distancelist[i][j];
-      size_t bin = static_cast<size_t>((distance - minDistance) / stepsize);
+      grid.offsets[d] = {-1, 0, 1};
+    }
+    else if(grid.numCells[d] == 2)
+    {
+      // Both the -1 and +1 neighbors wrap onto the same cell
+      grid.offsets[d] = {0, 1};
+    }
+    else
+    {
+      grid.offsets[d] = {0};
+    }
+  }
 
-      if(distance < minDistance)
-      {
-        freq[0]++;
-      }
-      else
+  // Counting sort of the points by cell
+  std::vector<size_t> pointCell(numPoints, 0);
+  grid.cellStart.assign(totalCells + 1, 0);
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    size_t cellIndex[3] = {0, 0, 0};
+    for(int d = 0; d < 3; d++)
+    {
+      if(grid.numCells[d] > 1)
       {
-        freq[bin + 1]++;
+        float width = extent[d] / grid.numCells[d];
+        size_t c = static_cast<size_t>(((*points)[3 * i + d] - lower[d]) / width);
+        cellIndex[d] = std::min(c, grid.numCells[d] - 1);
       }
     }
+    pointCell[i] = (cellIndex[2] * grid.numCells[1] + cellIndex[1]) * grid.numCells[0] + cellIndex[0];
+    grid.cellStart[pointCell[i] + 1]++;
+  }
+  for(size_t c = 0; c < totalCells; c++)
+  {
+    grid.cellStart[c + 1] += grid.cellStart[c];
+  }
+  grid.x.resize(numPoints);
+  grid.y.resize(numPoints);
+  grid.z.resize(numPoints);
+  std::vector<size_t> fill(grid.cellStart.begin(), grid.cellStart.end() - 1);
+  for(size_t i = 0; i < numPoints; i++)
+  {
+    size_t slot = fill[pointCell[i]]++;
+    grid.x[slot] = (*points)[3 * i];
+    grid.y[slot] = (*points)[3 * i + 1];
+    grid.z[slot] = (*points)[3 * i + 2];
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  tbb::task_scheduler_init init;
+  bool doParallel = true;
+#endif
+
+  PairHistogramImpl histogram(grid, minDistance, maxDistance, numBins);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(doParallel == true)
+  {
+    tbb::parallel_reduce(tbb::blocked_range<size_t>(0, totalCells), histogram, tbb::auto_partitioner());
   }
-  
-  // Normalize the frequencies
-  for(size_t i = 0; i < current_num_bins + 1; i++)
+  else
+#endif
+  {
+    histogram.compute(0, totalCells);
+  }
+
+  // Normalize the frequencies by the number of pairs
+  const std::vector<uint64_t>& counts = histogram.getCounts();
+  double numPairs = static_cast<double>(numPoints) * static_cast<double>(numPoints - 1) * 0.5;
+  for(size_t i = 0; i < freq.size(); i++)
   {
-    freq[i] = freq[i] / (numDistances);
+    freq[i] = static_cast<float>(counts[i] / numPairs);
   }
 
   return freq;
@@ -36,6 +36,7 @@
 #ifndef _radialdistributionfunction_h_
 #define _radialdistributionfunction_h_
 
+#include <cstdint>
 #include <vector>
 
 #include <QtCore/QJsonObject>
@@ -112,9 +113,30 @@ class SIMPLib_EXPORT RadialDistributionFunction
      * @param numBins The number of bins to generate
      * @param boxdims
      * @param boxres
-     * @return An array of values that are the frequency values for the histogram
+     * @param numPoints The number of random points placed in the box
+     * @param periodic Whether distances wrap around the box faces
+     * @param seed Seed of the SIMPLibRandomStream that places the points; the same seed always gives the same result
+     * @return An array of values that are the frequency values for the histogram. It extends to the box diagonal,
+     * but only pairs closer than maxDistance are binned, so the bins past maxDistance are zero.
      */
-    static std::vector<float> GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::vector<float> boxdims, std::vector<float> boxres);
+    static std::vector<float> GenerateRandomDistribution(float minDistance, float maxDistance, int numBins, std::vector<float> boxdims, std::vector<float> boxres, size_t numPoints = 1000,
+                                                         bool periodic = false, uint64_t seed = 0);
+
+    /**
+     * @brief ComputePairHistogram Bins the distance of every unordered pair of points that are closer than
+     * maxDistance. Points are sorted into a uniform grid of cells at least maxDistance wide so only pairs in
+     * neighboring cells are measured, and the cells are processed in parallel with one histogram per thread.
+     * @param centroids The x, y, z coordinates of the points, stored consecutively
+     * @param minDistance Pairs closer than this are counted in the first bin
+     * @param maxDistance Pairs this far apart or farther are not counted
+     * @param numBins The number of bins between minDistance and maxDistance
+     * @param boxDims The size of the box spanning [0, boxDims). Only used when periodic is true
+     * @param periodic Whether to use the minimum image distance in the box. maxDistance should then be no larger
+     * than half the smallest box dimension
+     * @return numBins + 1 frequencies, the first holding pairs closer than minDistance, each normalized by the
+     * total number of pairs
+     */
+    static std::vector<float> ComputePairHistogram(const std::vector<float>& centroids, float minDistance, float maxDistance, int numBins, const std::vector<float>& boxDims, bool periodic);
 
   protected:
     RadialDistributionFunction();
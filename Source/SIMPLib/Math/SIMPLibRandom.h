@@ -35,7 +35,8 @@
 
 /* This class uses the Mersenne Twister pseudorandom number generator code internally.
  * This class should be thread safe as long as only a single thread uses any particular
- * instance of this class.
+ * instance of this class. Note that genrand_beta() keeps its state in static variables
+ * and is not thread safe at all. Use SIMPLibRandomStream for parallel or reproducible work.
  */
 
 #ifndef _simplibrandom_h_
@@ -0,0 +1,249 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "SIMPLibRandomStream.h"
+
+#include <cmath>
+
+#include <QtCore/QDateTime>
+
+#include "SIMPLib/Math/SIMPLibMath.h"
+
+namespace
+{
+const uint32_t k_PhiloxM0 = 0xD2511F53;
+const uint32_t k_PhiloxM1 = 0xCD9E8D57;
+const uint32_t k_PhiloxW0 = 0x9E3779B9;
+const uint32_t k_PhiloxW1 = 0xBB67AE85;
+
+inline void mulhilo(uint32_t a, uint32_t b, uint32_t& hi, uint32_t& lo)
+{
+  uint64_t product = static_cast<uint64_t>(a) * static_cast<uint64_t>(b);
+  hi = static_cast<uint32_t>(product >> 32);
+  lo = static_cast<uint32_t>(product);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLibRandomStream::SIMPLibRandomStream(uint64_t seed, uint64_t streamIndex, uint32_t subStream)
+: m_Position(0)
+{
+  m_Key[0] = static_cast<uint32_t>(seed);
+  m_Key[1] = static_cast<uint32_t>(seed >> 32);
+  // The first counter word holds the block index, the others identify the stream
+  m_Counter[0] = 0;
+  m_Counter[1] = subStream;
+  m_Counter[2] = static_cast<uint32_t>(streamIndex);
+  m_Counter[3] = static_cast<uint32_t>(streamIndex >> 32);
+  Philox4x32(m_Counter, m_Key, m_Block);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLibRandomStream::~SIMPLibRandomStream() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t SIMPLibRandomStream::SeedFromClock()
+{
+  // SplitMix64 finalizer so that close clock readings give unrelated seeds
+  uint64_t z = static_cast<uint64_t>(QDateTime::currentMSecsSinceEpoch()) + 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLibRandomStream::Philox4x32(const uint32_t counter[4], const uint32_t key[2], uint32_t result[4])
+{
+  uint32_t ctr[4] = {counter[0], counter[1], counter[2], counter[3]};
+  uint32_t k0 = key[0];
+  uint32_t k1 = key[1];
+  for(int round = 0; round < 10; round++)
+  {
+    if(round > 0)
+    {
+      k0 += k_PhiloxW0;
+      k1 += k_PhiloxW1;
+    }
+    uint32_t hi0 = 0, lo0 = 0, hi1 = 0, lo1 = 0;
+    mulhilo(k_PhiloxM0, ctr[0], hi0, lo0);
+    mulhilo(k_PhiloxM1, ctr[2], hi1, lo1);
+    uint32_t next[4] = {hi1 ^ ctr[1] ^ k0, lo1, hi0 ^ ctr[3] ^ k1, lo0};
+    ctr[0] = next[0];
+    ctr[1] = next[1];
+    ctr[2] = next[2];
+    ctr[3] = next[3];
+  }
+  result[0] = ctr[0];
+  result[1] = ctr[1];
+  result[2] = ctr[2];
+  result[3] = ctr[3];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLibRandomStream::setPosition(uint64_t position)
+{
+  uint32_t block = static_cast<uint32_t>(position >> 2);
+  if(block != m_Counter[0])
+  {
+    m_Counter[0] = block;
+    Philox4x32(m_Counter, m_Key, m_Block);
+  }
+  m_Position = position;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint64_t SIMPLibRandomStream::getPosition() const
+{
+  return m_Position;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+uint32_t SIMPLibRandomStream::nextUInt32()
+{
+  uint32_t index = static_cast<uint32_t>(m_Position & 3);
+  if(index == 0 && static_cast<uint32_t>(m_Position >> 2) != m_Counter[0])
+  {
+    m_Counter[0] = static_cast<uint32_t>(m_Position >> 2);
+    Philox4x32(m_Counter, m_Key, m_Block);
+  }
+  m_Position++;
+  return m_Block[index];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double SIMPLibRandomStream::nextUniform()
+{
+  uint32_t a = nextUInt32() >> 5;
+  uint32_t b = nextUInt32() >> 6;
+  return (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double SIMPLibRandomStream::nextUniform(double min, double max)
+{
+  return min + (max - min) * nextUniform();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double SIMPLibRandomStream::nextNormal(double mean, double sigma)
+{
+  // 1 - u keeps the logarithm finite
+  double u1 = 1.0 - nextUniform();
+  double u2 = nextUniform();
+  double z = std::sqrt(-2.0 * std::log(u1)) * std::cos(SIMPLib::Constants::k_2Pi * u2);
+  return mean + sigma * z;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double SIMPLibRandomStream::nextLogNormal(double mu, double sigma)
+{
+  return std::exp(nextNormal(mu, sigma));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double SIMPLibRandomStream::nextGamma(double shape)
+{
+  if(shape <= 0.0)
+  {
+    return 0.0;
+  }
+  if(shape < 1.0)
+  {
+    // Boost the shape above one and scale the result back down
+    double u = 1.0 - nextUniform();
+    return nextGamma(shape + 1.0) * std::pow(u, 1.0 / shape);
+  }
+
+  double d = shape - 1.0 / 3.0;
+  double c = 1.0 / std::sqrt(9.0 * d);
+  while(true)
+  {
+    double x = 0.0;
+    double v = 0.0;
+    do
+    {
+      x = nextNormal(0.0, 1.0);
+      v = 1.0 + c * x;
+    } while(v <= 0.0);
+    v = v * v * v;
+    double u = 1.0 - nextUniform();
+    if(u < 1.0 - 0.0331 * x * x * x * x)
+    {
+      return d * v;
+    }
+    if(std::log(u) < 0.5 * x * x + d * (1.0 - v + std::log(v)))
+    {
+      return d * v;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double SIMPLibRandomStream::nextBeta(double alpha, double beta)
+{
+  double x = nextGamma(alpha);
+  double y = nextGamma(beta);
+  if(x + y <= 0.0)
+  {
+    return 0.0;
+  }
+  return x / (x + y);
+}
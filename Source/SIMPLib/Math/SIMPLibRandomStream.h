@@ -0,0 +1,240 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _simplibrandomstream_h_
+#define _simplibrandomstream_h_
+
+#include <cstdint>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+
+/**
+ * @brief The SIMPLibRandomStream class is a counter based random number generator (Philox4x32-10). Every
+ * output is a pure function of the seed, the stream index, the sub-stream index and the position in the
+ * stream, so independent streams can be handed to parallel tasks without any shared state and any
+ * position can be reached in constant time. A stream instance itself must only be used by one thread.
+ *
+ * The Fill* functions write samples into a DataArray in parallel. The array is split into fixed size
+ * chunks that each draw from their own sub-stream, which makes the result identical for any number of
+ * threads.
+ */
+class SIMPLib_EXPORT SIMPLibRandomStream
+{
+public:
+  /**
+   * @brief Creates the stream identified by seed and streamIndex. Sub-streams split one stream further,
+   * sub-stream 0 being the stream itself.
+   */
+  SIMPLibRandomStream(uint64_t seed, uint64_t streamIndex = 0, uint32_t subStream = 0);
+  virtual ~SIMPLibRandomStream();
+
+  /**
+   * @brief Number of array elements that share one sub-stream in the Fill* functions
+   */
+  static const size_t k_FillChunkSize = 4096;
+
+  /**
+   * @brief SeedFromClock Returns a seed derived from the system clock for callers that do not need reproducible results
+   */
+  static uint64_t SeedFromClock();
+
+  /**
+   * @brief Philox4x32 Applies the 10 round Philox bijection to a 128 bit counter with a 64 bit key
+   */
+  static void Philox4x32(const uint32_t counter[4], const uint32_t key[2], uint32_t result[4]);
+
+  /**
+   * @brief setPosition Jumps to the given 32 bit output of the stream
+   */
+  void setPosition(uint64_t position);
+
+  /**
+   * @brief getPosition Returns the index of the next 32 bit output
+   */
+  uint64_t getPosition() const;
+
+  /**
+   * @brief nextUInt32 Generates a random number on [0,0xffffffff]
+   */
+  uint32_t nextUInt32();
+
+  /**
+   * @brief nextUniform Generates a random number on [0,1) with 53-bit resolution
+   */
+  double nextUniform();
+
+  /**
+   * @brief nextUniform Generates a random number on [min,max)
+   */
+  double nextUniform(double min, double max);
+
+  /**
+   * @brief nextNormal Generates a normally distributed number using the Box-Muller transform
+   */
+  double nextNormal(double mean, double sigma);
+
+  /**
+   * @brief nextLogNormal Generates a number whose logarithm is normally distributed with the given mu and sigma
+   */
+  double nextLogNormal(double mu, double sigma);
+
+  /**
+   * @brief nextGamma Generates a gamma distributed number with unit scale (Marsaglia and Tsang)
+   */
+  double nextGamma(double shape);
+
+  /**
+   * @brief nextBeta Generates a beta distributed number on [0,1]
+   */
+  double nextBeta(double alpha, double beta);
+
+  template <typename T>
+  static void FillUniform(typename DataArray<T>::Pointer array, uint64_t seed, uint64_t streamIndex, double min, double max)
+  {
+    Fill<T>(array, seed, streamIndex, [min, max](SIMPLibRandomStream& rng) { return rng.nextUniform(min, max); });
+  }
+
+  template <typename T>
+  static void FillNormal(typename DataArray<T>::Pointer array, uint64_t seed, uint64_t streamIndex, double mean, double sigma)
+  {
+    Fill<T>(array, seed, streamIndex, [mean, sigma](SIMPLibRandomStream& rng) { return rng.nextNormal(mean, sigma); });
+  }
+
+  template <typename T>
+  static void FillLogNormal(typename DataArray<T>::Pointer array, uint64_t seed, uint64_t streamIndex, double mu, double sigma)
+  {
+    Fill<T>(array, seed, streamIndex, [mu, sigma](SIMPLibRandomStream& rng) { return rng.nextLogNormal(mu, sigma); });
+  }
+
+  template <typename T>
+  static void FillBeta(typename DataArray<T>::Pointer array, uint64_t seed, uint64_t streamIndex, double alpha, double beta)
+  {
+    Fill<T>(array, seed, streamIndex, [alpha, beta](SIMPLibRandomStream& rng) { return rng.nextBeta(alpha, beta); });
+  }
+
+  /**
+   * @brief Fill Writes sampler(stream) into every element of the array. Chunk c of k_FillChunkSize elements
+   * draws from sub-stream c + 1 of (seed, streamIndex).
+   */
+  template <typename T, typename Sampler>
+  static void Fill(typename DataArray<T>::Pointer array, uint64_t seed, uint64_t streamIndex, Sampler sampler)
+  {
+    if(nullptr == array.get() || array->getSize() == 0)
+    {
+      return;
+    }
+    T* data = array->getPointer(0);
+    size_t numElements = array->getSize();
+    size_t numChunks = (numElements + k_FillChunkSize - 1) / k_FillChunkSize;
+
+    FillImpl<T, Sampler> fill(data, numElements, seed, streamIndex, sampler);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::task_scheduler_init init;
+    bool doParallel = true;
+    if(doParallel == true)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, numChunks), fill, tbb::auto_partitioner());
+    }
+    else
+#endif
+    {
+      fill.generate(0, numChunks);
+    }
+  }
+
+private:
+  uint32_t m_Key[2];
+  uint32_t m_Counter[4];
+  uint32_t m_Block[4];
+  uint64_t m_Position;
+
+  /**
+   * @brief The FillImpl class generates the samples of a range of chunks
+   */
+  template <typename T, typename Sampler>
+  class FillImpl
+  {
+  public:
+    FillImpl(T* data, size_t numElements, uint64_t seed, uint64_t streamIndex, Sampler sampler)
+    : m_Data(data)
+    , m_NumElements(numElements)
+    , m_Seed(seed)
+    , m_StreamIndex(streamIndex)
+    , m_Sampler(sampler)
+    {
+    }
+
+    void generate(size_t chunkStart, size_t chunkEnd) const
+    {
+      for(size_t chunk = chunkStart; chunk < chunkEnd; chunk++)
+      {
+        SIMPLibRandomStream rng(m_Seed, m_StreamIndex, static_cast<uint32_t>(chunk + 1));
+        size_t end = (chunk + 1) * k_FillChunkSize;
+        if(end > m_NumElements)
+        {
+          end = m_NumElements;
+        }
+        for(size_t i = chunk * k_FillChunkSize; i < end; i++)
+        {
+          m_Data[i] = static_cast<T>(m_Sampler(rng));
+        }
+      }
+    }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      generate(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    T* m_Data;
+    size_t m_NumElements;
+    uint64_t m_Seed;
+    uint64_t m_StreamIndex;
+    Sampler m_Sampler;
+  };
+};
+
+#endif /* _simplibrandomstream_h_ */
@@ -0,0 +1,164 @@
+#include <stdlib.h>
+
+#include <cmath>
+#include <iostream>
+#include <random>
+
+#include "SIMPLib/Math/RadialDistributionFunction.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class RadialDistributionFunctionTest
+{
+
+public:
+  RadialDistributionFunctionTest()
+  {
+  }
+
+  virtual ~RadialDistributionFunctionTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  std::vector<float> BruteForceHistogram(const std::vector<float>& centroids, float minDistance, float maxDistance, int numBins, const std::vector<float>& boxDims, bool periodic)
+  {
+    std::vector<double> counts(numBins + 1, 0.0);
+    size_t numPoints = centroids.size() / 3;
+    float stepSize = (maxDistance - minDistance) / numBins;
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      for(size_t j = i + 1; j < numPoints; j++)
+      {
+        float delta[3] = {0.0f, 0.0f, 0.0f};
+        for(int d = 0; d < 3; d++)
+        {
+          delta[d] = centroids[3 * j + d] - centroids[3 * i + d];
+          if(periodic)
+          {
+            delta[d] -= boxDims[d] * std::floor(delta[d] / boxDims[d] + 0.5f);
+          }
+        }
+        float distance = sqrtf(delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2]);
+        if(distance >= maxDistance)
+        {
+          continue;
+        }
+        if(distance < minDistance)
+        {
+          counts[0]++;
+          continue;
+        }
+        size_t bin = static_cast<size_t>((distance - minDistance) / stepSize);
+        if(bin < static_cast<size_t>(numBins))
+        {
+          counts[bin + 1]++;
+        }
+      }
+    }
+
+    double numPairs = numPoints * (numPoints - 1) * 0.5;
+    std::vector<float> freq(numBins + 1, 0.0f);
+    for(size_t i = 0; i < freq.size(); i++)
+    {
+      freq[i] = static_cast<float>(counts[i] / numPairs);
+    }
+    return freq;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPairHistogram()
+  {
+    const size_t numPoints = 3000;
+    std::vector<float> boxDims = {40.0f, 25.0f, 30.0f};
+    std::mt19937 generator(5489u);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    std::vector<float> centroids(numPoints * 3);
+    for(size_t i = 0; i < numPoints; i++)
+    {
+      for(int d = 0; d < 3; d++)
+      {
+        centroids[3 * i + d] = unit(generator) * boxDims[d];
+      }
+    }
+
+    double numPairs = numPoints * (numPoints - 1) * 0.5;
+    for(bool periodic : {false, true})
+    {
+      std::vector<float> freq = RadialDistributionFunction::ComputePairHistogram(centroids, 1.5f, 9.0f, 30, boxDims, periodic);
+      std::vector<float> expected = BruteForceHistogram(centroids, 1.5f, 9.0f, 30, boxDims, periodic);
+      DREAM3D_REQUIRE_EQUAL(freq.size(), expected.size())
+      for(size_t i = 0; i < freq.size(); i++)
+      {
+        // Allow for a pair landing on the other side of a bin edge through rounding
+        DREAM3D_REQUIRE(std::fabs(freq[i] - expected[i]) <= 2.5 / numPairs)
+      }
+    }
+
+    // Degenerate input produces an empty histogram of the requested size
+    std::vector<float> single = {1.0f, 2.0f, 3.0f};
+    std::vector<float> freq = RadialDistributionFunction::ComputePairHistogram(single, 0.0f, 5.0f, 10, boxDims, false);
+    DREAM3D_REQUIRE_EQUAL(freq.size(), 11)
+    for(float value : freq)
+    {
+      DREAM3D_REQUIRE_EQUAL(value, 0.0f)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestRandomDistribution()
+  {
+    std::vector<float> boxDims(3, 98.0f);
+    std::vector<float> boxRes(3, 0.1f);
+    std::vector<float> frequencies = RadialDistributionFunction::GenerateRandomDistribution(8, 93, 55, boxDims, boxRes, 2000);
+
+    float stepSize = (93.0f - 8.0f) / 55.0f;
+    float maxBoxDistance = sqrtf(3.0f * 98.0f * 98.0f);
+    size_t numBins = static_cast<size_t>(ceil((maxBoxDistance - 8.0f) / stepSize));
+    DREAM3D_REQUIRE_EQUAL(frequencies.size(), numBins + 1)
+
+    // Only pairs closer than the maximum distance are binned; the bins out to the box diagonal stay empty
+    double total = 0.0;
+    for(size_t i = 0; i < frequencies.size(); i++)
+    {
+      DREAM3D_REQUIRE(frequencies[i] >= 0.0f)
+      if(i > 55)
+      {
+        DREAM3D_REQUIRE_EQUAL(frequencies[i], 0.0f)
+      }
+      total += frequencies[i];
+    }
+    DREAM3D_REQUIRE(total > 0.0)
+    DREAM3D_REQUIRE(total < 1.0)
+
+    // The points come from a seeded stream, so the result is reproducible
+    std::vector<float> again = RadialDistributionFunction::GenerateRandomDistribution(8, 93, 55, boxDims, boxRes, 2000);
+    DREAM3D_REQUIRE(again == frequencies)
+    std::vector<float> other = RadialDistributionFunction::GenerateRandomDistribution(8, 93, 55, boxDims, boxRes, 2000, false, 17);
+    DREAM3D_REQUIRE(other != frequencies)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### RadialDistributionFunctionTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestPairHistogram())
+    DREAM3D_REGISTER_TEST(TestRandomDistribution())
+  }
+
+private:
+  RadialDistributionFunctionTest(const RadialDistributionFunctionTest&); // Copy Constructor Not Implemented
+  void operator=(const RadialDistributionFunctionTest&);                 // Move assignment Not Implemented
+};
@@ -0,0 +1,172 @@
+#include <stdlib.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "SIMPLib/Math/GeometryMath.h"
+#include "SIMPLib/Math/SIMPLibRandomStream.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class SIMPLibRandomStreamTest
+{
+
+public:
+  SIMPLibRandomStreamTest()
+  {
+  }
+
+  virtual ~SIMPLibRandomStreamTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestKnownAnswers()
+  {
+    // Known answer vectors published with the Random123 reference implementation
+    uint32_t result[4] = {0, 0, 0, 0};
+    {
+      uint32_t counter[4] = {0, 0, 0, 0};
+      uint32_t key[2] = {0, 0};
+      SIMPLibRandomStream::Philox4x32(counter, key, result);
+      DREAM3D_REQUIRE_EQUAL(result[0], 0x6627e8d5u)
+      DREAM3D_REQUIRE_EQUAL(result[1], 0xe169c58du)
+      DREAM3D_REQUIRE_EQUAL(result[2], 0xbc57ac4cu)
+      DREAM3D_REQUIRE_EQUAL(result[3], 0x9b00dbd8u)
+    }
+    {
+      uint32_t counter[4] = {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344};
+      uint32_t key[2] = {0xa4093822, 0x299f31d0};
+      SIMPLibRandomStream::Philox4x32(counter, key, result);
+      DREAM3D_REQUIRE_EQUAL(result[0], 0xd16cfe09u)
+      DREAM3D_REQUIRE_EQUAL(result[1], 0x94fdccebu)
+      DREAM3D_REQUIRE_EQUAL(result[2], 0x5001e420u)
+      DREAM3D_REQUIRE_EQUAL(result[3], 0x24126ea1u)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestStreams()
+  {
+    SIMPLibRandomStream first(1234, 7);
+    SIMPLibRandomStream second(1234, 7);
+    SIMPLibRandomStream other(1234, 8);
+    int differences = 0;
+    std::vector<uint32_t> values(100);
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      values[i] = first.nextUInt32();
+      DREAM3D_REQUIRE_EQUAL(values[i], second.nextUInt32())
+      if(values[i] != other.nextUInt32())
+      {
+        differences++;
+      }
+    }
+    DREAM3D_REQUIRE(differences > 90)
+
+    // Jumping ahead lands on the same values as drawing sequentially
+    SIMPLibRandomStream jumper(1234, 7);
+    jumper.setPosition(37);
+    DREAM3D_REQUIRE_EQUAL(jumper.nextUInt32(), values[37])
+    jumper.setPosition(5);
+    DREAM3D_REQUIRE_EQUAL(jumper.getPosition(), 5)
+    DREAM3D_REQUIRE_EQUAL(jumper.nextUInt32(), values[5])
+
+    // Reproducible rays of the requested length
+    SIMPLibRandomStream rayStream(99, 0);
+    SIMPLibRandomStream rayStreamCopy(99, 0);
+    for(int i = 0; i < 10; i++)
+    {
+      float ray[3] = {0.0f, 0.0f, 0.0f};
+      float rayCopy[3] = {0.0f, 0.0f, 0.0f};
+      GeometryMath::GenerateRandomRay(rayStream, 2.5f, ray);
+      GeometryMath::GenerateRandomRay(rayStreamCopy, 2.5f, rayCopy);
+      DREAM3D_REQUIRE_EQUAL(ray[0], rayCopy[0])
+      DREAM3D_REQUIRE_EQUAL(ray[1], rayCopy[1])
+      DREAM3D_REQUIRE_EQUAL(ray[2], rayCopy[2])
+      float length = sqrtf(ray[0] * ray[0] + ray[1] * ray[1] + ray[2] * ray[2]);
+      DREAM3D_REQUIRE(std::fabs(length - 2.5f) < 1.0E-4f)
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestFill()
+  {
+    const size_t numElements = SIMPLibRandomStream::k_FillChunkSize * 40 + 123;
+    DoubleArrayType::Pointer normal = DoubleArrayType::CreateArray(numElements, "Normal");
+    SIMPLibRandomStream::FillNormal<double>(normal, 2018, 3, 5.0, 2.0);
+
+    // The fill must match a serial walk over the chunk sub-streams, independent of how the work was split
+    for(size_t chunk = 0; chunk * SIMPLibRandomStream::k_FillChunkSize < numElements; chunk++)
+    {
+      SIMPLibRandomStream rng(2018, 3, static_cast<uint32_t>(chunk + 1));
+      size_t end = std::min(numElements, (chunk + 1) * SIMPLibRandomStream::k_FillChunkSize);
+      for(size_t i = chunk * SIMPLibRandomStream::k_FillChunkSize; i < end; i++)
+      {
+        DREAM3D_REQUIRE_EQUAL(normal->getValue(i), rng.nextNormal(5.0, 2.0))
+      }
+    }
+
+    double mean = 0.0;
+    double variance = 0.0;
+    for(size_t i = 0; i < numElements; i++)
+    {
+      mean += normal->getValue(i);
+    }
+    mean /= numElements;
+    for(size_t i = 0; i < numElements; i++)
+    {
+      variance += (normal->getValue(i) - mean) * (normal->getValue(i) - mean);
+    }
+    variance /= numElements;
+    DREAM3D_REQUIRE(std::fabs(mean - 5.0) < 0.05)
+    DREAM3D_REQUIRE(std::fabs(variance - 4.0) < 0.1)
+
+    FloatArrayType::Pointer uniform = FloatArrayType::CreateArray(numElements, "Uniform");
+    SIMPLibRandomStream::FillUniform<float>(uniform, 1, 0, -1.0, 3.0);
+    FloatArrayType::Pointer beta = FloatArrayType::CreateArray(numElements, "Beta");
+    SIMPLibRandomStream::FillBeta<float>(beta, 1, 0, 2.0, 5.0);
+    FloatArrayType::Pointer logNormal = FloatArrayType::CreateArray(numElements, "LogNormal");
+    SIMPLibRandomStream::FillLogNormal<float>(logNormal, 1, 0, 0.0, 0.5);
+    double uniformMean = 0.0;
+    double betaMean = 0.0;
+    double logNormalMean = 0.0;
+    for(size_t i = 0; i < numElements; i++)
+    {
+      DREAM3D_REQUIRE(uniform->getValue(i) >= -1.0f && uniform->getValue(i) <= 3.0f)
+      DREAM3D_REQUIRE(beta->getValue(i) >= 0.0f && beta->getValue(i) <= 1.0f)
+      DREAM3D_REQUIRE(logNormal->getValue(i) > 0.0f)
+      uniformMean += uniform->getValue(i);
+      betaMean += beta->getValue(i);
+      logNormalMean += logNormal->getValue(i);
+    }
+    DREAM3D_REQUIRE(std::fabs(uniformMean / numElements - 1.0) < 0.02)
+    DREAM3D_REQUIRE(std::fabs(betaMean / numElements - 2.0 / 7.0) < 0.005)
+    DREAM3D_REQUIRE(std::fabs(logNormalMean / numElements - std::exp(0.125)) < 0.01)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### SIMPLibRandomStreamTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+    DREAM3D_REGISTER_TEST(TestKnownAnswers())
+    DREAM3D_REGISTER_TEST(TestStreams())
+    DREAM3D_REGISTER_TEST(TestFill())
+  }
+
+private:
+  SIMPLibRandomStreamTest(const SIMPLibRandomStreamTest&); // Copy Constructor Not Implemented
+  void operator=(const SIMPLibRandomStreamTest&);          // Move assignment Not Implemented
+};
@@ -0,0 +1,286 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PluginManifestCache.h"
+
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QSaveFile>
+#include <QtCore/QStandardPaths>
+
+#include "SIMPLib/SIMPLibVersion.h"
+
+namespace
+{
+const QString k_Version("Version");
+const QString k_Plugins("Plugins");
+const QString k_Size("Size");
+const QString k_LastModified("LastModified");
+const QString k_Filters("Filters");
+const QString k_ClassName("ClassName");
+const QString k_Uuid("Uuid");
+const QString k_GroupName("GroupName");
+const QString k_SubGroupName("SubGroupName");
+const QString k_HumanLabel("HumanLabel");
+const QString k_BrandingString("BrandingString");
+const QString k_CompiledLibraryName("CompiledLibraryName");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PluginManifestCache::PluginManifestCache(const QString& filePath)
+: m_FilePath(filePath)
+, m_Modified(false)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PluginManifestCache::~PluginManifestCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PluginManifestCache::DefaultFilePath()
+{
+  return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/SIMPLibPluginManifest.json";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PluginManifestCache::FilterEntry PluginManifestCache::CreateFilterEntry(IFilterFactory::Pointer factory)
+{
+  FilterEntry entry;
+  entry.className = factory->getFilterClassName();
+  entry.uuid = factory->getUuid();
+  entry.groupName = factory->getFilterGroup();
+  entry.subGroupName = factory->getFilterSubGroup();
+  entry.humanLabel = factory->getFilterHumanLabel();
+  entry.brandingString = factory->getBrandingString();
+  entry.compiledLibraryName = factory->getCompiledLibraryName();
+  return entry;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PluginManifestCache::load()
+{
+  m_Plugins.clear();
+  m_Modified = false;
+
+  QFile file(m_FilePath);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    return false;
+  }
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+  if(parseError.error != QJsonParseError::NoError || !doc.isObject())
+  {
+    return false;
+  }
+
+  QJsonObject root = doc.object();
+  if(root[k_Version].toString() != SIMPLib::Version::PackageComplete())
+  {
+    // Filters may have changed in ways the file attributes of the plugins do not show
+    m_Modified = true;
+    return false;
+  }
+
+  QJsonObject plugins = root[k_Plugins].toObject();
+  for(QJsonObject::const_iterator iter = plugins.constBegin(); iter != plugins.constEnd(); ++iter)
+  {
+    QJsonObject pluginObj = iter.value().toObject();
+    PluginEntry plugin;
+    plugin.size = static_cast<qint64>(pluginObj[k_Size].toDouble());
+    plugin.lastModified = static_cast<qint64>(pluginObj[k_LastModified].toDouble());
+
+    QJsonArray filters = pluginObj[k_Filters].toArray();
+    for(int i = 0; i < filters.size(); i++)
+    {
+      QJsonObject filterObj = filters[i].toObject();
+      FilterEntry entry;
+      entry.className = filterObj[k_ClassName].toString();
+      entry.uuid = QUuid(filterObj[k_Uuid].toString());
+      entry.groupName = filterObj[k_GroupName].toString();
+      entry.subGroupName = filterObj[k_SubGroupName].toString();
+      entry.humanLabel = filterObj[k_HumanLabel].toString();
+      entry.brandingString = filterObj[k_BrandingString].toString();
+      entry.compiledLibraryName = filterObj[k_CompiledLibraryName].toString();
+      if(entry.className.isEmpty())
+      {
+        continue;
+      }
+      plugin.filters.push_back(entry);
+    }
+    m_Plugins.insert(iter.key(), plugin);
+  }
+
+  return !m_Plugins.isEmpty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PluginManifestCache::save()
+{
+  if(!m_Modified)
+  {
+    return true;
+  }
+
+  QJsonObject plugins;
+  for(QMap<QString, PluginEntry>::const_iterator iter = m_Plugins.constBegin(); iter != m_Plugins.constEnd(); ++iter)
+  {
+    const PluginEntry& plugin = iter.value();
+    QJsonArray filters;
+    for(int i = 0; i < plugin.filters.size(); i++)
+    {
+      const FilterEntry& entry = plugin.filters[i];
+      QJsonObject filterObj;
+      filterObj[k_ClassName] = entry.className;
+      filterObj[k_Uuid] = entry.uuid.toString();
+      filterObj[k_GroupName] = entry.groupName;
+      filterObj[k_SubGroupName] = entry.subGroupName;
+      filterObj[k_HumanLabel] = entry.humanLabel;
+      filterObj[k_BrandingString] = entry.brandingString;
+      filterObj[k_CompiledLibraryName] = entry.compiledLibraryName;
+      filters.append(filterObj);
+    }
+
+    QJsonObject pluginObj;
+    pluginObj[k_Size] = static_cast<double>(plugin.size);
+    pluginObj[k_LastModified] = static_cast<double>(plugin.lastModified);
+    pluginObj[k_Filters] = filters;
+    plugins[iter.key()] = pluginObj;
+  }
+
+  QJsonObject root;
+  root[k_Version] = SIMPLib::Version::PackageComplete();
+  root[k_Plugins] = plugins;
+
+  QFileInfo fi(m_FilePath);
+  if(!QDir().mkpath(fi.absolutePath()))
+  {
+    return false;
+  }
+  // Several applications may start at once so never leave a half written file behind
+  QSaveFile file(m_FilePath);
+  if(!file.open(QIODevice::WriteOnly))
+  {
+    return false;
+  }
+  file.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+  if(!file.commit())
+  {
+    return false;
+  }
+  m_Modified = false;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PluginManifestCache::isCurrent(const QString& pluginPath) const
+{
+  QMap<QString, PluginEntry>::const_iterator iter = m_Plugins.constFind(pluginPath);
+  if(iter == m_Plugins.constEnd())
+  {
+    return false;
+  }
+  QFileInfo fi(pluginPath);
+  return fi.exists() && fi.size() == iter.value().size && fi.lastModified().toMSecsSinceEpoch() == iter.value().lastModified;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<PluginManifestCache::FilterEntry> PluginManifestCache::getFilters(const QString& pluginPath) const
+{
+  return m_Plugins.value(pluginPath).filters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PluginManifestCache::setFilters(const QString& pluginPath, const QVector<FilterEntry>& filters)
+{
+  QFileInfo fi(pluginPath);
+  PluginEntry plugin;
+  plugin.size = fi.size();
+  plugin.lastModified = fi.lastModified().toMSecsSinceEpoch();
+  plugin.filters = filters;
+  m_Plugins[pluginPath] = plugin;
+  m_Modified = true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PluginManifestCache::removeEntriesExcept(const QStringList& pluginPaths)
+{
+  QMap<QString, PluginEntry>::iterator iter = m_Plugins.begin();
+  while(iter != m_Plugins.end())
+  {
+    if(pluginPaths.contains(iter.key()))
+    {
+      ++iter;
+    }
+    else
+    {
+      iter = m_Plugins.erase(iter);
+      m_Modified = true;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PluginManifestCache::getFilePath() const
+{
+  return m_FilePath;
+}
@@ -0,0 +1,153 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _pluginmanifestcache_h_
+#define _pluginmanifestcache_h_
+
+#include <QtCore/QMap>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QUuid>
+#include <QtCore/QVector>
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/Filtering/IFilterFactory.hpp"
+#include "SIMPLib/SIMPLib.h"
+
+/**
+ * @brief The PluginManifestCache class remembers which filters each plugin library registered
+ * the last time it was loaded, keyed on the plugin file path, size and modification time. The
+ * SIMPLibPluginLoader uses it to register filter factories for a plugin without loading the
+ * library (see LazyFilterFactory). The whole cache is discarded when the SIMPLib version changes.
+ */
+class SIMPLib_EXPORT PluginManifestCache
+{
+public:
+  SIMPL_TYPE_MACRO(PluginManifestCache)
+
+  /**
+   * @brief Everything a FilterManager needs to know about a filter without instantiating it
+   */
+  struct FilterEntry
+  {
+    QString className;
+    QUuid uuid;
+    QString groupName;
+    QString subGroupName;
+    QString humanLabel;
+    QString brandingString;
+    QString compiledLibraryName;
+  };
+
+  /**
+   * @brief PluginManifestCache
+   * @param filePath The json file the cache is read from and written to
+   */
+  PluginManifestCache(const QString& filePath);
+  virtual ~PluginManifestCache();
+
+  /**
+   * @brief Returns the cache file used when SIMPL_PLUGIN_CACHE is not set, in the
+   * application cache directory.
+   */
+  static QString DefaultFilePath();
+
+  /**
+   * @brief Creates the cache entry describing the filter a factory creates
+   * @param factory
+   */
+  static FilterEntry CreateFilterEntry(IFilterFactory::Pointer factory);
+
+  /**
+   * @brief Reads the cache file. A missing, unreadable or out of date file leaves the cache empty.
+   * @return true if any entries were read
+   */
+  bool load();
+
+  /**
+   * @brief Writes the cache file if any entry changed since it was loaded
+   * @return false if the file could not be written
+   */
+  bool save();
+
+  /**
+   * @brief Returns true if the plugin file has an entry and has not changed since it was recorded
+   * @param pluginPath
+   */
+  bool isCurrent(const QString& pluginPath) const;
+
+  /**
+   * @brief Returns the filters recorded for a plugin file
+   * @param pluginPath
+   */
+  QVector<FilterEntry> getFilters(const QString& pluginPath) const;
+
+  /**
+   * @brief Records the filters a plugin file registered along with the current size and
+   * modification time of the file.
+   * @param pluginPath
+   * @param filters
+   */
+  void setFilters(const QString& pluginPath, const QVector<FilterEntry>& filters);
+
+  /**
+   * @brief Drops the entries of plugin files that are not in the list, i.e. plugins that
+   * were removed or are no longer on the plugin search path.
+   * @param pluginPaths
+   */
+  void removeEntriesExcept(const QStringList& pluginPaths);
+
+  /**
+   * @brief Returns the path of the cache file
+   */
+  QString getFilePath() const;
+
+private:
+  struct PluginEntry
+  {
+    qint64 size = 0;
+    qint64 lastModified = 0;
+    QVector<FilterEntry> filters;
+  };
+
+  QString m_FilePath;
+  QMap<QString, PluginEntry> m_Plugins;
+  bool m_Modified;
+
+  PluginManifestCache(const PluginManifestCache&) = delete; // Copy Constructor Not Implemented
+  void operator=(const PluginManifestCache&) = delete;      // Move assignment Not Implemented
+};
+
+#endif /* _PluginManifestCache_H_ */
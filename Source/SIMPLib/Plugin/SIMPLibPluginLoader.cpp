@@ -42,13 +42,18 @@
 // Qt Includes
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
 #include <QtCore/QPluginLoader>
 #include <QtCore/QStringList>
 #include <QtCore/QtDebug>
 
 #include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/LazyFilterFactory.h"
 #include "SIMPLib/Plugin/ISIMPLibPlugin.h"
 #include "SIMPLib/Plugin/PluginManager.h"
+#include "SIMPLib/Plugin/PluginManifestCache.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -65,7 +70,7 @@ SIMPLibPluginLoader::~SIMPLibPluginLoader() = default;
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool quiet)
+QStringList SIMPLibPluginLoader::FindPluginFilePaths(bool quiet)
 {
   QStringList pluginDirs;
   pluginDirs << qApp->applicationDirPath();
@@ -182,45 +187,123 @@ void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool q
     }
   }
 
+  return pluginFilePaths;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ISIMPLibPlugin* SIMPLibPluginLoader::LoadPlugin(const QString& path, FilterManager* filterManager, bool quiet)
+{
+  // Plugins that were deferred can be loaded from any thread that creates one of their filters
+  static QMutex mutex;
+  QMutexLocker locker(&mutex);
+
+  if(!quiet) qDebug() << "Plugin Being Loaded:" << path;
+  QPluginLoader loader(path);
+  QObject* plugin = loader.instance();
+  if(!quiet) qDebug() << "    Pointer: " << plugin << "\n";
+  if(nullptr == plugin)
+  {
+    if(!quiet)
+    {
+      QString message("The plugin did not load with the following error\n");
+      message.append(loader.errorString());
+      message.append("\n\n");
+      message.append("Possible causes include missing libraries that plugin depends on.");
+      qDebug() << message;
+    }
+    return nullptr;
+  }
+
+  ISIMPLibPlugin* ipPlugin = qobject_cast<ISIMPLibPlugin*>(plugin);
+  if(ipPlugin)
+  {
+    ipPlugin->registerFilters(filterManager);
+    ipPlugin->setDidLoad(true);
+    ipPlugin->setLocation(path);
+    PluginManager::Instance()->addPlugin(ipPlugin);
+  }
+  return ipPlugin;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLibPluginLoader::LoadPluginFilters(FilterManager* filterManager, bool quiet, bool deferLoading)
+{
+  QStringList pluginFilePaths = FindPluginFilePaths(quiet);
+
   filterManager->RegisterKnownFilters(filterManager);
 
-  PluginManager* pluginManager = PluginManager::Instance();
+  QString cacheFilePath = QString::fromLocal8Bit(qgetenv("SIMPL_PLUGIN_CACHE"));
+  if(cacheFilePath.isEmpty())
+  {
+    cacheFilePath = PluginManifestCache::DefaultFilePath();
+  }
+  PluginManifestCache manifest(cacheFilePath);
+  if(deferLoading)
+  {
+    manifest.load();
+    manifest.removeEntriesExcept(pluginFilePaths);
+  }
+
   QStringList pluginFileNames;
-  QVector<ISIMPLibPlugin*> loadedPlugins;
 
   // Now that we have a sorted list of plugins, go ahead and load them all from the
   // file system and add each to the toolbar and menu
   foreach(QString path, pluginFilePaths)
   {
-    if(!quiet) qDebug() << "Plugin Being Loaded:" << path;
-    QPluginLoader loader(path);
     QFileInfo fi(path);
     QString fileName = fi.fileName();
-    QObject* plugin = loader.instance();
-    if(!quiet) qDebug() << "    Pointer: " << plugin << "\n";
-    if(plugin && pluginFileNames.contains(fileName, Qt::CaseSensitive) == false)
+    if(pluginFileNames.contains(fileName, Qt::CaseSensitive))
+    {
+      continue;
+    }
+
+    if(deferLoading && manifest.isCurrent(path))
     {
-      ISIMPLibPlugin* ipPlugin = qobject_cast<ISIMPLibPlugin*>(plugin);
-      if(ipPlugin)
+      // Register stand-in factories from the manifest. The library is only loaded once one of
+      // its filters is actually created.
+      if(!quiet) qDebug() << "Plugin Deferred:" << path;
+      LazyFilterFactory::PluginLoadPointer pluginLoad(new LazyFilterFactory::PluginLoad([path, filterManager, quiet]() {
+        return nullptr != SIMPLibPluginLoader::LoadPlugin(path, filterManager, quiet);
+      }));
+      QVector<PluginManifestCache::FilterEntry> filters = manifest.getFilters(path);
+      for(int i = 0; i < filters.size(); i++)
       {
-        loadedPlugins.push_back(ipPlugin);
-        ipPlugin->registerFilters(filterManager);
-        ipPlugin->setDidLoad(true);
-        ipPlugin->setLocation(path);
-        pluginManager->addPlugin(ipPlugin);
+        filterManager->addFilterFactory(filters[i].className, LazyFilterFactory::New(filterManager, filters[i], pluginLoad));
       }
       pluginFileNames += fileName;
+      continue;
     }
-    else
+
+    FilterManager::Collection previousFactories = filterManager->getFactories();
+    ISIMPLibPlugin* ipPlugin = LoadPlugin(path, filterManager, quiet);
+    if(nullptr == ipPlugin)
     {
-      if(!quiet) 
+      continue;
+    }
+    pluginFileNames += fileName;
+
+    if(deferLoading)
+    {
+      // Remember what the plugin registered so the next start up does not need to load it
+      QVector<PluginManifestCache::FilterEntry> filters;
+      FilterManager::Collection factories = filterManager->getFactories();
+      for(FilterManager::Collection::iterator iter = factories.begin(); iter != factories.end(); ++iter)
       {
-        QString message("The plugin did not load with the following error\n");
-        message.append(loader.errorString());
-        message.append("\n\n");
-        message.append("Possible causes include missing libraries that plugin depends on.");
-        qDebug() << message;
+        if(previousFactories.value(iter.key()) != iter.value())
+        {
+          filters.push_back(PluginManifestCache::CreateFilterEntry(iter.value()));
+        }
       }
+      manifest.setFilters(path, filters);
     }
   }
+
+  if(deferLoading && !manifest.save())
+  {
+    if(!quiet) qDebug() << "Could not write the plugin manifest cache " << manifest.getFilePath();
+  }
 }
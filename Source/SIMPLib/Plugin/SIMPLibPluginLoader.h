@@ -38,9 +38,12 @@
 
 
 
+#include <QtCore/QStringList>
+
 #include "SIMPLib/SIMPLib.h"
 
 class FilterManager;
+class ISIMPLibPlugin;
 
 
 
@@ -59,8 +62,28 @@ class SIMPLib_EXPORT SIMPLibPluginLoader
      * @param filterManager The FilterManager object to load the filters into when
      * a plugin is loaded
      * @param quiet Dump progress to std::cout
+     * @param deferLoading Only load the plugins that are not in the plugin manifest cache (or
+     * changed since they were cached). The filters of the other plugins are registered from the
+     * cache as LazyFilterFactory objects and their library is loaded when one of those filters is
+     * first created. Those plugins do not show up in the PluginManager until then. The cache file
+     * can be set with the SIMPL_PLUGIN_CACHE environment variable.
+     */
+    static void LoadPluginFilters(FilterManager* filterManager, bool quiet = false, bool deferLoading = false);
+
+    /**
+     * @brief FindPluginFilePaths Returns the plugin files found in the plugin search directories
+     * @param quiet Dump progress to std::cout
+     */
+    static QStringList FindPluginFilePaths(bool quiet = false);
+
+    /**
+     * @brief LoadPlugin Loads a single plugin library and registers its filters
+     * @param path The plugin file
+     * @param filterManager The FilterManager object to load the filters into
+     * @param quiet Dump progress to std::cout
+     * @return The plugin or nullptr if the library could not be loaded
      */
-    static void LoadPluginFilters(FilterManager* filterManager, bool quiet = false);
+    static ISIMPLibPlugin* LoadPlugin(const QString& path, FilterManager* filterManager, bool quiet = false);
 
 
   protected:
@@ -0,0 +1,202 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdlib.h>
+
+#include <iostream>
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+
+#include "SIMPLib/CoreFilters/CreateDataContainer.h"
+#include "SIMPLib/Filtering/FilterFactory.hpp"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/LazyFilterFactory.h"
+#include "SIMPLib/Plugin/PluginManifestCache.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+class PluginManifestCacheTest
+{
+public:
+  PluginManifestCacheTest()
+  {
+  }
+  virtual ~PluginManifestCacheTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString getCacheFilePath()
+  {
+    return UnitTest::TestTempDir + QString("/PluginManifestCacheTest.json");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QString getPluginFilePath()
+  {
+    return UnitTest::TestTempDir + QString("/PluginManifestCacheTest.plugin");
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(getCacheFilePath());
+    QFile::remove(getPluginFilePath());
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void writePluginFile(const QByteArray& contents)
+  {
+    QDir().mkpath(UnitTest::TestTempDir);
+    QFile file(getPluginFilePath());
+    file.open(QIODevice::WriteOnly);
+    file.write(contents);
+    file.close();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestManifestRoundTrip()
+  {
+    writePluginFile("plugin");
+    PluginManifestCache::FilterEntry entry = PluginManifestCache::CreateFilterEntry(FilterFactory<CreateDataContainer>::New());
+
+    {
+      PluginManifestCache cache(getCacheFilePath());
+      DREAM3D_REQUIRE_EQUAL(cache.isCurrent(getPluginFilePath()), false)
+      cache.setFilters(getPluginFilePath(), QVector<PluginManifestCache::FilterEntry>(1, entry));
+      cache.setFilters(UnitTest::TestTempDir + "/Removed.plugin", QVector<PluginManifestCache::FilterEntry>(1, entry));
+      cache.removeEntriesExcept(QStringList() << getPluginFilePath());
+      DREAM3D_REQUIRE_EQUAL(cache.save(), true)
+    }
+
+    PluginManifestCache cache(getCacheFilePath());
+    DREAM3D_REQUIRE_EQUAL(cache.load(), true)
+    DREAM3D_REQUIRE_EQUAL(cache.isCurrent(getPluginFilePath()), true)
+    DREAM3D_REQUIRE_EQUAL(cache.getFilters(UnitTest::TestTempDir + "/Removed.plugin").size(), 0)
+
+    QVector<PluginManifestCache::FilterEntry> filters = cache.getFilters(getPluginFilePath());
+    DREAM3D_REQUIRE_EQUAL(filters.size(), 1)
+    DREAM3D_REQUIRE_EQUAL(filters[0].className, CreateDataContainer::ClassName())
+    DREAM3D_REQUIRE(filters[0].uuid == entry.uuid)
+    DREAM3D_REQUIRE_EQUAL(filters[0].groupName, entry.groupName)
+    DREAM3D_REQUIRE_EQUAL(filters[0].subGroupName, entry.subGroupName)
+    DREAM3D_REQUIRE_EQUAL(filters[0].humanLabel, entry.humanLabel)
+
+    // A rebuilt plugin invalidates its entry
+    writePluginFile("rebuilt plugin");
+    DREAM3D_REQUIRE_EQUAL(cache.isCurrent(getPluginFilePath()), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestLazyFactory()
+  {
+    FilterManager* fm = FilterManager::Instance();
+    PluginManifestCache::FilterEntry entry = PluginManifestCache::CreateFilterEntry(FilterFactory<CreateDataContainer>::New());
+    entry.className = "LazyTestFilter";
+    entry.uuid = QUuid::createUuid();
+
+    int loadCount = 0;
+    LazyFilterFactory::PluginLoadPointer pluginLoad(new LazyFilterFactory::PluginLoad([fm, &loadCount]() {
+      loadCount++;
+      fm->addFilterFactory("LazyTestFilter", FilterFactory<CreateDataContainer>::New());
+      return true;
+    }));
+    fm->addFilterFactory(entry.className, LazyFilterFactory::New(fm, entry, pluginLoad));
+
+    // Looking filters up never loads the plugin
+    IFilterFactory::Pointer factory = fm->getFactoryFromClassName("LazyTestFilter");
+    DREAM3D_REQUIRE_VALID_POINTER(factory.get())
+    DREAM3D_REQUIRE(fm->getFactoryFromUuid(entry.uuid) == factory)
+    DREAM3D_REQUIRE_EQUAL(factory->getFilterGroup(), entry.groupName)
+    DREAM3D_REQUIRE_EQUAL(factory->getFilterHumanLabel(), entry.humanLabel)
+    DREAM3D_REQUIRE_EQUAL(loadCount, 0)
+
+    // Creating a filter loads it once and hands over to the real factory
+    AbstractFilter::Pointer filter = factory->create();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get())
+    DREAM3D_REQUIRE_EQUAL(filter->getNameOfClass(), CreateDataContainer::ClassName())
+    DREAM3D_REQUIRE_EQUAL(loadCount, 1)
+    DREAM3D_REQUIRE_EQUAL(pluginLoad->isLoaded(), true)
+    DREAM3D_REQUIRE(nullptr == std::dynamic_pointer_cast<LazyFilterFactory>(fm->getFactoryFromClassName("LazyTestFilter")))
+
+    filter = factory->create();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get())
+    DREAM3D_REQUIRE_EQUAL(loadCount, 1)
+
+    // A plugin that fails to load gives no filter
+    entry.className = "MissingLazyTestFilter";
+    LazyFilterFactory::PluginLoadPointer failedLoad(new LazyFilterFactory::PluginLoad([]() { return false; }));
+    factory = LazyFilterFactory::New(fm, entry, failedLoad);
+    fm->addFilterFactory(entry.className, factory);
+    filter = factory->create();
+    DREAM3D_REQUIRE(nullptr == filter.get())
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### PluginManifestCacheTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles());
+    DREAM3D_REGISTER_TEST(TestManifestRoundTrip());
+    DREAM3D_REGISTER_TEST(TestLazyFactory());
+    DREAM3D_REGISTER_TEST(RemoveTestFiles());
+  }
+
+private:
+  PluginManifestCacheTest(const PluginManifestCacheTest&); // Copy Constructor Not Implemented
+  void operator=(const PluginManifestCacheTest&);          // Move assignment Not Implemented
+};
@@ -39,6 +39,7 @@
 #include "SIMPLib/Common/IObserver.h"
 #include "SIMPLib/DataContainers/DataContainerBundle.h"
 #include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/HDF5/H5StructureIndex.h"
 #include "SIMPLib/Utilities/SIMPLH5DataReaderRequirements.h"
 
 #include "H5Support/QH5Utilities.h"
@@ -230,8 +231,11 @@ DataContainerArrayProxy SIMPLH5DataReader::readDataContainerArrayStructure(SIMPL
 
   QString h5InternalPath = QString("/") + SIMPL::StringConstants::DataContainerGroupName;
 
-  // Read the entire structure of the file into the proxy
-  DataContainer::ReadDataContainerStructure(dcArrayGroupId, proxy, req, h5InternalPath);
+  // Use the structure index when the file has an up to date one, otherwise read the entire structure of the file into the proxy
+  if(!H5StructureIndex::Read(m_FileId, dcArrayGroupId, req, proxy))
+  {
+    DataContainer::ReadDataContainerStructure(dcArrayGroupId, proxy, req, h5InternalPath);
+  }
 
   QH5Utilities::closeHDF5Object(dcArrayGroupId);
   return proxy;
@@ -51,6 +51,7 @@ set_source_files_properties( ${SIMPLib_${SUBDIR_NAME}_Generated_MOC_SRCS} PROPER
 set(SIMPLib_VTKUtils_HDRS
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/VTKWriterMacros.h
   ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/VTKUtil.hpp
+  ${SIMPLib_SOURCE_DIR}/${SUBDIR_NAME}/VTKLegacyFile.hpp
 )
 
 set(SIMPLib_VTKUtils_SRCS
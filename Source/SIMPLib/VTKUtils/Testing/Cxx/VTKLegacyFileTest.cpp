@@ -0,0 +1,345 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <iostream>
+
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/VTKUtils/VTKFileReader.h"
+#include "SIMPLib/VTKUtils/VTKLegacyFile.hpp"
+#include "SIMPLib/VTKUtils/VTKWriterMacros.h"
+
+#include "SIMPLib/Testing/SIMPLTestFileLocations.h"
+#include "SIMPLib/Testing/UnitTestSupport.hpp"
+
+/**
+ * @brief The VTKLegacyFileTest class
+ */
+class VTKLegacyFileTest
+{
+public:
+  VTKLegacyFileTest()
+  {
+  }
+  virtual ~VTKLegacyFileTest()
+  {
+  }
+
+  const size_t k_Dims[3] = {7, 5, 3};
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RemoveTestFiles()
+  {
+#if REMOVE_TEST_FILES
+    QFile::remove(UnitTest::VTKLegacyFileTest::BinaryFile);
+    QFile::remove(UnitTest::VTKLegacyFileTest::AsciiFile);
+#endif
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void WriteTestFile(const QString& filePath, bool binary, Int32ArrayType* featureIds, FloatArrayType* vectors)
+  {
+    FILE* f = fopen(filePath.toLatin1().data(), "wb");
+    DREAM3D_REQUIRE(nullptr != f)
+    {
+      float origin[3] = {1.0f, 2.0f, 3.0f};
+      float spacing[3] = {0.5f, 0.5f, 0.25f};
+      // Use a tiny block size so the staging buffer is flushed many times
+      VTKLegacy::BlockWriter writer(f, 64);
+      DREAM3D_REQUIRE(VTKLegacy::WriteStructuredPointsHeader(writer, "VTKLegacyFileTest", binary, k_Dims, origin, spacing))
+      DREAM3D_REQUIRE(VTKLegacy::WriteSectionHeader(writer, VTKLegacy::ArrayRecord::PointData, featureIds->getNumberOfTuples()))
+      DREAM3D_REQUIRE(VTKLegacy::WriteScalars<int32_t>(writer, featureIds, binary, "%d "))
+      DREAM3D_REQUIRE(VTKLegacy::WriteScalars<float>(writer, vectors, binary, "%.8g "))
+      DREAM3D_REQUIRE(writer.flush())
+    }
+    fclose(f);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void RoundTrip(const QString& filePath, bool binary)
+  {
+    size_t numTuples = k_Dims[0] * k_Dims[1] * k_Dims[2];
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(numTuples, "Feature Ids");
+    QVector<size_t> cDims(1, 3);
+    FloatArrayType::Pointer vectors = FloatArrayType::CreateArray(numTuples, cDims, "Vectors");
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      featureIds->setValue(i, static_cast<int32_t>(i * 1000) - 7);
+      for(size_t c = 0; c < 3; c++)
+      {
+        vectors->setComponent(i, c, static_cast<float>(i) * 0.25f + static_cast<float>(c));
+      }
+    }
+
+    WriteTestFile(filePath, binary, featureIds.get(), vectors.get());
+    int32_t originalFirstId = featureIds->getValue(1);
+    // The writer must never byte swap the source array
+    DREAM3D_REQUIRE_EQUAL(originalFirstId, 993)
+
+    VTKLegacy::FileIndex index = VTKLegacy::IndexFile(filePath);
+    DREAM3D_REQUIRE(index.isValid())
+    DREAM3D_REQUIRE_EQUAL(index.binary, binary)
+    DREAM3D_REQUIRE(index.datasetType == "STRUCTURED_POINTS")
+    DREAM3D_REQUIRE_EQUAL(index.dims[0], k_Dims[0])
+    DREAM3D_REQUIRE_EQUAL(index.dims[2], k_Dims[2])
+    DREAM3D_REQUIRE_EQUAL(index.spacing[2], 0.25f)
+    DREAM3D_REQUIRE_EQUAL(index.numPoints, numTuples)
+    DREAM3D_REQUIRE_EQUAL(index.arrays.size(), 2)
+
+    int idIndex = index.indexOf("Feature_Ids", VTKLegacy::ArrayRecord::PointData);
+    int vecIndex = index.indexOf("Vectors");
+    DREAM3D_REQUIRE(idIndex >= 0)
+    DREAM3D_REQUIRE(vecIndex >= 0)
+    DREAM3D_REQUIRE(index.arrays[idIndex].vtkType == "int")
+    DREAM3D_REQUIRE_EQUAL(index.arrays[vecIndex].numComponents, 3)
+
+    QVector<int> which;
+    which << vecIndex << idIndex;
+    QVector<IDataArray::Pointer> arrays = VTKLegacy::ReadArrays(filePath, index, which);
+    DREAM3D_REQUIRE_EQUAL(arrays.size(), 2)
+
+    FloatArrayType::Pointer readVectors = std::dynamic_pointer_cast<FloatArrayType>(arrays[0]);
+    Int32ArrayType::Pointer readIds = std::dynamic_pointer_cast<Int32ArrayType>(arrays[1]);
+    DREAM3D_REQUIRE_VALID_POINTER(readVectors.get())
+    DREAM3D_REQUIRE_VALID_POINTER(readIds.get())
+    DREAM3D_REQUIRE_EQUAL(readIds->getNumberOfTuples(), numTuples)
+    DREAM3D_REQUIRE_EQUAL(readVectors->getNumberOfComponents(), 3)
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(readIds->getValue(i), featureIds->getValue(i))
+    }
+    for(size_t i = 0; i < numTuples * 3; i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(readVectors->getValue(i), vectors->getValue(i))
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestBinaryRoundTrip()
+  {
+    RoundTrip(UnitTest::VTKLegacyFileTest::BinaryFile, true);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestAsciiRoundTrip()
+  {
+    RoundTrip(UnitTest::VTKLegacyFileTest::AsciiFile, false);
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTruncatedFile()
+  {
+    QFile file(UnitTest::VTKLegacyFileTest::BinaryFile);
+    DREAM3D_REQUIRE(file.open(QIODevice::ReadWrite))
+    DREAM3D_REQUIRE(file.resize(file.size() - 16))
+    file.close();
+
+    VTKLegacy::FileIndex index = VTKLegacy::IndexFile(UnitTest::VTKLegacyFileTest::BinaryFile);
+    DREAM3D_REQUIRE_EQUAL(index.isValid(), false)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int WriteMaskFile(const QString& file, bool* mask, int64_t totalPoints)
+  {
+    FILE* f = fopen(file.toLatin1().data(), "wb");
+    if(nullptr == f)
+    {
+      return -1;
+    }
+    {
+      float origin[3] = {0.0f, 0.0f, 0.0f};
+      float spacing[3] = {1.0f, 1.0f, 1.0f};
+      VTKLegacy::BlockWriter writer(f);
+      VTKLegacy::WriteStructuredPointsHeader(writer, "VTKLegacyFileTest", true, k_Dims, origin, spacing);
+      VTKLegacy::WriteSectionHeader(writer, VTKLegacy::ArrayRecord::PointData, static_cast<size_t>(totalPoints));
+      writer.flush();
+    }
+    // The element type of the source differs from the type declared in the file
+    QString charName("MaskChar");
+    WRITE_VTK_SCALARS_FROM_VOXEL_BINARY(ptr, charName, char, mask)
+    fprintf(f, "\n");
+    QString intName("MaskInt");
+    WRITE_VTK_SCALARS_FROM_VOXEL_BINARY(ptr, intName, int, mask)
+    fprintf(f, "\n");
+    fclose(f);
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConvertingBinaryScalars()
+  {
+    size_t numTuples = k_Dims[0] * k_Dims[1] * k_Dims[2];
+    bool* mask = new bool[numTuples];
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      mask[i] = (i % 3 == 0);
+    }
+    int err = WriteMaskFile(UnitTest::VTKLegacyFileTest::BinaryFile, mask, static_cast<int64_t>(numTuples));
+    DREAM3D_REQUIRE_EQUAL(err, 0)
+
+    VTKLegacy::FileIndex index = VTKLegacy::IndexFile(UnitTest::VTKLegacyFileTest::BinaryFile);
+    DREAM3D_REQUIRE(index.isValid())
+    int charIndex = index.indexOf("MaskChar");
+    int intIndex = index.indexOf("MaskInt");
+    DREAM3D_REQUIRE(charIndex >= 0)
+    DREAM3D_REQUIRE(intIndex >= 0)
+
+    QVector<int> which;
+    which << charIndex << intIndex;
+    QVector<IDataArray::Pointer> arrays = VTKLegacy::ReadArrays(UnitTest::VTKLegacyFileTest::BinaryFile, index, which);
+    DREAM3D_REQUIRE_EQUAL(arrays.size(), 2)
+    Int8ArrayType::Pointer readChars = std::dynamic_pointer_cast<Int8ArrayType>(arrays[0]);
+    Int32ArrayType::Pointer readInts = std::dynamic_pointer_cast<Int32ArrayType>(arrays[1]);
+    DREAM3D_REQUIRE_VALID_POINTER(readChars.get())
+    DREAM3D_REQUIRE_VALID_POINTER(readInts.get())
+    for(size_t i = 0; i < numTuples; i++)
+    {
+      int8_t expected = mask[i] ? 1 : 0;
+      DREAM3D_REQUIRE_EQUAL(readChars->getValue(i), expected)
+      DREAM3D_REQUIRE_EQUAL(readInts->getValue(i), static_cast<int32_t>(expected))
+    }
+    delete[] mask;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestTabsAndInt64Ascii()
+  {
+    // 2^53 + 1 can not be represented by a double
+    const int64_t bigValue = 9007199254740993LL;
+    QFile file(UnitTest::VTKLegacyFileTest::AsciiFile);
+    DREAM3D_REQUIRE(file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    QTextStream out(&file);
+    out << "# vtk DataFile Version 2.0\n"
+        << "VTKLegacyFileTest\n"
+        << "ASCII\n"
+        << "DATASET\tSTRUCTURED_POINTS\n"
+        << "DIMENSIONS\t2 1\t1\n"
+        << "ORIGIN 0 0 0\n"
+        << "SPACING\t1\t1\t1\n"
+        << "POINT_DATA\t2\n"
+        << "SCALARS\tBig\tlong\t1\n"
+        << "LOOKUP_TABLE\tdefault\n"
+        << bigValue << "\t" << -bigValue << "\n";
+    out.flush();
+    file.close();
+
+    VTKLegacy::FileIndex index = VTKLegacy::IndexFile(UnitTest::VTKLegacyFileTest::AsciiFile);
+    DREAM3D_REQUIRE(index.isValid())
+    DREAM3D_REQUIRE(index.datasetType == "STRUCTURED_POINTS")
+    DREAM3D_REQUIRE_EQUAL(index.dims[0], static_cast<size_t>(2))
+    DREAM3D_REQUIRE_EQUAL(index.numPoints, static_cast<size_t>(2))
+    int bigIndex = index.indexOf("Big");
+    DREAM3D_REQUIRE(bigIndex >= 0)
+
+    Int64ArrayType::Pointer big = std::dynamic_pointer_cast<Int64ArrayType>(VTKLegacy::ReadArray(UnitTest::VTKLegacyFileTest::AsciiFile, index, index.arrays[bigIndex]));
+    DREAM3D_REQUIRE_VALID_POINTER(big.get())
+    DREAM3D_REQUIRE_EQUAL(big->getValue(0), bigValue)
+    DREAM3D_REQUIRE_EQUAL(big->getValue(1), -bigValue)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestReaderReadsSingleField()
+  {
+    size_t numTuples = k_Dims[0] * k_Dims[1] * k_Dims[2];
+    Int32ArrayType::Pointer featureIds = Int32ArrayType::CreateArray(numTuples, "Feature Ids");
+    QVector<size_t> cDims(1, 3);
+    FloatArrayType::Pointer vectors = FloatArrayType::CreateArray(numTuples, cDims, "Vectors");
+    featureIds->initializeWithValue(42);
+    vectors->initializeWithValue(1.5f);
+    WriteTestFile(UnitTest::VTKLegacyFileTest::BinaryFile, true, featureIds.get(), vectors.get());
+
+    VTKFileReader::Pointer reader = VTKFileReader::New();
+    reader->setInputFile(UnitTest::VTKLegacyFileTest::BinaryFile);
+    DREAM3D_REQUIRE(reader->getFileIndex().isValid())
+    DREAM3D_REQUIRE_EQUAL(reader->getFileIndex().arrays.size(), 2)
+
+    Int32ArrayType::Pointer readIds = std::dynamic_pointer_cast<Int32ArrayType>(reader->readDataArray("Feature_Ids"));
+    DREAM3D_REQUIRE_VALID_POINTER(readIds.get())
+    DREAM3D_REQUIRE_EQUAL(readIds->getNumberOfTuples(), numTuples)
+    DREAM3D_REQUIRE_EQUAL(readIds->getValue(numTuples - 1), 42)
+
+    IDataArray::Pointer missing = reader->readDataArray("NotInTheFile");
+    DREAM3D_REQUIRE_NULL_POINTER(missing.get())
+    DREAM3D_REQUIRE(reader->getErrorCondition() < 0)
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()()
+  {
+    std::cout << "#### VTKLegacyFileTest Starting ####" << std::endl;
+
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestBinaryRoundTrip())
+    DREAM3D_REGISTER_TEST(TestAsciiRoundTrip())
+    DREAM3D_REGISTER_TEST(TestTruncatedFile())
+    DREAM3D_REGISTER_TEST(TestConvertingBinaryScalars())
+    DREAM3D_REGISTER_TEST(TestTabsAndInt64Ascii())
+    DREAM3D_REGISTER_TEST(TestReaderReadsSingleField())
+
+    DREAM3D_REGISTER_TEST(RemoveTestFiles())
+  }
+
+private:
+  VTKLegacyFileTest(const VTKLegacyFileTest&); // Copy Constructor Not Implemented
+  void operator=(const VTKLegacyFileTest&);    // Move assignment Not Implemented
+};
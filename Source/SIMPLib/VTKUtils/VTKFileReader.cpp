@@ -41,6 +41,7 @@
 
 #include <QtCore/QByteArray>
 #include <QtCore/QFile>
+#include <QtCore/QFileInfo>
 
 #include "SIMPLib/Geometry/ImageGeom.h"
 #include "SIMPLib/SIMPLib.h"
@@ -201,57 +202,24 @@ int VTKFileReader::readHeader()
     return -1;
   }
 
-  QFile in(getInputFile());
-  if(!in.open(QIODevice::ReadOnly | QIODevice::Text))
+  const VTKLegacy::FileIndex& index = getFileIndex();
+  if(!index.isValid())
   {
-    QString msg = QObject::tr("VTF file could not be opened: %1").arg(getInputFile());
     setErrorCondition(-100);
-    notifyErrorMessage(getHumanLabel(), msg, getErrorCondition());
+    notifyErrorMessage(getHumanLabel(), index.errorMessage, getErrorCondition());
     return -100;
   }
 
-  QByteArray buf;
-  buf = in.readLine(); // Read Line 1 - VTK Version Info
+  setComment(index.comment);
+  setFileIsBinary(index.binary);
+  setDatasetType(index.datasetType);
 
-  buf = in.readLine(); // Read Line 2 - User Comment
-  setComment(QString(buf.trimmed()));
-
-  buf = in.readLine(); // Read Line 3 - BINARY or ASCII
-  QString fileType(buf);
-  if(fileType.startsWith("BINARY") == true)
-  {
-    setFileIsBinary(true);
-  }
-  else if(fileType.startsWith("ASCII") == true)
-  {
-    setFileIsBinary(false);
-  }
-  else
-  {
-    err = -1;
-    qDebug() << "The file type of the VTK legacy file could not be determined. It should be ASCII' or 'BINARY' and should appear on line 3 of the file.";
-    return err;
-  }
-
-  QList<QByteArray> tokens;
-  buf = in.readLine(); // Read Line 4 - Type of Dataset
-  {
-    tokens = buf.split(' ');
-    setDatasetType(QString(tokens[1]));
-  }
-
-  buf = in.readLine(); // Read Line 5 which is the Dimension values
-  bool ok = false;
-  int64_t dims[3];
-  tokens = buf.split(' ');
-  dims[0] = tokens[1].toLongLong(&ok, 10);
-  dims[1] = tokens[2].toLongLong(&ok, 10);
-  dims[2] = tokens[3].toLongLong(&ok, 10);
 #if(CMP_SIZEOF_SSIZE_T == 4)
   int64_t max = std::numeric_limits<size_t>::max();
 #else
   int64_t max = std::numeric_limits<int64_t>::max();
 #endif
+  int64_t dims[3] = {static_cast<int64_t>(index.dims[0]), static_cast<int64_t>(index.dims[1]), static_cast<int64_t>(index.dims[2])};
   if(dims[0] * dims[1] * dims[2] > max)
   {
     err = -1;
@@ -283,21 +251,56 @@ int VTKFileReader::readHeader()
   }
   image->setDimensions(dcDims);
 
-  buf = in.readLine(); // Read Line 6 which is the Origin values
-  float origin[3];
-  tokens = buf.split(' ');
-  origin[0] = tokens[1].toFloat(&ok);
-  origin[1] = tokens[2].toFloat(&ok);
-  origin[2] = tokens[3].toFloat(&ok);
+  float origin[3] = {index.origin[0], index.origin[1], index.origin[2]};
   image->setOrigin(origin);
 
-  buf = in.readLine(); // Read Line 7 which is the Scaling values
-  float resolution[3];
-  tokens = buf.split(' ');
-  resolution[0] = tokens[1].toFloat(&ok);
-  resolution[1] = tokens[2].toFloat(&ok);
-  resolution[2] = tokens[3].toFloat(&ok);
+  float resolution[3] = {index.spacing[0], index.spacing[1], index.spacing[2]};
   image->setResolution(resolution);
 
   return err;
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const VTKLegacy::FileIndex& VTKFileReader::getFileIndex()
+{
+  QDateTime modified = QFileInfo(getInputFile()).lastModified();
+  if(m_IndexedFile != getInputFile() || m_IndexedFileModified != modified)
+  {
+    m_FileIndex = VTKLegacy::IndexFile(getInputFile());
+    m_IndexedFile = getInputFile();
+    m_IndexedFileModified = modified;
+  }
+  return m_FileIndex;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer VTKFileReader::readDataArray(const QString& name)
+{
+  const VTKLegacy::FileIndex& index = getFileIndex();
+  if(!index.isValid())
+  {
+    setErrorCondition(-101);
+    notifyErrorMessage(getHumanLabel(), index.errorMessage, getErrorCondition());
+    return IDataArray::NullPointer();
+  }
+  int i = index.indexOf(name);
+  if(i < 0)
+  {
+    QString ss = QObject::tr("The VTK file '%1' does not contain a data section named '%2'").arg(getInputFile()).arg(name);
+    setErrorCondition(-102);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    return IDataArray::NullPointer();
+  }
+  IDataArray::Pointer array = VTKLegacy::ReadArray(getInputFile(), index, index.arrays[i]);
+  if(nullptr == array.get())
+  {
+    QString ss = QObject::tr("The data section '%1' of type '%2' could not be read from '%3'").arg(name).arg(index.arrays[i].vtkType).arg(getInputFile());
+    setErrorCondition(-103);
+    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+  }
+  return array;
+}
@@ -39,10 +39,12 @@
 
 #include <fstream>
 
+#include <QtCore/QDateTime>
 
 #include "SIMPLib/SIMPLib.h"
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/CoreFilters/FileReader.h"
+#include "SIMPLib/VTKUtils/VTKLegacyFile.hpp"
 
 /**
  * @class VTKFileReader VTKFileReader.h PathToHeader/VTKFileReader.h
@@ -107,6 +109,21 @@ class SIMPLib_EXPORT VTKFileReader : public FileReader
       */
      int readHeader();
 
+     /**
+      * @brief Returns the index of every data section in the input file. The file
+      * is scanned once and the index is reused until the input file or its
+      * modification time changes.
+      */
+     const VTKLegacy::FileIndex& getFileIndex();
+
+     /**
+      * @brief Reads a single named data section using the file index so that no
+      * other section is parsed or converted.
+      * @param name The name of the SCALARS, VECTORS, ... section to read
+      * @return The new array or a NullPointer if the section could not be read
+      */
+     IDataArray::Pointer readDataArray(const QString& name);
+
      /**
       * @brief This method should be re-implemented in a subclass
       */
@@ -137,24 +154,25 @@ class SIMPLib_EXPORT VTKFileReader : public FileReader
       size_t totalSize = xDim * yDim * zDim;
       if (getFileIsBinary() == true)
       {
-        T* buffer = new T[totalSize];
-        // Read all the xpoints in one shot into a buffer
-        inStream.read(reinterpret_cast<char* > (buffer), (totalSize * sizeof(T)));
-        if(inStream.gcount() != static_cast<std::streamsize>(totalSize * sizeof(T)))
+        // Only the last two values are needed so seek straight to them
+        T tail[2] = { static_cast<T>(0), static_cast<T>(0) };
+        size_t numTail = (totalSize > 1) ? 2 : totalSize;
+        inStream.seekg(static_cast<std::streamoff>((totalSize - numTail) * sizeof(T)), std::ios_base::cur);
+        inStream.read(reinterpret_cast<char* > (tail), (numTail * sizeof(T)));
+        if(inStream.gcount() != static_cast<std::streamsize>(numTail * sizeof(T)))
         {
           qDebug() << " ERROR READING BINARY FILE. Bytes read was not the same as func->xDim *. " << byteSize << "." << inStream.gcount()
-                   << " vs " << (totalSize * sizeof(T)) ;
+                   << " vs " << (numTail * sizeof(T)) ;
           return -1;
         }
         if (totalSize > 1)
         {
-          diff = buffer[totalSize - 1] - buffer[totalSize - 2];
+          diff = tail[1] - tail[0];
         }
         else
         {
-          diff = buffer[totalSize];
+          diff = tail[0];
         }
-        delete [] buffer;
       }
       else
       {
@@ -182,14 +200,12 @@ class SIMPLib_EXPORT VTKFileReader : public FileReader
       int err = 0;
       if(getFileIsBinary() == true)
       {
-        size_t totalSize = xDim * yDim * zDim;
-        typename DataArray<T>::Pointer bufferPtr = DataArray<T>::CreateArray(totalSize, "JUNK");
-        // Read all the xpoints in one shot into a buffer
-        inStream.read(reinterpret_cast<char*>(bufferPtr->getPointer(0)), (totalSize * sizeof(T)));
-        if(inStream.gcount() != static_cast<std::streamsize>(totalSize * sizeof(T)))
+        size_t totalSize = static_cast<size_t>(xDim) * static_cast<size_t>(yDim) * static_cast<size_t>(zDim);
+        // Nothing in the volume is needed so seek past it instead of reading it
+        inStream.seekg(static_cast<std::streamoff>(totalSize * sizeof(T)), std::ios_base::cur);
+        if(inStream.fail())
         {
-          qDebug() << " ERROR READING BINARY FILE. Bytes read was not the same as func->xDim *. " << byteSize << "." << inStream.gcount() << " vs "
-                   << (totalSize * sizeof(T)) ;
+          qDebug() << " ERROR SKIPPING BINARY VOLUME. Could not seek past " << (totalSize * sizeof(T)) << " bytes";
           return -1;
         }
       }
@@ -216,6 +232,10 @@ class SIMPLib_EXPORT VTKFileReader : public FileReader
 
 
   private:
+    VTKLegacy::FileIndex m_FileIndex;
+    QString m_IndexedFile;
+    QDateTime m_IndexedFileModified;
+
     VTKFileReader(const VTKFileReader&) = delete;  // Copy Constructor Not Implemented
     void operator=(const VTKFileReader&) = delete; // Move assignment Not Implemented
 };
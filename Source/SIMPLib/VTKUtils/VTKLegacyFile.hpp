@@ -0,0 +1,961 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#ifndef _vtklegacyfile_hpp_
+#define _vtklegacyfile_hpp_
+
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+
+#include <QtCore/QFile>
+#include <QtCore/QRegExp>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QTextStream>
+#include <QtCore/QVector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+#include "SIMPLib/SIMPLib.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/IDataArray.h"
+#include "SIMPLib/Utilities/SIMPLibEndian.h"
+#include "SIMPLib/VTKUtils/VTKUtil.hpp"
+
+/**
+ * @file VTKLegacyFile.hpp
+ * @brief This file contains a header only engine for reading and writing legacy
+ * VTK files. The reader makes a single pass over the file to build an index of
+ * every data section (name, type, component count and byte offset) without
+ * parsing any of the payloads. Binary payloads are then memory mapped and byte
+ * swapped directly into a DataArray, so only the arrays that are actually
+ * requested are ever touched. The writer streams arrays through a fixed size
+ * block buffer so that big endian conversion never modifies the source array
+ * and never allocates a full size temporary copy.
+ */
+namespace VTKLegacy
+{
+  /**
+   * @brief Size of the staging buffer used by BlockWriter (in bytes)
+   */
+  static const size_t k_WriteBlockSize = 1024 * 1024;
+
+  /**
+   * @brief Number of elements below which a byte swap is not split across threads
+   */
+  static const size_t k_ParallelSwapGrainSize = 1024 * 256;
+
+  /**
+   * @brief Returns the value with its bytes converted between big endian and
+   * the native byte order of this machine.
+   */
+  template<typename T>
+  inline T BigEndianToSystem(T value)
+  {
+#ifdef SIMPLib_LITTLE_ENDIAN
+    if(sizeof(T) > 1)
+    {
+      char* bytes = reinterpret_cast<char*>(&value);
+      std::reverse(bytes, bytes + sizeof(T));
+    }
+#endif
+    return value;
+  }
+
+  /**
+   * @brief Copies count big endian values from the (possibly unaligned) source
+   * buffer into the destination, converting to the native byte order.
+   */
+  template<typename T>
+  inline void CopyFromBigEndian(const char* src, T* dst, size_t start, size_t end)
+  {
+    T value;
+    for(size_t i = start; i < end; i++)
+    {
+      ::memcpy(&value, src + i * sizeof(T), sizeof(T));
+      dst[i] = BigEndianToSystem<T>(value);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  /**
+   * @brief The CopyFromBigEndianImpl class splits a large byte swapping copy
+   * across the TBB thread pool.
+   */
+  template<typename T>
+  class CopyFromBigEndianImpl
+  {
+    public:
+      CopyFromBigEndianImpl(const char* src, T* dst) :
+        m_Source(src),
+        m_Destination(dst)
+      {}
+      virtual ~CopyFromBigEndianImpl() {}
+
+      void operator()(const tbb::blocked_range<size_t>& r) const
+      {
+        CopyFromBigEndian<T>(m_Source, m_Destination, r.begin(), r.end());
+      }
+
+    private:
+      const char* m_Source;
+      T* m_Destination;
+  };
+#endif
+
+  /**
+   * @brief Converts an entire big endian buffer into the destination array
+   */
+  template<typename T>
+  inline void CopyFromBigEndian(const char* src, T* dst, size_t count)
+  {
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(sizeof(T) > 1 && count > k_ParallelSwapGrainSize)
+    {
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, count, k_ParallelSwapGrainSize), CopyFromBigEndianImpl<T>(src, dst), tbb::auto_partitioner());
+      return;
+    }
+#endif
+    CopyFromBigEndian<T>(src, dst, 0, count);
+  }
+
+  /**
+   * @brief Returns the size in bytes of a single value of the given VTK type
+   * name or 0 if the type is not supported.
+   */
+  inline size_t TypeSize(const QString& vtkType)
+  {
+    if(vtkType == "unsigned_char" || vtkType == "char") { return 1; }
+    if(vtkType == "unsigned_short" || vtkType == "short") { return 2; }
+    if(vtkType == "unsigned_int" || vtkType == "int" || vtkType == "float") { return 4; }
+    if(vtkType == "unsigned_long" || vtkType == "long" || vtkType == "double") { return 8; }
+    if(vtkType == "vtktypeint64" || vtkType == "vtktypeuint64") { return 8; }
+    return 0;
+  }
+
+  /**
+   * @brief The ArrayRecord struct describes one data section of a legacy VTK
+   * file as discovered by the indexing pass.
+   */
+  struct ArrayRecord
+  {
+    enum Section
+    {
+      Geometry = 0, //!< POINTS, X_COORDINATES, CELLS, ... sections
+      PointData = 1,
+      CellData = 2,
+      FieldData = 3
+    };
+
+    QString name;
+    QString keyword;       //!< SCALARS, VECTORS, NORMALS, TENSORS, FIELD, POINTS, ...
+    QString vtkType;
+    Section section = Geometry;
+    int numComponents = 1;
+    size_t numTuples = 0;
+    qint64 offset = 0;     //!< Byte offset of the first value of the payload
+    qint64 byteSize = 0;   //!< Payload size in bytes (binary files only)
+
+    size_t getNumberOfValues() const
+    {
+      return numTuples * static_cast<size_t>(numComponents);
+    }
+  };
+
+  /**
+   * @brief The FileIndex struct holds the parsed header of a legacy VTK file
+   * together with the location of every data section.
+   */
+  struct FileIndex
+  {
+    int errorCode = 0;
+    QString errorMessage;
+    QString version;
+    QString comment;
+    bool binary = false;
+    QString datasetType;
+    size_t dims[3] = { 0, 0, 0 };
+    float origin[3] = { 0.0f, 0.0f, 0.0f };
+    float spacing[3] = { 1.0f, 1.0f, 1.0f };
+    size_t numPoints = 0;
+    size_t numCells = 0;
+    QVector<ArrayRecord> arrays;
+
+    bool isValid() const
+    {
+      return errorCode >= 0;
+    }
+
+    /**
+     * @brief Returns the index of the first array with the given name or -1
+     */
+    int indexOf(const QString& name) const
+    {
+      for(int i = 0; i < arrays.size(); i++)
+      {
+        if(arrays[i].name == name) { return i; }
+      }
+      return -1;
+    }
+
+    /**
+     * @brief Returns the index of the first array with the given name inside
+     * the given section or -1
+     */
+    int indexOf(const QString& name, ArrayRecord::Section section) const
+    {
+      for(int i = 0; i < arrays.size(); i++)
+      {
+        if(arrays[i].name == name && arrays[i].section == section) { return i; }
+      }
+      return -1;
+    }
+  };
+
+  /**
+   * @brief Reads the next non empty line from the file, returning it split on
+   * whitespace. An empty list signals the end of the file.
+   */
+  inline QStringList ReadTokenLine(QFile& in)
+  {
+    while(!in.atEnd())
+    {
+      QByteArray line = in.readLine().trimmed();
+      if(!line.isEmpty())
+      {
+        return QString::fromLatin1(line).split(QRegExp("\\s+"), QString::SkipEmptyParts);
+      }
+    }
+    return QStringList();
+  }
+
+  /**
+   * @brief Moves the file position past count whitespace separated ASCII
+   * values without converting any of them.
+   * @return false if the end of the file was reached first
+   */
+  inline bool SkipAsciiValues(QFile& in, size_t count)
+  {
+    if(count == 0) { return true; }
+    std::vector<char> buffer(64 * 1024);
+    size_t found = 0;
+    bool inToken = false;
+    while(true)
+    {
+      qint64 chunkStart = in.pos();
+      qint64 nRead = in.read(buffer.data(), static_cast<qint64>(buffer.size()));
+      if(nRead <= 0)
+      {
+        return (inToken && found + 1 == count);
+      }
+      for(qint64 i = 0; i < nRead; i++)
+      {
+        char c = buffer[i];
+        bool space = (c == ' ' || c == '\n' || c == '\r' || c == '\t');
+        if(inToken && space)
+        {
+          inToken = false;
+          if(++found == count)
+          {
+            in.seek(chunkStart + i);
+            return true;
+          }
+        }
+        else if(!space)
+        {
+          inToken = true;
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Records a payload at the current file position and moves past it
+   */
+  inline bool AddRecord(QFile& in, FileIndex& index, ArrayRecord& record)
+  {
+    size_t typeSize = TypeSize(record.vtkType);
+    if(typeSize == 0)
+    {
+      index.errorCode = -3;
+      index.errorMessage = QString("Unsupported VTK data type '%1' for section '%2'").arg(record.vtkType).arg(record.name);
+      return false;
+    }
+    record.offset = in.pos();
+    if(index.binary)
+    {
+      record.byteSize = static_cast<qint64>(record.getNumberOfValues() * typeSize);
+      if(record.offset + record.byteSize > in.size() || !in.seek(record.offset + record.byteSize))
+      {
+        index.errorCode = -4;
+        index.errorMessage = QString("Binary section '%1' extends past the end of the file").arg(record.name);
+        return false;
+      }
+    }
+    else if(!SkipAsciiValues(in, record.getNumberOfValues()))
+    {
+      index.errorCode = -4;
+      index.errorMessage = QString("ASCII section '%1' is truncated").arg(record.name);
+      return false;
+    }
+    index.arrays.push_back(record);
+    return true;
+  }
+
+  /**
+   * @brief Makes one pass over a legacy VTK file collecting the header values
+   * and the location of every data section. No payload is converted.
+   * @param filePath The file to index
+   * @return The index. Check FileIndex::isValid() before using it.
+   */
+  inline FileIndex IndexFile(const QString& filePath)
+  {
+    FileIndex index;
+    QFile in(filePath);
+    if(!in.open(QIODevice::ReadOnly))
+    {
+      index.errorCode = -1;
+      index.errorMessage = QString("Could not open VTK file '%1' for reading").arg(filePath);
+      return index;
+    }
+
+    index.version = QString::fromLatin1(in.readLine().trimmed());
+    if(!index.version.startsWith("# vtk DataFile"))
+    {
+      index.errorCode = -2;
+      index.errorMessage = QString("'%1' is not a legacy VTK file").arg(filePath);
+      return index;
+    }
+    index.comment = QString::fromLatin1(in.readLine().trimmed());
+    index.binary = (QString::fromLatin1(in.readLine().trimmed()).toUpper() == "BINARY");
+
+    ArrayRecord::Section section = ArrayRecord::Geometry;
+    size_t sectionTuples = 0;
+    QStringList tokens = ReadTokenLine(in);
+    while(!tokens.isEmpty())
+    {
+      const QString keyword = tokens[0].toUpper();
+      ArrayRecord record;
+      record.keyword = keyword;
+      record.section = section;
+      record.numTuples = sectionTuples;
+
+      if(keyword == "DATASET" && tokens.size() > 1)
+      {
+        index.datasetType = tokens[1].toUpper();
+      }
+      else if(keyword == "DIMENSIONS" && tokens.size() > 3)
+      {
+        for(int i = 0; i < 3; i++) { index.dims[i] = tokens[i + 1].toULongLong(); }
+      }
+      else if(keyword == "ORIGIN" && tokens.size() > 3)
+      {
+        for(int i = 0; i < 3; i++) { index.origin[i] = tokens[i + 1].toFloat(); }
+      }
+      else if((keyword == "SPACING" || keyword == "ASPECT_RATIO") && tokens.size() > 3)
+      {
+        for(int i = 0; i < 3; i++) { index.spacing[i] = tokens[i + 1].toFloat(); }
+      }
+      else if(keyword == "POINT_DATA" && tokens.size() > 1)
+      {
+        section = ArrayRecord::PointData;
+        sectionTuples = tokens[1].toULongLong();
+        index.numPoints = sectionTuples;
+      }
+      else if(keyword == "CELL_DATA" && tokens.size() > 1)
+      {
+        section = ArrayRecord::CellData;
+        sectionTuples = tokens[1].toULongLong();
+        index.numCells = sectionTuples;
+      }
+      else if(keyword == "POINTS" && tokens.size() > 2)
+      {
+        record.name = keyword;
+        record.section = ArrayRecord::Geometry;
+        record.numTuples = tokens[1].toULongLong();
+        record.numComponents = 3;
+        record.vtkType = tokens[2];
+        if(!AddRecord(in, index, record)) { return index; }
+      }
+      else if((keyword == "X_COORDINATES" || keyword == "Y_COORDINATES" || keyword == "Z_COORDINATES") && tokens.size() > 2)
+      {
+        record.name = keyword;
+        record.section = ArrayRecord::Geometry;
+        record.numTuples = tokens[1].toULongLong();
+        record.vtkType = tokens[2];
+        if(!AddRecord(in, index, record)) { return index; }
+      }
+      else if((keyword == "CELLS" || keyword == "VERTICES" || keyword == "LINES" || keyword == "POLYGONS" || keyword == "TRIANGLE_STRIPS") && tokens.size() > 2)
+      {
+        record.name = keyword;
+        record.section = ArrayRecord::Geometry;
+        record.numTuples = tokens[2].toULongLong();
+        record.vtkType = "int";
+        if(!AddRecord(in, index, record)) { return index; }
+      }
+      else if(keyword == "CELL_TYPES" && tokens.size() > 1)
+      {
+        record.name = keyword;
+        record.section = ArrayRecord::Geometry;
+        record.numTuples = tokens[1].toULongLong();
+        record.vtkType = "int";
+        if(!AddRecord(in, index, record)) { return index; }
+      }
+      else if(keyword == "SCALARS" && tokens.size() > 2)
+      {
+        record.name = tokens[1];
+        record.vtkType = tokens[2];
+        record.numComponents = (tokens.size() > 3) ? tokens[3].toInt() : 1;
+        // The LOOKUP_TABLE line is optional when reading
+        qint64 pos = in.pos();
+        QStringList next = ReadTokenLine(in);
+        if(next.isEmpty() || next[0].toUpper() != "LOOKUP_TABLE")
+        {
+          in.seek(pos);
+        }
+        if(!AddRecord(in, index, record)) { return index; }
+      }
+      else if((keyword == "VECTORS" || keyword == "NORMALS" || keyword == "TENSORS") && tokens.size() > 2)
+      {
+        record.name = tokens[1];
+        record.vtkType = tokens[2];
+        record.numComponents = (keyword == "TENSORS") ? 9 : 3;
+        if(!AddRecord(in, index, record)) { return index; }
+      }
+      else if(keyword == "COLOR_SCALARS" && tokens.size() > 2)
+      {
+        // Stored as unsigned bytes in binary files and as floats in [0,1] in ASCII files
+        record.name = tokens[1];
+        record.numComponents = tokens[2].toInt();
+        record.vtkType = index.binary ? "unsigned_char" : "float";
+        if(!AddRecord(in, index, record)) { return index; }
+      }
+      else if(keyword == "TEXTURE_COORDINATES" && tokens.size() > 3)
+      {
+        record.name = tokens[1];
+        record.numComponents = tokens[2].toInt();
+        record.vtkType = tokens[3];
+        if(!AddRecord(in, index, record)) { return index; }
+      }
+      else if(keyword == "FIELD" && tokens.size() > 2)
+      {
+        int numFieldArrays = tokens[2].toInt();
+        for(int a = 0; a < numFieldArrays; a++)
+        {
+          QStringList fieldTokens = ReadTokenLine(in);
+          if(fieldTokens.size() < 4)
+          {
+            index.errorCode = -5;
+            index.errorMessage = QString("Malformed array header in FIELD '%1'").arg(tokens[1]);
+            return index;
+          }
+          ArrayRecord field;
+          field.keyword = keyword;
+          field.section = (section == ArrayRecord::Geometry) ? ArrayRecord::FieldData : section;
+          field.name = fieldTokens[0];
+          field.numComponents = fieldTokens[1].toInt();
+          field.numTuples = fieldTokens[2].toULongLong();
+          field.vtkType = fieldTokens[3];
+          if(!AddRecord(in, index, field)) { return index; }
+        }
+      }
+      else if(keyword == "LOOKUP_TABLE" && tokens.size() > 2)
+      {
+        // A color table that follows the data. Its values are 4 floats (or bytes in binary files)
+        record.name = tokens[1];
+        record.numTuples = tokens[2].toULongLong();
+        record.numComponents = 4;
+        record.vtkType = index.binary ? "unsigned_char" : "float";
+        if(!AddRecord(in, index, record)) { return index; }
+        index.arrays.pop_back();
+      }
+      else if(keyword == "METADATA" || keyword == "INFORMATION" || keyword.startsWith("NAME"))
+      {
+        // Metadata blocks written by newer versions of VTK are plain text and can be skipped line by line
+      }
+      tokens = ReadTokenLine(in);
+    }
+    return index;
+  }
+
+  /**
+   * @brief The AsciiValueType struct selects the type ASCII values are parsed
+   * into. Integers are parsed as 64 bit integers so values above 2^53 keep
+   * their precision; floating point values are parsed as double.
+   */
+  template<typename T, bool IsIntegral = std::is_integral<T>::value, bool IsSigned = std::is_signed<T>::value>
+  struct AsciiValueType
+  {
+    typedef double Type;
+  };
+
+  template<typename T>
+  struct AsciiValueType<T, true, true>
+  {
+    typedef qlonglong Type;
+  };
+
+  template<typename T>
+  struct AsciiValueType<T, true, false>
+  {
+    typedef qulonglong Type;
+  };
+
+  /**
+   * @brief Copies the payload of one indexed section into an already allocated
+   * buffer. Binary payloads are memory mapped when the platform allows it.
+   * @return Zero on success, a negative value otherwise
+   */
+  template<typename T>
+  int ReadPayload(const QString& filePath, const FileIndex& index, const ArrayRecord& record, T* dest)
+  {
+    if(TypeSize(record.vtkType) != sizeof(T))
+    {
+      return -10;
+    }
+    QFile in(filePath);
+    if(!in.open(QIODevice::ReadOnly))
+    {
+      return -1;
+    }
+    size_t count = record.getNumberOfValues();
+    if(index.binary)
+    {
+      if(record.byteSize == 0) { return 0; }
+      uchar* mapped = in.map(record.offset, record.byteSize);
+      if(nullptr != mapped)
+      {
+        CopyFromBigEndian<T>(reinterpret_cast<const char*>(mapped), dest, count);
+        in.unmap(mapped);
+        return 0;
+      }
+      // The file could not be mapped; read straight into the destination and swap in place
+      if(!in.seek(record.offset) || in.read(reinterpret_cast<char*>(dest), record.byteSize) != record.byteSize)
+      {
+        return -2;
+      }
+      CopyFromBigEndian<T>(reinterpret_cast<const char*>(dest), dest, count);
+      return 0;
+    }
+
+    if(!in.seek(record.offset))
+    {
+      return -2;
+    }
+    QTextStream stream(&in);
+    typename AsciiValueType<T>::Type value = 0;
+    for(size_t i = 0; i < count; i++)
+    {
+      stream >> value;
+      if(stream.status() != QTextStream::Ok)
+      {
+        return -3;
+      }
+      dest[i] = static_cast<T>(value);
+    }
+    return 0;
+  }
+
+  /**
+   * @brief Creates a DataArray of the matching type and fills it from the file
+   */
+  template<typename T>
+  IDataArray::Pointer CreateAndReadArray(const QString& filePath, const FileIndex& index, const ArrayRecord& record)
+  {
+    QVector<size_t> cDims(1, static_cast<size_t>(record.numComponents));
+    typename DataArray<T>::Pointer array = DataArray<T>::CreateArray(record.numTuples, cDims, record.name, true);
+    if(nullptr == array.get())
+    {
+      return IDataArray::NullPointer();
+    }
+    if(ReadPayload<T>(filePath, index, record, array->getPointer(0)) < 0)
+    {
+      return IDataArray::NullPointer();
+    }
+    return array;
+  }
+
+  /**
+   * @brief Reads a single indexed section into a new DataArray whose primitive
+   * type matches the type declared in the file.
+   * @return The new array or a NullPointer on error
+   */
+  inline IDataArray::Pointer ReadArray(const QString& filePath, const FileIndex& index, const ArrayRecord& record)
+  {
+    const QString& t = record.vtkType;
+    if(t == "unsigned_char") { return CreateAndReadArray<uint8_t>(filePath, index, record); }
+    if(t == "char") { return CreateAndReadArray<int8_t>(filePath, index, record); }
+    if(t == "unsigned_short") { return CreateAndReadArray<uint16_t>(filePath, index, record); }
+    if(t == "short") { return CreateAndReadArray<int16_t>(filePath, index, record); }
+    if(t == "unsigned_int") { return CreateAndReadArray<uint32_t>(filePath, index, record); }
+    if(t == "int") { return CreateAndReadArray<int32_t>(filePath, index, record); }
+    if(t == "unsigned_long" || t == "vtktypeuint64") { return CreateAndReadArray<uint64_t>(filePath, index, record); }
+    if(t == "long" || t == "vtktypeint64") { return CreateAndReadArray<int64_t>(filePath, index, record); }
+    if(t == "float") { return CreateAndReadArray<float>(filePath, index, record); }
+    if(t == "double") { return CreateAndReadArray<double>(filePath, index, record); }
+    return IDataArray::NullPointer();
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  /**
+   * @brief The ReadArraysImpl class reads several indexed sections concurrently.
+   * Each task opens its own file handle so no state is shared between threads.
+   */
+  class ReadArraysImpl
+  {
+    public:
+      ReadArraysImpl(const QString& filePath, const FileIndex& index, const QVector<int>& which, QVector<IDataArray::Pointer>& output) :
+        m_FilePath(filePath),
+        m_Index(index),
+        m_Which(which),
+        m_Output(output)
+      {}
+      virtual ~ReadArraysImpl() {}
+
+      void operator()(const tbb::blocked_range<int>& r) const
+      {
+        for(int i = r.begin(); i < r.end(); i++)
+        {
+          m_Output[i] = ReadArray(m_FilePath, m_Index, m_Index.arrays[m_Which[i]]);
+        }
+      }
+
+    private:
+      const QString& m_FilePath;
+      const FileIndex& m_Index;
+      const QVector<int>& m_Which;
+      QVector<IDataArray::Pointer>& m_Output;
+  };
+#endif
+
+  /**
+   * @brief Reads the requested sections, in parallel when SIMPLib is built
+   * with TBB. The returned vector has one entry per requested index; an entry
+   * is a NullPointer if that section could not be read.
+   * @param which Indices into FileIndex::arrays
+   */
+  inline QVector<IDataArray::Pointer> ReadArrays(const QString& filePath, const FileIndex& index, const QVector<int>& which)
+  {
+    QVector<IDataArray::Pointer> output(which.size());
+    for(int i = 0; i < which.size(); i++)
+    {
+      if(which[i] < 0 || which[i] >= index.arrays.size())
+      {
+        return QVector<IDataArray::Pointer>();
+      }
+    }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    tbb::task_scheduler_init init;
+    bool doParallel = true;
+#endif
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(doParallel == true && which.size() > 1)
+    {
+      tbb::parallel_for(tbb::blocked_range<int>(0, which.size(), 1), ReadArraysImpl(filePath, index, which, output), tbb::simple_partitioner());
+    }
+    else
+#endif
+    {
+      for(int i = 0; i < which.size(); i++)
+      {
+        output[i] = ReadArray(filePath, index, index.arrays[which[i]]);
+      }
+    }
+    return output;
+  }
+
+  /**
+   * @brief The BlockWriter class stages converted values in a fixed size buffer
+   * and hands them to fwrite in large blocks. The source data is never modified.
+   */
+  class BlockWriter
+  {
+    public:
+      explicit BlockWriter(FILE* f, size_t blockSize = k_WriteBlockSize) :
+        m_File(f),
+        m_Buffer(blockSize),
+        m_Used(0),
+        m_Error(false)
+      {}
+      virtual ~BlockWriter()
+      {
+        flush();
+      }
+
+      /**
+       * @brief Appends count values in big endian byte order
+       */
+      template<typename T>
+      bool writeBigEndian(const T* data, size_t count)
+      {
+        const size_t perBlock = m_Buffer.size() / sizeof(T);
+        size_t i = 0;
+        while(i < count && !m_Error)
+        {
+          size_t room = (m_Buffer.size() - m_Used) / sizeof(T);
+          if(room == 0)
+          {
+            flush();
+            room = perBlock;
+          }
+          size_t n = std::min(room, count - i);
+          char* out = m_Buffer.data() + m_Used;
+          for(size_t j = 0; j < n; j++)
+          {
+            T value = BigEndianToSystem<T>(data[i + j]);
+            ::memcpy(out + j * sizeof(T), &value, sizeof(T));
+          }
+          m_Used += n * sizeof(T);
+          i += n;
+        }
+        return !m_Error;
+      }
+
+      /**
+       * @brief Appends count values converted to Out in big endian byte order. data
+       * can be a pointer or any container with operator[]; values whose type differs
+       * from Out (a bool mask written as "char" for example) are converted one block
+       * at a time.
+       */
+      template<typename Out, typename Source>
+      bool writeBigEndianAs(const Source& data, size_t count)
+      {
+        typedef typename std::decay<decltype(data[0])>::type ElementType;
+        return writeAs<Out>(data, count, true, std::is_same<ElementType, Out>());
+      }
+
+      /**
+       * @brief Appends count values converted to Out in the byte order of this machine,
+       * see writeBigEndianAs()
+       */
+      template<typename Out, typename Source>
+      bool writeNativeAs(const Source& data, size_t count)
+      {
+        typedef typename std::decay<decltype(data[0])>::type ElementType;
+        return writeAs<Out>(data, count, false, std::is_same<ElementType, Out>());
+      }
+
+      /**
+       * @brief Appends count values as text, valuesPerLine values on each line
+       */
+      template<typename T>
+      bool writeAscii(const T* data, size_t count, const char* format, size_t valuesPerLine = 20)
+      {
+        char token[64];
+        for(size_t i = 0; i < count && !m_Error; i++)
+        {
+          int n = snprintf(token, sizeof(token) - 1, format, data[i]);
+          if(n < 0) { n = 0; }
+          if(n > static_cast<int>(sizeof(token)) - 2) { n = sizeof(token) - 2; }
+          while(n > 0 && token[n - 1] == ' ') { n--; }
+          bool endOfLine = ((i + 1) % valuesPerLine == 0) || (i + 1 == count);
+          token[n++] = endOfLine ? '\n' : ' ';
+          writeBytes(token, static_cast<size_t>(n));
+        }
+        return !m_Error;
+      }
+
+      /**
+       * @brief Appends raw bytes
+       */
+      bool writeBytes(const char* bytes, size_t count)
+      {
+        while(count > 0 && !m_Error)
+        {
+          if(m_Used == m_Buffer.size())
+          {
+            flush();
+          }
+          size_t n = std::min(count, m_Buffer.size() - m_Used);
+          ::memcpy(m_Buffer.data() + m_Used, bytes, n);
+          m_Used += n;
+          bytes += n;
+          count -= n;
+        }
+        return !m_Error;
+      }
+
+      bool writeString(const QString& str)
+      {
+        QByteArray bytes = str.toLatin1();
+        return writeBytes(bytes.constData(), static_cast<size_t>(bytes.size()));
+      }
+
+      /**
+       * @brief Writes any staged bytes to the file
+       */
+      bool flush()
+      {
+        if(m_Used > 0 && !m_Error)
+        {
+          m_Error = (fwrite(m_Buffer.data(), 1, m_Used, m_File) != m_Used);
+        }
+        m_Used = 0;
+        return !m_Error;
+      }
+
+      bool hasError() const
+      {
+        return m_Error;
+      }
+
+    private:
+      /**
+       * @brief The source already holds Out values so they are written straight from it
+       */
+      template<typename Out, typename Source>
+      bool writeAs(const Source& data, size_t count, bool bigEndian, std::true_type)
+      {
+        if(count == 0) { return !m_Error; }
+        const Out* values = &data[0];
+        if(bigEndian) { return writeBigEndian<Out>(values, count); }
+        return writeBytes(reinterpret_cast<const char*>(values), count * sizeof(Out));
+      }
+
+      /**
+       * @brief Converts the source to Out through a small staging block
+       */
+      template<typename Out, typename Source>
+      bool writeAs(const Source& data, size_t count, bool bigEndian, std::false_type)
+      {
+        static const size_t k_ConvertBlockSize = 4096;
+        std::vector<Out> block(std::min(count, k_ConvertBlockSize));
+        size_t i = 0;
+        while(i < count && !m_Error)
+        {
+          size_t n = std::min(count - i, k_ConvertBlockSize);
+          for(size_t j = 0; j < n; j++)
+          {
+            block[j] = static_cast<Out>(data[i + j]);
+          }
+          if(bigEndian) { writeBigEndian<Out>(block.data(), n); }
+          else { writeBytes(reinterpret_cast<const char*>(block.data()), n * sizeof(Out)); }
+          i += n;
+        }
+        return !m_Error;
+      }
+
+      FILE* m_File;
+      std::vector<char> m_Buffer;
+      size_t m_Used;
+      bool m_Error;
+
+      BlockWriter(const BlockWriter&); // Copy Constructor Not Implemented
+      void operator=(const BlockWriter&); // Operator '=' Not Implemented
+  };
+
+  /**
+   * @brief Writes the 4 line file preamble followed by a STRUCTURED_POINTS header
+   */
+  inline bool WriteStructuredPointsHeader(BlockWriter& writer, const QString& comment, bool binary, const size_t dims[3], const float origin[3], const float spacing[3])
+  {
+    QString header;
+    QTextStream ss(&header);
+    ss << "# vtk DataFile Version 2.0\n" << comment << "\n" << (binary ? "BINARY" : "ASCII") << "\n";
+    ss << "DATASET STRUCTURED_POINTS\n";
+    ss << "DIMENSIONS " << dims[0] << " " << dims[1] << " " << dims[2] << "\n";
+    ss << "ORIGIN " << origin[0] << " " << origin[1] << " " << origin[2] << "\n";
+    ss << "SPACING " << spacing[0] << " " << spacing[1] << " " << spacing[2] << "\n";
+    ss.flush();
+    return writer.writeString(header);
+  }
+
+  /**
+   * @brief Starts a POINT_DATA or CELL_DATA section
+   */
+  inline bool WriteSectionHeader(BlockWriter& writer, ArrayRecord::Section section, size_t numTuples)
+  {
+    QString header = QString("%1 %2\n").arg(section == ArrayRecord::CellData ? "CELL_DATA" : "POINT_DATA").arg(numTuples);
+    return writer.writeString(header);
+  }
+
+  /**
+   * @brief Writes the values of an array as a single coordinate axis of a
+   * RECTILINEAR_GRID (keyword is X_COORDINATES, Y_COORDINATES or Z_COORDINATES)
+   */
+  template<typename T>
+  bool WriteCoordinates(BlockWriter& writer, const QString& keyword, const T* values, size_t count, bool binary, const char* asciiFormat = "%f ")
+  {
+    T dummy = static_cast<T>(0);
+    writer.writeString(QString("%1 %2 %3\n").arg(keyword).arg(count).arg(VTKUtil::TypeForPrimitive(dummy)));
+    bool ok = binary ? writer.writeBigEndian<T>(values, count) : writer.writeAscii<T>(values, count, asciiFormat);
+    if(binary)
+    {
+      writer.writeBytes("\n", 1);
+    }
+    return ok && !writer.hasError();
+  }
+
+  /**
+   * @brief Writes a DataArray as a SCALARS section inside the current
+   * POINT_DATA or CELL_DATA section. Spaces in the name are replaced since
+   * legacy VTK names are whitespace delimited.
+   */
+  template<typename T>
+  bool WriteScalars(BlockWriter& writer, DataArray<T>* array, bool binary, const char* asciiFormat)
+  {
+    if(nullptr == array)
+    {
+      return false;
+    }
+    T dummy = static_cast<T>(0);
+    QString name = array->getName();
+    name = name.replace(" ", "_");
+    writer.writeString(QString("SCALARS %1 %2 %3\n").arg(name).arg(VTKUtil::TypeForPrimitive(dummy)).arg(array->getNumberOfComponents()));
+    writer.writeString("LOOKUP_TABLE default\n");
+    size_t count = array->getSize();
+    const T* values = array->getConstPointer(0);
+    bool ok = binary ? writer.writeBigEndian<T>(values, count) : writer.writeAscii<T>(values, count, asciiFormat);
+    if(binary)
+    {
+      writer.writeBytes("\n", 1);
+    }
+    return ok && !writer.hasError();
+  }
+}
+
+#endif /* _vtklegacyfile_hpp_ */
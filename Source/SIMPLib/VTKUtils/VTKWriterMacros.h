@@ -40,6 +40,7 @@
 
 #include "SIMPLib/Utilities/SIMPLibEndian.h"
 #include "SIMPLib/SIMPLibVersion.h"
+#include "SIMPLib/VTKUtils/VTKLegacyFile.hpp"
 
 /**@file VTKWriterMacros.h
  * @brief This file contains various macros to write out consistent VTK legacy
@@ -104,15 +105,8 @@
   fprintf(f, "SCALARS %s int 1\n", ScalarName.toLatin1().data());\
   fprintf(f, "LOOKUP_TABLE default\n"); \
   { \
-    std::vector<int> gn(totalPoints, 0);\
-    int t;\
-    for (int64_t i = 0; i < totalPoints; i++) {\
-      t = m_FeatureIds[i];\
-      SIMPLib::Endian::FromSystemToBig::convert(t);\
-      gn[i] = t; \
-    }\
-    int64_t totalWritten = fwrite( &(gn.front()), sizeof(int), totalPoints, f);\
-    if (totalWritten != totalPoints)  {\
+    VTKLegacy::BlockWriter blockWriter(f);\
+    if (!blockWriter.writeBigEndianAs<int32_t>(m_FeatureIds, totalPoints) || !blockWriter.flush())  {\
       qDebug() << "Error Writing Binary VTK Data into file " << file ;\
       fclose(f);\
       return -1;\
@@ -132,16 +126,8 @@
   fprintf(f, "SCALARS %s %s 1\n", name.toLatin1().data(), #m_msgType);\
   fprintf(f, "LOOKUP_TABLE default\n");\
   { \
-    m_msgType* gn = new m_msgType[totalPoints];\
-    m_msgType t;\
-    for (int64_t i = 0; i < totalPoints; i++) {\
-      t = var[i];\
-      SIMPLib::Endian::FromSystemToBig::convert(t);\
-      gn[i] = t; \
-    }\
-    int64_t totalWritten = fwrite(gn, sizeof(m_msgType), totalPoints, f);\
-    delete[] gn;\
-    if (totalWritten != totalPoints)  {\
+    VTKLegacy::BlockWriter blockWriter(f);\
+    if (!blockWriter.writeBigEndianAs<m_msgType>(var, totalPoints) || !blockWriter.flush())  {\
       qDebug() << "Error Writing Binary VTK Data into file " << file ;\
       fclose(f);\
       return -1;\
@@ -153,13 +139,8 @@
   fprintf(f, "SCALARS %s %s 1\n", name.toLatin1().data(), #m_msgType);\
   fprintf(f, "LOOKUP_TABLE default\n");\
   { \
-    m_msgType* gn = new m_msgType[totalPoints];\
-    for (int64_t i = 0; i < totalPoints; i++) {\
-      gn[i] = var[i];\
-    }\
-    int64_t totalWritten = fwrite(gn, sizeof(m_msgType), totalPoints, f);\
-    delete[] gn;\
-    if (totalWritten != totalPoints)  {\
+    VTKLegacy::BlockWriter blockWriter(f);\
+    if (!blockWriter.writeNativeAs<m_msgType>(var, totalPoints) || !blockWriter.flush())  {\
       qDebug() << "Error Writing Binary VTK Data into file " << file ;\
       fclose(f);\
       return -1;\
@@ -213,11 +194,10 @@
       fprintf(f, "SCALARS %s %s %d\n", dName.toLatin1().data(), VtkType, numComps);\
       fprintf(f, "LOOKUP_TABLE default\n");\
       if(getWriteBinaryFile()) {\
-        if(BIGENDIAN == 0) {array->byteSwapElements(); }\
-        size_t totalWritten = fwrite(val, array->getTypeSize(), totalElements, f);\
-        if(totalWritten != totalElements) {}\
+        VTKLegacy::BlockWriter blockWriter(f);\
+        blockWriter.writeBigEndian<Type>(val, totalElements);\
+        blockWriter.flush();\
         fprintf(f,"\n");\
-        if(BIGENDIAN == 0) {array->byteSwapElements(); }\
       } else {\
         for (size_t i = 0; i < totalElements; i++) {\
           if(i%20 == 0 && i > 0) { fprintf(f, "\n");}\
@@ -128,36 +128,208 @@ template <typename T> using PySharedPtrClass = py::class_<T, std::shared_ptr<T>>
  *
  ******************************************************************************/
 #include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataArrays/NeighborList.hpp"
+#include "SIMPLib/Geometry/EdgeGeom.h"
+#include "SIMPLib/Geometry/HexahedralGeom.h"
+#include "SIMPLib/Geometry/QuadGeom.h"
+#include "SIMPLib/Geometry/TetrahedralGeom.h"
+#include "SIMPLib/Geometry/TriangleGeom.h"
+#include "SIMPLib/Geometry/VertexGeom.h"
 
 /**
- * @brief Initializes a template specialization of DataArray<T>
+ * @brief Describes the memory of a DataArray<T> to the Python buffer protocol.
+ * The shape is the number of tuples followed by the component dimensions so a
+ * 3 component array shows up in NumPy as an (N, 3) array. No data is copied.
+ * An array that still shares its buffer with a shallowCopy() is exposed read
+ * only so that viewing it does not force a copy; call detach() first to get a
+ * writable view.
+ */
+template <typename T> py::buffer_info PyDataArrayBufferInfo(DataArray<T>& array)
+{
+  std::vector<ssize_t> shape(1, static_cast<ssize_t>(array.getNumberOfTuples()));
+  QVector<size_t> cDims = array.getComponentDimensions();
+  for(const size_t& dim : cDims)
+  {
+    shape.push_back(static_cast<ssize_t>(dim));
+  }
+  std::vector<ssize_t> strides(shape.size(), 0);
+  ssize_t stride = static_cast<ssize_t>(sizeof(T));
+  for(size_t i = shape.size(); i > 0; i--)
+  {
+    strides[i - 1] = stride;
+    stride *= shape[i - 1];
+  }
+#if PYBIND11_VERSION_MAJOR > 2 || (PYBIND11_VERSION_MAJOR == 2 && PYBIND11_VERSION_MINOR >= 6)
+  bool readOnly = array.isShared();
+  T* data = const_cast<T*>(array.getConstPointer(0));
+  return py::buffer_info(data, sizeof(T), py::format_descriptor<T>::format(), static_cast<ssize_t>(shape.size()), shape, strides, readOnly);
+#else
+  // Without read only buffers a view of a shared array has to be a private copy
+  return py::buffer_info(array.getPointer(0), sizeof(T), py::format_descriptor<T>::format(), static_cast<ssize_t>(shape.size()), shape, strides);
+#endif
+}
+
+/**
+ * @brief Creates a DataArray<T> from a contiguous NumPy array. By default the
+ * DataArray uses the NumPy memory without copying it and holds a reference to
+ * the NumPy array, so the memory stays valid for as long as any C++ or Python
+ * object still uses the DataArray. NumPy memory can never be handed to the
+ * DataArray to free, so with ownsData set the DataArray gets its own copy of
+ * the values instead.
+ */
+template <typename T> typename DataArray<T>::Pointer PyAdoptNumPyArray(py::array_t<T, py::array::c_style> b, std::vector<size_t> cDims, QString name, bool ownsData)
+{
+  size_t numElements = static_cast<size_t>(b.size());
+  size_t numComps = 1;
+  for(const size_t& dim : cDims)
+  {
+    numComps *= dim;
+  }
+  if(numComps == 0 || numElements % numComps != 0)
+  {
+    throw py::value_error("The number of elements in the NumPy array is not a multiple of the number of components");
+  }
+  size_t numTuples = numElements / numComps;
+  QVector<size_t> compDims = QVector<size_t>::fromStdVector(cDims);
+  if(ownsData)
+  {
+    typename DataArray<T>::Pointer copy = DataArray<T>::CreateArray(numTuples, compDims, name, true);
+    if(nullptr != copy.get() && numElements > 0)
+    {
+      std::memcpy(copy->getPointer(0), b.data(), numElements * sizeof(T));
+    }
+    return copy;
+  }
+  // The last reference to the NumPy array may be dropped from a thread that does not hold the GIL
+  std::shared_ptr<void> owner(new py::object(b), [](void* ptr) {
+    py::gil_scoped_acquire gil;
+    delete static_cast<py::object*>(ptr);
+  });
+  return DataArray<T>::WrapExternalBuffer(b.mutable_data(), numTuples, compDims, name, owner);
+}
+
+/**
+ * @brief Returns the start offset of every list of a NeighborList plus a final
+ * entry holding the total number of values, in the style of a CSR matrix.
+ */
+template <typename T> py::array_t<int64_t> PyNeighborListOffsets(NeighborList<T>& list)
+{
+  int numLists = list.getNumberOfLists();
+  py::array_t<int64_t> offsets(static_cast<ssize_t>(numLists + 1));
+  int64_t* ptr = offsets.mutable_data();
+  ptr[0] = 0;
+  for(int i = 0; i < numLists; i++)
+  {
+    ptr[i + 1] = ptr[i] + list.getListSize(i);
+  }
+  return offsets;
+}
+
+/**
+ * @brief Returns all the values of a NeighborList concatenated into one array.
+ * The lists are stored separately so this is necessarily a copy.
+ */
+template <typename T> py::array_t<T> PyNeighborListValues(NeighborList<T>& list)
+{
+  int numLists = list.getNumberOfLists();
+  size_t total = 0;
+  for(int i = 0; i < numLists; i++)
+  {
+    total += static_cast<size_t>(list.getListSize(i));
+  }
+  py::array_t<T> values(static_cast<ssize_t>(total));
+  T* ptr = values.mutable_data();
+  for(int i = 0; i < numLists; i++)
+  {
+    typename NeighborList<T>::VectorType& entries = list.getListReference(i);
+    std::copy(entries.begin(), entries.end(), ptr);
+    ptr += entries.size();
+  }
+  return values;
+}
+
+/**
+ * @brief Replaces the contents of a NeighborList from CSR style offsets/values arrays
+ */
+template <typename T> void PySetNeighborLists(NeighborList<T>& list, py::array_t<int64_t, py::array::c_style> offsets, py::array_t<T, py::array::c_style> values)
+{
+  ssize_t numLists = offsets.size() - 1;
+  if(numLists < 0 || offsets.at(numLists) != static_cast<int64_t>(values.size()))
+  {
+    throw py::value_error("The last offset must equal the number of values");
+  }
+  list.resizeTotalElements(static_cast<size_t>(numLists));
+  const T* data = values.data();
+  for(ssize_t i = 0; i < numLists; i++)
+  {
+    int64_t start = offsets.at(i);
+    int64_t end = offsets.at(i + 1);
+    if(start < 0 || end < start || end > static_cast<int64_t>(values.size()))
+    {
+      throw py::value_error("The offsets must be non-decreasing and inside the values array");
+    }
+    typename NeighborList<T>::SharedVectorType entries(new typename NeighborList<T>::VectorType(data + start, data + end));
+    list.setList(static_cast<int>(i), entries);
+  }
+}
+
+/**
+ * @brief Returns the shared vertex list of a node based geometry or a nullptr.
+ * The list is a FloatArrayType so it can be viewed with numpy.asarray().
+ */
+SharedVertexList::Pointer PyGetSharedVertexList(IGeometry::Pointer geometry)
+{
+  if(VertexGeom::Pointer geom = std::dynamic_pointer_cast<VertexGeom>(geometry)) { return geom->getVertices(); }
+  if(EdgeGeom::Pointer geom = std::dynamic_pointer_cast<EdgeGeom>(geometry)) { return geom->getVertices(); }
+  if(IGeometry2D::Pointer geom = std::dynamic_pointer_cast<IGeometry2D>(geometry)) { return geom->getVertices(); }
+  if(IGeometry3D::Pointer geom = std::dynamic_pointer_cast<IGeometry3D>(geometry)) { return geom->getVertices(); }
+  return SharedVertexList::NullPointer();
+}
+
+/**
+ * @brief Returns the shared element list (edges, triangles, quads, tetrahedra or
+ * hexahedra) of a node based geometry or a nullptr.
+ */
+Int64ArrayType::Pointer PyGetSharedElementList(IGeometry::Pointer geometry)
+{
+  if(EdgeGeom::Pointer geom = std::dynamic_pointer_cast<EdgeGeom>(geometry)) { return geom->getEdges(); }
+  if(TriangleGeom::Pointer geom = std::dynamic_pointer_cast<TriangleGeom>(geometry)) { return geom->getTriangles(); }
+  if(QuadGeom::Pointer geom = std::dynamic_pointer_cast<QuadGeom>(geometry)) { return geom->getQuads(); }
+  if(TetrahedralGeom::Pointer geom = std::dynamic_pointer_cast<TetrahedralGeom>(geometry)) { return geom->getTetrahedra(); }
+  if(HexahedralGeom::Pointer geom = std::dynamic_pointer_cast<HexahedralGeom>(geometry)) { return geom->getHexahedra(); }
+  return Int64ArrayType::NullPointer();
+}
+
+/**
+ * @brief Initializes a template specialization of DataArray<T>. The class
+ * implements the buffer protocol so numpy.asarray() gives a zero copy view.
  * @param T The Type
  * @param NAME The name of the Variable
  */
-#define PYB11_DEFINE_DATAARRAY_INIT(T, NAME)                                                                                                                                                           \
-  PySharedPtrClass<DataArray<T>> declare##NAME(py::module& m, PySharedPtrClass<IDataArray>& parent)                                                                                                    \
-  {                                                                                                                                                                                                    \
-    using DataArrayType = DataArray<T>;                                                                                                                                                                \
-    PySharedPtrClass<DataArrayType> instance(m, #NAME, parent, py::buffer_protocol());                                                                                                                 \
-    instance.def(py::init([](size_t numElements, QString name, bool allocate) { return DataArrayType::CreateArray(numElements, name, allocate); }))                                                    \
-        .def(py::init([](T* ptr, size_t numElements, std::vector<size_t> cDims, QString name, bool ownsData) {                                                                                         \
-          return DataArrayType::WrapPointer(ptr, numElements, QVector<size_t>::fromStdVector(cDims), name, ownsData);                                                                                  \
-        }))                                                                                                                                                                                            \
-        .def(py::init([](py::array_t<T, py::array::c_style> b, std::vector<size_t> cDims, QString name, bool ownsData) {                                                                               \
-          ssize_t numElements = 1;                                                                                                                                                                     \
-          ssize_t nDims = b.ndim();                                                                                                                                                                    \
-          for(ssize_t e = 0; e < nDims; e++)                                                                                                                                                           \
-          {                                                                                                                                                                                            \
-            numElements *= b.shape(e);                                                                                                                                                                 \
-          }                                                                                                                                                                                            \
-          return DataArrayType::WrapPointer(reinterpret_cast<T*>(b.mutable_data(0)), static_cast<size_t>(numElements), QVector<size_t>::fromStdVector(cDims), name, ownsData);                         \
-        })) /* Class instance method setValue */                                                                                                                                                       \
-        .def("setValue", &DataArrayType::setValue, py::arg("index"), py::arg("value"))                                                                                                                 \
-        .def("getValue", &DataArrayType::getValue, py::arg("index"))                                                                                                                                   \
-        .def_property("Name", &DataArrayType::getName, &DataArrayType::setName)                                                                                                                        \
-        .def("Cleanup", []() { return DataArrayType::NullPointer(); });                                                                                                                                \
-    ;                                                                                                                                                                                                  \
-    return instance;                                                                                                                                                                                   \
+#define PYB11_DEFINE_DATAARRAY_INIT(T, NAME)\
+  PySharedPtrClass<DataArray<T>> declare##NAME(py::module& m, PySharedPtrClass<IDataArray>& parent)                                                                                                     \
+  {                                                                                                                                                                                                     \
+    using DataArrayType = DataArray<T>;                                                                                                                                                                 \
+    PySharedPtrClass<DataArrayType> instance(m, #NAME, parent, py::buffer_protocol());                                                                                                                  \
+    instance.def(py::init([](size_t numElements, QString name, bool allocate) { return DataArrayType::CreateArray(numElements, name, allocate); }))                                                     \
+        .def(py::init([](T* ptr, size_t numElements, std::vector<size_t> cDims, QString name, bool ownsData) {                                                                                          \
+          return DataArrayType::WrapPointer(ptr, numElements, QVector<size_t>::fromStdVector(cDims), name, ownsData);                                                                                   \
+        }))                                                                                                                                                                                             \
+        .def(py::init([](py::array_t<T, py::array::c_style> b, std::vector<size_t> cDims, QString name, bool ownsData) {                                                                                \
+          return PyAdoptNumPyArray<T>(b, cDims, name, ownsData);                                                                                                                                        \
+        }),                                                                                                                                                                                             \
+             py::arg("array").noconvert(), py::arg("cDims"), py::arg("name"), py::arg("ownsData") = false)                                                                                              \
+        .def_buffer([](DataArrayType& array) { return PyDataArrayBufferInfo<T>(array); }) /* Class instance method setValue */                                                                          \
+        .def("setValue", &DataArrayType::setValue, py::arg("index"), py::arg("value"))                                                                                                                  \
+        .def("getValue", &DataArrayType::getValue, py::arg("index"))                                                                                                                                    \
+        .def("takeOwnership", &DataArrayType::takeOwnership)                                                                                                                                            \
+        .def("detach", &DataArrayType::detach)                                                                                                                                                          \
+        .def("isShared", &DataArrayType::isShared)                                                                                                                                                      \
+        .def("releaseOwnership", &DataArrayType::releaseOwnership)                                                                                                                                      \
+        .def_property("Name", &DataArrayType::getName, &DataArrayType::setName)                                                                                                                         \
+        .def("Cleanup", []() { return DataArrayType::NullPointer(); });                                                                                                                                 \
+    ;                                                                                                                                                                                                   \
+    return instance;                                                                                                                                                                                    \
   }
 
 PYB11_DEFINE_DATAARRAY_INIT(int8_t, Int8ArrayType);
@@ -175,6 +347,33 @@ PYB11_DEFINE_DATAARRAY_INIT(uint64_t, UInt64ArrayType);
 PYB11_DEFINE_DATAARRAY_INIT(float, FloatArrayType);
 PYB11_DEFINE_DATAARRAY_INIT(double, DoubleArrayType);
 
+/**
+ * @brief Initializes a template specialization of NeighborList<T>. The lists
+ * are exchanged with NumPy as CSR style offsets/values arrays.
+ * @param T The Type
+ * @param NAME The name of the Variable
+ */
+#define PYB11_DEFINE_NEIGHBORLIST_INIT(T, NAME)\
+  PySharedPtrClass<NeighborList<T>> declare##NAME(py::module& m, PySharedPtrClass<IDataArray>& parent)                                                                                                  \
+  {                                                                                                                                                                                                     \
+    using NeighborListType = NeighborList<T>;                                                                                                                                                           \
+    PySharedPtrClass<NeighborListType> instance(m, #NAME, parent);                                                                                                                                      \
+    instance.def(py::init([](size_t numTuples, QString name, bool allocate) { return NeighborListType::CreateArray(numTuples, name, allocate); }))                                                      \
+        .def("getNumberOfLists", &NeighborListType::getNumberOfLists)                                                                                                                                   \
+        .def("getListSize", &NeighborListType::getListSize, py::arg("index"))                                                                                                                           \
+        .def("getOffsets", [](NeighborListType& list) { return PyNeighborListOffsets<T>(list); })                                                                                                       \
+        .def("getValues", [](NeighborListType& list) { return PyNeighborListValues<T>(list); })                                                                                                         \
+        .def("setLists", [](NeighborListType& list, py::array_t<int64_t, py::array::c_style> offsets, py::array_t<T, py::array::c_style> values) {                                                      \
+          PySetNeighborLists<T>(list, offsets, values);                                                                                                                                                 \
+        },                                                                                                                                                                                              \
+             py::arg("offsets"), py::arg("values"))                                                                                                                                                     \
+        .def_property("Name", &NeighborListType::getName, &NeighborListType::setName);                                                                                                                  \
+    return instance;                                                                                                                                                                                    \
+  }
+
+PYB11_DEFINE_NEIGHBORLIST_INIT(int32_t, Int32NeighborListType);
+PYB11_DEFINE_NEIGHBORLIST_INIT(float, FloatNeighborListType);
+
 
 
 //------------------------------------------------------------------------------
@@ -267,6 +466,14 @@ PYBIND11_MODULE(dream3d_py, m)
   PySharedPtrClass<FloatArrayType> @LIB_NAME@_FloatArrayType = declareFloatArrayType(mod, @LIB_NAME@_IDataArray);
   PySharedPtrClass<DoubleArrayType> @LIB_NAME@_DoubleArrayType = declareDoubleArrayType(mod, @LIB_NAME@_IDataArray);
 
+  /* Init codes for the NeighborList<T> classes */
+  PySharedPtrClass<Int32NeighborListType> @LIB_NAME@_Int32NeighborListType = declareInt32NeighborListType(mod, @LIB_NAME@_IDataArray);
+  PySharedPtrClass<FloatNeighborListType> @LIB_NAME@_FloatNeighborListType = declareFloatNeighborListType(mod, @LIB_NAME@_IDataArray);
+
+  /* Zero copy access to the vertex and element lists of node based geometries */
+  mod.def("GetSharedVertexList", &PyGetSharedVertexList, py::arg("geometry"));
+  mod.def("GetSharedElementList", &PyGetSharedElementList, py::arg("geometry"));
+
   py::enum_<SIMPL::InfoStringFormat>(mod, "InfoStringFormat").value("HtmlFormat", SIMPL::InfoStringFormat::HtmlFormat).value("UnknownFormat", SIMPL::InfoStringFormat::UnknownFormat).export_values();
 
   
@@ -116,5 +116,17 @@ def CreateDataArray(name, shape, cDims, type):
     elif type == np.double:
         array = simpl.DoubleArrayType(z_flat, cDims, name, False)     
     
-    # we need to return the 'z' numpy array so it does not go out of scope.
+    # The DataArray shares the memory of 'z' and keeps it alive, so 'z' is only
+    # returned so that callers can fill it in place.
     return (z, array)
+
+
+def ConvertToNumPy(data_array):
+    """
+    Returns a numpy view of a SIMPL DataArray without copying its memory. The view
+    has one row per tuple and one column per component.
+
+    Keyword arguments:
+    data_array -- The SIMPL DataArray to view
+    """
+    return np.asarray(data_array)
@@ -64,9 +64,44 @@ def DataArrayTest():
     err = sc.WriteDREAM3DFile(sd.GetTestTempDirectory() + "/DataArrayTest.dream3d", dca, True)
     assert err == 0
 
+def BufferProtocolTest():
+    """
+    Checks that DataArrays and numpy arrays share memory in both directions
+    """
+    # numpy -> SIMPL: the DataArray adopts the numpy memory
+    z = np.arange(12, dtype=np.float32)
+    array = simpl.FloatArrayType(z, simpl.VectorSizeT([3]), "Adopted", False)
+    view = np.asarray(array)
+    assert view.shape == (4, 3)
+    z[5] = 100.0
+    assert array.getValue(5) == 100.0
+    # The DataArray keeps the numpy memory alive after the original name is gone
+    del z
+    assert view[1, 2] == 100.0
+
+    # ownsData gives the DataArray its own copy of the numpy values
+    z = np.arange(12, dtype=np.float32)
+    array = simpl.FloatArrayType(z, simpl.VectorSizeT([3]), "Copied", True)
+    z[5] = 100.0
+    assert array.getValue(5) == 5.0
+
+    # SIMPL -> numpy: the view writes straight into the DataArray
+    array = simpl.Int32ArrayType(10, "Owned", True)
+    view = sc.ConvertToNumPy(array)
+    view[:] = np.arange(10)
+    assert array.getValue(9) == 9
+
+    # NeighborLists are exchanged as offsets/values
+    neighbors = simpl.Int32NeighborListType(3, "Neighbors", True)
+    neighbors.setLists(np.array([0, 2, 2, 5], dtype=np.int64), np.array([1, 2, 3, 4, 5], dtype=np.int32))
+    assert neighbors.getListSize(1) == 0
+    assert list(neighbors.getOffsets()) == [0, 2, 2, 5]
+    assert list(neighbors.getValues()) == [1, 2, 3, 4, 5]
+
 """
 Main entry point for python script
 """
 if __name__ == "__main__":
   DataArrayTest()
+  BufferProtocolTest()
   print("[DataArrayTest] Complete")